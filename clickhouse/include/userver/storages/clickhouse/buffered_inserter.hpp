@@ -0,0 +1,129 @@
+#pragma once
+
+/// @file userver/storages/clickhouse/buffered_inserter.hpp
+/// @brief @copybrief storages::clickhouse::BufferedInserter
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <userver/formats/parse/to.hpp>
+#include <userver/utils/statistics/writer.hpp>
+#include <userver/yaml_config/fwd.hpp>
+
+#include <userver/storages/clickhouse/fwd.hpp>
+#include <userver/storages/clickhouse/impl/insertion_request.hpp>
+#include <userver/storages/clickhouse/options.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::clickhouse {
+
+/// Settings of storages::clickhouse::BufferedInserter
+struct BufferedInserterSettings final {
+    /// A table buffer is flushed once it has that many rows
+    std::size_t max_rows{100'000};
+
+    /// A table buffer is flushed once it takes that many bytes of memory
+    std::size_t max_bytes{16 * 1024 * 1024};
+
+    /// The non-empty table buffers are flushed at least that often
+    std::chrono::milliseconds flush_interval{1000};
+
+    /// Inserts wait while the buffered and the flushing data take that many
+    /// bytes of memory
+    std::size_t max_total_bytes{256 * 1024 * 1024};
+
+    /// Timeout of a single flushing INSERT
+    OptionalCommandControl command_control;
+};
+
+BufferedInserterSettings Parse(const yaml_config::YamlConfig& value, formats::parse::To<BufferedInserterSettings>);
+
+// clang-format off
+
+/// @ingroup userver_clients
+///
+/// @brief Accumulates the inserted data into per-table buffers, that are sent
+/// to the cluster as large INSERTs in background.
+///
+/// A table buffer is flushed once it has `max_rows` rows or takes `max_bytes`
+/// of memory, and at least every `flush_interval`. Insert and InsertRows
+/// return as soon as the data is buffered, and wait only if the buffered and
+/// the flushing data exceed `max_total_bytes`.
+///
+/// The data inserted into a table must always have the same column names and
+/// types. A failed flush is logged and its data is dropped.
+///
+/// All the buffered data is flushed on destruction.
+///
+/// Usually retrieved from components::ClickHouseBufferedInserter component.
+
+// clang-format on
+class BufferedInserter final {
+public:
+    BufferedInserter(ClusterPtr cluster, const BufferedInserterSettings& settings);
+
+    /// Flushes the buffered data and waits for all the flushes
+    ~BufferedInserter();
+
+    BufferedInserter(const BufferedInserter&) = delete;
+
+    /// @brief Buffer data for insertion into the table;
+    /// `T` is expected to be a struct of vectors of same length.
+    /// See storages::clickhouse::Cluster::Insert for details.
+    template <typename T>
+    void Insert(const std::string& table_name, const std::vector<std::string_view>& column_names, const T& data);
+
+    /// @brief Buffer data for insertion into the table;
+    /// `Container` is expected to be an iterable of clickhouse-mapped type.
+    /// See storages::clickhouse::Cluster::InsertRows for details.
+    template <typename Container>
+    void InsertRows(
+        const std::string& table_name,
+        const std::vector<std::string_view>& column_names,
+        const Container& data
+    );
+
+    /// Flushes all the buffered data and waits for all the flushes to finish
+    void Flush();
+
+    /// Write inserter statistics
+    void WriteStatistics(USERVER_NAMESPACE::utils::statistics::Writer& writer) const;
+
+private:
+    void DoInsert(impl::InsertionRequest&& request);
+
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+template <typename T>
+void BufferedInserter::Insert(
+    const std::string& table_name,
+    const std::vector<std::string_view>& column_names,
+    const T& data
+) {
+    auto request = impl::InsertionRequest::Create(table_name, column_names, data);
+
+    DoInsert(std::move(request));
+}
+
+template <typename Container>
+void BufferedInserter::InsertRows(
+    const std::string& table_name,
+    const std::vector<std::string_view>& column_names,
+    const Container& data
+) {
+    if (data.empty()) return;
+
+    auto request = impl::InsertionRequest::CreateFromRows(table_name, column_names, data);
+
+    DoInsert(std::move(request));
+}
+
+}  // namespace storages::clickhouse
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,63 @@
+#pragma once
+
+/// @file userver/storages/clickhouse/buffered_inserter_component.hpp
+/// @brief @copybrief components::ClickHouseBufferedInserter
+/// @ingroup userver_components
+
+#include <memory>
+
+#include <userver/components/component_base.hpp>
+#include <userver/utils/statistics/entry.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::clickhouse {
+class BufferedInserter;
+}
+
+namespace components {
+
+// clang-format off
+
+/// @ingroup userver_components
+///
+/// @brief Component that accumulates the inserts into a ClickHouse cluster
+/// and sends them as large INSERTs in background,
+/// see storages::clickhouse::BufferedInserter.
+///
+/// The buffered data is flushed on the component shutdown.
+///
+/// ## Static options:
+/// Name                 | Description                                                              | Default value
+/// -------------------- | ------------------------------------------------------------------------ | ---------------
+/// clickhouse_component | name of the components::ClickHouse component to insert into             | -
+/// max_rows             | a table buffer is flushed once it has that many rows                     | 100000
+/// max_bytes            | a table buffer is flushed once it takes that many bytes of memory        | 16777216
+/// flush_interval       | the non-empty table buffers are flushed at least that often              | 1s
+/// max_total_bytes      | inserts wait while the buffered and flushing data take that many bytes   | 268435456
+/// execute_timeout      | timeout of a single flushing INSERT                                      | 750ms
+
+// clang-format on
+class ClickHouseBufferedInserter final : public ComponentBase {
+public:
+    /// Component constructor
+    ClickHouseBufferedInserter(const ComponentConfig&, const ComponentContext&);
+    /// Component destructor, flushes the buffered data
+    ~ClickHouseBufferedInserter() override;
+
+    /// Inserter accessor
+    storages::clickhouse::BufferedInserter& GetInserter() const;
+
+    static yaml_config::Schema GetStaticConfigSchema();
+
+private:
+    std::unique_ptr<storages::clickhouse::BufferedInserter> inserter_;
+    utils::statistics::Entry statistics_holder_;
+};
+
+template <>
+inline constexpr bool kHasValidate<ClickHouseBufferedInserter> = true;
+
+}  // namespace components
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,61 @@
+#pragma once
+
+/// @file userver/storages/clickhouse/cursor.hpp
+/// @brief @copybrief storages::clickhouse::Cursor
+
+#include <memory>
+#include <optional>
+
+#include <userver/storages/clickhouse/execution_result.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::clickhouse {
+
+namespace impl {
+class CursorImpl;
+}
+
+// clang-format off
+
+/// @brief Streaming result of a query, returned by
+/// storages::clickhouse::Cluster ExecuteStreaming methods.
+///
+/// Yields the blocks of the result one by one as they arrive from the server,
+/// so that the whole result is never held in memory. Each block is an
+/// ExecutionResult, that could be converted with the usual @ref clickhouse_io
+/// mapping.
+///
+/// The query is executed in a background task, that holds a connection to the
+/// server until the whole result is read or the Cursor is destroyed. At most a
+/// couple of blocks are buffered: the server is not read from until the
+/// buffered blocks are consumed. Destroying the Cursor before the end of the
+/// result cancels the query.
+///
+/// @note CommandControl limits the overall time of the query, including the
+/// time spent by the consumer between the calls to Next.
+///
+/// ## Usage example:
+///
+/// @snippet storages/tests/execute_chtest.cpp  Sample Cursor usage
+
+// clang-format on
+class Cursor final {
+public:
+    explicit Cursor(std::unique_ptr<impl::CursorImpl>&& impl);
+    Cursor(Cursor&&) noexcept;
+    Cursor& operator=(Cursor&&) noexcept;
+    ~Cursor();
+
+    /// @brief Waits for the next non-empty block of the result.
+    /// @returns `std::nullopt` once the whole result has been read
+    /// @throws std::exception the query execution failure
+    std::optional<ExecutionResult> Next();
+
+private:
+    std::unique_ptr<impl::CursorImpl> impl_;
+};
+
+}  // namespace storages::clickhouse
+
+USERVER_NAMESPACE_END
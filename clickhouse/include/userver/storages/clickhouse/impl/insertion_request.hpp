@@ -22,6 +22,11 @@ namespace storages::clickhouse::impl {
 class InsertionRequest final {
 public:
     InsertionRequest(const std::string& table_name, const std::vector<std::string_view>& column_names);
+    InsertionRequest(
+        const std::string& table_name,
+        const std::vector<std::string_view>& column_names,
+        std::unique_ptr<impl::BlockWrapper>&& block
+    );
     InsertionRequest(InsertionRequest&&) noexcept;
     ~InsertionRequest();
 
@@ -38,8 +43,12 @@ public:
 
     const std::string& GetTableName() const;
 
+    const std::vector<std::string_view>& GetColumnNames() const;
+
     const impl::BlockWrapper& GetBlock() const;
 
+    std::unique_ptr<impl::BlockWrapper> ExtractBlock() &&;
+
 private:
     template <typename MappedType>
     class ColumnsMapper final {
@@ -0,0 +1,198 @@
+#include <userver/storages/clickhouse/buffered_inserter.hpp>
+
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+
+#include <userver/concurrent/background_task_storage.hpp>
+#include <userver/engine/condition_variable.hpp>
+#include <userver/engine/exception.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/storages/clickhouse/cluster.hpp>
+#include <userver/utils/periodic_task.hpp>
+#include <userver/yaml_config/yaml_config.hpp>
+
+#include <storages/clickhouse/impl/block_wrapper.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::clickhouse {
+
+namespace {
+
+struct TableBuffer final {
+    std::vector<std::string> column_names;
+    std::unique_ptr<impl::BlockWrapper> block;
+    std::size_t bytes{0};
+};
+
+}  // namespace
+
+BufferedInserterSettings Parse(const yaml_config::YamlConfig& value, formats::parse::To<BufferedInserterSettings>) {
+    BufferedInserterSettings settings;
+    settings.max_rows = value["max_rows"].As<std::size_t>(settings.max_rows);
+    settings.max_bytes = value["max_bytes"].As<std::size_t>(settings.max_bytes);
+    settings.flush_interval = value["flush_interval"].As<std::chrono::milliseconds>(settings.flush_interval);
+    settings.max_total_bytes = value["max_total_bytes"].As<std::size_t>(settings.max_total_bytes);
+
+    const auto execute_timeout = value["execute_timeout"].As<std::optional<std::chrono::milliseconds>>();
+    if (execute_timeout) {
+        settings.command_control.emplace(*execute_timeout);
+    }
+    return settings;
+}
+
+struct BufferedInserter::Impl {
+    Impl(ClusterPtr&& cluster, const BufferedInserterSettings& settings)
+        : cluster{std::move(cluster)}, settings{settings} {
+        UINVARIANT(this->cluster, "ClickHouse cluster is not set");
+    }
+
+    // Must be called with the mutex locked
+    void StartFlush(const std::string& table_name, TableBuffer& buffer) {
+        UASSERT(buffer.block);
+        ++flushes_in_progress;
+        flush_tasks.AsyncDetach(
+            "clickhouse_buffered_insert",
+            [this, table_name, column_names = buffer.column_names, block = std::move(buffer.block), bytes = buffer.bytes](
+            ) mutable { DoFlush(table_name, column_names, std::move(block), bytes); }
+        );
+        buffer.bytes = 0;
+    }
+
+    // Must be called with the mutex locked
+    void StartFlushAll() {
+        for (auto& [table_name, buffer] : buffers) {
+            if (buffer.block) StartFlush(table_name, buffer);
+        }
+    }
+
+    void DoFlush(
+        const std::string& table_name,
+        const std::vector<std::string>& column_names,
+        std::unique_ptr<impl::BlockWrapper>&& block,
+        std::size_t bytes
+    ) {
+        const auto rows = block->GetRowsCount();
+        const std::vector<std::string_view> column_name_views{column_names.begin(), column_names.end()};
+        try {
+            cluster->DoInsert(
+                settings.command_control, impl::InsertionRequest{table_name, column_name_views, std::move(block)}
+            );
+            flushed_rows += rows;
+        } catch (const std::exception& ex) {
+            LOG_ERROR() << "Failed to insert " << rows << " buffered rows into ClickHouse table '" << table_name
+                        << "', the rows are dropped: " << ex;
+            dropped_rows += rows;
+            ++failed_flushes;
+        }
+        ++flushes;
+
+        const std::lock_guard lock{mutex};
+        total_bytes -= bytes;
+        --flushes_in_progress;
+        flush_finished_cv.NotifyAll();
+    }
+
+    const ClusterPtr cluster;
+    const BufferedInserterSettings settings;
+
+    engine::Mutex mutex;
+    engine::ConditionVariable flush_finished_cv;
+    std::unordered_map<std::string, TableBuffer> buffers;
+    std::size_t flushes_in_progress{0};
+    // Modified with the mutex locked, includes the data being flushed
+    std::atomic<std::size_t> total_bytes{0};
+
+    std::atomic<std::uint64_t> inserted_rows{0};
+    std::atomic<std::uint64_t> flushed_rows{0};
+    std::atomic<std::uint64_t> dropped_rows{0};
+    std::atomic<std::uint64_t> flushes{0};
+    std::atomic<std::uint64_t> failed_flushes{0};
+
+    concurrent::BackgroundTaskStorage flush_tasks;
+    USERVER_NAMESPACE::utils::PeriodicTask flush_timer;
+};
+
+BufferedInserter::BufferedInserter(ClusterPtr cluster, const BufferedInserterSettings& settings)
+    : impl_{std::make_unique<Impl>(std::move(cluster), settings)} {
+    impl_->flush_timer.Start(
+        "clickhouse_buffered_inserter_flush",
+        USERVER_NAMESPACE::utils::PeriodicTask::Settings{settings.flush_interval},
+        [this] {
+            const std::lock_guard lock{impl_->mutex};
+            impl_->StartFlushAll();
+        }
+    );
+}
+
+BufferedInserter::~BufferedInserter() {
+    impl_->flush_timer.Stop();
+    try {
+        Flush();
+    } catch (const std::exception& ex) {
+        LOG_ERROR() << "Failed to flush the buffered ClickHouse inserts on shutdown: " << ex;
+    }
+}
+
+void BufferedInserter::Flush() {
+    std::unique_lock lock{impl_->mutex};
+    impl_->StartFlushAll();
+    if (!impl_->flush_finished_cv.Wait(lock, [this] { return impl_->flushes_in_progress == 0; })) {
+        throw engine::WaitInterruptedException(engine::current_task::CancellationReason());
+    }
+}
+
+void BufferedInserter::WriteStatistics(USERVER_NAMESPACE::utils::statistics::Writer& writer) const {
+    writer["inserted_rows"] = impl_->inserted_rows.load();
+    writer["flushed_rows"] = impl_->flushed_rows.load();
+    writer["dropped_rows"] = impl_->dropped_rows.load();
+    writer["flushes"] = impl_->flushes.load();
+    writer["failed_flushes"] = impl_->failed_flushes.load();
+    writer["buffered_bytes"] = impl_->total_bytes.load();
+}
+
+void BufferedInserter::DoInsert(impl::InsertionRequest&& request) {
+    const auto& table_name = request.GetTableName();
+    const auto& column_names = request.GetColumnNames();
+    auto block = std::move(request).ExtractBlock();
+    const auto rows = block->GetRowsCount();
+    const auto bytes = block->GetMemoryUsage();
+    const auto& settings = impl_->settings;
+
+    std::unique_lock lock{impl_->mutex};
+    // The data exceeding the limit on its own is let through once nothing else
+    // is buffered, so that it does not wait forever
+    const auto has_room = [this, bytes, &settings] {
+        const auto total_bytes = impl_->total_bytes.load();
+        return total_bytes == 0 || total_bytes + bytes <= settings.max_total_bytes;
+    };
+    while (!has_room()) {
+        // Makes room right away instead of waiting for the flush timer
+        impl_->StartFlushAll();
+        if (impl_->flush_finished_cv.Wait(lock) == engine::CvStatus::kCancelled) {
+            throw engine::WaitInterruptedException(engine::current_task::CancellationReason());
+        }
+    }
+
+    auto& buffer = impl_->buffers[table_name];
+    if (buffer.block) {
+        buffer.block->AppendRows(*block);
+    } else {
+        buffer.column_names.assign(column_names.begin(), column_names.end());
+        buffer.block = std::move(block);
+    }
+    buffer.bytes += bytes;
+    impl_->total_bytes += bytes;
+    impl_->inserted_rows += rows;
+
+    if (buffer.block->GetRowsCount() >= settings.max_rows || buffer.bytes >= settings.max_bytes) {
+        impl_->StartFlush(table_name, buffer);
+    }
+}
+
+}  // namespace storages::clickhouse
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,76 @@
+#include <userver/storages/clickhouse/buffered_inserter_component.hpp>
+
+#include <userver/components/component_config.hpp>
+#include <userver/components/component_context.hpp>
+#include <userver/components/statistics_storage.hpp>
+#include <userver/utils/statistics/writer.hpp>
+#include <userver/yaml_config/merge_schemas.hpp>
+
+#include <userver/storages/clickhouse/buffered_inserter.hpp>
+#include <userver/storages/clickhouse/component.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace components {
+
+ClickHouseBufferedInserter::ClickHouseBufferedInserter(const ComponentConfig& config, const ComponentContext& context)
+    : ComponentBase{config, context} {
+    auto cluster =
+        context.FindComponent<ClickHouse>(config["clickhouse_component"].As<std::string>()).GetCluster();
+    inserter_ = std::make_unique<storages::clickhouse::BufferedInserter>(
+        std::move(cluster), config.As<storages::clickhouse::BufferedInserterSettings>()
+    );
+
+    auto& statistics_storage = context.FindComponent<components::StatisticsStorage>();
+    statistics_holder_ = statistics_storage.GetStorage().RegisterWriter(
+        "clickhouse.buffered_inserter",
+        [this](utils::statistics::Writer& writer) { inserter_->WriteStatistics(writer); },
+        {{"clickhouse_buffered_inserter", config.Name()}}
+    );
+}
+
+ClickHouseBufferedInserter::~ClickHouseBufferedInserter() {
+    statistics_holder_.Unregister();
+    inserter_.reset();
+}
+
+storages::clickhouse::BufferedInserter& ClickHouseBufferedInserter::GetInserter() const { return *inserter_; }
+
+yaml_config::Schema ClickHouseBufferedInserter::GetStaticConfigSchema() {
+    return yaml_config::MergeSchemas<ComponentBase>(R"(
+type: object
+description: Buffered ClickHouse inserter component
+additionalProperties: false
+properties:
+    clickhouse_component:
+        type: string
+        description: name of the ClickHouse component to insert into
+    max_rows:
+        type: integer
+        description: a table buffer is flushed once it has that many rows
+        defaultDescription: 100000
+        minimum: 1
+    max_bytes:
+        type: integer
+        description: a table buffer is flushed once it takes that many bytes of memory
+        defaultDescription: 16777216
+        minimum: 1
+    flush_interval:
+        type: string
+        description: the non-empty table buffers are flushed at least that often
+        defaultDescription: 1s
+    max_total_bytes:
+        type: integer
+        description: inserts wait while the buffered and flushing data take that many bytes of memory
+        defaultDescription: 268435456
+        minimum: 1
+    execute_timeout:
+        type: string
+        description: timeout of a single flushing INSERT
+        defaultDescription: 750ms
+)");
+}
+
+}  // namespace components
+
+USERVER_NAMESPACE_END
@@ -1,5 +1,9 @@
 #include "block_wrapper.hpp"
 
+#include <stdexcept>
+
+#include <fmt/format.h>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace storages::clickhouse::impl {
@@ -16,6 +20,45 @@ void BlockWrapper::AppendColumn(std::string_view name, const clickhouse_cpp::Col
     native_.AppendColumn(std::string{name}, column);
 }
 
+void BlockWrapper::AppendRows(const BlockWrapper& other) {
+    const auto& other_native = other.GetNative();
+    if (native_.GetColumnCount() != other_native.GetColumnCount()) {
+        throw std::runtime_error(fmt::format(
+            "Columns count mismatch: {} columns are appended to {} columns",
+            other_native.GetColumnCount(),
+            native_.GetColumnCount()
+        ));
+    }
+
+    for (size_t ind = 0; ind < native_.GetColumnCount(); ++ind) {
+        const auto& column = native_[ind];
+        const auto& other_column = other_native[ind];
+        if (native_.GetColumnName(ind) != other_native.GetColumnName(ind) ||
+            !column->Type()->IsEqual(other_column->Type())) {
+            throw std::runtime_error(fmt::format(
+                "Column mismatch: '{}' of type {} is appended to '{}' of type {}",
+                other_native.GetColumnName(ind),
+                other_column->Type()->GetName(),
+                native_.GetColumnName(ind),
+                column->Type()->GetName()
+            ));
+        }
+    }
+
+    for (size_t ind = 0; ind < native_.GetColumnCount(); ++ind) {
+        native_[ind]->Append(other_native[ind]);
+    }
+    native_.RefreshRowCount();
+}
+
+size_t BlockWrapper::GetMemoryUsage() const {
+    size_t result = 0;
+    for (size_t ind = 0; ind < native_.GetColumnCount(); ++ind) {
+        result += native_[ind]->MemoryUsage();
+    }
+    return result;
+}
+
 const clickhouse_cpp::Block& BlockWrapper::GetNative() const { return native_; }
 
 void BlockWrapperDeleter::operator()(BlockWrapper* ptr) const noexcept { std::default_delete<BlockWrapper>{}(ptr); }
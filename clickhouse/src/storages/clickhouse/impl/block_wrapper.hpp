@@ -22,6 +22,11 @@ public:
 
     void AppendColumn(std::string_view name, const clickhouse_cpp::ColumnRef& column);
 
+    // Appends the rows of a block with the same column names and types
+    void AppendRows(const BlockWrapper& other);
+
+    size_t GetMemoryUsage() const;
+
     const clickhouse_cpp::Block& GetNative() const;
 
 private:
@@ -100,6 +100,24 @@ ExecutionResult Connection::Execute(OptionalCommandControl optional_cc, const Qu
     return ExecutionResult{BlockWrapperPtr{result_ptr.release()}};
 }
 
+void Connection::ExecuteStreaming(OptionalCommandControl optional_cc, const Query& query, BlockConsumer consumer) {
+    clickhouse_cpp::Query native_query{query.QueryText()};
+
+    auto& span = tracing::Span::CurrentSpan();
+    auto scope = span.CreateScopeTime(scopes::kExec);
+
+    native_query.OnDataCancelable([&consumer, &scope](const NativeBlock& data) {
+        scope.Reset(scopes::kExec);
+        // we must return 'true' if we don't want to cancel query
+        if (data.GetRowCount() != 0 && !consumer(BlockWrapperPtr{new BlockWrapper{NativeBlock{data}}})) {
+            return false;
+        }
+        return !engine::current_task::ShouldCancel();
+    });
+
+    DoExecute(optional_cc, native_query);
+}
+
 void Connection::Insert(OptionalCommandControl optional_cc, const InsertionRequest& request) {
     const auto& block = request.GetBlock();
 
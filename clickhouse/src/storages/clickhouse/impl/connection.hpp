@@ -4,7 +4,9 @@
 
 #include <userver/clients/dns/resolver_fwd.hpp>
 #include <userver/storages/clickhouse/execution_result.hpp>
+#include <userver/storages/clickhouse/impl/block_wrapper_fwd.hpp>
 #include <userver/storages/clickhouse/options.hpp>
+#include <userver/utils/function_ref.hpp>
 
 #include <storages/clickhouse/impl/native_client_factory.hpp>
 
@@ -27,6 +29,11 @@ public:
 
     ExecutionResult Execute(OptionalCommandControl, const Query&);
 
+    /// Returns false to cancel the query
+    using BlockConsumer = USERVER_NAMESPACE::utils::function_ref<bool(BlockWrapperPtr&&)>;
+
+    void ExecuteStreaming(OptionalCommandControl, const Query&, BlockConsumer);
+
     void Insert(OptionalCommandControl, const InsertionRequest&);
 
     void Ping();
@@ -0,0 +1,27 @@
+#include <storages/clickhouse/impl/cursor_impl.hpp>
+
+#include <storages/clickhouse/impl/block_wrapper.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::clickhouse::impl {
+
+CursorImpl::CursorImpl(Queue::Consumer&& consumer, engine::TaskWithResult<void>&& execution_task)
+    : execution_task_{std::move(execution_task)}, consumer_{std::move(consumer)} {}
+
+std::optional<ExecutionResult> CursorImpl::Next() {
+    BlockWrapperPtr block;
+    if (consumer_.Pop(block)) {
+        return ExecutionResult{std::move(block)};
+    }
+
+    // The execution task has finished, rethrow its exception if any
+    if (execution_task_.IsValid()) {
+        execution_task_.Get();
+    }
+    return std::nullopt;
+}
+
+}  // namespace storages::clickhouse::impl
+
+USERVER_NAMESPACE_END
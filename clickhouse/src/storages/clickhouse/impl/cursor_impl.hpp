@@ -0,0 +1,34 @@
+#pragma once
+
+#include <optional>
+
+#include <userver/concurrent/queue.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/storages/clickhouse/execution_result.hpp>
+#include <userver/storages/clickhouse/impl/block_wrapper_fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::clickhouse::impl {
+
+class CursorImpl final {
+public:
+    using Queue = concurrent::SpscQueue<BlockWrapperPtr>;
+
+    // The blocks pushed by the execution task are waiting for the consumer.
+    static constexpr std::size_t kMaxQueuedBlocks = 2;
+
+    CursorImpl(Queue::Consumer&& consumer, engine::TaskWithResult<void>&& execution_task);
+
+    std::optional<ExecutionResult> Next();
+
+private:
+    engine::TaskWithResult<void> execution_task_;
+    // Destroyed first, so that the execution task stops pushing and cancels
+    // the query
+    Queue::Consumer consumer_;
+};
+
+}  // namespace storages::clickhouse::impl
+
+USERVER_NAMESPACE_END
@@ -13,14 +13,27 @@ InsertionRequest::InsertionRequest(const std::string& table_name, const std::vec
       column_names_{column_names},
       block_{std::make_unique<impl::BlockWrapper>(impl::clickhouse_cpp::Block{column_names_.size(), 0})} {}
 
+InsertionRequest::InsertionRequest(
+    const std::string& table_name,
+    const std::vector<std::string_view>& column_names,
+    std::unique_ptr<impl::BlockWrapper>&& block
+)
+    : table_name_{table_name}, column_names_{column_names}, block_{std::move(block)} {
+    UASSERT(block_);
+}
+
 InsertionRequest::InsertionRequest(InsertionRequest&&) noexcept = default;
 
 InsertionRequest::~InsertionRequest() = default;
 
 const std::string& InsertionRequest::GetTableName() const { return table_name_; }
 
+const std::vector<std::string_view>& InsertionRequest::GetColumnNames() const { return column_names_; }
+
 const impl::BlockWrapper& InsertionRequest::GetBlock() const { return *block_; }
 
+std::unique_ptr<impl::BlockWrapper> InsertionRequest::ExtractBlock() && { return std::move(block_); }
+
 }  // namespace storages::clickhouse::impl
 
 USERVER_NAMESPACE_END
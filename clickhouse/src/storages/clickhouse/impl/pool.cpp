@@ -4,9 +4,11 @@
 
 #include <userver/tracing/span.hpp>
 #include <userver/tracing/tags.hpp>
+#include <userver/utils/async.hpp>
 
 #include <storages/clickhouse/impl/connection.hpp>
 #include <storages/clickhouse/impl/connection_ptr.hpp>
+#include <storages/clickhouse/impl/cursor_impl.hpp>
 #include <storages/clickhouse/impl/pool_impl.hpp>
 #include <storages/clickhouse/impl/tracing_tags.hpp>
 #include <userver/formats/json/value_builder.hpp>
@@ -43,6 +45,28 @@ ExecutionResult Pool::Execute(OptionalCommandControl optional_cc, const Query& q
     return conn_ptr->Execute(optional_cc, query);
 }
 
+Cursor Pool::ExecuteStreaming(OptionalCommandControl optional_cc, const Query& query) const {
+    auto conn_ptr = impl_->Acquire();
+
+    auto queue = CursorImpl::Queue::Create(CursorImpl::kMaxQueuedBlocks);
+    auto consumer = queue->GetConsumer();
+    auto execution_task = USERVER_NAMESPACE::utils::Async(
+        "clickhouse_execute_streaming",
+        [pool_impl = impl_, conn_ptr = std::move(conn_ptr), producer = queue->GetProducer(), optional_cc, query] {
+            auto span = PrepareExecutionSpan(impl::scopes::kQuery, pool_impl->GetHostName());
+            query.FillSpanTags(span);
+
+            const auto timer = pool_impl->GetExecuteTimer();
+            conn_ptr->ExecuteStreaming(optional_cc, query, [&producer](BlockWrapperPtr&& block) {
+                // fails if the Cursor is destroyed
+                return producer.Push(std::move(block));
+            });
+        }
+    );
+
+    return Cursor{std::make_unique<CursorImpl>(std::move(consumer), std::move(execution_task))};
+}
+
 void Pool::Insert(OptionalCommandControl optional_cc, const InsertionRequest& request) const {
     auto conn_ptr = impl_->Acquire();
 
@@ -0,0 +1,189 @@
+#include <userver/utest/utest.hpp>
+
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/utils/statistics/storage.hpp>
+#include <userver/utils/statistics/testing.hpp>
+
+#include <userver/storages/clickhouse/buffered_inserter.hpp>
+#include <userver/storages/clickhouse/cluster.hpp>
+#include <userver/storages/clickhouse/query.hpp>
+
+#include "utils_test.hpp"
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+struct Row final {
+    uint64_t id;
+    std::string value;
+};
+
+struct Columns final {
+    std::vector<uint64_t> ids;
+};
+
+struct Count final {
+    std::vector<uint64_t> count;
+};
+
+}  // namespace
+
+namespace storages::clickhouse::io {
+
+template <>
+struct CppToClickhouse<Row> {
+    using mapped_type = std::tuple<columns::UInt64Column, columns::StringColumn>;
+};
+
+template <>
+struct CppToClickhouse<Columns> {
+    using mapped_type = std::tuple<columns::UInt64Column>;
+};
+
+template <>
+struct CppToClickhouse<Count> {
+    using mapped_type = std::tuple<columns::UInt64Column>;
+};
+
+}  // namespace storages::clickhouse::io
+
+namespace {
+
+class TableGuard final {
+public:
+    TableGuard(storages::clickhouse::Cluster& cluster, const std::string& name) : cluster_{cluster}, name_{name} {
+        cluster_.Execute(fmt::format("DROP TABLE IF EXISTS {}", name_));
+        cluster_.Execute(fmt::format("CREATE TABLE {} (id UInt64, value String) ENGINE = Memory", name_));
+    }
+
+    ~TableGuard() { cluster_.Execute(fmt::format("DROP TABLE IF EXISTS {}", name_)); }
+
+    uint64_t CountRows() const {
+        return cluster_.Execute(fmt::format("SELECT count() FROM {}", name_)).As<Count>().count.at(0);
+    }
+
+private:
+    storages::clickhouse::Cluster& cluster_;
+    const std::string name_;
+};
+
+storages::clickhouse::ClusterPtr NonOwning(storages::clickhouse::Cluster& cluster) {
+    return {std::shared_ptr<void>{}, &cluster};
+}
+
+std::vector<Row> MakeRows(uint64_t count) {
+    std::vector<Row> rows;
+    for (uint64_t i = 0; i < count; ++i) rows.push_back({i, std::to_string(i)});
+    return rows;
+}
+
+std::int64_t GetFlushes(const storages::clickhouse::BufferedInserter& inserter) {
+    utils::statistics::Storage storage;
+    auto holder = storage.RegisterWriter("inserter", [&inserter](utils::statistics::Writer& writer) {
+        inserter.WriteStatistics(writer);
+    });
+    return utils::statistics::Snapshot{storage, "inserter"}.SingleMetric("flushes").AsInt();
+}
+
+// Waits for the background flushes, without forcing them with Flush()
+template <typename Predicate>
+bool WaitUntil(Predicate predicate) {
+    const auto deadline = engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+    while (!predicate()) {
+        if (deadline.IsReached()) return false;
+        engine::SleepFor(std::chrono::milliseconds{10});
+    }
+    return true;
+}
+
+}  // namespace
+
+UTEST(BufferedInserter, FlushesOnRowsThreshold) {
+    ClusterWrapper cluster{};
+    const TableGuard table{*cluster, "buffered_inserter_rows"};
+
+    storages::clickhouse::BufferedInserterSettings settings;
+    settings.max_rows = 100;
+    settings.flush_interval = std::chrono::hours{1};
+    storages::clickhouse::BufferedInserter inserter{NonOwning(*cluster), settings};
+
+    for (int i = 0; i < 10; ++i) {
+        inserter.InsertRows("buffered_inserter_rows", {"id", "value"}, MakeRows(30));
+    }
+
+    // The buffer reaches 100 rows at 120 and 240 rows, the last 60 stay
+    EXPECT_TRUE(WaitUntil([&] { return GetFlushes(inserter) == 2; }));
+    EXPECT_EQ(table.CountRows(), 240);
+
+    inserter.Flush();
+    EXPECT_EQ(GetFlushes(inserter), 3);
+    EXPECT_EQ(table.CountRows(), 300);
+}
+
+UTEST(BufferedInserter, FlushesOnTimer) {
+    ClusterWrapper cluster{};
+    const TableGuard table{*cluster, "buffered_inserter_timer"};
+
+    storages::clickhouse::BufferedInserterSettings settings;
+    settings.flush_interval = std::chrono::milliseconds{50};
+    storages::clickhouse::BufferedInserter inserter{NonOwning(*cluster), settings};
+
+    inserter.InsertRows("buffered_inserter_timer", {"id", "value"}, MakeRows(10));
+    EXPECT_TRUE(WaitUntil([&] { return GetFlushes(inserter) == 1; }));
+    EXPECT_EQ(table.CountRows(), 10);
+}
+
+UTEST(BufferedInserter, BackpressureFlushes) {
+    ClusterWrapper cluster{};
+    const TableGuard table{*cluster, "buffered_inserter_backpressure"};
+
+    storages::clickhouse::BufferedInserterSettings settings;
+    // Every insert exceeds the limit, so it waits for the previous data to be
+    // flushed. The flush must start at once, not on the timer
+    settings.max_total_bytes = 1;
+    settings.flush_interval = std::chrono::hours{1};
+    storages::clickhouse::BufferedInserter inserter{NonOwning(*cluster), settings};
+
+    for (int i = 0; i < 3; ++i) {
+        inserter.InsertRows("buffered_inserter_backpressure", {"id", "value"}, MakeRows(10));
+    }
+    EXPECT_EQ(GetFlushes(inserter), 2);
+    EXPECT_EQ(table.CountRows(), 20);
+
+    inserter.Flush();
+    EXPECT_EQ(table.CountRows(), 30);
+}
+
+UTEST(BufferedInserter, FlushesOnDestruction) {
+    ClusterWrapper cluster{};
+    const TableGuard table{*cluster, "buffered_inserter_shutdown"};
+
+    {
+        storages::clickhouse::BufferedInserterSettings settings;
+        settings.flush_interval = std::chrono::hours{1};
+        storages::clickhouse::BufferedInserter inserter{NonOwning(*cluster), settings};
+        inserter.InsertRows("buffered_inserter_shutdown", {"id", "value"}, MakeRows(10));
+        EXPECT_EQ(table.CountRows(), 0);
+    }
+
+    EXPECT_EQ(table.CountRows(), 10);
+}
+
+UTEST(BufferedInserter, ColumnsMismatch) {
+    ClusterWrapper cluster{};
+    const TableGuard table{*cluster, "buffered_inserter_mismatch"};
+
+    storages::clickhouse::BufferedInserterSettings settings;
+    settings.flush_interval = std::chrono::hours{1};
+    storages::clickhouse::BufferedInserter inserter{NonOwning(*cluster), settings};
+
+    inserter.InsertRows("buffered_inserter_mismatch", {"id", "value"}, MakeRows(10));
+    UEXPECT_THROW(inserter.Insert("buffered_inserter_mismatch", {"id"}, Columns{{1, 2}}), std::exception);
+    inserter.Flush();
+
+    EXPECT_EQ(table.CountRows(), 10);
+}
+
+USERVER_NAMESPACE_END
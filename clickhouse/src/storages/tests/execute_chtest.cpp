@@ -116,4 +116,46 @@ UTEST(Execute, IterationMovesFromUnderlying) {
     }
 }
 
+UTEST(Execute, Streaming) {
+    ClusterWrapper cluster{};
+
+    const storages::clickhouse::Query q{
+        "SELECT c.number, randomString(10), c.number as t, NOW64(9) "
+        "FROM numbers(0, 100000) c SETTINGS max_block_size = 1000"};
+
+    /// [Sample Cursor usage]
+    auto cursor = cluster->ExecuteStreaming(q);
+    std::size_t blocks_count = 0;
+    uint64_t rows_count = 0;
+    uint64_t sum = 0;
+    while (auto block = cursor.Next()) {
+        const auto data = std::move(*block).As<Data>();
+        for (const auto number : data.numbers) sum += number;
+        rows_count += data.numbers.size();
+        ++blocks_count;
+    }
+    /// [Sample Cursor usage]
+
+    EXPECT_EQ(rows_count, 100000);
+    EXPECT_EQ(sum, 100000ULL * (100000 - 1) / 2);
+    EXPECT_GT(blocks_count, 1);
+    EXPECT_FALSE(cursor.Next().has_value());
+}
+
+UTEST(Execute, StreamingCancel) {
+    ClusterWrapper cluster{};
+
+    {
+        auto cursor = cluster->ExecuteStreaming(
+            storages::clickhouse::Query{"SELECT number FROM system.numbers SETTINGS max_block_size = 1000"}
+        );
+        const auto block = cursor.Next();
+        ASSERT_TRUE(block.has_value());
+        EXPECT_EQ(block->GetRowsCount(), 1000);
+    }
+
+    const auto data = cluster->Execute(common_query).As<Data>();
+    EXPECT_EQ(data.numbers.size(), 10000);
+}
+
 USERVER_NAMESPACE_END
@@ -140,6 +140,10 @@ namespace components {
 /// If both `update-interval` and `full-update-interval` are present,
 /// `full-and-incremental` types is assumed. Otherwise `only-full` is used.
 ///
+/// Caches with large container contents may override `WriteContents` and
+/// `ReadContents` with dump::WriteInParts and dump::ReadInParts, so that the
+/// parts of the container are serialized in parallel with `dump.chunked`.
+///
 /// @see `dump::Dumper` for more info on persistent cache dumps and
 /// corresponding config options.
 ///
@@ -0,0 +1,304 @@
+#pragma once
+
+/// @file userver/cache/chunked_cow_map.hpp
+/// @brief @copybrief cache::ChunkedCowMap
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <userver/dump/common.hpp>
+#include <userver/dump/operations.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache {
+
+/// @ingroup userver_containers
+///
+/// @brief Hash map with structural sharing between copies, intended as a
+/// cache data type for caches with incremental updates.
+///
+/// Elements are distributed between a fixed number of chunks, each chunk is
+/// an `std::unordered_map` behind a `std::shared_ptr`. Copying the map copies
+/// only the chunk pointers, and modifying a copy clones just the chunks that
+/// are actually touched. So an incremental update of a cache
+///
+/// @code
+/// auto data = std::make_unique<MyMap>(*Get());  // cheap
+/// for (auto& item : delta) data->insert_or_assign(item.id, std::move(item));
+/// Set(std::move(data));
+/// @endcode
+///
+/// costs time and memory proportional to the number of chunks touched by the
+/// delta rather than to the size of the cache, while the readers keep their
+/// old snapshots unchanged.
+///
+/// A copy may be read from any number of threads, but it must be modified by
+/// a single thread at a time, as any other standard container.
+template <typename Key, typename Value, typename Hash = std::hash<Key>, typename Equal = std::equal_to<Key>>
+class ChunkedCowMap final {
+    using Chunk = std::unordered_map<Key, Value, Hash, Equal>;
+
+public:
+    using key_type = Key;
+    using mapped_type = Value;
+    using value_type = typename Chunk::value_type;
+    using size_type = std::size_t;
+    using hasher = Hash;
+    using key_equal = Equal;
+
+    class const_iterator;
+    using iterator = const_iterator;
+
+    static constexpr std::size_t kDefaultChunksCount = 1024;
+
+    ChunkedCowMap() : ChunkedCowMap(kDefaultChunksCount) {}
+
+    /// @param chunks_count must be a power of 2. More chunks mean cheaper
+    /// updates but more expensive copies, the copy is `O(chunks_count)`.
+    explicit ChunkedCowMap(std::size_t chunks_count);
+
+    std::size_t size() const noexcept { return size_; }
+    bool empty() const noexcept { return size_ == 0; }
+
+    const_iterator begin() const noexcept;
+    const_iterator end() const noexcept;
+
+    const_iterator find(const Key& key) const;
+    std::size_t count(const Key& key) const { return find(key) != end() ? 1 : 0; }
+    bool contains(const Key& key) const { return find(key) != end(); }
+
+    /// @throws std::out_of_range if there is no such key
+    const Value& at(const Key& key) const;
+
+    /// Returns nullptr if there is no such key
+    const Value* GetOrNullptr(const Key& key) const;
+
+    /// @returns `true` if the value was inserted, `false` if it was assigned
+    template <typename V>
+    bool insert_or_assign(Key key, V&& value);
+
+    /// @returns `true` if the value was inserted, `false` if the key exists
+    bool insert(value_type&& value);
+
+    /// Returns a mutable reference to the value, clones its chunk if it is
+    /// shared with other copies. Default-constructs the value if it is missing.
+    Value& operator[](const Key& key);
+
+    std::size_t erase(const Key& key);
+
+    void clear();
+
+    std::size_t GetChunksCount() const noexcept { return chunks_.size(); }
+
+private:
+    std::size_t ChunkIndex(const Key& key) const;
+    Chunk& MutableChunk(std::size_t index);
+
+    std::vector<std::shared_ptr<Chunk>> chunks_;
+    std::size_t size_{0};
+    unsigned chunks_shift_{0};
+};
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+class ChunkedCowMap<Key, Value, Hash, Equal>::const_iterator final {
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = ChunkedCowMap::value_type;
+    using difference_type = std::ptrdiff_t;
+    using reference = const value_type&;
+    using pointer = const value_type*;
+
+    const_iterator() = default;
+
+    reference operator*() const { return *it_; }
+    pointer operator->() const { return &*it_; }
+
+    const_iterator& operator++() {
+        ++it_;
+        SkipEmptyChunks();
+        return *this;
+    }
+
+    const_iterator operator++(int) {
+        auto copy = *this;
+        ++*this;
+        return copy;
+    }
+
+    bool operator==(const const_iterator& other) const noexcept {
+        return chunk_index_ == other.chunk_index_ && (chunk_index_ == ChunksCount() || it_ == other.it_);
+    }
+    bool operator!=(const const_iterator& other) const noexcept { return !(*this == other); }
+
+private:
+    friend class ChunkedCowMap;
+
+    const_iterator(const ChunkedCowMap& map, std::size_t chunk_index) : map_(&map), chunk_index_(chunk_index) {
+        if (chunk_index_ != ChunksCount()) {
+            it_ = map_->chunks_[chunk_index_]->cbegin();
+            SkipEmptyChunks();
+        }
+    }
+
+    const_iterator(const ChunkedCowMap& map, std::size_t chunk_index, typename Chunk::const_iterator it)
+        : map_(&map), chunk_index_(chunk_index), it_(it) {}
+
+    std::size_t ChunksCount() const noexcept { return map_ ? map_->chunks_.size() : 0; }
+
+    void SkipEmptyChunks() {
+        while (it_ == map_->chunks_[chunk_index_]->cend()) {
+            if (++chunk_index_ == ChunksCount()) return;
+            it_ = map_->chunks_[chunk_index_]->cbegin();
+        }
+    }
+
+    const ChunkedCowMap* map_{nullptr};
+    std::size_t chunk_index_{0};
+    typename Chunk::const_iterator it_{};
+};
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+ChunkedCowMap<Key, Value, Hash, Equal>::ChunkedCowMap(std::size_t chunks_count) {
+    if (chunks_count == 0 || (chunks_count & (chunks_count - 1)) != 0) {
+        throw std::invalid_argument("ChunkedCowMap chunks count must be a power of 2");
+    }
+    unsigned bits = 0;
+    while ((std::size_t{1} << bits) < chunks_count) ++bits;
+    chunks_shift_ = 64 - bits;
+
+    // All the chunks of an empty map share a single empty chunk, it is never
+    // modified in place.
+    const auto empty_chunk = std::make_shared<Chunk>();
+    chunks_.assign(chunks_count, empty_chunk);
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+auto ChunkedCowMap<Key, Value, Hash, Equal>::begin() const noexcept -> const_iterator {
+    return const_iterator{*this, 0};
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+auto ChunkedCowMap<Key, Value, Hash, Equal>::end() const noexcept -> const_iterator {
+    return const_iterator{*this, chunks_.size()};
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+auto ChunkedCowMap<Key, Value, Hash, Equal>::find(const Key& key) const -> const_iterator {
+    const auto index = ChunkIndex(key);
+    const auto& chunk = *chunks_[index];
+    const auto it = chunk.find(key);
+    if (it == chunk.end()) return end();
+    return const_iterator{*this, index, it};
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+const Value& ChunkedCowMap<Key, Value, Hash, Equal>::at(const Key& key) const {
+    return chunks_[ChunkIndex(key)]->at(key);
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+const Value* ChunkedCowMap<Key, Value, Hash, Equal>::GetOrNullptr(const Key& key) const {
+    const auto& chunk = *chunks_[ChunkIndex(key)];
+    const auto it = chunk.find(key);
+    return it == chunk.end() ? nullptr : &it->second;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+template <typename V>
+bool ChunkedCowMap<Key, Value, Hash, Equal>::insert_or_assign(Key key, V&& value) {
+    auto& chunk = MutableChunk(ChunkIndex(key));
+    const bool inserted = chunk.insert_or_assign(std::move(key), std::forward<V>(value)).second;
+    if (inserted) ++size_;
+    return inserted;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+bool ChunkedCowMap<Key, Value, Hash, Equal>::insert(value_type&& value) {
+    const auto index = ChunkIndex(value.first);
+    if (chunks_[index]->count(value.first)) return false;
+
+    MutableChunk(index).insert(std::move(value));
+    ++size_;
+    return true;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+Value& ChunkedCowMap<Key, Value, Hash, Equal>::operator[](const Key& key) {
+    auto& chunk = MutableChunk(ChunkIndex(key));
+    const auto [it, inserted] = chunk.try_emplace(key);
+    if (inserted) ++size_;
+    return it->second;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+std::size_t ChunkedCowMap<Key, Value, Hash, Equal>::erase(const Key& key) {
+    const auto index = ChunkIndex(key);
+    // Avoid cloning a shared chunk if there is nothing to erase
+    if (!chunks_[index]->count(key)) return 0;
+
+    MutableChunk(index).erase(key);
+    --size_;
+    return 1;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+void ChunkedCowMap<Key, Value, Hash, Equal>::clear() {
+    *this = ChunkedCowMap(chunks_.size());
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+std::size_t ChunkedCowMap<Key, Value, Hash, Equal>::ChunkIndex(const Key& key) const {
+    // Fibonacci hashing, so that the chunk index does not depend on the low
+    // bits of the hash that std::unordered_map uses for its buckets.
+    const auto hash = static_cast<std::uint64_t>(Hash{}(key));
+    return chunks_.size() == 1 ? 0 : static_cast<std::size_t>((hash * 0x9E3779B97F4A7C15ULL) >> chunks_shift_);
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+auto ChunkedCowMap<Key, Value, Hash, Equal>::MutableChunk(std::size_t index) -> Chunk& {
+    auto& chunk = chunks_[index];
+    // Other copies of the map are only able to drop their references
+    // concurrently, never to add new ones. So use_count() == 1 means that the
+    // chunk is exclusively ours, the fence pairs with the release decrement
+    // of the last other owner.
+    if (chunk.use_count() == 1) {
+        std::atomic_thread_fence(std::memory_order_acquire);
+    } else {
+        chunk = std::make_shared<Chunk>(*chunk);
+    }
+    return *chunk;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+void Write(dump::Writer& writer, const ChunkedCowMap<Key, Value, Hash, Equal>& map) {
+    writer.Write(map.GetChunksCount());
+    writer.Write(map.size());
+    for (const auto& [key, value] : map) {
+        writer.Write(key);
+        writer.Write(value);
+    }
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+ChunkedCowMap<Key, Value, Hash, Equal> Read(dump::Reader& reader, dump::To<ChunkedCowMap<Key, Value, Hash, Equal>>) {
+    ChunkedCowMap<Key, Value, Hash, Equal> map{reader.Read<std::size_t>()};
+    const auto size = reader.Read<std::size_t>();
+    for (std::size_t i = 0; i < size; ++i) {
+        auto key = reader.Read<Key>();
+        map.insert_or_assign(std::move(key), reader.Read<Value>());
+    }
+    return map;
+}
+
+}  // namespace cache
+
+USERVER_NAMESPACE_END
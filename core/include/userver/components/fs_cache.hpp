@@ -23,6 +23,7 @@ namespace components {
 /// dir               | directory to cache files from                        | /var/www
 /// update-period     | Update period (0 - fill the cache only at startup)   | 0
 /// fs-task-processor | task processor to do filesystem operations           | fs-task-processor
+/// keep-files-opened | keep a descriptor of each cached file opened, e.g. for sendfile(2) in server::handlers::HttpHandlerStatic | false
 
 // clang-format on
 
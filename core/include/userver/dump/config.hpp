@@ -42,6 +42,11 @@ struct Config final {
     std::optional<std::chrono::milliseconds> max_dump_age;
     bool max_dump_age_set;
     bool dump_is_encrypted;
+    bool dump_is_mapped;
+    bool dump_is_chunked;
+    std::size_t chunk_size;
+    std::size_t max_parallel_chunks;
+    std::string chunk_task_processor;
 
     bool static_dumps_enabled;
     std::chrono::milliseconds static_min_dump_interval;
@@ -85,6 +85,11 @@ enum class UpdateType {
 /// `min-interval` | `string` (duration) | `WriteDumpAsync` calls performed in a fast succession are ignored | `0s`
 /// `fs-task-processor` | `string` | `TaskProcessor` for blocking disk IO | `fs-task-processor`
 /// `encrypted` | `boolean` | Whether to encrypt the dump | `false`
+/// `mmap` | `boolean` | Whether to memory-map the dump on reading, so that `dump::FlatArray` values are used in place. Incompatible with `encrypted` | `false`
+/// `chunked` | `boolean` | Whether to split the dump into chunks, that are compressed with zstd and, if `encrypted`, encrypted in parallel. Incompatible with `mmap` | `false`
+/// `chunk-size` | `integer` | Size of the uncompressed data of a chunk in bytes | `4194304`
+/// `max-parallel-chunks` | `integer` | Max number of chunks that are processed at once | `4`
+/// `chunk-task-processor` | `string` | `TaskProcessor` for the compression and encryption of chunks, and for dump::WriteInParts | `main-task-processor`
 ///
 /// ## Sample usage
 /// @snippet core/src/dump/dumper_test.cpp  Sample Dumper usage
@@ -171,7 +176,7 @@ private:
     Dumper(const Config& initial_config, const components::ComponentContext& context, DumpableEntity& dumpable);
 
     class Impl;
-    utils::FastPimpl<Impl, 1088, 16> impl_;
+    utils::FastPimpl<Impl, 1184, 16> impl_;
 };
 
 }  // namespace dump
@@ -0,0 +1,129 @@
+#pragma once
+
+/// @file userver/dump/flat.hpp
+/// @brief @copybrief dump::FlatArray
+///
+/// @ingroup userver_dump_read_write
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <userver/dump/operations.hpp>
+#include <userver/dump/to.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/span.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dump {
+
+namespace impl {
+
+struct FlatBlock final {
+    std::string_view data;
+    std::shared_ptr<const void> owner;
+};
+
+}  // namespace impl
+
+/// @brief An immutable array of trivially copyable values, that is dumped as
+/// a single checksummed block without per-element serialization.
+///
+/// Suits flat layouts: sorted arrays, open-addressing tables, string pools.
+/// The values must not contain pointers or references, use offsets instead.
+///
+/// On reading with a dump::MmapFileReader (see the `mmap` option of
+/// dump::Dumper) the array references the mapped dump file in place and keeps
+/// the mapping alive. Otherwise, the values are copied in bulk.
+///
+/// The dump stores the element size, a change of the layout of `T` must still
+/// be accompanied with a `format-version` bump.
+template <typename T>
+class FlatArray final {
+    static_assert(std::is_trivially_copyable_v<T>, "FlatArray only supports trivially copyable types");
+
+public:
+    using value_type = T;
+    using const_iterator = const T*;
+    using iterator = const_iterator;
+
+    FlatArray() = default;
+
+    explicit FlatArray(std::vector<T>&& values) {
+        auto storage = std::make_shared<std::vector<T>>(std::move(values));
+        data_ = storage->data();
+        size_ = storage->size();
+        storage_ = std::move(storage);
+    }
+
+    const T* data() const noexcept { return data_; }
+    std::size_t size() const noexcept { return size_; }
+    bool empty() const noexcept { return size_ == 0; }
+
+    const_iterator begin() const noexcept { return data_; }
+    const_iterator end() const noexcept { return data_ + size_; }
+
+    const T& operator[](std::size_t index) const noexcept {
+        UASSERT(index < size_);
+        return data_[index];
+    }
+
+    /// @returns true if the values reference a memory-mapped dump
+    bool IsMapped() const noexcept { return is_mapped_; }
+
+private:
+    template <typename U>
+    friend FlatArray<U> Read(Reader& reader, To<FlatArray<U>>);
+
+    FlatArray(std::shared_ptr<const void> owner, const T* data, std::size_t size) noexcept
+        : storage_(std::move(owner)), data_(data), size_(size), is_mapped_(true) {}
+
+    std::shared_ptr<const void> storage_;
+    const T* data_{nullptr};
+    std::size_t size_{0};
+    bool is_mapped_{false};
+};
+
+/// @brief Writes the values as a single checksummed block, that can be read
+/// back as dump::FlatArray
+template <typename T>
+void WriteFlat(Writer& writer, utils::span<const T> values) {
+    static_assert(std::is_trivially_copyable_v<T>, "WriteFlat only supports trivially copyable types");
+    static_assert(alignof(T) < 128, "WriteFlat does not support over-aligned types");
+    impl::WriteFlatBlock(
+        writer,
+        std::string_view{reinterpret_cast<const char*>(values.data()), values.size() * sizeof(T)},
+        sizeof(T),
+        alignof(T)
+    );
+}
+
+/// @brief dump::FlatArray serialization support
+template <typename T>
+void Write(Writer& writer, const FlatArray<T>& array) {
+    dump::WriteFlat(writer, utils::span<const T>{array.data(), array.size()});
+}
+
+/// @brief dump::FlatArray deserialization support
+template <typename T>
+FlatArray<T> Read(Reader& reader, To<FlatArray<T>>) {
+    auto block = impl::ReadFlatBlock(reader, sizeof(T), alignof(T));
+    const auto count = block.data.size() / sizeof(T);
+
+    if (block.owner && reinterpret_cast<std::uintptr_t>(block.data.data()) % alignof(T) == 0) {
+        return FlatArray<T>{std::move(block.owner), reinterpret_cast<const T*>(block.data.data()), count};
+    }
+
+    std::vector<T> values(count);
+    if (count != 0) std::memcpy(values.data(), block.data.data(), block.data.size());
+    return FlatArray<T>{std::move(values)};
+}
+
+}  // namespace dump
+
+USERVER_NAMESPACE_END
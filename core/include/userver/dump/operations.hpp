@@ -1,5 +1,6 @@
 #pragma once
 
+#include <memory>
 #include <stdexcept>
 #include <string>
 #include <string_view>
@@ -10,8 +11,22 @@
 
 USERVER_NAMESPACE_BEGIN
 
+namespace engine {
+class TaskProcessor;
+}  // namespace engine
+
 namespace dump {
 
+namespace impl {
+
+struct FlatBlock;
+
+void WriteFlatBlock(Writer& writer, std::string_view data, std::size_t element_size, std::size_t alignment);
+
+FlatBlock ReadFlatBlock(Reader& reader, std::size_t element_size, std::size_t alignment);
+
+}  // namespace impl
+
 /// Indicates a failure reading or writing a dump. No further operations
 /// should be performed with a failed dump.
 class Error final : public std::runtime_error {
@@ -35,6 +50,11 @@ public:
     /// @throws `Error` on write operation failure
     virtual void Finish() = 0;
 
+    /// @brief Returns the `TaskProcessor` to serialize independent parts of
+    /// the data on in parallel (see dump::WriteInParts), or `nullptr` if the
+    /// parts should be serialized sequentially
+    virtual engine::TaskProcessor* GetTaskProcessor() const noexcept { return nullptr; }
+
 protected:
     /// @brief Writes binary data
     /// @details Unlike `Write`, doesn't write the size of `data`
@@ -42,6 +62,10 @@ protected:
     virtual void WriteRaw(std::string_view data) = 0;
 
     friend void WriteStringViewUnsafe(Writer& writer, std::string_view value);
+    friend void impl::WriteFlatBlock(Writer&, std::string_view, std::size_t, std::size_t);
+
+private:
+    std::size_t written_size_{0};
 };
 
 /// A general interface for binary data input
@@ -60,6 +84,11 @@ public:
     /// @throws `Error` on read operation failure or if there is leftover data
     virtual void Finish() = 0;
 
+    /// @brief Returns the `TaskProcessor` to deserialize independent parts of
+    /// the data on in parallel (see dump::ReadInParts), or `nullptr` if the
+    /// parts should be deserialized sequentially
+    virtual engine::TaskProcessor* GetTaskProcessor() const noexcept { return nullptr; }
+
 protected:
     /// @brief Reads binary data
     /// @note Invalidates the memory returned by the previous call of `ReadRaw`
@@ -68,7 +97,16 @@ protected:
     /// @throws `Error` on read operation failure
     virtual std::string_view ReadRaw(std::size_t max_size) = 0;
 
+    /// @brief Returns an owner of the memory returned by `ReadRaw`, that keeps
+    /// the memory valid after the next `ReadRaw` and after the destruction of
+    /// the `Reader`, or `nullptr` if the memory can't outlive the next read
+    virtual std::shared_ptr<const void> GetRawMemoryOwner() const { return nullptr; }
+
     friend std::string_view ReadUnsafeAtMost(Reader& reader, std::size_t size);
+    friend impl::FlatBlock impl::ReadFlatBlock(Reader&, std::size_t, std::size_t);
+
+private:
+    std::size_t read_size_{0};
 };
 
 namespace impl {
@@ -0,0 +1,110 @@
+#pragma once
+
+/// @file userver/dump/operations_chunked.hpp
+/// @brief @copybrief dump::ChunkedWriter
+
+#include <memory>
+#include <optional>
+
+#include <boost/filesystem/operations.hpp>
+
+#include <userver/dump/factory.hpp>
+#include <userver/dump/operations.hpp>
+#include <userver/dump/operations_encrypted.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dump {
+
+/// Settings of dump::ChunkedWriter and dump::ChunkedReader
+struct ChunkedOptions final {
+    /// Size of the uncompressed data of a chunk
+    std::size_t chunk_size{4 * 1024 * 1024};
+
+    /// Max number of chunks that are compressed or decompressed at once
+    std::size_t max_parallel_chunks{4};
+
+    /// zstd compression level of the chunks
+    int compression_level{1};
+
+    /// If set, each chunk is encrypted with AES-GCM using a random IV.
+    /// The order of the chunks and the end of the dump are authenticated too.
+    std::optional<SecretKey> secret_key;
+};
+
+/// @brief A handle to a dump file, that is split into chunks. The chunks are
+/// compressed with zstd and optionally encrypted in parallel on the
+/// `TaskProcessor`, and are written to the file in order.
+///
+/// File operations block the thread.
+class ChunkedWriter final : public Writer {
+public:
+    /// @brief Creates a new dump file and opens it
+    /// @throws `Error` on a filesystem error
+    ChunkedWriter(
+        std::string path,
+        boost::filesystem::perms perms,
+        tracing::ScopeTime& scope,
+        engine::TaskProcessor& task_processor,
+        const ChunkedOptions& options
+    );
+
+    ~ChunkedWriter() override;
+
+    void Finish() override;
+
+    engine::TaskProcessor* GetTaskProcessor() const noexcept override;
+
+private:
+    void WriteRaw(std::string_view data) override;
+
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+/// @brief A handle to a dump file written by dump::ChunkedWriter. The next
+/// chunks are read ahead, decrypted and decompressed in parallel on the
+/// `TaskProcessor`.
+///
+/// File operations block the thread.
+class ChunkedReader final : public Reader {
+public:
+    /// @brief Opens an existing dump file
+    /// @throws `Error` on a filesystem error or if the file is not a chunked
+    /// dump
+    ChunkedReader(std::string path, engine::TaskProcessor& task_processor, const ChunkedOptions& options);
+
+    ~ChunkedReader() override;
+
+    void Finish() override;
+
+    engine::TaskProcessor* GetTaskProcessor() const noexcept override;
+
+private:
+    std::string_view ReadRaw(std::size_t max_size) override;
+
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+class ChunkedOperationsFactory final : public OperationsFactory {
+public:
+    ChunkedOperationsFactory(
+        boost::filesystem::perms perms,
+        engine::TaskProcessor& task_processor,
+        ChunkedOptions&& options
+    );
+
+    std::unique_ptr<Reader> CreateReader(std::string full_path) override;
+
+    std::unique_ptr<Writer> CreateWriter(std::string full_path, tracing::ScopeTime& scope) override;
+
+private:
+    const boost::filesystem::perms perms_;
+    engine::TaskProcessor& task_processor_;
+    const ChunkedOptions options_;
+};
+
+}  // namespace dump
+
+USERVER_NAMESPACE_END
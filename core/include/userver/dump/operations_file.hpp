@@ -51,9 +51,36 @@ private:
     std::string curr_chunk_;
 };
 
+namespace impl {
+class MappedFile;
+}  // namespace impl
+
+/// @brief A handle to a memory-mapped dump file. Reads return the mapped
+/// memory without copying, dump::FlatArray values are used in place.
+class MmapFileReader final : public Reader {
+public:
+    /// @brief Opens and maps an existing dump file
+    /// @throws `Error` on a filesystem error
+    explicit MmapFileReader(std::string path);
+
+    ~MmapFileReader() override;
+
+    void Finish() override;
+
+private:
+    std::string_view ReadRaw(std::size_t max_size) override;
+
+    std::shared_ptr<const void> GetRawMemoryOwner() const override;
+
+    std::string path_;
+    std::shared_ptr<const impl::MappedFile> file_;
+    std::string_view unread_data_;
+};
+
 class FileOperationsFactory final : public OperationsFactory {
 public:
-    explicit FileOperationsFactory(boost::filesystem::perms perms);
+    /// @param use_mmap read the dumps with dump::MmapFileReader
+    explicit FileOperationsFactory(boost::filesystem::perms perms, bool use_mmap = false);
 
     std::unique_ptr<Reader> CreateReader(std::string full_path) override;
 
@@ -61,6 +88,7 @@ public:
 
 private:
     const boost::filesystem::perms perms_;
+    const bool use_mmap_;
 };
 
 }  // namespace dump
@@ -0,0 +1,157 @@
+#pragma once
+
+/// @file userver/dump/parts.hpp
+/// @brief Parallel serialization of containers, see dump::WriteInParts
+///
+/// @ingroup userver_dump_read_write
+
+#include <algorithm>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <userver/utils/assert.hpp>
+#include <userver/utils/function_ref.hpp>
+#include <userver/utils/meta.hpp>
+
+#include <userver/dump/common.hpp>
+#include <userver/dump/meta.hpp>
+#include <userver/dump/meta_containers.hpp>
+#include <userver/dump/operations.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dump {
+
+/// The default number of parts for dump::WriteInParts
+inline constexpr std::size_t kDefaultPartsCount = 16;
+
+namespace impl {
+
+/// A `Writer` that appends to a string buffer
+class StringWriter final : public Writer {
+public:
+    void Finish() override {}
+
+    std::string Extract() && { return std::move(data_); }
+
+private:
+    void WriteRaw(std::string_view data) override;
+
+    std::string data_;
+};
+
+/// A `Reader` that references a string buffer
+class StringReader final : public Reader {
+public:
+    explicit StringReader(std::string_view data) noexcept : unread_data_(data) {}
+
+    void Finish() override;
+
+private:
+    std::string_view ReadRaw(std::size_t max_size) override;
+
+    std::string_view unread_data_;
+};
+
+/// Calls `func(part_index)` for each part, in parallel if `task_processor` is
+/// not `nullptr`
+void RunInParts(
+    engine::TaskProcessor* task_processor,
+    std::size_t parts_count,
+    utils::function_ref<void(std::size_t)> func
+);
+
+}  // namespace impl
+
+/// @brief Writes the container split into parts, that are serialized in
+/// parallel on `writer.GetTaskProcessor()`, e.g. the one of
+/// dump::ChunkedWriter. Otherwise, the parts are serialized sequentially.
+///
+/// Use it in `WriteContents` of a cache with large contents. The serialized
+/// parts are buffered in memory before being written. Must be read back with
+/// dump::ReadInParts.
+template <typename T>
+void WriteInParts(Writer& writer, const T& container, std::size_t parts_count = kDefaultPartsCount) {
+    static_assert(kIsContainer<T> && kIsWritable<meta::RangeValueType<T>>, "T must be a dumpable container");
+    UINVARIANT(parts_count != 0, "parts_count must be positive");
+
+    const std::size_t size = std::size(container);
+    parts_count = std::max(std::min(parts_count, size), std::size_t{1});
+
+    using Iterator = decltype(std::begin(container));
+    std::vector<Iterator> bounds;
+    bounds.reserve(parts_count + 1);
+    auto it = std::begin(container);
+    for (std::size_t i = 0; i < parts_count; ++i) {
+        bounds.push_back(it);
+        std::advance(it, size * (i + 1) / parts_count - size * i / parts_count);
+    }
+    bounds.push_back(it);
+
+    std::vector<std::string> parts(parts_count);
+    impl::RunInParts(writer.GetTaskProcessor(), parts_count, [&](std::size_t part_index) {
+        impl::StringWriter part_writer;
+        part_writer.Write(size * (part_index + 1) / parts_count - size * part_index / parts_count);
+        for (auto item = bounds[part_index]; item != bounds[part_index + 1]; ++item) {
+            // explicit cast for vector<bool> shenanigans
+            part_writer.Write(static_cast<const meta::RangeValueType<T>&>(*item));
+        }
+        parts[part_index] = std::move(part_writer).Extract();
+    });
+
+    writer.Write(size);
+    writer.Write(parts.size());
+    for (const auto& part : parts) {
+        writer.Write(part);
+    }
+}
+
+/// @brief Reads the container written by dump::WriteInParts. The parts are
+/// deserialized in parallel on `reader.GetTaskProcessor()`, if any
+template <typename T>
+T ReadInParts(Reader& reader) {
+    using Value = meta::RangeValueType<T>;
+    static_assert(kIsContainer<T> && kIsReadable<Value>, "T must be a dumpable container");
+
+    const auto size = reader.Read<std::size_t>();
+    const auto parts_count = reader.Read<std::size_t>();
+    std::vector<std::string> parts;
+    for (std::size_t i = 0; i < parts_count; ++i) {
+        parts.push_back(reader.Read<std::string>());
+    }
+
+    std::vector<std::vector<Value>> values(parts.size());
+    impl::RunInParts(reader.GetTaskProcessor(), parts.size(), [&](std::size_t part_index) {
+        impl::StringReader part_reader{parts[part_index]};
+        const auto part_size = part_reader.Read<std::size_t>();
+        auto& part_values = values[part_index];
+        for (std::size_t i = 0; i < part_size; ++i) {
+            part_values.push_back(part_reader.Read<Value>());
+        }
+        part_reader.Finish();
+    });
+
+    std::size_t values_count = 0;
+    for (const auto& part_values : values) values_count += part_values.size();
+    if (values_count != size) {
+        throw Error(fmt::format("Unexpected count of container items in parts: expected={}, actual={}", size, values_count));
+    }
+
+    T result{};
+    if constexpr (meta::kIsReservable<T>) {
+        result.reserve(size);
+    }
+    for (auto& part_values : values) {
+        for (auto& value : part_values) {
+            dump::Insert(result, std::move(value));
+        }
+    }
+    return result;
+}
+
+}  // namespace dump
+
+USERVER_NAMESPACE_END
@@ -5,6 +5,7 @@
 
 #include <sys/socket.h>
 
+#include <cstdint>
 #include <initializer_list>
 
 #include <userver/engine/deadline.hpp>
@@ -112,6 +113,14 @@ public:
     /// @note Can return less than len if socket is closed by peer.
     [[nodiscard]] size_t SendAll(const void* buf, size_t len, Deadline deadline);
 
+    /// @brief Sends exactly len bytes of a file starting at offset to the
+    /// socket without copying them to the user space, see `man sendfile`.
+    /// @note Can return less than len if socket is closed by peer or the file
+    /// is shorter than expected.
+    /// @note The file must support mmap-like operations, e.g. be a regular
+    /// file. Reading it may block the current thread on a disk access.
+    [[nodiscard]] size_t SendFile(int file_fd, std::uint64_t offset, size_t len, Deadline deadline);
+
     /// @brief Accepts a connection from a listening socket.
     /// @see engine::io::Listen
     [[nodiscard]] Socket Accept(Deadline);
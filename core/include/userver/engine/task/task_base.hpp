@@ -200,6 +200,9 @@ namespace impl {
 // For internal use only.
 std::uint64_t GetCreatedTaskCount(TaskProcessor&);
 
+// For internal use only.
+std::size_t GetWorkerCount(TaskProcessor&);
+
 }  // namespace impl
 
 }  // namespace engine
@@ -23,7 +23,13 @@ public:
     /// @param update_period time (0 - fill the cache only at startup), not used
     /// in Linux
     /// @param tp task processor to do filesystem operations
-    FsCacheClient(std::string_view dir, std::chrono::milliseconds update_period, engine::TaskProcessor& tp);
+    /// @param flags settings read files
+    FsCacheClient(
+        std::string_view dir,
+        std::chrono::milliseconds update_period,
+        engine::TaskProcessor& tp,
+        utils::Flags<SettingsReadFile> flags = {SettingsReadFile::kSkipHidden}
+    );
 
     /// @brief get file from memory
     /// @param path to file
@@ -52,6 +58,7 @@ private:
     const std::string dir_;
     const std::chrono::milliseconds update_period_;
     engine::TaskProcessor& tp_;
+    const utils::Flags<SettingsReadFile> flags_;
 #ifndef __linux__
     utils::PeriodicTask cache_updater_;
 #endif
@@ -3,6 +3,7 @@
 /// @file userver/fs/read.hpp
 /// @brief functions for asynchronous file read operations
 
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -15,10 +16,33 @@ USERVER_NAMESPACE_BEGIN
 /// @brief filesystem support
 namespace fs {
 
+namespace blocking {
+class FileDescriptor;
+}  // namespace blocking
+
+/// @brief Identity and modification time of a file, as reported by fstat(2)
+struct FileStatus {
+    std::uint64_t device{0};
+    std::uint64_t inode{0};
+    std::uint64_t size{0};
+    std::int64_t modification_time_ns{0};
+
+    bool operator==(const FileStatus& other) const noexcept;
+};
+
 /// @brief Struct file with load data
 struct FileInfoWithData {
     std::string data;
     std::string extension;
+    /// Path the file was read from
+    std::string path;
+    /// Quoted hash of the data, suitable for the HTTP ETag header
+    std::string etag;
+    /// Status of the file at the moment the data was read
+    FileStatus status;
+    /// The file the data was read from, only set with
+    /// SettingsReadFile::kKeepOpened
+    std::shared_ptr<const blocking::FileDescriptor> file;
 };
 
 using FileInfoWithDataConstPtr = std::shared_ptr<const FileInfoWithData>;
@@ -28,6 +52,9 @@ enum class SettingsReadFile {
     kNone = 0,
     /// Skip hidden files,
     kSkipHidden = 1 << 0,
+    /// Keep the files opened in FileInfoWithData::file, e.g. to send them
+    /// with sendfile(2). Takes a file descriptor per file.
+    kKeepOpened = 1 << 1,
 };
 
 /// @brief Returns relative path from full path
@@ -58,6 +85,23 @@ FileInfoWithDataMap ReadRecursiveFilesInfoWithData(
 /// read error, etc.),
 std::string ReadFileContents(engine::TaskProcessor& async_tp, const std::string& path);
 
+/// @brief Reads file contents and fills the file info asynchronously
+/// @param async_tp TaskProcessor for synchronous waiting
+/// @param path file to open
+/// @param flags settings read files
+/// @throws std::runtime_error if read fails for any reason (e.g. no such file,
+/// read error, etc.),
+FileInfoWithData
+ReadFileInfoWithData(engine::TaskProcessor& async_tp, const std::string& path, utils::Flags<SettingsReadFile> flags = {});
+
+/// @brief Checks that the opened FileInfoWithData::file still holds the data,
+/// i.e. it was not modified in place since it was read
+/// @note Does a single non-blocking fstat(2), so it may be called on each
+/// request. A file replaced by a rename keeps the old contents in the opened
+/// descriptor and is reported as unchanged.
+/// @returns false if the file is not kept opened or was modified
+bool IsOpenedFileUnchanged(const FileInfoWithData& info) noexcept;
+
 /// @brief Checks whether the file exists asynchronously
 /// @param async_tp TaskProcessor for synchronous waiting
 /// @param path file path to check
@@ -43,9 +43,10 @@ namespace components {
 /// ---- | ----------- | -------------
 /// file_path | path to the log file | -
 /// level | log verbosity | info
-/// format | log output format, either `tskv` or `ltsv` | tskv
+/// format | log output format, either `tskv`, `ltsv`, `raw` or `binary`. The `binary` logs are converted to text by the `log-decoder` tool | tskv
+/// deferred_formatting | if `true`, the values are formatted by the logger task instead of the logging thread | false
 /// flush_level | messages of this and higher levels get flushed to the file immediately | warning
-/// message_queue_size | the size of internal message queue, must be a power of 2 | 65536
+/// message_queue_size | the maximum number of buffered messages, must be a power of 2. It is split evenly between the threads that write to the logger, and the memory is allocated on demand. Records of a coroutine that migrates between threads may be written out of order | 65536
 /// overflow_behavior | message handling policy while the queue is full: `discard` drops messages, `block` waits until message gets into the queue | discard
 /// testsuite-capture | if exists, setups additional TCP log sink for testing purposes | {}
 /// fs-task-processor | task processor for disk I/O operations for this logger | fs-task-processor of the loggers component
@@ -3,6 +3,7 @@
 #include <array>
 #include <atomic>
 
+#include <userver/concurrent/striped_counter.hpp>
 #include <userver/logging/level.hpp>
 #include <userver/utils/statistics/rate_counter.hpp>
 #include <userver/utils/statistics/writer.hpp>
@@ -16,7 +17,8 @@ using Counter = utils::statistics::RateCounter;
 struct LogStatistics final {
     Counter dropped{};
 
-    std::array<Counter, kLevelMax + 1> by_level{};
+    // Incremented by each logging thread, so must not share a cache line
+    std::array<concurrent::StripedCounter, kLevelMax + 1> by_level{};
     std::atomic<bool> has_reopening_error{false};
 };
 
@@ -3,6 +3,9 @@
 /// @file userver/server/handlers/http_handler_static.hpp
 /// @brief @copybrief server::handlers::HttpHandlerStatic
 
+#include <cstddef>
+#include <optional>
+
 #include <userver/components/fs_cache.hpp>
 #include <userver/dynamic_config/source.hpp>
 #include <userver/fs/fs_cache_client.hpp>
@@ -19,6 +22,19 @@ namespace server::handlers {
 /// @brief Handler that returns HTTP 200 if file exist
 /// and returns file data with mapped content/type
 ///
+/// Responses carry an `ETag` computed from the file contents, so conditional
+/// `If-None-Match` requests are answered with 304. A single byte range
+/// requested with `Range` (optionally guarded by `If-Range`) is answered with
+/// 206.
+///
+/// Files of at least `sendfile-min-size` bytes are sent to plain HTTP/1.x
+/// connections with sendfile(2) straight from the page cache, if the FsCache
+/// has `keep-files-opened` enabled. The file opened at cache load is checked
+/// with fstat(2) on each request, and the cached contents are sent instead if
+/// the file was modified in place. TLS and HTTP/2 connections send the cached
+/// contents without copying them into the response. Such responses are not
+/// compressed by the server::middlewares::Compression.
+///
 /// ## Dynamic config
 /// * @ref USERVER_FILES_CONTENT_TYPE_MAP
 ///
@@ -31,6 +47,7 @@ namespace server::handlers {
 /// Name               | Description                   | Default value
 /// ------------------ | ----------------------------- | -------------
 /// fs-cache-component | Name of the FsCache component | fs-cache-component
+/// sendfile-min-size  | minimal file size in bytes to send with sendfile(2) | - (sendfile is not used)
 ///
 /// ## Example usage:
 ///
@@ -55,6 +72,7 @@ public:
 private:
     dynamic_config::Source config_;
     const fs::FsCacheClient& storage_;
+    const std::optional<std::size_t> sendfile_min_size_;
 };
 
 }  // namespace server::handlers
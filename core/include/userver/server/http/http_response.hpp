@@ -4,6 +4,10 @@
 /// @brief @copybrief server::http::HttpResponse
 
 #include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
 #include <string>
 #include <variant>
 
@@ -20,6 +24,10 @@
 
 USERVER_NAMESPACE_BEGIN
 
+namespace fs::blocking {
+class FileDescriptor;
+}  // namespace fs::blocking
+
 namespace server::http {
 
 // RFC 9110 states that in case of missing Content-Type it may be assumed to be
@@ -144,6 +152,36 @@ public:
     // Can be called only once
     Producer GetBodyProducer();
 
+    /// @cond
+    // Transforms chunks of a streamed body, e.g. compresses them. `is_last` is
+    // set for the final call that must flush and terminate the encoding.
+    struct BodyStreamEncoder final {
+        std::string content_encoding;
+        std::function<std::string(std::string_view chunk, bool is_last)> encode;
+    };
+
+    void SetBodyStreamEncoder(BodyStreamEncoder encoder);
+    // Can be called only once
+    std::optional<BodyStreamEncoder> ExtractBodyStreamEncoder();
+
+    // Body that is sent from already loaded file contents instead of the
+    // response data, without copying it. Used only if the response data is
+    // empty.
+    struct FileBody final {
+        // Whole contents of the file, e.g. shared with fs::FsCacheClient
+        std::shared_ptr<const std::string> contents;
+        // The same file opened for reading. If set, the body is sent with
+        // sendfile(2) over plain HTTP/1.x connections.
+        std::shared_ptr<const fs::blocking::FileDescriptor> file;
+        // The part of the contents to send
+        std::size_t offset{0};
+        std::size_t size{0};
+    };
+
+    void SetFileBody(FileBody body);
+    bool HasFileBody() const noexcept { return file_body_.has_value(); }
+    /// @endcond
+
 private:
     friend class Http2ResponseWriter;
 
@@ -153,6 +191,12 @@ private:
     // Returns total size of the response
     std::size_t SetBodyNotStreamed(engine::io::RwBase& socket, USERVER_NAMESPACE::http::headers::HeadersString& header);
 
+    // Returns total size of the response
+    std::size_t SetBodyFromFile(engine::io::RwBase& socket, USERVER_NAMESPACE::http::headers::HeadersString& header);
+
+    // The part of the FileBody contents to send
+    std::string_view GetFileBodyView() const;
+
     const HttpRequestImpl& request_;
     HttpStatus status_ = HttpStatus::kOk;
     HeadersMap headers_;
@@ -161,6 +205,8 @@ private:
     engine::SingleConsumerEvent headers_end_{engine::SingleConsumerEvent::NoAutoReset()};
     std::optional<Queue::Consumer> body_stream_;
     Producer body_stream_producer_;
+    std::optional<BodyStreamEncoder> body_stream_encoder_;
+    std::optional<FileBody> file_body_;
     bool is_stream_body_{false};
 };
 
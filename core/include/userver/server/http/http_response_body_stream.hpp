@@ -1,5 +1,6 @@
 #pragma once
 
+#include <optional>
 #include <string>
 
 #include <userver/server/http/http_response.hpp>
@@ -15,7 +16,7 @@ namespace server::http {
 
 class ResponseBodyStream final {
 public:
-    ResponseBodyStream(ResponseBodyStream&&) = default;
+    ResponseBodyStream(ResponseBodyStream&&);
     ~ResponseBodyStream();
 
     // Send a chunk of response data. It may NOT generate
@@ -37,9 +38,12 @@ private:
 
     ResponseBodyStream(HttpResponse::Producer&& queue_producer, HttpResponse& http_response);
 
+    void PushEncodedChunk(std::string&& chunk, engine::Deadline deadline);
+
     bool headers_ended_{false};
     HttpResponse::Producer queue_producer_;
     HttpResponse& http_response_;
+    std::optional<HttpResponse::BodyStreamEncoder> encoder_;
 };
 
 }  // namespace server::http
@@ -25,6 +25,25 @@ namespace components {
 /// ---- | ----------- | -------------
 /// service-name | name of the service to write in traces | ''
 /// tracer | type of the tracer to trace, currently supported only 'native' | 'native'
+/// sampling.ratio | probability to log a new trace | 1.0
+/// sampling.max-traces-per-second | max number of logged traces per second for each root span name (i.e. for each handler), 0 for no limit | 0
+/// sampling.tail-latency-threshold | unsampled traces with a span that takes longer are logged anyway, 0 to disable | 0ms
+/// sampling.tail-keep-errors | unsampled traces with a span with the `error` tag are logged anyway | false
+///
+/// Sampling decision is made once for a trace, when its root span is created.
+/// If the request came with a B3 or OpenTelemetry "sampled" flag, the decision
+/// of the upstream service is used instead. The decision is propagated to the
+/// downstream services in the same flags. Without the `sampling` section every
+/// span is logged and the incoming flags are passed through unchanged.
+///
+/// Spans of unsampled traces are not written to the logs and
+/// tracing::Span::ShouldLogDefault() returns `false` for them, unless the tail
+/// sampling is enabled. Logs that are not span records are not affected.
+///
+/// With the tail sampling, the finished spans of an unsampled trace are kept in
+/// memory until its root span ends. Then all of them are logged if any of them
+/// is slow or failed, and dropped otherwise. Only the spans of the same process
+/// are buffered, up to 1000 spans per trace.
 ///
 /// ## Static configuration example:
 ///
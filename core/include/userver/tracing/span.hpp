@@ -193,9 +193,14 @@ public:
     const std::string& GetParentId() const;
 
     /// @returns true if this span would be logged with the current local and
-    /// global log levels to the default logger.
+    /// global log levels to the default logger. False for the spans of the
+    /// unsampled traces if the tail sampling is off, see components::Tracer.
     bool ShouldLogDefault() const noexcept;
 
+    /// @returns the sampling decision of the trace, that is propagated to the
+    /// downstream services. See components::Tracer.
+    bool IsSampled() const noexcept;
+
     /// Detach the Span from current engine::Task so it is not
     /// returned by CurrentSpan() any more.
     void DetachFromCoroStack();
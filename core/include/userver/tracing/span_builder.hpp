@@ -27,6 +27,11 @@ public:
     void SetParentLink(std::string parent_link);
     void AddTagFrozen(std::string key, logging::LogExtra::Value value);
     void AddNonInheritableTag(std::string key, logging::LogExtra::Value value);
+
+    /// Overrides the sampling decision of the new trace, e.g. with the one that
+    /// came from the upstream service. See components::Tracer.
+    void SetSampled(bool sampled);
+
     Span Build() &&;
 
 private:
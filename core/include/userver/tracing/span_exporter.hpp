@@ -0,0 +1,83 @@
+#pragma once
+
+/// @file userver/tracing/span_exporter.hpp
+/// @brief @copybrief tracing::SpanExporter
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include <userver/logging/level.hpp>
+#include <userver/logging/log_extra.hpp>
+#include <userver/tracing/span.hpp>
+#include <userver/utils/function_ref.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace tracing {
+
+/// @brief Data of a finished tracing::Span, that is passed to
+/// tracing::SpanExporter.
+///
+/// References the internals of the span, so it must not be used after the
+/// tracing::SpanExporter::Export call returns.
+class FinishedSpan final {
+public:
+    using TagVisitor = utils::function_ref<void(std::string_view key, const logging::LogExtra::Value& value)>;
+    using ScopeTimeVisitor = utils::function_ref<void(std::string_view name, std::chrono::nanoseconds duration)>;
+
+    FinishedSpan(const FinishedSpan&) = delete;
+    FinishedSpan& operator=(const FinishedSpan&) = delete;
+
+    const std::string& GetName() const noexcept;
+    const std::string& GetTraceId() const noexcept;
+    const std::string& GetSpanId() const noexcept;
+    const std::string& GetParentId() const noexcept;
+    ReferenceType GetReferenceType() const noexcept;
+    logging::Level GetLogLevel() const noexcept;
+
+    std::chrono::system_clock::time_point GetStartSystemTime() const noexcept;
+    std::chrono::steady_clock::duration GetDuration() const noexcept { return duration_; }
+
+    /// Calls `visitor` for each tag of the span, both inheritable and
+    /// non-inheritable. Each key is visited once.
+    void VisitTags(TagVisitor visitor) const;
+
+    /// Calls `visitor` for each tracing::ScopeTime of the span
+    void VisitScopeTimes(ScopeTimeVisitor visitor) const;
+
+private:
+    friend class Span::Impl;
+
+    FinishedSpan(const Span::Impl& impl, std::chrono::steady_clock::duration duration) noexcept
+        : impl_(impl), duration_(duration) {}
+
+    const Span::Impl& impl_;
+    const std::chrono::steady_clock::duration duration_;
+};
+
+/// @brief Base class for the exporters of finished spans that consume the
+/// span data directly, without formatting the span log record.
+///
+/// Set with tracing::SetSpanExporter.
+class SpanExporter {
+public:
+    virtual ~SpanExporter();
+
+    /// Called from the destructor of each span that should be logged. Must not
+    /// block, the span data must be copied if it is needed later.
+    virtual void Export(const FinishedSpan& span) = 0;
+
+    /// @returns true if the span log record should also be written to the
+    /// default logger
+    virtual bool ShouldAlsoLog() const noexcept { return false; }
+};
+
+/// @brief Sets the global span exporter, nullptr restores writing the spans
+/// to the default logger.
+void SetSpanExporter(std::shared_ptr<SpanExporter> exporter);
+
+}  // namespace tracing
+
+USERVER_NAMESPACE_END
@@ -15,12 +15,17 @@ class TagWriter;
 namespace tracing {
 
 struct NoLogSpans;
+struct SamplingSettings;
 
 class Tracer : public std::enable_shared_from_this<Tracer> {
 public:
     static void SetNoLogSpans(NoLogSpans&& spans);
     static bool IsNoLogSpan(const std::string& name);
 
+    /// Sets the sampling of the new traces. The spans of unsampled traces are
+    /// not logged and do not collect their non-inheritable tags.
+    static void SetSamplingSettings(const SamplingSettings& settings);
+
     static void SetTracer(TracerPtr tracer);
 
     static TracerPtr GetTracer();
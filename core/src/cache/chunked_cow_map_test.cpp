@@ -0,0 +1,91 @@
+#include <userver/cache/chunked_cow_map.hpp>
+
+#include <map>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <userver/dump/common_containers.hpp>
+#include <userver/dump/test_helpers.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using Map = cache::ChunkedCowMap<int, std::string>;
+
+std::map<int, std::string> ToStdMap(const Map& map) { return {map.begin(), map.end()}; }
+
+}  // namespace
+
+TEST(ChunkedCowMap, Basic) {
+    Map map{16};
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(map.begin(), map.end());
+
+    EXPECT_TRUE(map.insert_or_assign(1, "a"));
+    EXPECT_FALSE(map.insert_or_assign(1, "b"));
+    EXPECT_TRUE(map.insert({2, "c"}));
+    EXPECT_FALSE(map.insert({2, "d"}));
+    map[3] += "e";
+
+    EXPECT_EQ(map.size(), 3);
+    EXPECT_EQ(map.at(1), "b");
+    EXPECT_EQ(map.find(2)->second, "c");
+    EXPECT_EQ(*map.GetOrNullptr(3), "e");
+    EXPECT_EQ(map.GetOrNullptr(4), nullptr);
+    EXPECT_EQ(map.find(4), map.end());
+    EXPECT_THROW(map.at(4), std::out_of_range);
+
+    EXPECT_EQ(map.erase(1), 1);
+    EXPECT_EQ(map.erase(1), 0);
+    EXPECT_EQ(ToStdMap(map), (std::map<int, std::string>{{2, "c"}, {3, "e"}}));
+
+    map.clear();
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(map.GetChunksCount(), 16);
+
+    EXPECT_THROW(Map{3}, std::invalid_argument);
+}
+
+TEST(ChunkedCowMap, Iteration) {
+    Map map{64};
+    std::map<int, std::string> expected;
+    for (int i = 0; i < 1000; ++i) {
+        map.insert_or_assign(i, std::to_string(i));
+        expected.emplace(i, std::to_string(i));
+    }
+    EXPECT_EQ(map.size(), expected.size());
+    EXPECT_EQ(ToStdMap(map), expected);
+}
+
+TEST(ChunkedCowMap, CopiesAreIndependent) {
+    Map original{64};
+    for (int i = 0; i < 1000; ++i) original.insert_or_assign(i, std::to_string(i));
+    const auto snapshot = ToStdMap(original);
+
+    Map copy = original;
+    copy.insert_or_assign(1, "changed");
+    copy.erase(2);
+    copy[5000] = "new";
+
+    EXPECT_EQ(ToStdMap(original), snapshot);
+    EXPECT_EQ(copy.at(1), "changed");
+    EXPECT_FALSE(copy.contains(2));
+    EXPECT_EQ(copy.size(), original.size());
+
+    // Chunks that are not shared anymore are modified in place
+    copy.insert_or_assign(1, "changed again");
+    EXPECT_EQ(original.at(1), "1");
+}
+
+TEST(ChunkedCowMap, Dump) {
+    Map map{8};
+    for (int i = 0; i < 100; ++i) map.insert_or_assign(i, std::to_string(i));
+
+    const auto after_cycle = dump::FromBinary<Map>(dump::ToBinary(map));
+    EXPECT_EQ(after_cycle.GetChunksCount(), 8);
+    EXPECT_EQ(ToStdMap(after_cycle), ToStdMap(map));
+}
+
+USERVER_NAMESPACE_END
@@ -7,6 +7,16 @@ USERVER_NAMESPACE_BEGIN
 
 namespace components {
 
+namespace {
+
+utils::Flags<fs::SettingsReadFile> GetReadFileSettings(const components::ComponentConfig& config) {
+    utils::Flags<fs::SettingsReadFile> flags{fs::SettingsReadFile::kSkipHidden};
+    if (config["keep-files-opened"].As<bool>(false)) flags |= fs::SettingsReadFile::kKeepOpened;
+    return flags;
+}
+
+}  // namespace
+
 const FsCache::Client& FsCache::GetClient() const { return client_; }
 
 FsCache::FsCache(const components::ComponentConfig& config, const components::ComponentContext& context)
@@ -14,7 +24,8 @@ FsCache::FsCache(const components::ComponentConfig& config, const components::Co
       client_(
           config["dir"].As<std::string>("/var/www"),
           config["update-period"].As<std::chrono::milliseconds>(0),
-          context.GetTaskProcessor(config["fs-task-processor"].As<std::string>("fs-task-processor"))
+          context.GetTaskProcessor(config["fs-task-processor"].As<std::string>("fs-task-processor")),
+          GetReadFileSettings(config)
       ) {}
 
 yaml_config::Schema FsCache::GetStaticConfigSchema() {
@@ -36,6 +47,10 @@ properties:
         type: string
         description: task processor to do filesystem operations
         defaultDescription: fs-task-processor
+    keep-files-opened:
+        type: boolean
+        description: keep a descriptor of each cached file opened, e.g. for sendfile(2)
+        defaultDescription: false
 )");
 }
 
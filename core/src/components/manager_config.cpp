@@ -167,6 +167,29 @@ properties:
                     enum:
                       - global-task-queue
                       - work-stealing-task-queue
+                io-backend:
+                    type: string
+                    description: |
+                        Backend used by sockets created in the task processor
+                        to wait for I/O readiness.
+                        `ev` waits via libev watchers in ev threads.
+                        `io-uring` submits readiness waits to io_uring directly
+                        from coroutines, completions are reaped by ev threads;
+                        falls back to `ev` if io_uring is not available.
+                    defaultDescription: ev
+                    enum:
+                      - ev
+                      - io-uring
+                numa-aware:
+                    type: boolean
+                    description: |
+                        Splits the worker threads between the NUMA nodes
+                        available to the process and pins them to the CPUs
+                        of their nodes. Idle workers steal tasks from the
+                        workers of their own node before crossing nodes.
+                        Requires `work-stealing-task-queue`, does nothing on
+                        single-node hosts.
+                    defaultDescription: false
                 task-trace:
                     type: object
                     description: .
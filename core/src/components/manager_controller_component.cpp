@@ -15,6 +15,15 @@ USERVER_NAMESPACE_BEGIN
 
 namespace engine {
 
+void DumpMetric(utils::statistics::Writer& writer, const NumaNodeStats& stats) {
+    writer["worker-threads"] = stats.worker_threads;
+    writer["queued"] = stats.queued;
+    if (auto steals = writer["steals"]) {
+        steals["local"] = stats.local_steals;
+        steals["remote"] = stats.remote_steals;
+    }
+}
+
 void DumpMetric(utils::statistics::Writer& writer, const engine::TaskProcessor& task_processor) {
     const auto& counter = task_processor.GetTaskCounter();
 
@@ -48,6 +57,10 @@ void DumpMetric(utils::statistics::Writer& writer, const engine::TaskProcessor&
     }
 
     writer["worker-threads"] = task_processor.GetWorkerCount();
+
+    for (const auto& node_stats : task_processor.GetNumaNodeStats()) {
+        writer["numa-nodes"].ValueWithLabels(node_stats, {{"numa_node", std::to_string(node_stats.node_id)}});
+    }
 }
 
 }  // namespace engine
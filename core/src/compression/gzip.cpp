@@ -1,16 +1,70 @@
 #include <compression/gzip.hpp>
 
+#include <algorithm>
+
 #include <boost/iostreams/filter/gzip.hpp>
 #include <boost/iostreams/filtering_stream.hpp>
 
+#include <zlib.h>
+
+#include <userver/utils/assert.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace compression::gzip {
 
 namespace {
 constexpr auto kDecompressBufferSize = 1024;
+
+// 15 bits of window + 16 for a gzip header and trailer instead of a zlib one
+constexpr int kGzipWindowBits = 15 + 16;
+constexpr int kMemLevel = 8;
+
+// Size of the output buffer extension if deflate ran out of space
+constexpr std::size_t kCompressBufferSize = 4096;
+
+void InitDeflate(z_stream& stream, int level) {
+    const auto res = deflateInit2(&stream, level, Z_DEFLATED, kGzipWindowBits, kMemLevel, Z_DEFAULT_STRATEGY);
+    if (res != Z_OK) {
+        throw CompressionError(stream.msg ? stream.msg : "failed to initialize gzip compression");
+    }
+}
+
+// Feeds the whole `input` into the stream and appends all the produced data
+// to `output`. `flush` must be either Z_SYNC_FLUSH or Z_FINISH, so that
+// deflate consumes everything and leaves nothing in its internal buffers.
+void Deflate(z_stream& stream, std::string_view input, int flush, std::string& output) {
+    UASSERT(flush == Z_SYNC_FLUSH || flush == Z_FINISH);
+
+    // zlib API is not const-correct
+    stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(input.data()));
+    stream.avail_in = static_cast<uInt>(input.size());
+
+    std::size_t output_size = output.size();
+    while (true) {
+        if (output_size == output.size()) {
+            output.resize(output.size() + std::max(kCompressBufferSize, std::size_t{stream.avail_in}));
+        }
+
+        stream.next_out = reinterpret_cast<Bytef*>(output.data() + output_size);
+        stream.avail_out = static_cast<uInt>(output.size() - output_size);
+
+        const auto res = deflate(&stream, flush);
+        output_size = output.size() - stream.avail_out;
+
+        if (res == Z_STREAM_END) break;
+        if (res != Z_OK && res != Z_BUF_ERROR) {
+            throw CompressionError(stream.msg ? stream.msg : "gzip deflate failed");
+        }
+        // Everything is consumed and flushed if deflate did not fill the output
+        if (flush == Z_SYNC_FLUSH && stream.avail_in == 0 && stream.avail_out != 0) break;
+    }
+
+    output.resize(output_size);
 }
 
+}  // namespace
+
 std::string Decompress(std::string_view compressed, size_t max_size) {
     std::string decompressed;
 
@@ -41,6 +95,53 @@ std::string Decompress(std::string_view compressed, size_t max_size) {
     return decompressed;
 }
 
+std::string Compress(std::string_view data, int level) {
+    z_stream stream{};
+    InitDeflate(stream, level);
+
+    std::string compressed;
+    try {
+        compressed.reserve(deflateBound(&stream, data.size()));
+        Deflate(stream, data, Z_FINISH, compressed);
+    } catch (const std::exception&) {
+        deflateEnd(&stream);
+        throw;
+    }
+
+    deflateEnd(&stream);
+    return compressed;
+}
+
+struct Compressor::Impl final {
+    explicit Impl(int level) { InitDeflate(stream, level); }
+
+    Impl(const Impl&) = delete;
+    Impl& operator=(const Impl&) = delete;
+    ~Impl() { deflateEnd(&stream); }
+
+    z_stream stream{};
+};
+
+Compressor::Compressor(int level) : impl_(std::make_unique<Impl>(level)) {}
+
+Compressor::Compressor(Compressor&&) noexcept = default;
+
+Compressor& Compressor::operator=(Compressor&&) noexcept = default;
+
+Compressor::~Compressor() = default;
+
+std::string Compressor::Flush(std::string_view chunk) { return Compress(chunk, Z_SYNC_FLUSH); }
+
+std::string Compressor::Finish(std::string_view chunk) { return Compress(chunk, Z_FINISH); }
+
+std::string Compressor::Compress(std::string_view chunk, int flush) {
+    UASSERT(impl_);
+    std::string compressed;
+    compressed.reserve(deflateBound(&impl_->stream, chunk.size()));
+    Deflate(impl_->stream, chunk, flush, compressed);
+    return compressed;
+}
+
 }  // namespace compression::gzip
 
 USERVER_NAMESPACE_END
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <memory>
+#include <string>
 #include <string_view>
 
 #include <userver/compression/error.hpp>
@@ -8,10 +10,48 @@ USERVER_NAMESPACE_BEGIN
 
 namespace compression::gzip {
 
+/// Default compression level, favours speed over ratio
+inline constexpr int kDefaultLevel = 6;
+
 /// Decompresses the string.
 /// @throws DecompressionError
 std::string Decompress(std::string_view compressed, size_t max_size);
 
+/// Compresses the string into a gzip member.
+/// @throws CompressionError
+std::string Compress(std::string_view data, int level = kDefaultLevel);
+
+/// @brief Streaming compressor that produces a single gzip member out of
+/// multiple chunks.
+///
+/// Output of each Flush() call is byte aligned (Z_SYNC_FLUSH) and may be
+/// decompressed on the receiving side without waiting for the following chunks.
+class Compressor final {
+public:
+    /// @throws CompressionError
+    explicit Compressor(int level = kDefaultLevel);
+
+    Compressor(Compressor&&) noexcept;
+    Compressor& operator=(Compressor&&) noexcept;
+    ~Compressor();
+
+    /// Compresses the chunk and flushes all the buffered data.
+    /// @throws CompressionError
+    std::string Flush(std::string_view chunk);
+
+    /// Compresses the last chunk and writes the gzip trailer. The compressor
+    /// must not be used after that.
+    /// @throws CompressionError
+    std::string Finish(std::string_view chunk = {});
+
+private:
+    struct Impl;
+
+    std::string Compress(std::string_view chunk, int flush);
+
+    std::unique_ptr<Impl> impl_;
+};
+
 }  // namespace compression::gzip
 
 USERVER_NAMESPACE_END
@@ -28,4 +28,27 @@ TEST(Gzip, TestOverflow) {
     EXPECT_THROW(compression::gzip::Decompress(compressed, big_msg.size() / 2), compression::TooBigError);
 }
 
+TEST(Gzip, CompressRoundTrip) {
+    const std::string msg(16'000, 'a');
+
+    const auto compressed = compression::gzip::Compress(msg);
+    EXPECT_LT(compressed.size(), msg.size());
+    EXPECT_EQ(compression::gzip::Decompress(compressed, msg.size()), msg);
+}
+
+TEST(Gzip, CompressorChunks) {
+    const std::string chunk("This is a \"Very long\" msg!");
+
+    compression::gzip::Compressor compressor;
+    std::string compressed;
+    std::string expected;
+    for (int i = 0; i < 100; ++i) {
+        compressed += compressor.Flush(chunk);
+        expected += chunk;
+    }
+    compressed += compressor.Finish();
+
+    EXPECT_EQ(compression::gzip::Decompress(compressed, expected.size()), expected);
+}
+
 USERVER_NAMESPACE_END
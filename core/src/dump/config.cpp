@@ -18,9 +18,17 @@ constexpr std::string_view kDumpFormatVersion = "format-version";
 constexpr std::string_view kMaxDumpCount = "max-count";
 constexpr std::string_view kWorldReadable = "world-readable";
 constexpr std::string_view kEncrypted = "encrypted";
+constexpr std::string_view kMmap = "mmap";
+constexpr std::string_view kChunked = "chunked";
+constexpr std::string_view kChunkSize = "chunk-size";
+constexpr std::string_view kMaxParallelChunks = "max-parallel-chunks";
+constexpr std::string_view kChunkTaskProcessor = "chunk-task-processor";
 
 constexpr auto kDefaultFsTaskProcessor = std::string_view{"fs-task-processor"};
 constexpr auto kDefaultMaxDumpCount = uint64_t{1};
+constexpr auto kDefaultChunkSize = std::size_t{4 * 1024 * 1024};
+constexpr auto kDefaultMaxParallelChunks = std::size_t{4};
+constexpr auto kDefaultChunkTaskProcessor = std::string_view{"main-task-processor"};
 
 }  // namespace
 
@@ -61,11 +69,28 @@ Config::Config(std::string name, const yaml_config::YamlConfig& config, std::str
       max_dump_age(config[kMaxDumpAge].As<std::optional<std::chrono::milliseconds>>()),
       max_dump_age_set(config.HasMember(kMaxDumpAge)),
       dump_is_encrypted(config[kEncrypted].As<bool>(false)),
+      dump_is_mapped(config[kMmap].As<bool>(false)),
+      dump_is_chunked(config[kChunked].As<bool>(false)),
+      chunk_size(config[kChunkSize].As<std::size_t>(kDefaultChunkSize)),
+      max_parallel_chunks(config[kMaxParallelChunks].As<std::size_t>(kDefaultMaxParallelChunks)),
+      chunk_task_processor(config[kChunkTaskProcessor].As<std::string>(kDefaultChunkTaskProcessor)),
       static_dumps_enabled(config[kDumpsEnabled].As<bool>()),
       static_min_dump_interval(config[kMinDumpInterval].As<std::chrono::milliseconds>(0)) {
     if (max_dump_age && *max_dump_age <= std::chrono::milliseconds::zero()) {
         throw std::logic_error(fmt::format("{}: {} must be positive", this->name, kMaxDumpAge));
     }
+    if (dump_is_encrypted && dump_is_mapped) {
+        throw std::logic_error(fmt::format("{}: {} and {} are mutually exclusive", this->name, kEncrypted, kMmap));
+    }
+    if (dump_is_chunked && dump_is_mapped) {
+        throw std::logic_error(fmt::format("{}: {} and {} are mutually exclusive", this->name, kChunked, kMmap));
+    }
+    if (chunk_size == 0) {
+        throw std::logic_error(fmt::format("{}: {} must not be 0", this->name, kChunkSize));
+    }
+    if (max_parallel_chunks == 0) {
+        throw std::logic_error(fmt::format("{}: {} must not be 0", this->name, kMaxParallelChunks));
+    }
     if (max_dump_count == 0) {
         throw std::logic_error(fmt::format("{}: {} must not be 0", this->name, kMaxDumpCount));
     }
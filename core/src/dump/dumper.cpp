@@ -564,6 +564,28 @@ properties:
                 type: boolean
                 description: Whether to encrypt the dump
                 defaultDescription: false
+            mmap:
+                type: boolean
+                description: Whether to memory-map the dump on reading, so that `dump::FlatArray` values are used in place
+                defaultDescription: false
+            chunked:
+                type: boolean
+                description: Whether to split the dump into chunks, that are compressed and encrypted in parallel
+                defaultDescription: false
+            chunk-size:
+                type: integer
+                description: Size of the uncompressed data of a chunk in bytes
+                defaultDescription: 4194304
+                minimum: 1
+            max-parallel-chunks:
+                type: integer
+                description: Max number of chunks that are processed at once
+                defaultDescription: 4
+                minimum: 1
+            chunk-task-processor:
+                type: string
+                description: "`TaskProcessor` for the compression and encryption of chunks"
+                defaultDescription: main-task-processor
 )");
 }
 
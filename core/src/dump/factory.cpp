@@ -1,8 +1,10 @@
 #include <userver/dump/factory.hpp>
 
 #include <dump/secdist.hpp>
+#include <userver/dump/operations_chunked.hpp>
 #include <userver/dump/operations_encrypted.hpp>
 #include <userver/dump/operations_file.hpp>
+#include <userver/engine/task/task_base.hpp>
 #include <userver/storages/secdist/component.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -19,24 +21,45 @@ boost::filesystem::perms GetPerms(const Config& config) {
         return perms::owner_read;
 }
 
+ChunkedOptions GetChunkedOptions(const Config& config) {
+    ChunkedOptions options;
+    options.chunk_size = config.chunk_size;
+    options.max_parallel_chunks = config.max_parallel_chunks;
+    return options;
+}
+
 }  // namespace
 
 std::unique_ptr<dump::OperationsFactory>
 CreateOperationsFactory(const Config& config, const components::ComponentContext& context) {
     auto dump_perms = GetPerms(config);
 
-    if (config.dump_is_encrypted) {
+    if (config.dump_is_chunked) {
+        auto options = GetChunkedOptions(config);
+        if (config.dump_is_encrypted) {
+            const auto& secdist = context.FindComponent<components::Secdist>().Get();
+            options.secret_key = secdist.Get<dump::Secdist>().GetSecretKey(config.name);
+        }
+        return std::make_unique<dump::ChunkedOperationsFactory>(
+            dump_perms, context.GetTaskProcessor(config.chunk_task_processor), std::move(options)
+        );
+    } else if (config.dump_is_encrypted) {
         const auto& secdist = context.FindComponent<components::Secdist>().Get();
         auto secret_key = secdist.Get<dump::Secdist>().GetSecretKey(config.name);
         return std::make_unique<dump::EncryptedOperationsFactory>(std::move(secret_key), dump_perms);
     } else {
-        return std::make_unique<dump::FileOperationsFactory>(dump_perms);
+        return std::make_unique<dump::FileOperationsFactory>(dump_perms, config.dump_is_mapped);
     }
 }
 
 std::unique_ptr<dump::OperationsFactory> CreateDefaultOperationsFactory(const Config& config) {
     auto dump_perms = GetPerms(config);
-    return std::make_unique<dump::FileOperationsFactory>(dump_perms);
+    if (config.dump_is_chunked) {
+        return std::make_unique<dump::ChunkedOperationsFactory>(
+            dump_perms, engine::current_task::GetTaskProcessor(), GetChunkedOptions(config)
+        );
+    }
+    return std::make_unique<dump::FileOperationsFactory>(dump_perms, config.dump_is_mapped);
 }
 
 }  // namespace dump
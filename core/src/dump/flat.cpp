@@ -0,0 +1,96 @@
+#include <userver/dump/flat.hpp>
+
+#include <fmt/format.h>
+
+#include <userver/dump/common.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dump::impl {
+
+namespace {
+
+// MurmurHash64A, processes 8 bytes per step, so that validating multi-GB
+// dumps does not take longer than reading them from disk.
+std::uint64_t ComputeChecksum(std::string_view data) noexcept {
+    constexpr std::uint64_t kMul = 0xc6a4a7935bd1e995ULL;
+    constexpr int kShift = 47;
+
+    std::uint64_t hash = data.size() * kMul;
+
+    const auto* position = data.data();
+    const auto* const words_end = position + (data.size() / 8) * 8;
+    for (; position != words_end; position += 8) {
+        std::uint64_t word{};
+        std::memcpy(&word, position, sizeof(word));
+        word *= kMul;
+        word ^= word >> kShift;
+        word *= kMul;
+        hash ^= word;
+        hash *= kMul;
+    }
+
+    const auto tail_size = data.size() % 8;
+    if (tail_size != 0) {
+        std::uint64_t tail{};
+        std::memcpy(&tail, position, tail_size);
+        hash ^= tail;
+        hash *= kMul;
+    }
+
+    hash ^= hash >> kShift;
+    hash *= kMul;
+    hash ^= hash >> kShift;
+    return hash;
+}
+
+}  // namespace
+
+// Block layout: element size, data size, checksum, padding size, padding, data.
+// The padding aligns the data relative to the beginning of the dump, so that
+// a memory-mapped dump can be used in place.
+void WriteFlatBlock(Writer& writer, std::string_view data, std::size_t element_size, std::size_t alignment) {
+    writer.Write(element_size);
+    writer.Write(data.size());
+    writer.Write(ComputeChecksum(data));
+
+    // The padding size is written as a single byte
+    UASSERT(alignment < 128);
+    const auto padding = (alignment - (writer.written_size_ + 1) % alignment) % alignment;
+    writer.Write(padding);
+    WriteStringViewUnsafe(writer, std::string(padding, '\0'));
+    UASSERT(writer.written_size_ % alignment == 0);
+
+    WriteStringViewUnsafe(writer, data);
+}
+
+FlatBlock ReadFlatBlock(Reader& reader, std::size_t element_size, std::size_t alignment) {
+    const auto stored_element_size = reader.Read<std::size_t>();
+    if (stored_element_size != element_size) {
+        throw Error(fmt::format(
+            "Flat array element size mismatch: expected={}, actual={}. Bump the dump format-version after changing "
+            "the layout of the elements",
+            element_size,
+            stored_element_size
+        ));
+    }
+
+    const auto size = reader.Read<std::size_t>();
+    if (size % element_size != 0) {
+        throw Error(fmt::format("Flat array size {} is not a multiple of the element size {}", size, element_size));
+    }
+    const auto checksum = reader.Read<std::uint64_t>();
+    const auto padding = reader.Read<std::size_t>();
+    ReadStringViewUnsafe(reader, padding);
+    UASSERT(reader.read_size_ % alignment == 0);
+
+    FlatBlock block{ReadStringViewUnsafe(reader, size), reader.GetRawMemoryOwner()};
+    if (ComputeChecksum(block.data) != checksum) {
+        throw Error(fmt::format("Flat array checksum mismatch, size={}", size));
+    }
+    return block;
+}
+
+}  // namespace dump::impl
+
+USERVER_NAMESPACE_END
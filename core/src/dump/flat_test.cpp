@@ -0,0 +1,98 @@
+#include <userver/dump/flat.hpp>
+
+#include <string>
+#include <vector>
+
+#include <userver/dump/common.hpp>
+#include <userver/dump/operations_file.hpp>
+#include <userver/dump/test_helpers.hpp>
+#include <userver/fs/blocking/temp_directory.hpp>
+#include <userver/tracing/span.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+struct Entry final {
+    std::uint64_t key;
+    std::uint32_t value;
+    char tag;
+};
+
+bool operator==(const Entry& lhs, const Entry& rhs) {
+    return lhs.key == rhs.key && lhs.value == rhs.value && lhs.tag == rhs.tag;
+}
+
+std::vector<Entry> MakeEntries(std::size_t count) {
+    std::vector<Entry> entries;
+    for (std::size_t i = 0; i < count; ++i) {
+        entries.push_back({i * 7, static_cast<std::uint32_t>(i), static_cast<char>('a' + i % 26)});
+    }
+    return entries;
+}
+
+template <typename T>
+std::vector<T> ToVector(const dump::FlatArray<T>& array) {
+    return {array.begin(), array.end()};
+}
+
+}  // namespace
+
+TEST(DumpFlatArray, WriteReadCycle) {
+    const dump::FlatArray<Entry> original{MakeEntries(1000)};
+
+    const auto after_cycle = dump::FromBinary<dump::FlatArray<Entry>>(dump::ToBinary(original));
+    EXPECT_FALSE(after_cycle.IsMapped());
+    EXPECT_EQ(ToVector(after_cycle), ToVector(original));
+}
+
+TEST(DumpFlatArray, Empty) {
+    const auto after_cycle = dump::FromBinary<dump::FlatArray<int>>(dump::ToBinary(dump::FlatArray<int>{}));
+    EXPECT_TRUE(after_cycle.empty());
+}
+
+TEST(DumpFlatArray, ChecksumMismatch) {
+    auto binary = dump::ToBinary(dump::FlatArray<Entry>{MakeEntries(10)});
+    binary[binary.size() - 1] ^= 1;
+    UEXPECT_THROW(dump::FromBinary<dump::FlatArray<Entry>>(std::move(binary)), dump::Error);
+}
+
+TEST(DumpFlatArray, ElementSizeMismatch) {
+    const auto binary = dump::ToBinary(dump::FlatArray<std::uint32_t>{std::vector<std::uint32_t>{1, 2, 3, 4}});
+    UEXPECT_THROW(dump::FromBinary<dump::FlatArray<std::uint64_t>>(binary), dump::Error);
+}
+
+UTEST(DumpFlatArray, MmapInPlace) {
+    const auto dir = fs::blocking::TempDirectory::Create();
+    const auto path = dir.GetPath() + "/dump";
+    const auto entries = MakeEntries(1000);
+    const std::string pool = "string pool";
+
+    {
+        auto scope_time = tracing::Span::CurrentSpan().CreateScopeTime("dump");
+        dump::FileWriter writer(path, boost::filesystem::perms::owner_read, scope_time);
+        // Misaligns the following blocks
+        writer.Write(std::string{"odd"});
+        writer.Write(dump::FlatArray<Entry>{std::vector<Entry>{entries}});
+        dump::WriteFlat(writer, utils::span<const char>{pool.data(), pool.size()});
+        writer.Finish();
+    }
+
+    dump::FlatArray<Entry> read_entries;
+    dump::FlatArray<char> read_pool;
+    {
+        dump::MmapFileReader reader(path);
+        EXPECT_EQ(reader.Read<std::string>(), "odd");
+        read_entries = reader.Read<dump::FlatArray<Entry>>();
+        read_pool = reader.Read<dump::FlatArray<char>>();
+        reader.Finish();
+    }
+
+    // The mapping outlives the reader
+    EXPECT_TRUE(read_entries.IsMapped());
+    EXPECT_EQ(ToVector(read_entries), entries);
+    EXPECT_EQ(std::string(read_pool.begin(), read_pool.end()), pool);
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,348 @@
+#include <userver/dump/operations_chunked.hpp>
+
+#include <cstdint>
+#include <deque>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include <cryptopp/filters.h>
+#include <cryptopp/gcm.h>
+
+#include <userver/compression/zstd.hpp>
+#include <userver/crypto/random.hpp>
+#include <userver/dump/common.hpp>
+#include <userver/dump/operations_file.hpp>
+#include <userver/dump/unsafe.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dump {
+
+namespace {
+
+// File layout:
+//   magic, is-encrypted flag, random dump id if encrypted,
+//   for each chunk: uncompressed size (non-zero), size-prefixed payload,
+//   zero uncompressed size and the payload of an empty terminator chunk.
+// The payload is the zstd frame of the chunk, prefixed with IV and encrypted
+// if the dump is encrypted. The dump id, the index of the chunk, its size and
+// whether it is the terminator are authenticated as the associated data, so
+// that reordered, dropped or truncated chunks are detected.
+constexpr std::string_view kMagic = "userver-chunked-dump\x02";
+
+using Encryption = ::CryptoPP::GCM<::CryptoPP::AES>::Encryption;
+using Decryption = ::CryptoPP::GCM<::CryptoPP::AES>::Decryption;
+
+constexpr std::size_t kIvSize = ::CryptoPP::AES::BLOCKSIZE;
+constexpr std::size_t kDumpIdSize = 16;
+
+const ::CryptoPP::byte* GetBytes(std::string_view data) {
+    return reinterpret_cast<const ::CryptoPP::byte*>(data.data());
+}
+
+struct EncodedChunk final {
+    std::size_t raw_size{0};
+    std::string payload;
+};
+
+// The position of a chunk in the dump
+struct ChunkPosition final {
+    std::string_view dump_id;
+    std::uint64_t index{0};
+    bool is_last{false};
+};
+
+void AppendLittleEndian(std::string& out, std::uint64_t value) {
+    for (int i = 0; i < 8; ++i) {
+        out.push_back(static_cast<char>((value >> (i * 8)) & 0xff));
+    }
+}
+
+std::string MakeAssociatedData(const ChunkPosition& position, std::size_t raw_size) {
+    std::string data{position.dump_id};
+    AppendLittleEndian(data, position.index);
+    AppendLittleEndian(data, raw_size);
+    data.push_back(position.is_last ? '\x01' : '\x00');
+    return data;
+}
+
+EncodedChunk EncodeChunk(const std::string& raw, const ChunkedOptions& options, const ChunkPosition& position) {
+    EncodedChunk chunk{raw.size(), {}};
+    try {
+        auto compressed = compression::zstd::Compress(raw, options.compression_level);
+        if (!options.secret_key) {
+            chunk.payload = std::move(compressed);
+            return chunk;
+        }
+
+        const auto& key = options.secret_key->GetUnderlying();
+        chunk.payload = crypto::GenerateRandomBlock(kIvSize);
+        Encryption encryption;
+        encryption.SetKeyWithIV(GetBytes(key), key.size(), GetBytes(chunk.payload), kIvSize);
+
+        const auto associated_data = MakeAssociatedData(position, chunk.raw_size);
+        ::CryptoPP::AuthenticatedEncryptionFilter filter(encryption, new ::CryptoPP::StringSink(chunk.payload));
+        filter.ChannelPut(::CryptoPP::AAD_CHANNEL, GetBytes(associated_data), associated_data.size());
+        filter.ChannelMessageEnd(::CryptoPP::AAD_CHANNEL);
+        filter.ChannelPut(::CryptoPP::DEFAULT_CHANNEL, GetBytes(compressed), compressed.size());
+        filter.ChannelMessageEnd(::CryptoPP::DEFAULT_CHANNEL);
+    } catch (const std::exception& ex) {
+        throw Error(fmt::format("Failed to encode a dump chunk: {}", ex.what()));
+    }
+    return chunk;
+}
+
+std::string DecodeChunk(const EncodedChunk& chunk, const ChunkedOptions& options, const ChunkPosition& position) {
+    std::string raw;
+    try {
+        std::string_view compressed = chunk.payload;
+        std::string decrypted;
+        if (options.secret_key) {
+            if (compressed.size() < kIvSize) throw std::runtime_error("the chunk is too small to contain IV");
+
+            const auto& key = options.secret_key->GetUnderlying();
+            Decryption decryption;
+            decryption.SetKeyWithIV(GetBytes(key), key.size(), GetBytes(compressed), kIvSize);
+            compressed.remove_prefix(kIvSize);
+
+            const auto associated_data = MakeAssociatedData(position, chunk.raw_size);
+            ::CryptoPP::AuthenticatedDecryptionFilter filter(decryption, new ::CryptoPP::StringSink(decrypted));
+            filter.ChannelPut(::CryptoPP::AAD_CHANNEL, GetBytes(associated_data), associated_data.size());
+            filter.ChannelPut(::CryptoPP::DEFAULT_CHANNEL, GetBytes(compressed), compressed.size());
+            filter.ChannelMessageEnd(::CryptoPP::AAD_CHANNEL);
+            filter.ChannelMessageEnd(::CryptoPP::DEFAULT_CHANNEL);
+            compressed = decrypted;
+        }
+        raw = compression::zstd::Decompress(compressed, chunk.raw_size);
+    } catch (const std::exception& ex) {
+        throw Error(fmt::format("Failed to decode the dump chunk #{}: {}", position.index, ex.what()));
+    }
+
+    if (raw.size() != chunk.raw_size) {
+        throw Error(fmt::format(
+            "Unexpected size of a decoded dump chunk: expected-size={}, actual-size={}", chunk.raw_size, raw.size()
+        ));
+    }
+    return raw;
+}
+
+}  // namespace
+
+struct ChunkedWriter::Impl {
+    Impl(
+        std::string&& path,
+        boost::filesystem::perms perms,
+        tracing::ScopeTime& scope,
+        engine::TaskProcessor& task_processor,
+        const ChunkedOptions& options
+    )
+        : file(std::move(path), perms, scope), task_processor(task_processor), options(options) {
+        UINVARIANT(options.chunk_size != 0, "chunk_size must be positive");
+        UINVARIANT(options.max_parallel_chunks != 0, "max_parallel_chunks must be positive");
+        buffer.reserve(options.chunk_size);
+    }
+
+    void SubmitChunk() {
+        if (in_flight.size() >= options.max_parallel_chunks) WriteFrontChunk();
+
+        in_flight.push_back(engine::AsyncNoSpan(
+            task_processor,
+            [this, position = ChunkPosition{dump_id, next_index, false}](std::string raw) {
+                return EncodeChunk(raw, options, position);
+            },
+            std::move(buffer)
+        ));
+        ++next_index;
+        buffer = {};
+        buffer.reserve(options.chunk_size);
+    }
+
+    void WriteTerminator() {
+        const auto chunk = EncodeChunk({}, options, ChunkPosition{dump_id, next_index, true});
+        file.Write(chunk.raw_size);
+        file.Write(chunk.payload);
+    }
+
+    void WriteFrontChunk() {
+        const auto chunk = in_flight.front().Get();
+        in_flight.pop_front();
+        file.Write(chunk.raw_size);
+        file.Write(chunk.payload);
+    }
+
+    FileWriter file;
+    engine::TaskProcessor& task_processor;
+    const ChunkedOptions options;
+    const std::string dump_id{options.secret_key ? crypto::GenerateRandomBlock(kDumpIdSize) : std::string{}};
+    std::uint64_t next_index{0};
+    std::string buffer;
+    // Must be destroyed before `options` and `dump_id`
+    std::deque<engine::TaskWithResult<EncodedChunk>> in_flight;
+};
+
+ChunkedWriter::ChunkedWriter(
+    std::string path,
+    boost::filesystem::perms perms,
+    tracing::ScopeTime& scope,
+    engine::TaskProcessor& task_processor,
+    const ChunkedOptions& options
+)
+    : impl_(std::make_unique<Impl>(std::move(path), perms, scope, task_processor, options)) {
+    WriteStringViewUnsafe(impl_->file, kMagic);
+    impl_->file.Write(impl_->options.secret_key.has_value());
+    if (impl_->options.secret_key) WriteStringViewUnsafe(impl_->file, impl_->dump_id);
+}
+
+ChunkedWriter::~ChunkedWriter() = default;
+
+void ChunkedWriter::WriteRaw(std::string_view data) {
+    auto& buffer = impl_->buffer;
+    while (!data.empty()) {
+        const auto part = data.substr(0, impl_->options.chunk_size - buffer.size());
+        buffer.append(part);
+        data.remove_prefix(part.size());
+        if (buffer.size() == impl_->options.chunk_size) impl_->SubmitChunk();
+    }
+}
+
+void ChunkedWriter::Finish() {
+    if (!impl_->buffer.empty()) impl_->SubmitChunk();
+    while (!impl_->in_flight.empty()) impl_->WriteFrontChunk();
+
+    impl_->WriteTerminator();
+    impl_->file.Finish();
+}
+
+engine::TaskProcessor* ChunkedWriter::GetTaskProcessor() const noexcept { return &impl_->task_processor; }
+
+struct ChunkedReader::Impl {
+    Impl(std::string&& full_path, engine::TaskProcessor& task_processor, const ChunkedOptions& options)
+        : path(full_path), file(std::move(full_path)), task_processor(task_processor), options(options) {
+        UINVARIANT(options.max_parallel_chunks != 0, "max_parallel_chunks must be positive");
+    }
+
+    void ReadAhead() {
+        while (!is_file_exhausted && in_flight.size() < options.max_parallel_chunks) {
+            EncodedChunk chunk;
+            chunk.raw_size = file.Read<std::size_t>();
+            chunk.payload = file.Read<std::string>();
+            if (chunk.raw_size == 0) {
+                // Authenticates the end of the dump, so that it can't be
+                // truncated at a chunk boundary
+                DecodeChunk(chunk, options, ChunkPosition{dump_id, next_index, true});
+                is_file_exhausted = true;
+                break;
+            }
+
+            in_flight.push_back(engine::AsyncNoSpan(
+                task_processor,
+                [this, position = ChunkPosition{dump_id, next_index, false}](EncodedChunk encoded) {
+                    return DecodeChunk(encoded, options, position);
+                },
+                std::move(chunk)
+            ));
+            ++next_index;
+        }
+    }
+
+    // Returns false on end-of-file
+    bool FetchNextChunk() {
+        ReadAhead();
+        if (in_flight.empty()) return false;
+
+        current = in_flight.front().Get();
+        current_offset = 0;
+        in_flight.pop_front();
+        ReadAhead();
+        return true;
+    }
+
+    std::string_view GetUnread() const noexcept { return std::string_view{current}.substr(current_offset); }
+
+    const std::string path;
+    FileReader file;
+    engine::TaskProcessor& task_processor;
+    const ChunkedOptions options;
+    std::string dump_id;
+    std::uint64_t next_index{0};
+    bool is_file_exhausted{false};
+    std::string current;
+    std::size_t current_offset{0};
+    // Data spanning multiple chunks, that is returned from ReadRaw
+    std::string joined;
+    // Must be destroyed before `options` and `dump_id`
+    std::deque<engine::TaskWithResult<std::string>> in_flight;
+};
+
+ChunkedReader::ChunkedReader(std::string path, engine::TaskProcessor& task_processor, const ChunkedOptions& options)
+    : impl_(std::make_unique<Impl>(std::move(path), task_processor, options)) {
+    if (ReadStringViewUnsafe(impl_->file, kMagic.size()) != kMagic) {
+        throw Error(fmt::format("The dump file \"{}\" is not a chunked dump", impl_->path));
+    }
+
+    const auto is_encrypted = impl_->file.Read<bool>();
+    if (is_encrypted != impl_->options.secret_key.has_value()) {
+        throw Error(fmt::format(
+            "The chunked dump file \"{}\" is {}encrypted, which does not match the config",
+            impl_->path,
+            is_encrypted ? "" : "not "
+        ));
+    }
+    if (is_encrypted) impl_->dump_id = ReadStringViewUnsafe(impl_->file, kDumpIdSize);
+
+    impl_->ReadAhead();
+}
+
+ChunkedReader::~ChunkedReader() = default;
+
+std::string_view ChunkedReader::ReadRaw(std::size_t max_size) {
+    const auto unread = impl_->GetUnread();
+    if (unread.size() >= max_size) {
+        impl_->current_offset += max_size;
+        return unread.substr(0, max_size);
+    }
+
+    auto& joined = impl_->joined;
+    joined.assign(unread);
+    impl_->current_offset += unread.size();
+
+    while (joined.size() < max_size && impl_->FetchNextChunk()) {
+        const auto part = impl_->GetUnread().substr(0, max_size - joined.size());
+        joined.append(part);
+        impl_->current_offset += part.size();
+    }
+    return joined;
+}
+
+void ChunkedReader::Finish() {
+    impl_->ReadAhead();
+    if (!impl_->GetUnread().empty() || !impl_->in_flight.empty() || !impl_->is_file_exhausted) {
+        throw Error(fmt::format("Unexpected extra data at the end of the chunked dump file \"{}\"", impl_->path));
+    }
+    impl_->file.Finish();
+}
+
+engine::TaskProcessor* ChunkedReader::GetTaskProcessor() const noexcept { return &impl_->task_processor; }
+
+ChunkedOperationsFactory::ChunkedOperationsFactory(
+    boost::filesystem::perms perms,
+    engine::TaskProcessor& task_processor,
+    ChunkedOptions&& options
+)
+    : perms_(perms), task_processor_(task_processor), options_(std::move(options)) {}
+
+std::unique_ptr<Reader> ChunkedOperationsFactory::CreateReader(std::string full_path) {
+    return std::make_unique<ChunkedReader>(std::move(full_path), task_processor_, options_);
+}
+
+std::unique_ptr<Writer> ChunkedOperationsFactory::CreateWriter(std::string full_path, tracing::ScopeTime& scope) {
+    return std::make_unique<ChunkedWriter>(std::move(full_path), perms_, scope, task_processor_, options_);
+}
+
+}  // namespace dump
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,230 @@
+#include <userver/utest/utest.hpp>
+
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/filesystem/operations.hpp>
+
+#include <userver/dump/common.hpp>
+#include <userver/dump/common_containers.hpp>
+#include <userver/dump/operations_chunked.hpp>
+#include <userver/dump/operations_file.hpp>
+#include <userver/dump/parts.hpp>
+#include <userver/dump/test_helpers.hpp>
+#include <userver/dump/unsafe.hpp>
+#include <userver/engine/task/task_base.hpp>
+#include <userver/fs/blocking/temp_directory.hpp>
+#include <userver/tracing/span.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+const dump::SecretKey kTestKey{"12345678901234567890123456789012"};
+
+dump::ChunkedOptions MakeOptions(bool encrypted) {
+    dump::ChunkedOptions options;
+    // Tiny chunks, so that the values span chunk boundaries
+    options.chunk_size = 7;
+    options.max_parallel_chunks = 3;
+    if (encrypted) options.secret_key = kTestKey;
+    return options;
+}
+
+void WriteDump(const std::string& path, const dump::ChunkedOptions& options, int count) {
+    auto scope_time = tracing::Span::CurrentSpan().CreateScopeTime("dump");
+    dump::ChunkedWriter writer(
+        path, boost::filesystem::perms::owner_read, scope_time, engine::current_task::GetTaskProcessor(), options
+    );
+    for (int i = 0; i < count; ++i) writer.Write(std::to_string(i));
+    writer.Finish();
+}
+
+void TestWriteReadCycle(bool encrypted) {
+    const auto dir = fs::blocking::TempDirectory::Create();
+    const auto path = dir.GetPath() + "/file";
+    const auto options = MakeOptions(encrypted);
+
+    WriteDump(path, options, 1000);
+
+    dump::ChunkedReader reader(path, engine::current_task::GetTaskProcessor(), options);
+    for (int i = 0; i < 1000; ++i) EXPECT_EQ(reader.Read<std::string>(), std::to_string(i));
+    UEXPECT_THROW(reader.Read<std::string>(), dump::Error);
+    UEXPECT_NO_THROW(reader.Finish());
+}
+
+// magic, is-encrypted flag, dump id
+constexpr std::size_t kMagicSize = 21;
+constexpr std::size_t kDumpIdSize = 16;
+
+struct EncryptedDump final {
+    std::string magic;
+    std::string dump_id;
+    // uncompressed size and payload of each chunk, including the terminator
+    std::vector<std::pair<std::size_t, std::string>> chunks;
+};
+
+EncryptedDump ParseEncryptedDump(const std::string& path) {
+    EncryptedDump dump;
+    dump::FileReader reader(path);
+    dump.magic = std::string{dump::ReadStringViewUnsafe(reader, kMagicSize)};
+    EXPECT_TRUE(reader.Read<bool>());
+    dump.dump_id = std::string{dump::ReadStringViewUnsafe(reader, kDumpIdSize)};
+    while (true) {
+        auto raw_size = reader.Read<std::size_t>();
+        auto payload = reader.Read<std::string>();
+        dump.chunks.emplace_back(raw_size, std::move(payload));
+        if (raw_size == 0) break;
+    }
+    reader.Finish();
+    return dump;
+}
+
+void WriteEncryptedDump(const std::string& path, const EncryptedDump& dump) {
+    auto scope_time = tracing::Span::CurrentSpan().CreateScopeTime("dump");
+    dump::FileWriter writer(path, boost::filesystem::perms::owner_read, scope_time);
+    dump::WriteStringViewUnsafe(writer, dump.magic);
+    writer.Write(true);
+    dump::WriteStringViewUnsafe(writer, dump.dump_id);
+    for (const auto& [raw_size, payload] : dump.chunks) {
+        writer.Write(raw_size);
+        writer.Write(payload);
+    }
+    writer.Finish();
+}
+
+bool IsReadable(const std::string& path, int count) {
+    try {
+        dump::ChunkedReader reader(path, engine::current_task::GetTaskProcessor(), MakeOptions(true));
+        for (int i = 0; i < count; ++i) {
+            if (reader.Read<std::string>() != std::to_string(i)) return false;
+        }
+        reader.Finish();
+        return true;
+    } catch (const dump::Error& /*ex*/) {
+        return false;
+    }
+}
+
+template <typename Tamper>
+void TestTamperedDump(Tamper tamper) {
+    const auto dir = fs::blocking::TempDirectory::Create();
+    const auto path = dir.GetPath() + "/file";
+    const auto tampered_path = dir.GetPath() + "/tampered";
+
+    WriteDump(path, MakeOptions(true), 100);
+    auto dump = ParseEncryptedDump(path);
+    ASSERT_GT(dump.chunks.size(), std::size_t{4});
+
+    // The untouched dump survives the round trip
+    WriteEncryptedDump(tampered_path, dump);
+    ASSERT_TRUE(IsReadable(tampered_path, 100));
+    boost::filesystem::remove(tampered_path);
+
+    tamper(dump.chunks);
+    WriteEncryptedDump(tampered_path, dump);
+    EXPECT_FALSE(IsReadable(tampered_path, 100));
+}
+
+}  // namespace
+
+UTEST_MT(DumpChunkedFile, WriteReadCycle, 4) { TestWriteReadCycle(false); }
+
+UTEST_MT(DumpChunkedFile, WriteReadCycleEncrypted, 4) { TestWriteReadCycle(true); }
+
+UTEST(DumpChunkedFile, Empty) {
+    const auto dir = fs::blocking::TempDirectory::Create();
+    const auto path = dir.GetPath() + "/file";
+    const auto options = MakeOptions(false);
+
+    WriteDump(path, options, 0);
+
+    dump::ChunkedReader reader(path, engine::current_task::GetTaskProcessor(), options);
+    UEXPECT_NO_THROW(reader.Finish());
+}
+
+UTEST(DumpChunkedFile, UnreadData) {
+    const auto dir = fs::blocking::TempDirectory::Create();
+    const auto path = dir.GetPath() + "/file";
+    const auto options = MakeOptions(false);
+
+    WriteDump(path, options, 100);
+
+    dump::ChunkedReader reader(path, engine::current_task::GetTaskProcessor(), options);
+    EXPECT_EQ(reader.Read<std::string>(), "0");
+    UEXPECT_THROW(reader.Finish(), dump::Error);
+}
+
+UTEST(DumpChunkedFile, EncryptionMismatch) {
+    const auto dir = fs::blocking::TempDirectory::Create();
+    const auto path = dir.GetPath() + "/file";
+
+    WriteDump(path, MakeOptions(true), 10);
+
+    UEXPECT_THROW(
+        dump::ChunkedReader(path, engine::current_task::GetTaskProcessor(), MakeOptions(false)), dump::Error
+    );
+}
+
+UTEST(DumpChunkedFile, TamperedTruncated) {
+    // Drops the terminator
+    TestTamperedDump([](auto& chunks) { chunks.pop_back(); });
+}
+
+UTEST(DumpChunkedFile, TamperedTruncatedWithTerminator) {
+    // Moves the terminator to a chunk boundary in the middle of the dump
+    TestTamperedDump([](auto& chunks) { chunks.erase(chunks.begin() + 2, chunks.end() - 1); });
+}
+
+UTEST(DumpChunkedFile, TamperedReordered) {
+    TestTamperedDump([](auto& chunks) { std::swap(chunks[1], chunks[2]); });
+}
+
+UTEST(DumpChunkedFile, TamperedDroppedChunk) {
+    TestTamperedDump([](auto& chunks) { chunks.erase(chunks.begin() + 1); });
+}
+
+UTEST_MT(DumpParts, ChunkedWriteReadCycle, 4) {
+    const auto dir = fs::blocking::TempDirectory::Create();
+    const auto path = dir.GetPath() + "/file";
+    auto options = MakeOptions(false);
+    options.chunk_size = 1024;
+
+    std::map<int, std::string> original;
+    for (int i = 0; i < 1000; ++i) original.emplace(i, std::to_string(i));
+
+    {
+        auto scope_time = tracing::Span::CurrentSpan().CreateScopeTime("dump");
+        dump::ChunkedWriter writer(
+            path, boost::filesystem::perms::owner_read, scope_time, engine::current_task::GetTaskProcessor(), options
+        );
+        dump::WriteInParts(writer, original);
+        writer.Finish();
+    }
+
+    dump::ChunkedReader reader(path, engine::current_task::GetTaskProcessor(), options);
+    EXPECT_EQ((dump::ReadInParts<std::map<int, std::string>>(reader)), original);
+    reader.Finish();
+}
+
+UTEST(DumpParts, Sequential) {
+    const std::vector<int> original{1, 2, 3, 4, 5};
+
+    dump::MockWriter writer;
+    dump::WriteInParts(writer, original, 3);
+    dump::MockReader reader(std::move(writer).Extract());
+    EXPECT_EQ(dump::ReadInParts<std::vector<int>>(reader), original);
+    reader.Finish();
+}
+
+UTEST(DumpParts, Empty) {
+    dump::MockWriter writer;
+    dump::WriteInParts(writer, std::vector<int>{});
+    dump::MockReader reader(std::move(writer).Extract());
+    EXPECT_TRUE(dump::ReadInParts<std::vector<int>>(reader).empty());
+    reader.Finish();
+}
+
+USERVER_NAMESPACE_END
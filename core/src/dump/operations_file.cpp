@@ -1,12 +1,17 @@
 #include <userver/dump/operations_file.hpp>
 
+#include <sys/mman.h>
+
 #include <algorithm>
 #include <stdexcept>
 #include <utility>
 
 #include <fmt/format.h>
 
+#include <userver/fs/blocking/file_descriptor.hpp>
 #include <userver/fs/blocking/write.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/strerror.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -109,9 +114,81 @@ void FileReader::Finish() {
     }
 }
 
-FileOperationsFactory::FileOperationsFactory(boost::filesystem::perms perms) : perms_(perms) {}
+namespace impl {
+
+class MappedFile final {
+public:
+    explicit MappedFile(const std::string& path) {
+        auto fd = fs::blocking::FileDescriptor::Open(path, fs::blocking::OpenFlag::kRead);
+        size_ = fd.GetSize();
+        if (size_ == 0) return;
+
+        void* const data = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd.GetNative(), 0);
+        if (data == MAP_FAILED) {
+            throw std::runtime_error(fmt::format("mmap failed: {}", utils::strerror(errno)));
+        }
+        data_ = static_cast<const char*>(data);
+
+        // The whole dump is going to be read, start the readahead right away.
+        ::madvise(const_cast<char*>(data_), size_, MADV_WILLNEED);
+    }
+
+    MappedFile(MappedFile&&) = delete;
+    MappedFile& operator=(MappedFile&&) = delete;
+
+    ~MappedFile() {
+        if (data_) ::munmap(const_cast<char*>(data_), size_);
+    }
+
+    std::string_view GetData() const noexcept { return {data_, size_}; }
+
+private:
+    const char* data_{nullptr};
+    std::size_t size_{0};
+};
+
+}  // namespace impl
+
+MmapFileReader::MmapFileReader(std::string path) : path_(std::move(path)) {
+    try {
+        file_ = std::make_shared<const impl::MappedFile>(path_);
+    } catch (const std::exception& ex) {
+        throw Error(fmt::format("Failed to map the dump file \"{}\". Reason: {}", path_, ex.what()));
+    }
+    unread_data_ = file_->GetData();
+}
+
+MmapFileReader::~MmapFileReader() = default;
+
+std::string_view MmapFileReader::ReadRaw(std::size_t max_size) {
+    const auto result = unread_data_.substr(0, max_size);
+    unread_data_.remove_prefix(result.size());
+    return result;
+}
+
+std::shared_ptr<const void> MmapFileReader::GetRawMemoryOwner() const { return file_; }
+
+void MmapFileReader::Finish() {
+    if (!unread_data_.empty()) {
+        const auto file_size = file_->GetData().size();
+        throw Error(fmt::format(
+            "Unexpected extra data at the end of the dump file \"{}\": "
+            "file-size={}, position={}, unread-size={}",
+            path_,
+            file_size,
+            file_size - unread_data_.size(),
+            unread_data_.size()
+        ));
+    }
+}
+
+FileOperationsFactory::FileOperationsFactory(boost::filesystem::perms perms, bool use_mmap)
+    : perms_(perms), use_mmap_(use_mmap) {}
 
 std::unique_ptr<Reader> FileOperationsFactory::CreateReader(std::string full_path) {
+    if (use_mmap_) {
+        return std::make_unique<MmapFileReader>(std::move(full_path));
+    }
     return std::make_unique<FileReader>(std::move(full_path));
 }
 
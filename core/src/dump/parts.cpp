@@ -0,0 +1,44 @@
+#include <userver/dump/parts.hpp>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/wait_all_checked.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dump::impl {
+
+void StringWriter::WriteRaw(std::string_view data) { data_.append(data); }
+
+std::string_view StringReader::ReadRaw(std::size_t max_size) {
+    const auto result = unread_data_.substr(0, max_size);
+    unread_data_.remove_prefix(result.size());
+    return result;
+}
+
+void StringReader::Finish() {
+    if (!unread_data_.empty()) {
+        throw Error(fmt::format("Unexpected extra data at the end of a dump part: unread-size={}", unread_data_.size()));
+    }
+}
+
+void RunInParts(
+    engine::TaskProcessor* task_processor,
+    std::size_t parts_count,
+    utils::function_ref<void(std::size_t)> func
+) {
+    if (!task_processor || parts_count == 1) {
+        for (std::size_t i = 0; i < parts_count; ++i) func(i);
+        return;
+    }
+
+    std::vector<engine::TaskWithResult<void>> tasks;
+    tasks.reserve(parts_count);
+    for (std::size_t i = 0; i < parts_count; ++i) {
+        tasks.push_back(engine::AsyncNoSpan(*task_processor, func, i));
+    }
+    engine::WaitAllChecked(tasks);
+}
+
+}  // namespace dump::impl
+
+USERVER_NAMESPACE_END
@@ -9,7 +9,10 @@ USERVER_NAMESPACE_BEGIN
 
 namespace dump {
 
-void WriteStringViewUnsafe(Writer& writer, std::string_view value) { writer.WriteRaw(value); }
+void WriteStringViewUnsafe(Writer& writer, std::string_view value) {
+    writer.WriteRaw(value);
+    writer.written_size_ += value.size();
+}
 
 std::string_view ReadStringViewUnsafe(Reader& reader) {
     const auto size = reader.Read<std::size_t>();
@@ -33,6 +36,7 @@ std::string_view ReadStringViewUnsafe(Reader& reader, std::size_t size) {
 std::string_view ReadUnsafeAtMost(Reader& reader, std::size_t max_size) {
     const auto result = reader.ReadRaw(max_size);
     UASSERT(result.size() <= max_size);
+    reader.read_size_ += result.size();
     return result;
 }
 
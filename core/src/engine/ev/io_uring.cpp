@@ -0,0 +1,345 @@
+#include <engine/ev/io_uring.hpp>
+
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+
+#include <linux/io_uring.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <system_error>
+
+#include <userver/engine/future_status.hpp>
+#include <userver/engine/single_use_event.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/assert.hpp>
+
+#include <utils/check_syscall.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::ev {
+
+namespace {
+
+// Completions of internal requests (e.g. poll removal) do not wake anyone up
+constexpr std::uint64_t kInternalUserData = 0;
+
+int IoUringSetup(unsigned entries, io_uring_params& params) noexcept {
+    return static_cast<int>(::syscall(__NR_io_uring_setup, entries, &params));
+}
+
+int IoUringEnter(int ring_fd, unsigned to_submit, unsigned min_complete, unsigned flags) noexcept {
+    return static_cast<int>(::syscall(__NR_io_uring_enter, ring_fd, to_submit, min_complete, flags, nullptr, 0));
+}
+
+int IoUringRegister(int ring_fd, unsigned opcode, const void* arg, unsigned nr_args) noexcept {
+    return static_cast<int>(::syscall(__NR_io_uring_register, ring_fd, opcode, arg, nr_args));
+}
+
+unsigned LoadAcquire(const unsigned* ptr) noexcept { return __atomic_load_n(ptr, __ATOMIC_ACQUIRE); }
+
+void StoreRelease(unsigned* ptr, unsigned value) noexcept { __atomic_store_n(ptr, value, __ATOMIC_RELEASE); }
+
+template <typename T>
+T* Offset(void* base, std::uint32_t offset) noexcept {
+    return reinterpret_cast<T*>(static_cast<char*>(base) + offset);
+}
+
+void* MapRing(int ring_fd, std::size_t size, off_t offset) {
+    // NOLINTNEXTLINE(hicpp-signed-bitwise)
+    void* ptr = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd, offset);
+    if (ptr == MAP_FAILED) {
+        utils::CheckSyscall(-1, "mapping io_uring ring, offset={}", offset);
+    }
+    return ptr;
+}
+
+struct Operation final {
+    SingleUseEvent completed;
+    std::int32_t result{0};
+};
+
+}  // namespace
+
+struct IoUring::Impl final {
+    explicit Impl(unsigned entries);
+    ~Impl();
+
+    void Cleanup() noexcept;
+
+    // The following functions must be called with submit_mutex locked
+    io_uring_sqe* TryGetSqe() noexcept;
+    void Publish() noexcept;
+    bool SubmitPending() noexcept;
+
+    void SubmitPollRemove(Operation& op);
+
+    int ring_fd{-1};
+    int event_fd{-1};
+
+    void* sq_ring{nullptr};
+    std::size_t sq_ring_size{0};
+    void* cq_ring{nullptr};
+    std::size_t cq_ring_size{0};
+    io_uring_sqe* sqes{nullptr};
+    std::size_t sqes_size{0};
+
+    unsigned* sq_head{nullptr};
+    unsigned* sq_tail{nullptr};
+    unsigned* sq_flags{nullptr};
+    unsigned* sq_array{nullptr};
+    unsigned sq_mask{0};
+    unsigned sq_entries{0};
+    unsigned sqe_tail{0};
+
+    unsigned* cq_head{nullptr};
+    unsigned* cq_tail{nullptr};
+    io_uring_cqe* cqes{nullptr};
+    unsigned cq_mask{0};
+
+    std::mutex submit_mutex;
+};
+
+IoUring::Impl::Impl(unsigned entries) {
+    io_uring_params params{};
+    ring_fd = utils::CheckSyscall(IoUringSetup(entries, params), "setting up io_uring with {} entries", entries);
+
+    try {
+        sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+        cq_ring_size = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        const bool single_mmap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+        if (single_mmap) {
+            sq_ring_size = cq_ring_size = std::max(sq_ring_size, cq_ring_size);
+        }
+
+        sq_ring = MapRing(ring_fd, sq_ring_size, IORING_OFF_SQ_RING);
+        if (single_mmap) {
+            cq_ring = sq_ring;
+        } else {
+            cq_ring = MapRing(ring_fd, cq_ring_size, IORING_OFF_CQ_RING);
+        }
+        sqes_size = params.sq_entries * sizeof(io_uring_sqe);
+        sqes = static_cast<io_uring_sqe*>(MapRing(ring_fd, sqes_size, IORING_OFF_SQES));
+
+        sq_head = Offset<unsigned>(sq_ring, params.sq_off.head);
+        sq_tail = Offset<unsigned>(sq_ring, params.sq_off.tail);
+        sq_flags = Offset<unsigned>(sq_ring, params.sq_off.flags);
+        sq_array = Offset<unsigned>(sq_ring, params.sq_off.array);
+        sq_mask = *Offset<unsigned>(sq_ring, params.sq_off.ring_mask);
+        sq_entries = params.sq_entries;
+        sqe_tail = *sq_tail;
+
+        cq_head = Offset<unsigned>(cq_ring, params.cq_off.head);
+        cq_tail = Offset<unsigned>(cq_ring, params.cq_off.tail);
+        cqes = Offset<io_uring_cqe>(cq_ring, params.cq_off.cqes);
+        cq_mask = *Offset<unsigned>(cq_ring, params.cq_off.ring_mask);
+
+        // NOLINTNEXTLINE(hicpp-signed-bitwise)
+        event_fd = utils::CheckSyscall(::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC), "creating eventfd for io_uring");
+        utils::CheckSyscall(
+            IoUringRegister(ring_fd, IORING_REGISTER_EVENTFD, &event_fd, 1), "registering eventfd in io_uring"
+        );
+    } catch (const std::exception&) {
+        Cleanup();
+        throw;
+    }
+}
+
+IoUring::Impl::~Impl() { Cleanup(); }
+
+void IoUring::Impl::Cleanup() noexcept {
+    if (sqes) ::munmap(sqes, sqes_size);
+    if (cq_ring && cq_ring != sq_ring) ::munmap(cq_ring, cq_ring_size);
+    if (sq_ring) ::munmap(sq_ring, sq_ring_size);
+    if (event_fd != -1) ::close(event_fd);
+    if (ring_fd != -1) ::close(ring_fd);
+
+    sqes = nullptr;
+    cq_ring = sq_ring = nullptr;
+    event_fd = ring_fd = -1;
+}
+
+io_uring_sqe* IoUring::Impl::TryGetSqe() noexcept {
+    if (sqe_tail - LoadAcquire(sq_head) >= sq_entries) {
+        return nullptr;
+    }
+
+    auto* sqe = &sqes[sqe_tail & sq_mask];
+    std::memset(sqe, 0, sizeof(*sqe));
+    return sqe;
+}
+
+void IoUring::Impl::Publish() noexcept {
+    const auto index = sqe_tail & sq_mask;
+    sq_array[index] = index;
+    ++sqe_tail;
+    StoreRelease(sq_tail, sqe_tail);
+}
+
+bool IoUring::Impl::SubmitPending() noexcept {
+    while (true) {
+        const auto to_submit = sqe_tail - LoadAcquire(sq_head);
+        if (to_submit == 0) return true;
+
+        const auto res = IoUringEnter(ring_fd, to_submit, 0, 0);
+        if (res > 0) continue;
+        if (res == -1 && errno == EINTR) continue;
+
+        // EAGAIN/EBUSY: the entries stay in the ring and are submitted by the
+        // next submitter or by ReapCompletions().
+        return false;
+    }
+}
+
+void IoUring::Impl::SubmitPollRemove(Operation& op) {
+    while (true) {
+        {
+            std::lock_guard lock(submit_mutex);
+            auto* sqe = TryGetSqe();
+            if (!sqe) {
+                SubmitPending();
+                sqe = TryGetSqe();
+            }
+
+            if (sqe) {
+                sqe->opcode = IORING_OP_POLL_REMOVE;
+                sqe->fd = -1;
+                sqe->addr = reinterpret_cast<std::uint64_t>(&op);
+                sqe->user_data = kInternalUserData;
+                Publish();
+                SubmitPending();
+                return;
+            }
+        }
+
+        // Submission queue is overflown, let the ev thread drain it
+        engine::Yield();
+    }
+}
+
+IoUring::IoUring(unsigned entries) : impl_(std::make_unique<Impl>(entries)) {}
+
+IoUring::~IoUring() = default;
+
+bool IoUring::IsSupported() noexcept {
+    static const bool is_supported = [] {
+        io_uring_params params{};
+        const auto ring_fd = IoUringSetup(1, params);
+        if (ring_fd == -1) {
+            return false;
+        }
+        ::close(ring_fd);
+        // IORING_FEAT_NODROP guarantees that completions are never lost on CQ
+        // overflow, we rely on that.
+        return (params.features & IORING_FEAT_NODROP) != 0;
+    }();
+    return is_supported;
+}
+
+int IoUring::GetEventFd() const noexcept { return impl_->event_fd; }
+
+std::optional<bool> IoUring::PollOnce(int fd, short poll_events, Deadline deadline) {
+    Operation op;
+
+    {
+        std::lock_guard lock(impl_->submit_mutex);
+        auto* sqe = impl_->TryGetSqe();
+        if (!sqe) {
+            return std::nullopt;
+        }
+
+        sqe->opcode = IORING_OP_POLL_ADD;
+        sqe->fd = fd;
+        sqe->poll_events = static_cast<std::uint16_t>(poll_events);
+        sqe->user_data = reinterpret_cast<std::uint64_t>(&op);
+        impl_->Publish();
+        impl_->SubmitPending();
+    }
+
+    if (op.completed.WaitUntil(deadline) != FutureStatus::kReady) {
+        // The kernel still references `op`, we have to wait for its completion
+        impl_->SubmitPollRemove(op);
+        op.completed.WaitNonCancellable();
+        if (op.result <= 0) {
+            return false;
+        }
+    }
+
+    if (op.result < 0) {
+        LOG_LIMITED_WARNING() << "io_uring poll failed for fd=" << fd << ": "
+                              << std::error_code(-op.result, std::system_category()).message();
+        return std::nullopt;
+    }
+    return true;
+}
+
+void IoUring::ReapCompletions() noexcept {
+    std::uint64_t counter = 0;
+    [[maybe_unused]] const auto read_res = ::read(impl_->event_fd, &counter, sizeof(counter));
+
+    while (true) {
+        auto head = *impl_->cq_head;
+        const auto tail = LoadAcquire(impl_->cq_tail);
+        for (; head != tail; ++head) {
+            const auto& cqe = impl_->cqes[head & impl_->cq_mask];
+            if (cqe.user_data == kInternalUserData) continue;
+
+            // NOLINTNEXTLINE(performance-no-int-to-ptr)
+            auto& op = *reinterpret_cast<Operation*>(cqe.user_data);
+            op.result = cqe.res;
+            // `op` may be destroyed right after Send()
+            op.completed.Send();
+        }
+        StoreRelease(impl_->cq_head, head);
+
+        if ((LoadAcquire(impl_->sq_flags) & IORING_SQ_CQ_OVERFLOW) == 0) {
+            break;
+        }
+        // Completions were stashed in the overflow list, flush them into CQ
+        IoUringEnter(impl_->ring_fd, 0, 0, IORING_ENTER_GETEVENTS);
+    }
+
+    std::lock_guard lock(impl_->submit_mutex);
+    impl_->SubmitPending();
+}
+
+}  // namespace engine::ev
+
+USERVER_NAMESPACE_END
+
+#else
+
+#include <stdexcept>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::ev {
+
+struct IoUring::Impl final {};
+
+IoUring::IoUring(unsigned) { throw std::runtime_error("io_uring is not supported on this platform"); }
+
+IoUring::~IoUring() = default;
+
+bool IoUring::IsSupported() noexcept { return false; }
+
+int IoUring::GetEventFd() const noexcept { return -1; }
+
+std::optional<bool> IoUring::PollOnce(int, short, Deadline) { return std::nullopt; }
+
+void IoUring::ReapCompletions() noexcept {}
+
+}  // namespace engine::ev
+
+USERVER_NAMESPACE_END
+
+#endif
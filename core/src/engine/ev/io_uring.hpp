@@ -0,0 +1,55 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+
+#include <userver/engine/deadline.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::ev {
+
+/// An io_uring instance bound to an ev thread.
+///
+/// Coroutines submit operations directly into the submission queue without
+/// waking up the ev thread. Completions are signalled via an eventfd that is
+/// watched by the bound ev loop, which reaps them and wakes up the waiters.
+///
+/// Falls back gracefully (see IsSupported) on kernels without io_uring or
+/// in environments where it is forbidden by seccomp policies.
+class IoUring final {
+public:
+    explicit IoUring(unsigned entries);
+
+    IoUring(const IoUring&) = delete;
+    IoUring& operator=(const IoUring&) = delete;
+    ~IoUring();
+
+    /// @returns whether io_uring may be set up in the current environment
+    static bool IsSupported() noexcept;
+
+    /// @returns eventfd that becomes readable when completions are available
+    int GetEventFd() const noexcept;
+
+    /// @brief Waits until `poll_events` (POLLIN, POLLOUT) happen on `fd`.
+    ///
+    /// The readiness wait is submitted from the calling coroutine, no ev thread
+    /// round trip and no epoll_ctl is required.
+    ///
+    /// @returns std::nullopt if io_uring was unable to serve the request and
+    /// the caller should fall back to the ev poller, otherwise whether the fd
+    /// became ready before the deadline expired or the task was cancelled.
+    std::optional<bool> PollOnce(int fd, short poll_events, Deadline deadline);
+
+    /// Reaps completions and wakes up the waiters. Must be called from the
+    /// bound ev thread only.
+    void ReapCompletions() noexcept;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace engine::ev
+
+USERVER_NAMESPACE_END
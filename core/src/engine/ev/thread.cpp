@@ -10,6 +10,8 @@
 #include <userver/utils/datetime/steady_coarse_clock.hpp>
 #include <userver/utils/thread_name.hpp>
 
+#include <engine/ev/io_uring.hpp>
+#include <engine/ev/thread_control.hpp>
 #include <utils/check_syscall.hpp>
 #include <utils/statistics/thread_statistics.hpp>
 
@@ -20,6 +22,10 @@ namespace {
 
 constexpr std::chrono::milliseconds kCpuStatsCollectInterval{1000};
 
+// Only bounds the amount of not yet submitted requests, in-flight requests are
+// limited by the CQ size, which is twice as large.
+constexpr unsigned kIoUringEntries = 1024;
+
 const auto kDeferredInterval = kMinDurationToDefer - utils::datetime::SteadyCoarseClock::resolution();
 
 // Check the time at least twice per collect interval
@@ -83,6 +89,36 @@ std::uint8_t Thread::GetCurrentLoadPercent() const { return cpu_stats_storage_.G
 
 const std::string& Thread::GetName() const { return name_; }
 
+IoUring* Thread::GetIoUring() {
+    std::call_once(io_uring_init_flag_, [this] { InitIoUring(); });
+    return io_uring_.get();
+}
+
+void Thread::InitIoUring() {
+    if (!IoUring::IsSupported()) {
+        LOG_WARNING() << "io_uring is not supported by the kernel or is forbidden, "
+                         "falling back to the ev backend for ev thread "
+                      << name_;
+        return;
+    }
+
+    std::unique_ptr<IoUring> io_uring;
+    try {
+        io_uring = std::make_unique<IoUring>(kIoUringEntries);
+    } catch (const std::exception& ex) {
+        LOG_WARNING() << "Failed to set up io_uring, falling back to the ev backend for ev thread " << name_ << ": "
+                      << ex;
+        return;
+    }
+
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
+    ev_io_init(&watch_io_uring_, IoUringWatcher, io_uring->GetEventFd(), EV_READ);
+    watch_io_uring_.data = io_uring.get();
+    ThreadControl{*this}.RunInEvLoopBlocking([this] { ev_io_start(GetEvLoop(), &watch_io_uring_); });
+
+    io_uring_ = std::move(io_uring);
+}
+
 void Thread::Start() {
     auto* loop = GetEvLoop();
 
@@ -137,6 +173,7 @@ void Thread::RunEvLoop() {
     ev_async_stop(GetEvLoop(), &watch_update_);
     ev_async_stop(GetEvLoop(), &watch_break_);
     ev_timer_stop(GetEvLoop(), &defer_timer_);
+    ev_io_stop(GetEvLoop(), &watch_io_uring_);
 }
 
 void Thread::UpdateLoopWatcher(struct ev_loop* loop, ev_async*, int) noexcept {
@@ -174,6 +211,12 @@ void Thread::BreakLoopWatcherImpl() {
     ev_break(GetEvLoop(), EVBREAK_ALL);
 }
 
+void Thread::IoUringWatcher(struct ev_loop*, ev_io* w, int) noexcept {
+    auto* io_uring = static_cast<IoUring*>(w->data);
+    UASSERT(io_uring != nullptr);
+    io_uring->ReapCompletions();
+}
+
 void Thread::Acquire(struct ev_loop* loop) noexcept {
     auto* ev_thread = static_cast<Thread*>(ev_userdata(loop));
     UASSERT(ev_thread != nullptr);
@@ -3,6 +3,7 @@
 #include <atomic>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <string>
 #include <thread>
 
@@ -19,6 +20,8 @@ USERVER_NAMESPACE_BEGIN
 
 namespace engine::ev {
 
+class IoUring;
+
 // Avoid ev_async_send on timers that have bigger timeouts
 inline constexpr std::chrono::microseconds kMinDurationToDefer{19500};
 
@@ -48,6 +51,10 @@ public:
     std::uint8_t GetCurrentLoadPercent() const;
     const std::string& GetName() const;
 
+    // Lazily sets up io_uring bound to this thread. Returns nullptr if io_uring
+    // is not available.
+    IoUring* GetIoUring();
+
 private:
     Thread(const std::string& thread_name, EventLoop::EvLoopType ev_loop_type);
 
@@ -63,6 +70,8 @@ private:
     void UpdateLoopWatcherImpl();
     static void BreakLoopWatcher(struct ev_loop*, ev_async* w, int) noexcept;
     void BreakLoopWatcherImpl();
+    static void IoUringWatcher(struct ev_loop*, ev_io* w, int) noexcept;
+    void InitIoUring();
 
     static void Acquire(struct ev_loop* loop) noexcept;
     static void Release(struct ev_loop* loop) noexcept;
@@ -81,6 +90,10 @@ private:
     ev_async watch_update_{};
     ev_async watch_break_{};
 
+    std::once_flag io_uring_init_flag_{};
+    std::unique_ptr<IoUring> io_uring_{};
+    ev_io watch_io_uring_{};
+
     const std::string name_;
     utils::statistics::ThreadCpuStatsStorage cpu_stats_storage_;
     bool is_running_{false};
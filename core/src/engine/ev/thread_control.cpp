@@ -105,6 +105,9 @@ void ThreadControl::Start(ev_io& w) noexcept { DoStart(w); }
 // NOLINTNEXTLINE(readability-make-member-function-const)
 void ThreadControl::Stop(ev_io& w) noexcept { DoStop(w); }
 
+// NOLINTNEXTLINE(readability-make-member-function-const)
+IoUring* ThreadControl::GetIoUring() { return GetThread().GetIoUring(); }
+
 }  // namespace engine::ev
 
 USERVER_NAMESPACE_END
@@ -112,6 +112,7 @@ private:
 }  // namespace impl
 
 class Thread;
+class IoUring;
 
 class ThreadControlBase {
 public:
@@ -140,6 +141,8 @@ public:
     bool IsInEvThread() const noexcept;
 
 protected:
+    Thread& GetThread() const noexcept { return thread_; }
+
     explicit ThreadControlBase(Thread& thread) noexcept;
 
     void DoStart(ev_timer& w) noexcept;
@@ -230,6 +233,10 @@ public:
 
     void Start(ev_io& w) noexcept;
     void Stop(ev_io& w) noexcept;
+
+    /// Returns io_uring bound to the ev thread, nullptr if io_uring is not
+    /// available. Sets up the io_uring on first call.
+    IoUring* GetIoUring();
 };
 
 }  // namespace engine::ev
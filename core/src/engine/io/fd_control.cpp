@@ -1,6 +1,7 @@
 #include "fd_control.hpp"
 
 #include <fcntl.h>
+#include <poll.h>
 #include <sys/resource.h>
 #include <unistd.h>
 
@@ -11,7 +12,10 @@
 #include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
 
+#include <engine/ev/io_uring.hpp>
+#include <engine/ev/thread_control.hpp>
 #include <engine/task/task_context.hpp>
+#include <engine/task/task_processor.hpp>
 #include <utils/check_syscall.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -49,6 +53,19 @@ int ReduceSigpipe(int fd) {
     return fd;
 }
 
+short GetPollEvents(Direction::Kind kind) {
+    switch (kind) {
+        case Direction::Kind::kRead:
+            return POLLIN;
+        case Direction::Kind::kWrite:
+            return POLLOUT;
+        case Direction::Kind::kReadWrite:
+            return POLLIN | POLLOUT;  // NOLINT(hicpp-signed-bitwise)
+    }
+
+    UINVARIANT(false, "Invalid kind: " + std::to_string(static_cast<int>(kind)));
+}
+
 }  // namespace
 
 void FdControlDeleter::operator()(FdControl* ptr) const noexcept { std::default_delete<FdControl>{}(ptr); }
@@ -59,6 +76,17 @@ Direction::SingleUserGuard::SingleUserGuard(Direction& dir) : dir_(dir) { dir_.p
 Direction::SingleUserGuard::~SingleUserGuard() { dir_.poller_.SwitchStateToReadyToUse(); }
 #endif  // #ifndef NDEBUG
 
+bool Direction::WaitForIo(Deadline deadline) {
+    if (io_uring_) {
+        const auto result = io_uring_->PollOnce(Fd(), GetPollEvents(kind_), deadline);
+        if (result) {
+            return *result;
+        }
+    }
+
+    return poller_.Wait(deadline).has_value();
+}
+
 // Write operations on socket usually do not block, so it makes sense to reuse
 // the same ThreadControl for the sake of better balancing of ev threads.
 FdControl::FdControl(const ev::ThreadControl& control) : read_(control), write_(control) {}
@@ -72,13 +100,20 @@ FdControl::~FdControl() {
 }
 
 FdControlHolder FdControl::Adopt(int fd) {
-    FdControlHolder fd_control{new FdControl(current_task::GetEventThread())};
+    auto& ev_thread = current_task::GetEventThread();
+    FdControlHolder fd_control{new FdControl(ev_thread)};
     // TODO: add conditional CLOEXEC set
     SetCloexec(fd);
     SetNonblock(fd);
     ReduceSigpipe(fd);
     fd_control->read_.Reset(fd, Direction::Kind::kRead);
     fd_control->write_.Reset(fd, Direction::Kind::kWrite);
+
+    if (current_task::GetTaskProcessor().GetIoBackend() == IoBackend::kIoUring) {
+        auto* io_uring = ev_thread.GetIoUring();
+        fd_control->read_.io_uring_ = io_uring;
+        fd_control->write_.io_uring_ = io_uring;
+    }
     return fd_control;
 }
 
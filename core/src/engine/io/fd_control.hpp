@@ -17,6 +17,10 @@
 
 USERVER_NAMESPACE_BEGIN
 
+namespace engine::ev {
+class IoUring;
+}  // namespace engine::ev
+
 namespace engine::io::impl {
 
 /// I/O operation transfer mode
@@ -99,13 +103,31 @@ public:
         const Context&... context
     );
 
+    // (IoFunc*)(int, size_t), for transfers that do not involve user space
+    // buffers, e.g. sendfile
+    template <typename IoFunc, typename... Context>
+    size_t PerformIoWithoutBuffer(
+        SingleUserGuard& guard,
+        IoFunc&& io_func,
+        size_t len,
+        TransferMode mode,
+        Deadline deadline,
+        const Context&... context
+    );
+
     engine::impl::ContextAccessor* TryGetContextAccessor() noexcept { return poller_.TryGetContextAccessor(); }
 
 private:
     friend class FdControl;
     explicit Direction(const ev::ThreadControl& control) : poller_(control) {}
 
-    void Reset(int fd, Kind kind) { poller_.Reset(fd, kind); }
+    void Reset(int fd, Kind kind) {
+        poller_.Reset(fd, kind);
+        kind_ = kind;
+    }
+
+    // Waits for the readiness of the fd for the operation in progress
+    [[nodiscard]] bool WaitForIo(Deadline deadline);
 
     void WakeupWaiters() { poller_.WakeupWaiters(); }
 
@@ -117,6 +139,8 @@ private:
     TryHandleError(int error_code, size_t processed_bytes, TransferMode mode, Deadline deadline, Context&... context);
 
     FdPoller poller_;
+    Kind kind_{Kind::kRead};
+    ev::IoUring* io_uring_{nullptr};
 };
 
 class FdControl final {
@@ -173,7 +197,7 @@ ErrorMode Direction::TryHandleError(
         if (current_task::ShouldCancel()) {
             throw(IoCancelled(/*bytes_transferred =*/processed_bytes) << ... << context);
         }
-        if (!poller_.Wait(deadline)) {
+        if (!WaitForIo(deadline)) {
             if (current_task::ShouldCancel()) {
                 throw(IoCancelled(/*bytes_transferred =*/processed_bytes) << ... << context);
             } else {
@@ -273,6 +297,31 @@ size_t Direction::PerformIo(
     return pos - begin;
 }
 
+template <typename IoFunc, typename... Context>
+size_t Direction::PerformIoWithoutBuffer(
+    SingleUserGuard&,
+    IoFunc&& io_func,
+    size_t len,
+    TransferMode mode,
+    Deadline deadline,
+    const Context&... context
+) {
+    size_t processed_bytes = 0;
+    while (processed_bytes < len) {
+        auto chunk_size = io_func(Fd(), len - processed_bytes);
+
+        if (chunk_size > 0) {
+            processed_bytes += chunk_size;
+            if (mode == TransferMode::kOnce) {
+                break;
+            }
+        } else if (!chunk_size || TryHandleError(errno, processed_bytes, mode, deadline, context...) == ErrorMode::kFatal) {
+            break;
+        }
+    }
+    return processed_bytes;
+}
+
 }  // namespace engine::io::impl
 
 USERVER_NAMESPACE_END
@@ -1,10 +1,15 @@
 #include <userver/engine/io/socket.hpp>
 
 #include <fcntl.h>
+#ifdef __linux__
+#include <sys/sendfile.h>
+#endif
 #include <sys/socket.h>
 #include <sys/uio.h>
 #include <unistd.h>
 
+#include <algorithm>
+#include <array>
 #include <cerrno>
 #include <string>
 #include <vector>
@@ -338,6 +343,52 @@ size_t Socket::SendAll(const void* buf, size_t len, Deadline deadline) {
     );
 }
 
+size_t Socket::SendFile(int file_fd, std::uint64_t offset, size_t len, Deadline deadline) {
+    if (!IsValid()) {
+        throw IoException("Attempt to SendFile to closed socket");
+    }
+    if (len == 0) return 0;
+
+    auto& dir = fd_control_->Write();
+    dir.ResetReady();
+    impl::Direction::SingleUserGuard guard(dir);
+#ifdef __linux__
+    auto file_offset = static_cast<off_t>(offset);
+    return dir.PerformIoWithoutBuffer(
+        guard,
+        [file_fd, &file_offset](int fd, size_t chunk_len) { return ::sendfile(fd, file_fd, &file_offset, chunk_len); },
+        len,
+        impl::TransferMode::kWhole,
+        deadline,
+        "SendFile to ",
+        peername_
+    );
+#else
+    // MAC_COMPAT: sendfile has different semantics, copy through a buffer
+    std::array<char, 64 * 1024> buffer{};
+    size_t sent_bytes = 0;
+    while (sent_bytes < len) {
+        const auto read_bytes = ::pread(
+            file_fd, buffer.data(), std::min(buffer.size(), len - sent_bytes), static_cast<off_t>(offset + sent_bytes)
+        );
+        if (read_bytes < 0) {
+            if (errno == EINTR) continue;
+            IoSystemError ex(errno, "Socket::SendFile");
+            ex << "Error while reading a file for SendFile to " << peername_;
+            throw std::move(ex);
+        }
+        if (read_bytes == 0) break;
+
+        const auto chunk_sent = dir.PerformIo(
+            guard, &SendWrapper, buffer.data(), read_bytes, impl::TransferMode::kWhole, deadline, "SendFile to ", peername_
+        );
+        sent_bytes += chunk_sent;
+        if (chunk_sent != static_cast<size_t>(read_bytes)) break;
+    }
+    return sent_bytes;
+#endif
+}
+
 Socket::RecvFromResult Socket::RecvSomeFrom(void* buf, size_t len, Deadline deadline) {
     if (!IsValid()) {
         throw IoException("Attempt to RecvSomeFrom via closed socket");
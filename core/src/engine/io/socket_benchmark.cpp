@@ -4,6 +4,7 @@
 #include <chrono>
 #include <string>
 
+#include <engine/task/task_processor.hpp>
 #include <userver/engine/async.hpp>
 #include <userver/engine/condition_variable.hpp>
 #include <userver/engine/io/sockaddr.hpp>
@@ -75,6 +76,45 @@ void socket_send_all_v(benchmark::State& state) {
 }
 BENCHMARK(socket_send_all_v);
 
+void socket_ping_pong(benchmark::State& state) {
+    engine::RunStandalone([&]() {
+        engine::TaskProcessorConfig config;
+        config.name = "benchmark";
+        config.thread_name = "benchmark";
+        config.worker_threads = 2;
+        config.io_backend = state.range(0) ? engine::IoBackend::kIoUring : engine::IoBackend::kEv;
+        engine::TaskProcessor task_processor(
+            std::move(config), engine::current_task::GetTaskProcessor().GetTaskProcessorPools()
+        );
+
+        engine::AsyncNoSpan(task_processor, [&state] {
+            const auto test_deadline = Deadline::FromDuration(kDeadlineMaxTime);
+            internal::net::TcpListener listener;
+            auto socket_pair = listener.MakeSocketPair(test_deadline);
+            auto& client = socket_pair.second;
+            auto task_echo = engine::AsyncNoSpan(
+                [test_deadline](auto&& server) {
+                    char c = 0;
+                    while (server.RecvSome(&c, 1, test_deadline) > 0) {
+                        server.SendAll(&c, 1, test_deadline);
+                    }
+                },
+                std::move(socket_pair.first)
+            );
+
+            char c = 'x';
+            for ([[maybe_unused]] auto _ : state) {
+                client.SendAll(&c, 1, test_deadline);
+                benchmark::DoNotOptimize(client.RecvAll(&c, 1, test_deadline));
+            }
+            client.Close();
+            task_echo.Get();
+        }).Get();
+    });
+}
+// 0 - ev backend, 1 - io_uring backend
+BENCHMARK(socket_ping_pong)->Arg(0)->Arg(1);
+
 [[maybe_unused]] void socket_send_all_v_range(benchmark::State& state) {
     engine::RunStandalone(2, [&]() {
         const auto test_deadline = Deadline::FromDuration(kDeadlineMaxTime);
@@ -10,8 +10,10 @@
 #include <cstdlib>
 #include <string_view>
 
+#include <engine/task/task_processor.hpp>
 #include <userver/engine/async.hpp>
 #include <userver/engine/condition_variable.hpp>
+#include <userver/engine/io/exception.hpp>
 #include <userver/engine/io/sockaddr.hpp>
 #include <userver/engine/io/socket.hpp>
 #include <userver/engine/mutex.hpp>
@@ -483,4 +485,50 @@ UTEST(Socket, WriteALot) {
     }
 }
 
+UTEST(Socket, IoUringBackend) {
+    engine::TaskProcessorConfig config;
+    config.name = "io-uring";
+    config.thread_name = "io-uring";
+    config.worker_threads = 2;
+    config.io_backend = engine::IoBackend::kIoUring;
+    engine::TaskProcessor task_processor(
+        std::move(config), engine::current_task::GetTaskProcessor().GetTaskProcessorPools()
+    );
+
+    // Falls back to the ev backend if io_uring is not available, so the test
+    // passes either way
+    engine::AsyncNoSpan(task_processor, [] {
+        const auto test_deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+        TcpListener listener;
+        auto socket_pair = listener.MakeSocketPair(test_deadline);
+        auto& server = socket_pair.first;
+        auto& client = socket_pair.second;
+
+        auto reader = engine::AsyncNoSpan([&server, test_deadline] {
+            std::array<char, 3> buf{};
+            EXPECT_EQ(buf.size(), server.RecvAll(buf.data(), buf.size(), test_deadline));
+            return std::string(buf.data(), buf.size());
+        });
+        engine::SleepFor(std::chrono::milliseconds{10});
+        EXPECT_EQ(3, client.SendAll("abc", 3, test_deadline));
+        EXPECT_EQ("abc", reader.Get());
+
+        char c = 0;
+        UEXPECT_THROW(
+            [[maybe_unused]] auto res = server.RecvSome(&c, 1, Deadline::FromDuration(std::chrono::milliseconds{10})),
+            io::IoTimeout
+        );
+
+        auto cancelled_reader = engine::AsyncNoSpan([&server, &c, test_deadline] {
+            UEXPECT_THROW([[maybe_unused]] auto res = server.RecvSome(&c, 1, test_deadline), io::IoCancelled);
+        });
+        engine::SleepFor(std::chrono::milliseconds{10});
+        cancelled_reader.SyncCancel();
+
+        EXPECT_EQ(1, client.SendAll("d", 1, test_deadline));
+        EXPECT_EQ(1, server.RecvAll(&c, 1, test_deadline));
+        EXPECT_EQ('d', c);
+    }).Get();
+}
+
 USERVER_NAMESPACE_END
@@ -174,6 +174,8 @@ std::uint64_t GetCreatedTaskCount(TaskProcessor& task_processor) {
     return task_processor.GetTaskCounter().GetCreatedTasks().value;
 }
 
+std::size_t GetWorkerCount(TaskProcessor& task_processor) { return task_processor.GetWorkerCount(); }
+
 }  // namespace impl
 
 }  // namespace engine
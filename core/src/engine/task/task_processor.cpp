@@ -178,6 +178,10 @@ std::size_t TaskProcessor::GetTaskQueueSize() const {
     return std::visit([](auto&& arg) { return arg.GetSizeApproximate(); }, task_queue_);
 }
 
+std::vector<NumaNodeStats> TaskProcessor::GetNumaNodeStats() const {
+    return std::visit([](auto&& arg) { return arg.GetNumaNodeStats(); }, task_queue_);
+}
+
 void TaskProcessor::SetSettings(const TaskProcessorSettings& settings) {
     sensor_task_queue_wait_time_ = settings.sensor_wait_queue_time_limit;
 
@@ -60,6 +60,10 @@ public:
 
     std::size_t GetWorkerCount() const { return workers_.size(); }
 
+    std::vector<NumaNodeStats> GetNumaNodeStats() const;
+
+    IoBackend GetIoBackend() const noexcept { return config_.io_backend; }
+
     void SetSettings(const TaskProcessorSettings& settings);
 
     std::chrono::microseconds GetProfilerThreshold() const;
@@ -55,6 +55,14 @@ TaskQueueType Parse(const yaml_config::YamlConfig& value, formats::parse::To<Tas
     return utils::ParseFromValueString(value, kMap);
 }
 
+IoBackend Parse(const yaml_config::YamlConfig& value, formats::parse::To<IoBackend>) {
+    static constexpr utils::TrivialBiMap kMap([](auto selector) {
+        return selector().Case(IoBackend::kEv, "ev").Case(IoBackend::kIoUring, "io-uring");
+    });
+
+    return utils::ParseFromValueString(value, kMap);
+}
+
 TaskProcessorConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<TaskProcessorConfig>) {
     TaskProcessorConfig config;
     config.should_guess_cpu_limit = value["guess-cpu-limit"].As<bool>(config.should_guess_cpu_limit);
@@ -63,6 +71,11 @@ TaskProcessorConfig Parse(const yaml_config::YamlConfig& value, formats::parse::
     config.os_scheduling = value["os-scheduling"].As<OsScheduling>(config.os_scheduling);
     config.spinning_iterations = value["spinning-iterations"].As<int>(config.spinning_iterations);
     config.task_processor_queue = value["task-processor-queue"].As<TaskQueueType>(config.task_processor_queue);
+    config.io_backend = value["io-backend"].As<IoBackend>(config.io_backend);
+    config.numa_aware = value["numa-aware"].As<bool>(config.numa_aware);
+    if (config.numa_aware && config.task_processor_queue != TaskQueueType::kWorkStealingTaskQueue) {
+        throw std::runtime_error("numa-aware requires task-processor-queue: work-stealing-task-queue");
+    }
 
     const auto task_trace = value["task-trace"];
     if (!task_trace.IsMissing()) {
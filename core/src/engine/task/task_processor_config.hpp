@@ -20,10 +20,17 @@ enum class OsScheduling {
 
 enum class TaskQueueType { kGlobalTaskQueue, kWorkStealingTaskQueue };
 
+enum class IoBackend {
+    kEv,
+    kIoUring,
+};
+
 OsScheduling Parse(const yaml_config::YamlConfig& value, formats::parse::To<OsScheduling>);
 
 TaskQueueType Parse(const yaml_config::YamlConfig& value, formats::parse::To<TaskQueueType>);
 
+IoBackend Parse(const yaml_config::YamlConfig& value, formats::parse::To<IoBackend>);
+
 struct TaskProcessorConfig {
     std::string name;
 
@@ -33,6 +40,8 @@ struct TaskProcessorConfig {
     OsScheduling os_scheduling{OsScheduling::kNormal};
     int spinning_iterations{1000};
     TaskQueueType task_processor_queue{TaskQueueType::kGlobalTaskQueue};
+    IoBackend io_backend{IoBackend::kEv};
+    bool numa_aware{false};
 
     std::size_t task_trace_every{1000};
     std::size_t task_trace_max_csw{0};
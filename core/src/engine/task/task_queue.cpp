@@ -42,6 +42,8 @@ std::size_t TaskQueue::GetSizeApproximate() const noexcept { return queue_.size_
 
 void TaskQueue::PrepareWorker(std::size_t) {}
 
+std::vector<NumaNodeStats> TaskQueue::GetNumaNodeStats() const { return {}; }
+
 void TaskQueue::DoPush(impl::TaskContext* context) {
     // This piece of code is copy-pasted from
     // moodycamel::BlockingConcurrentQueue::enqueue
@@ -1,10 +1,13 @@
 #pragma once
 
+#include <vector>
+
 #include <moodycamel/blockingconcurrentqueue.h>
 #include <moodycamel/lightweightsemaphore.h>
 #include <boost/smart_ptr/intrusive_ptr.hpp>
 
 #include <engine/task/task_processor_config.hpp>
+#include <engine/task/work_stealing_queue/numa_topology.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -29,6 +32,8 @@ public:
 
     void PrepareWorker(std::size_t index);
 
+    std::vector<NumaNodeStats> GetNumaNodeStats() const;
+
 private:
     void DoPush(impl::TaskContext* context);
 
@@ -81,6 +81,13 @@ WorkStealingTaskQueue* Consumer::GetOwner() const noexcept { return &owner_; }
 
 void Consumer::SetIndex(std::size_t index) noexcept { inner_index_ = index; }
 
+void Consumer::SetNode(std::size_t node_index, std::size_t node_begin, std::size_t node_end) noexcept {
+    UASSERT(node_begin <= inner_index_ && inner_index_ < node_end);
+    node_index_ = node_index;
+    node_begin_ = node_begin;
+    node_end_ = node_end;
+}
+
 bool Consumer::IsStopped() const noexcept { return consumers_manager_.IsStopped(); }
 
 void Consumer::EmptySurplusQueue(impl::TaskContext* extra) {
@@ -102,21 +109,19 @@ void Consumer::EmptySurplusQueue(impl::TaskContext* extra) {
 
 impl::TaskContext*
 Consumer::StealFromAnotherConsumerOrGlobalQueue(const std::size_t attempts, std::size_t to_steal_count) {
+    const bool has_other_nodes = node_end_ - node_begin_ != owner_.consumers_count_;
     std::size_t stealed_size = 0;
     for (std::size_t i = 0; i < attempts && to_steal_count > 0 && stealed_size == 0; ++i) {
-        std::size_t start_index = rnd_() % owner_.consumers_count_;
-        for (std::size_t shift = 0; shift < owner_.consumers_count_ && to_steal_count > 0 && stealed_size == 0;
-             ++shift) {
-            std::size_t index = (start_index + shift) % owner_.consumers_count_;
-            Consumer* victim = &owner_.consumers_[index];
-            if (victim == this) {
-                continue;
-            }
-            const std::size_t tasks_count =
-                victim->Steal(utils::span(steal_buffer_.data() + stealed_size, to_steal_count));
-            stealed_size += tasks_count;
-            to_steal_count -= tasks_count;
+        // Tasks of the same NUMA node are preferred, their data is likely in
+        // the shared cache and node-local memory
+        stealed_size = StealFromConsumers(/*same_node=*/true, to_steal_count);
+        if (stealed_size) {
+            if (has_other_nodes) local_steals_.fetch_add(1, std::memory_order_relaxed);
+        } else if (has_other_nodes) {
+            stealed_size = StealFromConsumers(/*same_node=*/false, to_steal_count);
+            if (stealed_size) remote_steals_.fetch_add(1, std::memory_order_relaxed);
         }
+        to_steal_count -= stealed_size;
 
         if (stealed_size == 0) {
             impl::TaskContext* ctx = owner_.global_queue_.TryPop(global_queue_token_);
@@ -144,6 +149,21 @@ Consumer::StealFromAnotherConsumerOrGlobalQueue(const std::size_t attempts, std:
     return nullptr;
 }
 
+std::size_t Consumer::StealFromConsumers(bool same_node, std::size_t to_steal_count) {
+    const std::size_t begin = same_node ? node_begin_ : 0;
+    const std::size_t size = same_node ? node_end_ - node_begin_ : owner_.consumers_count_;
+    const std::size_t start_index = rnd_() % size;
+    for (std::size_t shift = 0; shift < size; ++shift) {
+        Consumer* victim = &owner_.consumers_[begin + (start_index + shift) % size];
+        if (victim == this || (!same_node && victim->node_index_ == node_index_)) {
+            continue;
+        }
+        const std::size_t tasks_count = victim->Steal(utils::span(steal_buffer_.data(), to_steal_count));
+        if (tasks_count) return tasks_count;
+    }
+    return 0;
+}
+
 std::size_t Consumer::Steal(utils::span<impl::TaskContext*> buffer) {
     std::size_t can_be_stealed_count = local_queue_.GetSize();
     if (can_be_stealed_count) {
@@ -1,8 +1,10 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 #include <condition_variable>
 #include <cstddef>
+#include <cstdint>
 #include <random>
 
 #include <engine/task/work_stealing_queue/global_queue.hpp>
@@ -37,12 +39,17 @@ private:
 
     void SetIndex(std::size_t index) noexcept;
 
+    // Consumers of the node are [node_begin, node_end) in the owner
+    void SetNode(std::size_t node_index, std::size_t node_begin, std::size_t node_end) noexcept;
+
     bool IsStopped() const noexcept;
 
     void EmptySurplusQueue(impl::TaskContext* extra);
 
     impl::TaskContext* StealFromAnotherConsumerOrGlobalQueue(const std::size_t attempts, std::size_t to_steal);
 
+    std::size_t StealFromConsumers(bool same_node, std::size_t to_steal_count);
+
     std::size_t Steal(utils::span<impl::TaskContext*> buffer);
 
     impl::TaskContext* TryPopFromOwnerQueue(const bool is_global);
@@ -73,6 +80,11 @@ private:
     ConsumersManager& consumers_manager_;
     const std::size_t steal_attempts_count_;
     std::size_t inner_index_{0};
+    std::size_t node_index_{0};
+    std::size_t node_begin_{0};
+    std::size_t node_end_{0};
+    std::atomic<std::uint64_t> local_steals_{0};
+    std::atomic<std::uint64_t> remote_steals_{0};
     // kConsumerStealBufferSize + 1 for extra task in push
     std::array<impl::TaskContext*, kConsumerStealBufferSize + 1> steal_buffer_{};
     std::minstd_rand rnd_;
@@ -0,0 +1,143 @@
+#include <engine/task/work_stealing_queue/numa_topology.hpp>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include <algorithm>
+#include <charconv>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+
+#include <fmt/format.h>
+
+#include <userver/logging/log.hpp>
+#include <userver/utils/text_light.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+namespace {
+
+int ParseCpu(std::string_view str) {
+    int result = 0;
+    const auto* end = str.data() + str.size();
+    const auto [ptr, ec] = std::from_chars(str.data(), end, result);
+    if (ec != std::errc{} || ptr != end || result < 0) {
+        throw std::runtime_error(fmt::format("Invalid CPU number '{}' in a CPU list", str));
+    }
+    return result;
+}
+
+#ifdef __linux__
+constexpr std::string_view kNodesDirectory = "/sys/devices/system/node";
+constexpr std::string_view kNodeDirectoryPrefix = "node";
+
+std::vector<int> GetAllowedCpus() {
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    if (::sched_getaffinity(0, sizeof(cpu_set), &cpu_set) != 0) return {};
+
+    std::vector<int> result;
+    for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+        if (CPU_ISSET(cpu, &cpu_set)) result.push_back(cpu);
+    }
+    return result;
+}
+#endif
+
+}  // namespace
+
+std::vector<int> ParseCpuList(std::string_view cpu_list) {
+    std::vector<int> result;
+    while (!cpu_list.empty() && (cpu_list.back() == '\n' || cpu_list.back() == ' ')) cpu_list.remove_suffix(1);
+
+    while (!cpu_list.empty()) {
+        const auto comma = cpu_list.find(',');
+        const auto range = cpu_list.substr(0, comma);
+        cpu_list = (comma == std::string_view::npos) ? std::string_view{} : cpu_list.substr(comma + 1);
+
+        const auto dash = range.find('-');
+        const int first = ParseCpu(range.substr(0, dash));
+        const int last = (dash == std::string_view::npos) ? first : ParseCpu(range.substr(dash + 1));
+        if (last < first) {
+            throw std::runtime_error(fmt::format("Invalid CPU range '{}' in a CPU list", range));
+        }
+        for (int cpu = first; cpu <= last; ++cpu) result.push_back(cpu);
+    }
+
+    std::sort(result.begin(), result.end());
+    result.erase(std::unique(result.begin(), result.end()), result.end());
+    return result;
+}
+
+std::vector<NumaNode> GetNumaNodes() {
+#ifdef __linux__
+    std::vector<NumaNode> nodes;
+    try {
+        const auto allowed_cpus = GetAllowedCpus();
+        std::error_code ec;
+        for (const auto& entry : std::filesystem::directory_iterator(std::string{kNodesDirectory}, ec)) {
+            const auto name = entry.path().filename().string();
+            if (!utils::text::StartsWith(name, kNodeDirectoryPrefix)) continue;
+            const auto id_str = std::string_view{name}.substr(kNodeDirectoryPrefix.size());
+            if (id_str.empty() || id_str.find_first_not_of("0123456789") != std::string_view::npos) continue;
+
+            std::ifstream cpulist_file(entry.path() / "cpulist");
+            std::string cpulist;
+            if (!cpulist_file || !std::getline(cpulist_file, cpulist)) continue;
+
+            NumaNode node;
+            node.id = static_cast<std::size_t>(ParseCpu(id_str));
+            for (const int cpu : ParseCpuList(cpulist)) {
+                if (std::binary_search(allowed_cpus.begin(), allowed_cpus.end(), cpu)) node.cpus.push_back(cpu);
+            }
+            if (!node.cpus.empty()) nodes.push_back(std::move(node));
+        }
+    } catch (const std::exception& ex) {
+        LOG_WARNING() << "Failed to read the NUMA topology: " << ex;
+        return {};
+    }
+
+    std::sort(nodes.begin(), nodes.end(), [](const NumaNode& lhs, const NumaNode& rhs) { return lhs.id < rhs.id; });
+    return nodes;
+#else
+    return {};
+#endif
+}
+
+std::vector<std::size_t> DistributeWorkersByNodes(std::size_t workers_count, std::size_t nodes_count) {
+    std::vector<std::size_t> result(workers_count, 0);
+    if (nodes_count == 0) return result;
+
+    for (std::size_t i = 0; i < workers_count; ++i) {
+        result[i] = i * nodes_count / workers_count;
+    }
+    return result;
+}
+
+void SetCurrentThreadAffinity(const std::vector<int>& cpus) {
+#ifdef __linux__
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    for (const int cpu : cpus) {
+        if (cpu < CPU_SETSIZE) CPU_SET(cpu, &cpu_set);
+    }
+
+    const int ret = ::pthread_setaffinity_np(::pthread_self(), sizeof(cpu_set), &cpu_set);
+    if (ret) {
+        throw std::system_error(ret, std::system_category(), "Cannot set thread affinity");
+    }
+#else
+    (void)cpus;
+#endif
+}
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
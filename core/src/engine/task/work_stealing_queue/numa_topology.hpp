@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+struct NumaNode final {
+    std::size_t id{0};
+    // CPUs of the node that the process is allowed to run on
+    std::vector<int> cpus;
+};
+
+/// NUMA nodes of the host that have CPUs available to the process. Empty if
+/// the topology is unknown or the platform is not Linux.
+std::vector<NumaNode> GetNumaNodes();
+
+/// Parses a CPU list in the sysfs format, e.g. "0-3,8,10-11"
+std::vector<int> ParseCpuList(std::string_view cpu_list);
+
+/// Splits the workers into contiguous groups, one per node, so that the group
+/// sizes differ by at most one. Returns the node index of each worker.
+std::vector<std::size_t> DistributeWorkersByNodes(std::size_t workers_count, std::size_t nodes_count);
+
+/// Restricts the current thread to the CPUs, does nothing on non-Linux
+void SetCurrentThreadAffinity(const std::vector<int>& cpus);
+
+/// Per-node statistics of a NUMA-aware work stealing queue
+struct NumaNodeStats final {
+    std::size_t node_id{0};
+    std::size_t worker_threads{0};
+    std::size_t queued{0};
+    std::uint64_t local_steals{0};
+    std::uint64_t remote_steals{0};
+};
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,35 @@
+#include <engine/task/work_stealing_queue/numa_topology.hpp>
+
+#include <stdexcept>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+TEST(NumaTopology, ParseCpuList) {
+    EXPECT_THAT(engine::ParseCpuList("0"), testing::ElementsAre(0));
+    EXPECT_THAT(engine::ParseCpuList("0-3\n"), testing::ElementsAre(0, 1, 2, 3));
+    EXPECT_THAT(engine::ParseCpuList("8,0-1,10-11"), testing::ElementsAre(0, 1, 8, 10, 11));
+    EXPECT_THAT(engine::ParseCpuList(""), testing::IsEmpty());
+
+    EXPECT_THROW(engine::ParseCpuList("3-1"), std::runtime_error);
+    EXPECT_THROW(engine::ParseCpuList("a-b"), std::runtime_error);
+    EXPECT_THROW(engine::ParseCpuList("1,,2"), std::runtime_error);
+}
+
+TEST(NumaTopology, DistributeWorkersByNodes) {
+    EXPECT_THAT(engine::DistributeWorkersByNodes(4, 2), testing::ElementsAre(0, 0, 1, 1));
+    EXPECT_THAT(engine::DistributeWorkersByNodes(5, 2), testing::ElementsAre(0, 0, 0, 1, 1));
+    EXPECT_THAT(engine::DistributeWorkersByNodes(3, 3), testing::ElementsAre(0, 1, 2));
+    EXPECT_THAT(engine::DistributeWorkersByNodes(3, 0), testing::ElementsAre(0, 0, 0));
+}
+
+TEST(NumaTopology, GetNumaNodes) {
+    const auto nodes = engine::GetNumaNodes();
+    for (const auto& node : nodes) {
+        EXPECT_FALSE(node.cpus.empty());
+    }
+}
+
+USERVER_NAMESPACE_END
@@ -1,5 +1,6 @@
 #include <engine/task/work_stealing_queue/task_queue.hpp>
 
+#include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/rand.hpp>
 
@@ -23,6 +24,10 @@ WorkStealingTaskQueue::WorkStealingTaskQueue(const TaskProcessorConfig& config)
       consumers_manager_(consumers_count_) {
     for (size_t i = 0; i < consumers_count_; ++i) {
         consumers_[i].SetIndex(i);
+        consumers_[i].SetNode(0, 0, consumers_count_);
+    }
+    if (config.numa_aware) {
+        SetupNumaNodes();
     }
 }
 
@@ -57,7 +62,57 @@ std::size_t WorkStealingTaskQueue::GetSizeApproximate() const noexcept {
 void WorkStealingTaskQueue::PrepareWorker(std::size_t index) {
     if (index < consumers_count_) {
         localConsumer = &consumers_[index];
+
+        if (!numa_nodes_.empty()) {
+            const auto& node = numa_nodes_[consumers_[index].node_index_];
+            try {
+                // Pages are placed on the node that touches them first, so the
+                // coroutine stacks from the thread local cache and the memory
+                // allocated by the tasks stay node-local too
+                SetCurrentThreadAffinity(node.cpus);
+            } catch (const std::exception& ex) {
+                LOG_WARNING() << "Failed to pin worker " << index << " to NUMA node " << node.id << ": " << ex;
+            }
+        }
+    }
+}
+
+std::vector<NumaNodeStats> WorkStealingTaskQueue::GetNumaNodeStats() const {
+    std::vector<NumaNodeStats> result(numa_nodes_.size());
+    for (std::size_t i = 0; i < numa_nodes_.size(); ++i) {
+        result[i].node_id = numa_nodes_[i].id;
+    }
+    for (const auto& consumer : consumers_) {
+        if (consumer.node_index_ >= result.size()) continue;
+        auto& stats = result[consumer.node_index_];
+        ++stats.worker_threads;
+        stats.queued += consumer.GetLocalQueueSize();
+        stats.local_steals += consumer.local_steals_.load(std::memory_order_relaxed);
+        stats.remote_steals += consumer.remote_steals_.load(std::memory_order_relaxed);
+    }
+    return result;
+}
+
+void WorkStealingTaskQueue::SetupNumaNodes() {
+    auto nodes = GetNumaNodes();
+    if (nodes.size() < 2) {
+        LOG_INFO() << "numa-aware task processor runs on a host with " << nodes.size()
+                   << " NUMA node(s) available, worker threads are not pinned";
+        return;
+    }
+    // Every node gets at least one worker
+    if (nodes.size() > consumers_count_) nodes.resize(consumers_count_);
+
+    const auto worker_nodes = DistributeWorkersByNodes(consumers_count_, nodes.size());
+    std::size_t begin = 0;
+    while (begin < consumers_count_) {
+        const auto node_index = worker_nodes[begin];
+        auto end = begin;
+        while (end < consumers_count_ && worker_nodes[end] == node_index) ++end;
+        for (auto i = begin; i < end; ++i) consumers_[i].SetNode(node_index, begin, end);
+        begin = end;
     }
+    numa_nodes_ = std::move(nodes);
 }
 
 void WorkStealingTaskQueue::DoPush(impl::TaskContext* context) {
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstddef>
+#include <vector>
 
 #include <boost/smart_ptr/intrusive_ptr.hpp>
 
@@ -8,6 +9,7 @@
 #include <engine/task/work_stealing_queue/consumer.hpp>
 #include <engine/task/work_stealing_queue/consumers_manager.hpp>
 #include <engine/task/work_stealing_queue/global_queue.hpp>
+#include <engine/task/work_stealing_queue/numa_topology.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -33,7 +35,12 @@ public:
 
     void PrepareWorker(std::size_t index);
 
+    // Empty if the queue is not NUMA-aware
+    std::vector<NumaNodeStats> GetNumaNodeStats() const;
+
 private:
+    void SetupNumaNodes();
+
     void DoPush(impl::TaskContext* context);
 
     impl::TaskContext* DoPopBlocking();
@@ -46,6 +53,8 @@ private:
     GlobalQueue background_queue_;
     utils::FixedArray<Consumer> consumers_;
     ConsumersManager consumers_manager_;
+    // Nodes with at least one worker, empty if the queue is not NUMA-aware
+    std::vector<NumaNode> numa_nodes_;
 };
 
 }  // namespace engine
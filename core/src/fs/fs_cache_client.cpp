@@ -40,8 +40,13 @@ bool IsFilepathHidden(const std::string& path) {
 }  // namespace
 #endif  // __linux__
 
-FsCacheClient::FsCacheClient(std::string_view dir, std::chrono::milliseconds update_period, engine::TaskProcessor& tp)
-    : dir_(GetNormalizeDirectory(dir)), update_period_(update_period), tp_(tp) {
+FsCacheClient::FsCacheClient(
+    std::string_view dir,
+    std::chrono::milliseconds update_period,
+    engine::TaskProcessor& tp,
+    utils::Flags<SettingsReadFile> flags
+)
+    : dir_(GetNormalizeDirectory(dir)), update_period_(update_period), tp_(tp), flags_(flags) {
     UpdateCache();
 
     if (update_period_ == std::chrono::milliseconds(0)) {
@@ -56,7 +61,7 @@ FsCacheClient::FsCacheClient(std::string_view dir, std::chrono::milliseconds upd
 }
 
 void FsCacheClient::UpdateCache() {
-    auto map = fs::ReadRecursiveFilesInfoWithData(tp_, dir_, {fs::SettingsReadFile::kSkipHidden});
+    auto map = fs::ReadRecursiveFilesInfoWithData(tp_, dir_, flags_);
     data_.Assign(std::move(map));
 }
 
@@ -99,12 +104,12 @@ void FsCacheClient::HandleDeleteDirectory(engine::io::sys_linux::Inotify& inotif
 }
 
 void FsCacheClient::HandleCreate(const std::string& path) {
-    if (IsFilepathHidden(path)) return;
+    if ((flags_ & SettingsReadFile::kSkipHidden) && IsFilepathHidden(path)) return;
 
-    FileInfoWithData info{};
-    info.extension = boost::filesystem::path(path).extension().string();
-    info.data = ReadFileContents(tp_, path);
-    data_.InsertOrAssign(GetLexicallyRelative(path, dir_), std::make_shared<const FileInfoWithData>(std::move(info)));
+    data_.InsertOrAssign(
+        GetLexicallyRelative(path, dir_),
+        std::make_shared<const FileInfoWithData>(ReadFileInfoWithData(tp_, path, flags_))
+    );
 }
 
 void FsCacheClient::HandleCreateDirectory(engine::io::sys_linux::Inotify& inotify, const std::string& path) {
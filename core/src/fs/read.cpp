@@ -1,11 +1,17 @@
 #include <userver/fs/read.hpp>
 
+#include <sys/stat.h>
+
 #include <boost/filesystem.hpp>
 
+#include <userver/crypto/hash.hpp>
 #include <userver/engine/async.hpp>
+#include <userver/fs/blocking/file_descriptor.hpp>
 #include <userver/fs/blocking/read.hpp>
 #include <userver/utils/async.hpp>
 
+#include <utils/check_syscall.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace fs {
@@ -18,8 +24,40 @@ bool IsHiddenFile(const boost::filesystem::path& path) {
     return name != ".." && name != "." && name[0] == '.';
 }
 
+FileStatus ToFileStatus(const struct ::stat& stat) noexcept {
+    FileStatus status;
+    status.device = stat.st_dev;
+    status.inode = stat.st_ino;
+    status.size = stat.st_size;
+#ifdef __APPLE__
+    status.modification_time_ns = stat.st_mtimespec.tv_sec * 1'000'000'000LL + stat.st_mtimespec.tv_nsec;
+#else
+    status.modification_time_ns = stat.st_mtim.tv_sec * 1'000'000'000LL + stat.st_mtim.tv_nsec;
+#endif
+    return status;
+}
+
+std::string ReadContents(blocking::FileDescriptor& fd, std::size_t size_hint) {
+    std::string contents;
+    contents.resize(size_hint + 1);
+    std::size_t size = 0;
+    while (true) {
+        if (size == contents.size()) contents.resize(contents.size() * 2);
+        const auto read = fd.Read(contents.data() + size, contents.size() - size);
+        if (read == 0) break;
+        size += read;
+    }
+    contents.resize(size);
+    return contents;
+}
+
 }  // namespace
 
+bool FileStatus::operator==(const FileStatus& other) const noexcept {
+    return device == other.device && inode == other.inode && size == other.size &&
+           modification_time_ns == other.modification_time_ns;
+}
+
 std::string GetLexicallyRelative(std::string_view path, std::string_view dir) {
     UASSERT(dir.size() < path.size());
     UASSERT(path.substr(0, dir.size()) == dir);
@@ -31,6 +69,38 @@ std::string ReadFileContents(engine::TaskProcessor& async_tp, const std::string&
     return engine::AsyncNoSpan(async_tp, &fs::blocking::ReadFileContents, path).Get();
 }
 
+FileInfoWithData
+ReadFileInfoWithData(engine::TaskProcessor& async_tp, const std::string& path, utils::Flags<SettingsReadFile> flags) {
+    return engine::AsyncNoSpan(async_tp, [&path, flags] {
+               auto fd = blocking::FileDescriptor::Open(path, blocking::OpenFlag::kRead);
+               struct ::stat stat {};
+               utils::CheckSyscall(::fstat(fd.GetNative(), &stat), "calling fstat on '{}'", path);
+
+               FileInfoWithData info{};
+               // The status is taken before reading, so that a modification
+               // during the read is detected by IsOpenedFileUnchanged
+               info.status = ToFileStatus(stat);
+               info.data = ReadContents(fd, info.status.size);
+               info.extension = boost::filesystem::path(path).extension().string();
+               info.path = path;
+               // Content-based rather than mtime-based, so that all the hosts
+               // serving the same files agree on the ETag
+               info.etag = '"' + crypto::hash::Sha1(info.data) + '"';
+               if (flags & SettingsReadFile::kKeepOpened) {
+                   info.file = std::make_shared<const blocking::FileDescriptor>(std::move(fd));
+               }
+               return info;
+           }).Get();
+}
+
+bool IsOpenedFileUnchanged(const FileInfoWithData& info) noexcept {
+    if (!info.file) return false;
+
+    struct ::stat stat {};
+    if (::fstat(info.file->GetNative(), &stat) != 0) return false;
+    return ToFileStatus(stat) == info.status && info.status.size == info.data.size();
+}
+
 FileInfoWithDataMap ReadRecursiveFilesInfoWithData(
     engine::TaskProcessor& async_tp,
     const std::string& path,
@@ -45,11 +115,8 @@ FileInfoWithDataMap ReadRecursiveFilesInfoWithData(
         // only files
         if (it->status().type() != boost::filesystem::regular_file) continue;
         if ((flags & SettingsReadFile::kSkipHidden) && IsHiddenFile(it->path())) continue;
-        FileInfoWithData info{};
-        info.extension = it->path().extension().string();
-        info.data = ReadFileContents(async_tp, it->path().string());
         data[GetLexicallyRelative(it->path().string(), path)] =
-            std::make_shared<const FileInfoWithData>(std::move(info));
+            std::make_shared<const FileInfoWithData>(ReadFileInfoWithData(async_tp, it->path().string(), flags));
     }
     return data;
 }
@@ -1,6 +1,10 @@
 #include <gtest/gtest.h>
 
+#include <userver/engine/task/task_base.hpp>
+#include <userver/fs/blocking/temp_file.hpp>
+#include <userver/fs/blocking/write.hpp>
 #include <userver/fs/read.hpp>
+#include <userver/utest/utest.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -9,4 +13,44 @@ TEST(Fs, GetLexicallyRelative) {
     EXPECT_EQ(fs::GetLexicallyRelative("/path/to/file", "/path"), "/to/file");
 }
 
+UTEST(Fs, ReadFileInfoWithData) {
+    const auto file = fs::blocking::TempFile::Create();
+    fs::blocking::RewriteFileContents(file.GetPath(), "contents");
+
+    const auto info = fs::ReadFileInfoWithData(engine::current_task::GetTaskProcessor(), file.GetPath());
+    EXPECT_EQ(info.data, "contents");
+    EXPECT_EQ(info.path, file.GetPath());
+    EXPECT_EQ(info.status.size, info.data.size());
+    EXPECT_FALSE(info.file);
+    EXPECT_FALSE(fs::IsOpenedFileUnchanged(info));
+}
+
+UTEST(Fs, OpenedFileModifiedInPlace) {
+    const auto file = fs::blocking::TempFile::Create();
+    fs::blocking::RewriteFileContents(file.GetPath(), "contents");
+
+    const auto info = fs::ReadFileInfoWithData(
+        engine::current_task::GetTaskProcessor(), file.GetPath(), fs::SettingsReadFile::kKeepOpened
+    );
+    ASSERT_TRUE(info.file);
+    EXPECT_TRUE(fs::IsOpenedFileUnchanged(info));
+
+    // Same size, so that only the modification time tells the difference
+    fs::blocking::RewriteFileContents(file.GetPath(), "CONTENTS");
+    EXPECT_FALSE(fs::IsOpenedFileUnchanged(info));
+}
+
+UTEST(Fs, OpenedFileReplaced) {
+    const auto file = fs::blocking::TempFile::Create();
+    fs::blocking::RewriteFileContents(file.GetPath(), "contents");
+
+    const auto info = fs::ReadFileInfoWithData(
+        engine::current_task::GetTaskProcessor(), file.GetPath(), fs::SettingsReadFile::kKeepOpened
+    );
+    fs::blocking::RewriteFileContentsAtomically(file.GetPath(), "new contents", boost::filesystem::perms::owner_read);
+
+    // The opened descriptor still refers to the cached contents
+    EXPECT_TRUE(fs::IsOpenedFileUnchanged(info));
+}
+
 USERVER_NAMESPACE_END
@@ -78,6 +78,10 @@ void Logging::Init(const ComponentConfig& config, const ComponentContext& contex
             );
         }
 
+        if (logger_config.testsuite_capture && logger_config.format == logging::Format::kBinary) {
+            throw std::runtime_error("Testsuite capture requires a text log format");
+        }
+
         auto logger = logging::impl::GetDefaultLoggerOrMakeTpLogger(logger_config);
 
         if (is_default_logger) {
@@ -273,13 +277,18 @@ properties:
                       - tskv
                       - ltsv
                       - raw
+                      - binary
+                deferred_formatting:
+                    type: boolean
+                    description: format the values in the logger task instead of the logging thread
+                    defaultDescription: false
                 flush_level:
                     type: string
                     description: messages of this and higher levels get flushed to the file immediately
                     defaultDescription: warning
                 message_queue_size:
                     type: integer
-                    description: the size of internal message queue, must be a power of 2
+                    description: the maximum number of messages buffered by each thread that writes to the logger, must be a power of 2
                     defaultDescription: 65536
                 overflow_behavior:
                     type: string
@@ -37,6 +37,8 @@ LoggerConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<Logg
 
     config.format = value["format"].As<Format>();
 
+    config.deferred_formatting = value["deferred_formatting"].As<bool>(config.deferred_formatting);
+
     config.flush_level = value["flush_level"].As<logging::Level>(config.flush_level);
 
     config.message_queue_size = value["message_queue_size"].As<size_t>(config.message_queue_size);
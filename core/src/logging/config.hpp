@@ -32,6 +32,7 @@ struct LoggerConfig final {
     std::string file_path;
     Level level = Level::kInfo;
     Format format = Format::kTskv;
+    bool deferred_formatting = false;
     Level flush_level = Level::kWarning;
 
     // must be a power of 2
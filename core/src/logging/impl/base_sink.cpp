@@ -1,5 +1,7 @@
 #include "base_sink.hpp"
 
+#include <boost/container/small_vector.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace logging::impl {
@@ -14,6 +16,18 @@ void BaseSink::Log(const LogMessage& message) {
     }
 }
 
+void BaseSink::LogMany(utils::span<const LogMessage> messages) {
+    boost::container::small_vector<std::string_view, 64> logs;
+    for (const auto& message : messages) {
+        if (ShouldLog(message.level)) {
+            logs.push_back(message.payload);
+        }
+    }
+    if (!logs.empty()) {
+        WriteMany(logs);
+    }
+}
+
 void BaseSink::Flush() {}
 
 void BaseSink::Reopen(ReopenMode) {}
@@ -24,6 +38,12 @@ Level BaseSink::GetLevel() const { return level_.load(); }
 
 bool BaseSink::ShouldLog(Level msg_level) const { return msg_level >= level_.load(); }
 
+void BaseSink::WriteMany(utils::span<const std::string_view> logs) {
+    for (const auto log : logs) {
+        Write(log);
+    }
+}
+
 }  // namespace logging::impl
 
 USERVER_NAMESPACE_END
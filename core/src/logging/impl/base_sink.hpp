@@ -1,9 +1,11 @@
 #pragma once
 
 #include <atomic>
+#include <string_view>
 
 #include <logging/impl/reopen_mode.hpp>
 #include <userver/logging/level.hpp>
+#include <userver/utils/span.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -22,6 +24,9 @@ public:
 
     void Log(const LogMessage& message);
 
+    /// Writes the messages that pass the sink level with a single WriteMany
+    void LogMany(utils::span<const LogMessage> messages);
+
     virtual void Flush();
 
     virtual void Reopen(ReopenMode);
@@ -35,6 +40,10 @@ protected:
 
     virtual void Write(std::string_view log) = 0;
 
+    /// Writes the records in order, sinks with vectored I/O should override it.
+    /// The default implementation calls Write for each record.
+    virtual void WriteMany(utils::span<const std::string_view> logs);
+
 private:
     std::atomic<Level> level_{Level::kTrace};
 };
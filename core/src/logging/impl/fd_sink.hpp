@@ -21,6 +21,8 @@ public:
 protected:
     void Write(std::string_view log) final;
 
+    void WriteMany(utils::span<const std::string_view> logs) final;
+
     fs::blocking::FileDescriptor& GetFd();
 
     void SetFd(fs::blocking::FileDescriptor&& fd);
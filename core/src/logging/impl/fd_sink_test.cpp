@@ -72,4 +72,25 @@ UTEST(FdSink, PipeSinkLogMulti) {
     read_task.Get();
 }
 
+UTEST(FdSink, PipeSinkLogMany) {
+    engine::io::Pipe fd_pipe{};
+
+    auto read_task = engine::AsyncNoSpan([&fd_pipe] {
+        const auto result = test::ReadFromFd(fs::blocking::FileDescriptor::AdoptFd(fd_pipe.reader.Release()));
+        EXPECT_EQ(result, test::Messages("message", "message 3"));
+    });
+    {
+        auto sink = logging::impl::FdSink{fs::blocking::FileDescriptor::AdoptFd(fd_pipe.writer.Release())};
+        sink.SetLevel(logging::Level::kWarning);
+
+        const logging::impl::LogMessage messages[] = {
+            {"message\n", logging::Level::kWarning},
+            {"message 2\n", logging::Level::kInfo},
+            {"message 3\n", logging::Level::kCritical},
+        };
+        EXPECT_NO_THROW(sink.LogMany(messages));
+    }
+    read_task.Get();
+}
+
 USERVER_NAMESPACE_END
@@ -12,7 +12,7 @@ void DumpMetric(utils::statistics::Writer& writer, const impl::LogStatistics& st
     utils::statistics::Rate total;
 
     for (size_t i = 0; i < stats.by_level.size(); ++i) {
-        const auto by_level = stats.by_level[i].Load();
+        const utils::statistics::Rate by_level{stats.by_level[i].Read()};
         writer["by_level"].ValueWithLabels(by_level, {"level", ToString(static_cast<Level>(i))});
         total += by_level;
     }
@@ -6,12 +6,21 @@
 #include <netinet/tcp.h>
 #include <sys/socket.h>
 #include <sys/types.h>
+#include <sys/uio.h>
+#include <algorithm>
+#include <array>
 #include <cstring>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace logging::impl {
 
+namespace {
+
+constexpr std::size_t kMaxIovecs = 256;
+
+}  // namespace
+
 TcpSocketClient::TcpSocketClient(std::vector<engine::io::Sockaddr> addrs) : addrs_(std::move(addrs)) {}
 
 void TcpSocketClient::Connect() {
@@ -44,6 +53,29 @@ void TcpSocketClient::Send(const char* data, size_t n_bytes) {
     }
 }
 
+void TcpSocketClient::Send(utils::span<const std::string_view> logs) {
+    std::array<::iovec, kMaxIovecs> iovecs{};
+
+    while (!logs.empty()) {
+        const auto count = std::min(logs.size(), iovecs.size());
+        std::size_t n_bytes = 0;
+        for (std::size_t i = 0; i < count; ++i) {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+            iovecs[i].iov_base = const_cast<char*>(logs[i].data());
+            iovecs[i].iov_len = logs[i].size();
+            n_bytes += logs[i].size();
+        }
+
+        const auto send_result = socket_.SendAll(iovecs.data(), count, {});
+        if (n_bytes != send_result) {
+            throw std::runtime_error(
+                fmt::format("Failed to send {} bytes because the remote closed the connection", n_bytes)
+            );
+        }
+        logs = logs.subspan(count);
+    }
+}
+
 void TcpSocketClient::Close() { socket_.Close(); }
 
 bool TcpSocketClient::IsConnected() { return socket_.Fd() != -1; }
@@ -65,6 +97,14 @@ void TcpSocketSink::Write(std::string_view log) {
     client_.Send(log.data(), log.size());
 }
 
+void TcpSocketSink::WriteMany(utils::span<const std::string_view> logs) {
+    const std::lock_guard lock{mutex_};
+    if (!client_.IsConnected()) {
+        client_.Connect();
+    }
+    client_.Send(logs);
+}
+
 }  // namespace logging::impl
 
 USERVER_NAMESPACE_END
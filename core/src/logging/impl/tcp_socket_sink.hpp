@@ -24,6 +24,7 @@ public:
 
     void Connect();
     void Send(const char* data, size_t n_bytes);
+    void Send(utils::span<const std::string_view> logs);
     bool IsConnected();
     void Close();
 
@@ -45,6 +46,8 @@ public:
 protected:
     void Write(std::string_view log) final;
 
+    void WriteMany(utils::span<const std::string_view> logs) final;
+
 private:
     std::mutex mutex_;
     impl::TcpSocketClient client_;
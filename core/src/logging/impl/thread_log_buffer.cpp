@@ -0,0 +1,114 @@
+#include <logging/impl/thread_log_buffer.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <new>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace logging::impl {
+
+struct ThreadLogBuffer::Block final {
+    static constexpr std::size_t kSize = 64;
+
+    // Records are constructed on push and destroyed on pop, default
+    // constructing async::Log would query the clock for each slot.
+    union Slot {
+        Slot() noexcept {}
+        ~Slot() {}
+
+        async::Log log;
+    };
+
+    std::array<Slot, kSize> slots;
+    std::atomic<Block*> next{nullptr};
+};
+
+ThreadLogBuffer::ThreadLogBuffer(std::size_t max_size) : max_size_(max_size) {
+    UINVARIANT(max_size != 0, "Invalid max buffer size");
+    auto* const block = new Block{};
+    producer_.block = block;
+    consumer_.block = block;
+}
+
+ThreadLogBuffer::~ThreadLogBuffer() {
+    std::vector<async::Log> unconsumed;
+    PopMany(unconsumed, std::numeric_limits<std::size_t>::max());
+
+    auto* block = consumer_.block;
+    while (block) {
+        auto* const next = block->next.load(std::memory_order_relaxed);
+        delete block;
+        block = next;
+    }
+}
+
+bool ThreadLogBuffer::TryPush(async::Log&& log) {
+    const auto pushed = producer_.pushed.load(std::memory_order_relaxed);
+    if (pushed - consumer_.popped.load(std::memory_order_acquire) >= max_size_.load(std::memory_order_relaxed)) {
+        return false;
+    }
+
+    if (producer_.index == Block::kSize) {
+        auto* const block = new Block{};
+        // Published to the consumer by the `pushed` store below.
+        producer_.block->next.store(block, std::memory_order_relaxed);
+        producer_.block = block;
+        producer_.index = 0;
+    }
+
+    new (&producer_.block->slots[producer_.index].log) async::Log(std::move(log));
+    ++producer_.index;
+    producer_.pushed.store(pushed + 1, std::memory_order_release);
+    return true;
+}
+
+void ThreadLogBuffer::SetMaxSize(std::size_t max_size) noexcept {
+    UASSERT(max_size != 0);
+    max_size_.store(max_size, std::memory_order_relaxed);
+}
+
+bool ThreadLogBuffer::HasFreeCapacity() const noexcept {
+    return producer_.pushed.load(std::memory_order_relaxed) - consumer_.popped.load(std::memory_order_acquire) <
+           max_size_.load(std::memory_order_relaxed);
+}
+
+std::size_t ThreadLogBuffer::PopMany(std::vector<async::Log>& out, std::size_t max_count) {
+    const auto popped = consumer_.popped.load(std::memory_order_relaxed);
+    const auto available = producer_.pushed.load(std::memory_order_acquire) - popped;
+    const auto count = static_cast<std::size_t>(std::min<std::uint64_t>(available, max_count));
+    if (count == 0) return 0;
+
+    // Moving the records out must not throw, otherwise they would be lost.
+    out.reserve(out.size() + count);
+
+    for (std::size_t i = 0; i < count; ++i) {
+        if (consumer_.index == Block::kSize) {
+            // The producer has already switched to the next block, because
+            // there are records after the end of the current one.
+            auto* const next = consumer_.block->next.load(std::memory_order_relaxed);
+            UASSERT(next);
+            delete consumer_.block;
+            consumer_.block = next;
+            consumer_.index = 0;
+        }
+
+        auto& log = consumer_.block->slots[consumer_.index].log;
+        out.push_back(std::move(log));
+        log.~Log();
+        ++consumer_.index;
+    }
+
+    consumer_.popped.store(popped + count, std::memory_order_release);
+    return count;
+}
+
+bool ThreadLogBuffer::IsEmpty() const noexcept {
+    return producer_.pushed.load(std::memory_order_acquire) == consumer_.popped.load(std::memory_order_acquire);
+}
+
+}  // namespace logging::impl
+
+USERVER_NAMESPACE_END
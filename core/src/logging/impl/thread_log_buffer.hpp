@@ -0,0 +1,81 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <userver/concurrent/impl/interference_shield.hpp>
+#include <userver/logging/level.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace logging::impl {
+
+namespace async {
+
+struct Log {
+    Level level{};
+    std::string payload{};
+    std::chrono::system_clock::time_point time{std::chrono::system_clock::now()};
+};
+
+}  // namespace async
+
+/// @brief A wait-free single-producer single-consumer queue of log records,
+/// that is written by a single thread and drained by the logger consumer.
+///
+/// Records are stored in fixed-size blocks that are allocated by the producer
+/// on demand and freed by the consumer, so an idle buffer only holds a single
+/// block. The producer and the consumer sides live on different cache lines
+/// and share nothing except the counters of pushed and popped records.
+class ThreadLogBuffer final {
+public:
+    explicit ThreadLogBuffer(std::size_t max_size);
+
+    ThreadLogBuffer(ThreadLogBuffer&&) = delete;
+    ThreadLogBuffer& operator=(ThreadLogBuffer&&) = delete;
+    ~ThreadLogBuffer();
+
+    /// @returns false if `max_size` records are already buffered.
+    /// Must only be called by the producer thread.
+    bool TryPush(async::Log&& log);
+
+    /// May be called by anyone. The records already buffered above the new
+    /// limit are kept.
+    void SetMaxSize(std::size_t max_size) noexcept;
+
+    /// May be called by anyone, the result is approximate for a non-producer.
+    bool HasFreeCapacity() const noexcept;
+
+    /// Appends at most `max_count` records to `out`.
+    /// @returns the number of the appended records.
+    /// Must only be called by the consumer.
+    std::size_t PopMany(std::vector<async::Log>& out, std::size_t max_count);
+
+    /// May be called by anyone, the result is approximate for a non-consumer.
+    bool IsEmpty() const noexcept;
+
+private:
+    struct Block;
+
+    std::atomic<std::size_t> max_size_;
+
+    struct alignas(concurrent::impl::kDestructiveInterferenceSize) ProducerSide {
+        Block* block{nullptr};
+        std::size_t index{0};
+        std::atomic<std::uint64_t> pushed{0};
+    } producer_;
+
+    struct alignas(concurrent::impl::kDestructiveInterferenceSize) ConsumerSide {
+        Block* block{nullptr};
+        std::size_t index{0};
+        std::atomic<std::uint64_t> popped{0};
+    } consumer_;
+};
+
+}  // namespace logging::impl
+
+USERVER_NAMESPACE_END
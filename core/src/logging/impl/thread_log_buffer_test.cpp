@@ -0,0 +1,110 @@
+#include <logging/impl/thread_log_buffer.hpp>
+
+#include <thread>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+logging::impl::async::Log MakeLog(std::size_t index) { return {logging::Level::kInfo, std::to_string(index)}; }
+
+}  // namespace
+
+TEST(ThreadLogBuffer, PushPop) {
+    logging::impl::ThreadLogBuffer buffer{1000};
+    EXPECT_TRUE(buffer.IsEmpty());
+
+    // Spans several blocks
+    for (std::size_t i = 0; i < 300; ++i) {
+        ASSERT_TRUE(buffer.TryPush(MakeLog(i)));
+    }
+    EXPECT_FALSE(buffer.IsEmpty());
+
+    std::vector<logging::impl::async::Log> logs;
+    EXPECT_EQ(buffer.PopMany(logs, 100), 100);
+    EXPECT_EQ(buffer.PopMany(logs, 1000), 200);
+    EXPECT_EQ(buffer.PopMany(logs, 1000), 0);
+    EXPECT_TRUE(buffer.IsEmpty());
+
+    ASSERT_EQ(logs.size(), 300);
+    for (std::size_t i = 0; i < logs.size(); ++i) {
+        EXPECT_EQ(logs[i].payload, std::to_string(i));
+    }
+}
+
+TEST(ThreadLogBuffer, Overflow) {
+    logging::impl::ThreadLogBuffer buffer{2};
+
+    EXPECT_TRUE(buffer.TryPush(MakeLog(0)));
+    EXPECT_TRUE(buffer.HasFreeCapacity());
+    EXPECT_TRUE(buffer.TryPush(MakeLog(1)));
+    EXPECT_FALSE(buffer.HasFreeCapacity());
+    EXPECT_FALSE(buffer.TryPush(MakeLog(2)));
+
+    std::vector<logging::impl::async::Log> logs;
+    EXPECT_EQ(buffer.PopMany(logs, 1), 1);
+    EXPECT_TRUE(buffer.TryPush(MakeLog(3)));
+
+    EXPECT_EQ(buffer.PopMany(logs, 10), 2);
+    ASSERT_EQ(logs.size(), 3);
+    EXPECT_EQ(logs[2].payload, "3");
+}
+
+TEST(ThreadLogBuffer, SetMaxSize) {
+    logging::impl::ThreadLogBuffer buffer{4};
+    for (std::size_t i = 0; i < 3; ++i) {
+        ASSERT_TRUE(buffer.TryPush(MakeLog(i)));
+    }
+
+    // The records above the new limit are kept
+    buffer.SetMaxSize(1);
+    EXPECT_FALSE(buffer.HasFreeCapacity());
+    EXPECT_FALSE(buffer.TryPush(MakeLog(3)));
+
+    std::vector<logging::impl::async::Log> logs;
+    EXPECT_EQ(buffer.PopMany(logs, 10), 3);
+    EXPECT_TRUE(buffer.TryPush(MakeLog(4)));
+    EXPECT_FALSE(buffer.TryPush(MakeLog(5)));
+
+    buffer.SetMaxSize(2);
+    EXPECT_TRUE(buffer.TryPush(MakeLog(6)));
+}
+
+TEST(ThreadLogBuffer, DestroyNonEmpty) {
+    logging::impl::ThreadLogBuffer buffer{1000};
+    for (std::size_t i = 0; i < 200; ++i) {
+        ASSERT_TRUE(buffer.TryPush(MakeLog(i)));
+    }
+}
+
+TEST(ThreadLogBuffer, ConcurrentPushPop) {
+    constexpr std::size_t kCount = 100'000;
+    logging::impl::ThreadLogBuffer buffer{100};
+
+    std::thread producer([&buffer] {
+        for (std::size_t i = 0; i < kCount; ++i) {
+            auto log = MakeLog(i);
+            while (!buffer.TryPush(std::move(log))) {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    std::vector<logging::impl::async::Log> logs;
+    std::size_t expected = 0;
+    while (expected < kCount) {
+        logs.clear();
+        buffer.PopMany(logs, 64);
+        for (const auto& log : logs) {
+            ASSERT_EQ(log.payload, std::to_string(expected));
+            ++expected;
+        }
+    }
+
+    producer.join();
+    EXPECT_TRUE(buffer.IsEmpty());
+}
+
+USERVER_NAMESPACE_END
@@ -8,6 +8,7 @@
 
 #include <fmt/format.h>
 
+#include <logging/impl/vectored_write.hpp>
 #include <userver/engine/io/sockaddr.hpp>
 #include <userver/utils/strerror.hpp>
 #include <utils/check_syscall.hpp>
@@ -40,6 +41,15 @@ void UnixSocketClient::send(std::string_view message) {
     }
 }
 
+void UnixSocketClient::send(utils::span<const std::string_view> messages) {
+    try {
+        WriteVectored(socket_, messages);
+    } catch (const std::system_error&) {
+        close();
+        throw;
+    }
+}
+
 void UnixSocketClient::close() {
     if (socket_ != -1) {
         if (::close(socket_) == -1) {
@@ -55,6 +65,8 @@ UnixSocketClient::~UnixSocketClient() { close(); }
 
 void UnixSocketSink::Write(std::string_view log) { client_.send(log); }
 
+void UnixSocketSink::WriteMany(utils::span<const std::string_view> logs) { client_.send(logs); }
+
 void UnixSocketSink::Close() { client_.close(); }
 
 }  // namespace logging::impl
@@ -21,6 +21,7 @@ public:
 
     void connect(std::string_view filename);
     void send(std::string_view message);
+    void send(utils::span<const std::string_view> messages);
     void close();
 
 private:
@@ -36,6 +37,8 @@ public:
 protected:
     void Write(std::string_view log) final;
 
+    void WriteMany(utils::span<const std::string_view> logs) final;
+
 private:
     const std::string filename_;
     impl::UnixSocketClient client_;
@@ -0,0 +1,63 @@
+#include <logging/impl/vectored_write.hpp>
+
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <system_error>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace logging::impl {
+
+namespace {
+
+// Not more than IOV_MAX, which is 1024 on Linux and macOS
+constexpr std::size_t kMaxIovecs = 256;
+
+void WriteAll(int fd, ::iovec* iovecs, std::size_t count) {
+    while (count > 0) {
+        const ::ssize_t written = ::writev(fd, iovecs, static_cast<int>(count));
+        if (written < 0) {
+            if (errno == EAGAIN || errno == EINTR) continue;
+
+            const auto code = std::make_error_code(std::errc{errno});
+            throw std::system_error(code, "calling ::writev");
+        }
+
+        // Skip the fully written records and adjust the partially written one
+        auto left = static_cast<std::size_t>(written);
+        while (count > 0 && left >= iovecs->iov_len) {
+            left -= iovecs->iov_len;
+            ++iovecs;
+            --count;
+        }
+        if (count > 0) {
+            iovecs->iov_base = static_cast<char*>(iovecs->iov_base) + left;
+            iovecs->iov_len -= left;
+        }
+    }
+}
+
+}  // namespace
+
+void WriteVectored(int fd, utils::span<const std::string_view> logs) {
+    std::array<::iovec, kMaxIovecs> iovecs{};
+
+    while (!logs.empty()) {
+        const auto count = std::min(logs.size(), iovecs.size());
+        for (std::size_t i = 0; i < count; ++i) {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+            iovecs[i].iov_base = const_cast<char*>(logs[i].data());
+            iovecs[i].iov_len = logs[i].size();
+        }
+        WriteAll(fd, iovecs.data(), count);
+        logs = logs.subspan(count);
+    }
+}
+
+}  // namespace logging::impl
+
+USERVER_NAMESPACE_END
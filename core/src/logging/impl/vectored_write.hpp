@@ -0,0 +1,17 @@
+#pragma once
+
+#include <string_view>
+
+#include <userver/utils/span.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace logging::impl {
+
+/// Writes all the `logs` to a blocking `fd` with as few `::writev` calls as
+/// possible. Throws std::system_error on failure.
+void WriteVectored(int fd, utils::span<const std::string_view> logs);
+
+}  // namespace logging::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,76 @@
+#include <gtest/gtest.h>
+
+#include <logging/binary_record.hpp>
+#include <logging/logging_test.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/logging/logger.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+StringStreamLogger MakeDeferredStreamLogger(logging::Format format) {
+    auto sink = std::make_unique<StringSink>();
+    auto& stream = sink->GetStream();
+    auto logger = std::make_shared<logging::impl::TpLogger>(format, "test-deferred-logger", true);
+    logger->AddSink(std::move(sink));
+    return {std::move(logger), stream};
+}
+
+void LogValues(logging::LoggerRef logger) {
+    LOG_INFO_TO(logger) << "text\twith=escaping " << 42 << ' ' << -1 << ' ' << 1.5 << ' ' << 0.1f << ' ' << true << ' '
+                        << logging::Hex{255U} << ' ' << logging::HexShort{255U} << ' ' << logging::Quoted{"q\"uote"}
+                        << logging::LogExtra{{"key.with.periods", "value\n"}, {"number", 7}};
+}
+
+std::string WithoutTimestamp(std::string record) {
+    const auto level_pos = record.find("\tlevel=");
+    EXPECT_NE(level_pos, std::string::npos) << record;
+    return record.substr(level_pos);
+}
+
+}  // namespace
+
+TEST_F(LoggingTest, BinaryDeferredFormattingMatchesImmediate) {
+    const auto immediate = MakeNamedStreamLogger("test-immediate-logger", logging::Format::kTskv);
+    const auto deferred = MakeDeferredStreamLogger(logging::Format::kTskv);
+    EXPECT_EQ(deferred.logger->GetFormat(), logging::Format::kBinary);
+
+    LogValues(*immediate.logger);
+    LogValues(*deferred.logger);
+    immediate.logger->Flush();
+    deferred.logger->Flush();
+
+    EXPECT_EQ(WithoutTimestamp(deferred.stream.str()), WithoutTimestamp(immediate.stream.str()));
+}
+
+TEST_F(LoggingTest, BinaryFormatDecoding) {
+    const auto binary = MakeNamedStreamLogger("test-binary-logger", logging::Format::kBinary);
+
+    LOG_WARNING_TO(*binary.logger) << "binary " << 42;
+    logging::impl::LogRaw(*binary.logger, logging::Level::kInfo, "raw text");
+    binary.logger->Flush();
+
+    const auto data = binary.stream.str();
+    const std::string_view first{data};
+    const auto first_size = logging::impl::binary::GetRecordSize(first);
+    ASSERT_NE(first_size, 0);
+    ASSERT_LT(first_size, first.size());
+    const auto second = first.substr(first_size);
+    ASSERT_EQ(logging::impl::binary::GetRecordSize(second), second.size());
+
+    std::string json;
+    logging::impl::binary::FormatRecordAsJson(first.substr(0, first_size), json);
+    EXPECT_NE(json.find(R"("level":"WARNING")"), std::string::npos) << json;
+    EXPECT_NE(json.find(R"("text":"binary 42")"), std::string::npos) << json;
+
+    std::string tskv;
+    logging::impl::binary::FormatRecord(first.substr(0, first_size), logging::Format::kTskv, tskv);
+    EXPECT_EQ(ParseLoggedText(tskv, logging::Format::kTskv), "binary 42");
+
+    std::string raw;
+    logging::impl::binary::FormatRecord(second, logging::Format::kTskv, raw);
+    EXPECT_EQ(raw, "raw text\n");
+}
+
+USERVER_NAMESPACE_END
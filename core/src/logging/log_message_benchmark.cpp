@@ -15,7 +15,9 @@ namespace {
 
 class NoopLogger : public logging::impl::LoggerBase {
 public:
-    NoopLogger() noexcept : LoggerBase(logging::Format::kRaw) { SetLevel(logging::Level::kInfo); }
+    explicit NoopLogger(logging::Format format = logging::Format::kRaw) noexcept : LoggerBase(format) {
+        SetLevel(logging::Level::kInfo);
+    }
     void Log(logging::Level, std::string_view) override {}
     void Flush() override {}
 };
@@ -148,6 +150,21 @@ void LogPrependedTags(benchmark::State& state) {
 }
 BENCHMARK(LogPrependedTags);
 
+// Compares the hot path of the text and the binary (unformatted) records
+void LogMixedValues(benchmark::State& state) {
+    const auto format = state.range(0) ? logging::Format::kBinary : logging::Format::kTskv;
+    const logging::DefaultLoggerGuard guard{std::make_shared<NoopLogger>(format)};
+
+    const auto count = Launder(42);
+    const auto ratio = Launder(0.42);
+    const auto id = Launder(0xDEADBEEFULL);
+    const auto name = Launder(std::string(32, '*'));
+    for ([[maybe_unused]] auto _ : state) {
+        LOG_INFO() << "processed " << count << " items of " << name << ", ratio " << ratio << ", id " << id;
+    }
+}
+BENCHMARK(LogMixedValues)->ArgName("binary")->Arg(false)->Arg(true);
+
 }  // namespace
 
 USERVER_NAMESPACE_END
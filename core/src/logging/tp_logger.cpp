@@ -1,8 +1,12 @@
 #include "tp_logger.hpp"
 
+#include <algorithm>
+
 #include <fmt/format.h>
 
 #include <engine/task/task_context.hpp>
+#include <logging/binary_record.hpp>
+#include <userver/compiler/thread_local.hpp>
 #include <userver/engine/async.hpp>
 #include <userver/engine/task/cancel.hpp>
 #include <userver/logging/impl/tag_writer.hpp>
@@ -15,18 +19,36 @@ USERVER_NAMESPACE_BEGIN
 
 namespace logging::impl {
 
+namespace {
+
+// The records are written to the sinks in batches of this size
+constexpr std::size_t kMaxBatchSize = 128;
+
+std::atomic<std::uint64_t> next_logger_id{1};
+
+struct LocalThreadBuffer final {
+    std::uint64_t logger_id;
+    std::shared_ptr<ThreadLogBuffer> buffer;
+};
+
+// The buffers of the current thread, one per each TpLogger it writes to
+compiler::ThreadLocal local_thread_buffers = [] { return std::vector<LocalThreadBuffer>{}; };
+
+}  // namespace
+
 struct TpLogger::ActionVisitor final {
     TpLogger& logger;
 
-    void operator()(impl::async::Log&& log) const {
-        logger.AccountLogConsumed();
-        logger.BackendLog(std::move(log));
-    }
+    void operator()(impl::async::Log&& log) const { logger.BackendLog(std::move(log)); }
 
     void operator()(impl::async::Stop&&) const noexcept {
         // The consumer thread will check state_ later.
     }
 
+    void operator()(impl::async::Wakeup&&) const noexcept {
+        // The thread buffers are drained before consuming each action.
+    }
+
     void operator()(impl::async::ReopenCoro&& reopen) const noexcept {
         try {
             logger.BackendReopen(reopen.reopen_mode);
@@ -45,8 +67,14 @@ struct TpLogger::ActionVisitor final {
     }
 };
 
-TpLogger::TpLogger(Format format, std::string logger_name) : LoggerBase(format), logger_name_(std::move(logger_name)) {
+TpLogger::TpLogger(Format format, std::string logger_name, bool deferred_formatting)
+    : LoggerBase(deferred_formatting ? Format::kBinary : format),
+      logger_name_(std::move(logger_name)),
+      output_format_(format),
+      id_(next_logger_id.fetch_add(1)) {
     SetLevel(logging::Level::kInfo);
+    batch_.reserve(kMaxBatchSize);
+    batch_messages_.reserve(kMaxBatchSize);
 }
 
 void TpLogger::StartConsumerTask(
@@ -126,28 +154,20 @@ void TpLogger::Flush() {
 impl::LogStatistics& TpLogger::GetStatistics() noexcept { return stats_; }
 
 void TpLogger::Log(Level level, std::string_view msg) {
-    ++stats_.by_level[static_cast<std::size_t>(level)];
+    stats_.by_level[static_cast<std::size_t>(level)].Add(1);
 
     if (GetSinks().empty()) {
         return;
     }
 
-    if (TryWaitFreeQueueCapacity()) {
-        // The queue might have concurrently become full, in which case the size
-        // will temporarily go over the max size. The actual number of log actions
-        // in queue_ will not typically go over max_size + n_threads.
-        produced_->fetch_add(1);
-
-        try {
-            Push(impl::async::Log{level, std::string{msg}});
-        } catch (const std::exception&) {
-            // failed to construct a Log action or a node in Push
-            produced_->fetch_sub(1);
-            throw;
+    if (state_.load() == State::kAsync) {
+        if (!TryLogToThreadBuffer(level, msg)) {
+            ++stats_.dropped;
         }
-    } else {
-        ++stats_.dropped;
+        return;
     }
+
+    Push(impl::async::Log{level, std::string{msg}});
 }
 
 void TpLogger::PrependCommonTags(TagWriter writer) const { impl::default_::PrependCommonTags(writer); }
@@ -187,29 +207,74 @@ void TpLogger::ProcessingLoop() {
             UASSERT(state_ == State::kStoppingAsync);
             break;
         }
+
+        // Pairs with the fence in NotifyConsumer: either we see the new records
+        // here, or the producer sees that we sleep and wakes us up.
+        consumer_sleeping_->store(true);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (HasBufferedLogs()) {
+            consumer_sleeping_->store(false);
+            continue;
+        }
+
+        PruneThreadBuffers();
         queue_.WaitWhileEmpty(queue_consumer_);
+        consumer_sleeping_->store(false);
     }
 
+    // The producers that have seen the async state might have written to their
+    // buffers after the last drain, see NotifyConsumer.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    DrainThreadBuffers();
     CleanUpQueue(std::move(queue_consumer_));
 }
 
-void TpLogger::BackendPerform(impl::async::Action&& action) noexcept {
-    try {
-        std::visit(ActionVisitor{*this}, std::move(action));
-    } catch (const std::exception& e) {
-        UASSERT_MSG(false, fmt::format("Exception while doing an async logging: {}", e.what()));
-    }
-}
+bool TpLogger::TryLogToThreadBuffer(Level level, std::string_view msg) {
+    impl::async::Log log{level, std::string{msg}};
 
-bool TpLogger::HasFreeQueueCapacity() noexcept {
-    return produced_->load() - consumed_->load() < max_queue_size_.load();
-}
+    while (true) {
+        ThreadBufferPtr full_buffer;
+        {
+            auto local_buffers = local_thread_buffers.Use();
+            auto it = std::find_if(local_buffers->begin(), local_buffers->end(), [this](const auto& local) {
+                return local.logger_id == id_;
+            });
+            if (it == local_buffers->end()) {
+                // Forget the buffers of the destroyed loggers
+                local_buffers->erase(
+                    std::remove_if(
+                        local_buffers->begin(),
+                        local_buffers->end(),
+                        [](const auto& local) { return local.buffer.use_count() == 1; }
+                    ),
+                    local_buffers->end()
+                );
+                local_buffers->push_back({id_, RegisterThreadBuffer()});
+                it = std::prev(local_buffers->end());
+            }
+
+            if (it->buffer->TryPush(std::move(log))) {
+                break;
+            }
+            full_buffer = it->buffer;
+        }
 
-bool TpLogger::TryWaitFreeQueueCapacity() {
-    if (HasFreeQueueCapacity()) {
-        return true;
+        if (!TryWaitFreeBufferCapacity(full_buffer)) {
+            return false;
+        }
+        if (state_.load() != State::kAsync) {
+            Push(std::move(log));
+            return true;
+        }
+        // The task might have migrated to another thread while waiting, so
+        // look up the buffer again.
     }
 
+    NotifyConsumer();
+    return true;
+}
+
+bool TpLogger::TryWaitFreeBufferCapacity(const ThreadBufferPtr& buffer) {
     // Do not do blocking push if we are not in a coroutine context.
     if (overflow_policy_.load() != QueueOverflowBehavior::kBlock || !engine::current_task::IsTaskProcessorThread()) {
         return false;
@@ -217,11 +282,71 @@ bool TpLogger::TryWaitFreeQueueCapacity() {
 
     const engine::TaskCancellationBlocker block_cancel;
     std::unique_lock lock{capacity_waiters_mutex_};
-    [[maybe_unused]] const bool success = capacity_waiters_cv_.Wait(lock, [this] { return HasFreeQueueCapacity(); });
+    [[maybe_unused]] const bool success = capacity_waiters_cv_.Wait(lock, [this, &buffer] {
+        return buffer->HasFreeCapacity() || state_.load() != State::kAsync;
+    });
     UASSERT(success);
     return true;
 }
 
+auto TpLogger::RegisterThreadBuffer() -> ThreadBufferPtr {
+    auto buffer = std::make_shared<impl::ThreadLogBuffer>(max_queue_size_.load());
+
+    const std::lock_guard lock{buffers_mutex_};
+    buffers_.push_back(buffer);
+    SplitQueueSize();
+    buffers_version_.fetch_add(1, std::memory_order_release);
+    return buffer;
+}
+
+void TpLogger::PruneThreadBuffers() {
+    const std::lock_guard lock{buffers_mutex_};
+    const auto old_size = buffers_.size();
+    // Forget the drained buffers of the exited threads. Without a thread-local
+    // owner a buffer gets no more records, so it stays empty. Only the queue
+    // consumer removes buffers, so consumer_buffers_ never dangle.
+    buffers_.erase(
+        std::remove_if(
+            buffers_.begin(),
+            buffers_.end(),
+            [](const ThreadBufferPtr& buffer) { return buffer.use_count() == 1 && buffer->IsEmpty(); }
+        ),
+        buffers_.end()
+    );
+    if (buffers_.size() == old_size) return;
+
+    SplitQueueSize();
+    buffers_version_.fetch_add(1, std::memory_order_release);
+}
+
+void TpLogger::SplitQueueSize() noexcept {
+    // message_queue_size bounds the records of all the threads together. Each
+    // thread may buffer at least a single record though.
+    const auto buffers_count = std::max(buffers_.size(), std::size_t{1});
+    const auto per_buffer = std::max(max_queue_size_.load() / buffers_count, std::size_t{1});
+    for (const auto& buffer : buffers_) {
+        buffer->SetMaxSize(per_buffer);
+    }
+}
+
+void TpLogger::NotifyConsumer() {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (state_.load() != State::kAsync) {
+        // The consumer might have already done its final drain.
+        Push(impl::async::Wakeup{});
+    } else if (consumer_sleeping_->load(std::memory_order_relaxed) && consumer_sleeping_->exchange(false)) {
+        Push(impl::async::Wakeup{});
+    }
+}
+
+void TpLogger::BackendPerform(impl::async::Action&& action) noexcept {
+    try {
+        std::visit(ActionVisitor{*this}, std::move(action));
+    } catch (const std::exception& e) {
+        UASSERT_MSG(false, fmt::format("Exception while doing an async logging: {}", e.what()));
+    }
+}
+
 void TpLogger::Push(impl::async::Action&& action) {
     auto node = std::make_unique<impl::async::ActionNode>();
     node->action = std::move(action);
@@ -235,22 +360,10 @@ void TpLogger::DoPush(concurrent::impl::SinglyLinkedBaseHook& node) noexcept {
     }
 }
 
-void TpLogger::AccountLogConsumed() noexcept {
-    consumed_->store(consumed_->load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
-    if (overflow_policy_.load() == QueueOverflowBehavior::kBlock) {
-        {
-            // Atomic consumed_ mutation doesn't need to be protected by lock.
-            // With this lock in place, a waiter can check + wait either:
-            // 1. before us locking, then we will notify the waiter, or
-            // 2. after us locking, then the waiter will receive our updates and
-            //    not fall asleep
-            const std::lock_guard lock{capacity_waiters_mutex_};
-        }
-        capacity_waiters_cv_.NotifyOne();
-    }
-}
-
 void TpLogger::ConsumeNode(concurrent::impl::SinglyLinkedBaseHook& node) noexcept {
+    // The records buffered before the action was pushed must be written first.
+    DrainThreadBuffers();
+
     // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
     auto& action_node = static_cast<impl::async::ActionNode&>(node);
     if (&action_node == &stop_node_) return;
@@ -260,6 +373,7 @@ void TpLogger::ConsumeNode(concurrent::impl::SinglyLinkedBaseHook& node) noexcep
 }
 
 void TpLogger::ConsumeQueueOnce(Queue::Consumer& consumer) noexcept {
+    DrainThreadBuffers();
     while (auto* const node_base = consumer.TryPop()) {
         ConsumeNode(*node_base);
     }
@@ -269,9 +383,95 @@ void TpLogger::CleanUpQueue(Queue::Consumer&& consumer) noexcept {
     std::move(consumer).ConsumeAndStop([this](auto& node) noexcept { ConsumeNode(node); });
 }
 
+void TpLogger::RefreshConsumerBuffers() {
+    if (buffers_version_.load(std::memory_order_acquire) == consumer_buffers_version_) {
+        return;
+    }
+
+    const std::lock_guard lock{buffers_mutex_};
+    consumer_buffers_.clear();
+    for (const auto& buffer : buffers_) {
+        consumer_buffers_.push_back(buffer.get());
+    }
+    consumer_buffers_version_ = buffers_version_.load(std::memory_order_relaxed);
+}
+
+void TpLogger::DrainThreadBuffers() noexcept {
+    const auto write_batch = [this] {
+        BackendLogMany(batch_);
+        batch_.clear();
+        NotifyCapacityWaiters();
+    };
+
+    try {
+        RefreshConsumerBuffers();
+
+        for (const auto& buffer : consumer_buffers_) {
+            while (true) {
+                const auto requested = kMaxBatchSize - batch_.size();
+                const auto popped = buffer->PopMany(batch_, requested);
+                if (batch_.size() == kMaxBatchSize) {
+                    write_batch();
+                }
+                if (popped < requested) break;
+            }
+        }
+
+        if (!batch_.empty()) {
+            write_batch();
+        }
+    } catch (const std::exception& e) {
+        batch_.clear();
+        UASSERT_MSG(false, fmt::format("Exception while draining the thread log buffers: {}", e.what()));
+    }
+}
+
+bool TpLogger::HasBufferedLogs() {
+    RefreshConsumerBuffers();
+    return std::any_of(consumer_buffers_.begin(), consumer_buffers_.end(), [](const impl::ThreadLogBuffer* buffer) {
+        return !buffer->IsEmpty();
+    });
+}
+
+void TpLogger::NotifyCapacityWaiters() noexcept {
+    if (overflow_policy_.load() != QueueOverflowBehavior::kBlock) {
+        return;
+    }
+
+    {
+        // The buffer counters don't need to be protected by lock.
+        // With this lock in place, a waiter can check + wait either:
+        // 1. before us locking, then we will notify the waiter, or
+        // 2. after us locking, then the waiter will receive our updates and
+        //    not fall asleep
+        const std::lock_guard lock{capacity_waiters_mutex_};
+    }
+    // The waiters may wait for different thread buffers
+    capacity_waiters_cv_.NotifyAll();
+}
+
+std::string_view TpLogger::PrepareRecord(const impl::async::Log& log, std::string& storage) const {
+    if (GetFormat() != Format::kBinary) return log.payload;
+
+    // Records that bypass LogHelper, e.g. from LogRaw, are always text.
+    const bool is_binary_record = binary::IsRecord(log.payload);
+    if (output_format_ == Format::kBinary) {
+        if (is_binary_record) return log.payload;
+        storage.clear();
+        binary::AppendTextRecord(storage, log.level, log.payload);
+        return storage;
+    }
+
+    if (!is_binary_record) return log.payload;
+    storage.clear();
+    binary::FormatRecord(log.payload, output_format_, storage);
+    return storage;
+}
+
 void TpLogger::BackendLog(impl::async::Log&& action) const {
+    std::string storage;
     LogMessage message;
-    message.payload = action.payload;
+    message.payload = PrepareRecord(action, storage);
     message.level = action.level;
 
     for (const auto& sink : GetSinks()) {
@@ -287,6 +487,33 @@ void TpLogger::BackendLog(impl::async::Log&& action) const {
     }
 }
 
+void TpLogger::BackendLogMany(utils::span<const impl::async::Log> logs) {
+    batch_messages_.clear();
+    if (GetFormat() == Format::kBinary && batch_records_.size() < logs.size()) {
+        batch_records_.resize(logs.size());
+    }
+
+    bool should_flush = false;
+    for (const auto& [index, log] : utils::enumerate(logs)) {
+        std::string_view payload = log.payload;
+        if (GetFormat() == Format::kBinary) payload = PrepareRecord(log, batch_records_[index]);
+        batch_messages_.push_back(LogMessage{payload, log.level});
+        should_flush = should_flush || ShouldFlush(log.level);
+    }
+
+    for (const auto& sink : GetSinks()) {
+        try {
+            sink->LogMany(batch_messages_);
+        } catch (const std::exception& e) {
+            UASSERT_MSG(false, "While writing log messages caught an exception: " + std::string(e.what()));
+        }
+    }
+
+    if (should_flush) {
+        BackendFlush();
+    }
+}
+
 void TpLogger::BackendFlush() const {
     for (const auto& sink : GetSinks()) {
         try {
@@ -1,9 +1,11 @@
 #pragma once
 
 #include <atomic>
+#include <cstdint>
 #include <future>
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <string_view>
 #include <variant>
@@ -20,6 +22,7 @@
 #include <logging/config.hpp>
 #include <logging/impl/base_sink.hpp>
 #include <logging/impl/reopen_mode.hpp>
+#include <logging/impl/thread_log_buffer.hpp>
 #include <userver/concurrent/impl/interference_shield.hpp>
 #include <userver/concurrent/impl/intrusive_hooks.hpp>
 #include <userver/logging/impl/log_stats.hpp>
@@ -32,12 +35,6 @@ using SinkPtr = std::unique_ptr<BaseSink>;
 
 namespace async {
 
-struct Log {
-    Level level{};
-    std::string payload{};
-    std::chrono::system_clock::time_point time{std::chrono::system_clock::now()};
-};
-
 struct FlushCoro {
     engine::Promise<void> promise;
 };
@@ -53,7 +50,10 @@ struct ReopenCoro {
 
 struct Stop {};
 
-using Action = std::variant<Stop, Log, FlushCoro, FlushThreaded, ReopenCoro>;
+// Notifies the consumer about the new records in the thread buffers
+struct Wakeup {};
+
+using Action = std::variant<Stop, Log, FlushCoro, FlushThreaded, ReopenCoro, Wakeup>;
 
 struct ActionNode final : public concurrent::impl::SinglyLinkedBaseHook {
     Action action{Stop{}};
@@ -62,9 +62,23 @@ struct ActionNode final : public concurrent::impl::SinglyLinkedBaseHook {
 }  // namespace async
 
 /// @brief Asynchronous logger that logs into a specific TaskProcessor.
+///
+/// In async mode each thread writes the log records into its own
+/// ThreadLogBuffer, and the consumer task drains all the buffers in batches.
+/// Other actions (flushes, reopens) and the records logged in sync mode go
+/// through a shared queue; the buffers are drained before each such action.
+///
+/// The max queue size is split evenly between the buffers of the live
+/// threads. The records of a single thread are written in order. A coroutine
+/// that migrates to another thread between two records writes them into
+/// different buffers, so they may be written out of order, the timestamps in
+/// the records stay correct.
+///
+/// With deferred formatting the producers put the records in Format::kBinary,
+/// and the consumer task converts them into the output format.
 class TpLogger final : public LoggerBase {
 public:
-    TpLogger(Format format, std::string logger_name);
+    TpLogger(Format format, std::string logger_name, bool deferred_formatting = false);
     ~TpLogger() override;
 
     void StartConsumerTask(
@@ -100,30 +114,42 @@ private:
     };
 
     using Queue = engine::impl::AsyncFlatCombiningQueue;
-    using QueueSize = std::int64_t;
+    using ThreadBufferPtr = std::shared_ptr<impl::ThreadLogBuffer>;
 
     void ProcessingLoop();
-    bool HasFreeQueueCapacity() noexcept;
-    bool TryWaitFreeQueueCapacity();
+    bool TryLogToThreadBuffer(Level level, std::string_view msg);
+    bool TryWaitFreeBufferCapacity(const ThreadBufferPtr& buffer);
+    ThreadBufferPtr RegisterThreadBuffer();
+    void PruneThreadBuffers();
+    void SplitQueueSize() noexcept;
+    void NotifyConsumer();
     void Push(impl::async::Action&& action);
     void DoPush(concurrent::impl::SinglyLinkedBaseHook& node) noexcept;
     void ConsumeNode(concurrent::impl::SinglyLinkedBaseHook& node) noexcept;
     void ConsumeQueueOnce(Queue::Consumer& consumer) noexcept;
     void CleanUpQueue(Queue::Consumer&& consumer) noexcept;
-    void AccountLogConsumed() noexcept;
+    void RefreshConsumerBuffers();
+    void DrainThreadBuffers() noexcept;
+    bool HasBufferedLogs();
+    void NotifyCapacityWaiters() noexcept;
+    std::string_view PrepareRecord(const impl::async::Log& log, std::string& storage) const;
     void BackendPerform(impl::async::Action&& action) noexcept;
     void BackendLog(impl::async::Log&& action) const;
+    void BackendLogMany(utils::span<const impl::async::Log> logs);
     void BackendFlush() const;
     void BackendReopen(ReopenMode reopen_mode) const;
 
     const std::string logger_name_;
+    const Format output_format_;
+    // Distinguishes the thread buffers of different loggers, is never reused
+    const std::uint64_t id_;
     std::vector<impl::SinkPtr> sinks_;
     mutable impl::LogStatistics stats_{};
 
     engine::Mutex capacity_waiters_mutex_;
     engine::ConditionVariable capacity_waiters_cv_;
     engine::Task consuming_task_;
-    std::atomic<QueueSize> max_queue_size_{std::numeric_limits<QueueSize>::max()};
+    std::atomic<std::size_t> max_queue_size_{std::numeric_limits<std::size_t>::max()};
     std::atomic<QueueOverflowBehavior> overflow_policy_{QueueOverflowBehavior::kDiscard};
     // State changes rarely, no need for an InterferenceShield.
     std::atomic<State> state_{State::kSync};
@@ -132,8 +158,24 @@ private:
     impl::async::ActionNode stop_node_;
 
     Queue queue_;
-    concurrent::impl::InterferenceShield<std::atomic<QueueSize>> produced_{0};
-    concurrent::impl::InterferenceShield<std::atomic<QueueSize>> consumed_{0};
+
+    // Set by the consumer task before waiting for the queue. Written rarely,
+    // but read on each log.
+    concurrent::impl::InterferenceShield<std::atomic<bool>> consumer_sleeping_{false};
+
+    // Registration of the thread buffers, may happen outside coroutines.
+    std::mutex buffers_mutex_;
+    std::vector<ThreadBufferPtr> buffers_;
+    std::atomic<std::uint64_t> buffers_version_{0};
+
+    // Only accessed by the current queue consumer. The buffers are owned by
+    // buffers_, and only the queue consumer removes them from there.
+    std::vector<impl::ThreadLogBuffer*> consumer_buffers_;
+    std::uint64_t consumer_buffers_version_{0};
+    std::vector<impl::async::Log> batch_;
+    std::vector<LogMessage> batch_messages_;
+    // Storage for the records converted by PrepareRecord
+    std::vector<std::string> batch_records_;
 };
 
 }  // namespace logging::impl
@@ -9,6 +9,7 @@
 #include <userver/tracing/span.hpp>
 #include <userver/utils/fast_scope_guard.hpp>
 #include <utils/gbench_auxilary.hpp>
+#include <utils/impl/parallelize_benchmark.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -58,6 +59,21 @@ BENCHMARK_DEFINE_F(TpLoggerBenchmark, LogString)(benchmark::State& state) {
 // Run benchmarks to output string of sizes of 8 bytes to 8 kilobytes
 BENCHMARK_REGISTER_F(TpLoggerBenchmark, LogString)->RangeMultiplier(2)->Range(8, 8 << 10)->Complexity();
 
+BENCHMARK_DEFINE_F(TpLoggerBenchmark, LogStringMT)(benchmark::State& state) {
+    // One more thread for the consumer task
+    engine::RunStandalone(state.range(0) + 1, [&] {
+        auto scope = StartAsyncLoggerScope();
+        const auto msg = Launder(std::string(64, '*'));
+        RunParallelBenchmark(state, [&](auto& range) {
+            for ([[maybe_unused]] auto _ : range) {
+                LOG_INFO() << msg;
+            }
+        });
+    });
+}
+// Logging from many worker threads, must scale without a shared queue head
+BENCHMARK_REGISTER_F(TpLoggerBenchmark, LogStringMT)->RangeMultiplier(2)->Range(1, 64)->UseRealTime();
+
 namespace {
 
 __attribute__((noinline)) void LogDebug() { LOG_DEBUG() << 42; }
@@ -66,7 +66,7 @@ auto MakeTestsuiteSink(const TestsuiteCaptureConfig& config) {
 }  // namespace
 
 std::shared_ptr<TpLogger> MakeTpLogger(const LoggerConfig& config) {
-    auto logger = std::make_shared<TpLogger>(config.format, config.logger_name);
+    auto logger = std::make_shared<TpLogger>(config.format, config.logger_name, config.deferred_formatting);
     logger->SetLevel(config.level);
     logger->SetFlushOn(config.flush_level);
 
@@ -187,6 +187,11 @@ properties:
                         type: integer
                         description: delay in microseconds of the start of abort check routine
                         defaultDescription: 20ms
+                    pipeline_window:
+                        type: integer
+                        description: max number of pipelined HTTP/1.1 requests of a connection to handle concurrently, responses are still sent in order
+                        defaultDescription: 1
+                        minimum: 1
                     http-version:
                         type: string
                         description: HTTP protocol version - 1.1 or 2
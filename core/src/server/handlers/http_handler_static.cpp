@@ -1,9 +1,15 @@
 #include <userver/server/handlers/http_handler_static.hpp>
 
+#include <fmt/format.h>
+
+#include <server/http/http_byte_range.hpp>
 #include <userver/components/component_config.hpp>
 #include <userver/components/component_context.hpp>
 #include <userver/dynamic_config/storage/component.hpp>
 #include <userver/dynamic_config/value.hpp>
+#include <userver/fs/read.hpp>
+#include <userver/http/common_headers.hpp>
+#include <userver/utils/text_light.hpp>
 #include <userver/yaml_config/merge_schemas.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -32,6 +38,24 @@ const dynamic_config::Key<dynamic_config::ValueDict<std::string>> kContentTypeMa
 )"},
 };
 
+// Weak comparison of RFC 9110 13.1.2
+bool IsNoneMatchSatisfied(std::string_view if_none_match, std::string_view etag) {
+    if (if_none_match.empty()) return false;
+    // Entity tags contain no whitespace
+    for (auto tag : utils::text::SplitIntoStringViewVector(if_none_match, ", \t")) {
+        if (tag == "*") return true;
+        if (utils::text::StartsWith(tag, "W/")) tag.remove_prefix(2);
+        if (tag == etag) return true;
+    }
+    return false;
+}
+
+// Strong comparison of RFC 9110 13.1.5. Dates are not supported, so a date
+// never matches and the whole file is sent.
+bool IsRangeConditionSatisfied(std::string_view if_range, std::string_view etag) {
+    return if_range.empty() || if_range == etag;
+}
+
 }  // namespace
 
 HttpHandlerStatic::HttpHandlerStatic(
@@ -43,18 +67,66 @@ HttpHandlerStatic::HttpHandlerStatic(
       storage_(
           context.FindComponent<components::FsCache>(config["fs-cache-component"].As<std::string>("fs-cache-component"))
               .GetClient()
-      ) {}
+      ),
+      sendfile_min_size_(config["sendfile-min-size"].As<std::optional<std::size_t>>()) {}
 
 std::string HttpHandlerStatic::HandleRequestThrow(const http::HttpRequest& request, request::RequestContext&) const {
+    namespace headers = USERVER_NAMESPACE::http::headers;
+
     LOG_DEBUG() << "Handler: " << request.GetRequestPath();
     const auto file = storage_.TryGetFile(request.GetRequestPath());
-    if (file) {
-        const auto config = config_.GetSnapshot();
-        request.GetHttpResponse().SetContentType(config[kContentTypeMap][file->extension]);
-        return file->data;
+    if (!file) {
+        request.GetResponse().SetStatusNotFound();
+        return "File not found";
+    }
+
+    auto& response = request.GetHttpResponse();
+    const auto config = config_.GetSnapshot();
+    response.SetContentType(config[kContentTypeMap][file->extension]);
+    response.SetHeader(headers::kAcceptRanges, std::string{"bytes"});
+    if (!file->etag.empty()) {
+        response.SetHeader(headers::kETag, file->etag);
+        if (IsNoneMatchSatisfied(request.GetHeader(headers::kIfNoneMatch), file->etag)) {
+            response.SetStatus(http::HttpStatus::kNotModified);
+            return {};
+        }
     }
-    request.GetResponse().SetStatusNotFound();
-    return "File not found";
+
+    const auto& data = file->data;
+    auto range = http::impl::ByteRangeRequest{http::impl::ByteRangeRequest::Kind::kWhole, 0, data.size()};
+    const auto& range_header = request.GetHeader(headers::kRange);
+    if (!range_header.empty() && IsRangeConditionSatisfied(request.GetHeader(headers::kIfRange), file->etag)) {
+        range = http::impl::ParseByteRange(range_header, data.size());
+    }
+
+    switch (range.kind) {
+        case http::impl::ByteRangeRequest::Kind::kWhole:
+            break;
+        case http::impl::ByteRangeRequest::Kind::kPartial:
+            response.SetStatus(http::HttpStatus::kPartialContent);
+            response.SetHeader(
+                headers::kContentRange,
+                fmt::format("bytes {}-{}/{}", range.offset, range.offset + range.size - 1, data.size())
+            );
+            break;
+        case http::impl::ByteRangeRequest::Kind::kUnsatisfiable:
+            response.SetStatus(http::HttpStatus::kRangeNotSatisfiable);
+            response.SetHeader(headers::kContentRange, fmt::format("bytes */{}", data.size()));
+            return {};
+    }
+
+    if (sendfile_min_size_ && range.size >= *sendfile_min_size_) {
+        // The file may have been modified in place since it was cached, the
+        // cached contents are served in that case
+        auto fd = fs::IsOpenedFileUnchanged(*file) ? file->file : nullptr;
+
+        response.SetFileBody(http::HttpResponse::FileBody{
+            std::shared_ptr<const std::string>(file, &file->data), std::move(fd), range.offset, range.size});
+        return {};
+    }
+
+    if (range.kind == http::impl::ByteRangeRequest::Kind::kWhole) return data;
+    return data.substr(range.offset, range.size);
 }
 
 yaml_config::Schema HttpHandlerStatic::GetStaticConfigSchema() {
@@ -69,6 +141,11 @@ properties:
         type: string
         description: Name of the FsCache component
         defaultDescription: fs-cache-component
+    sendfile-min-size:
+        type: integer
+        description: minimal file size in bytes to send with sendfile(2)
+        defaultDescription: sendfile is not used
+        minimum: 0
 )");
 }
 
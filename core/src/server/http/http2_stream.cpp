@@ -67,7 +67,12 @@ bool Stream::CheckUrlComplete() {
 
 void Stream::PushChunk(std::string&& chunk) {
     if (chunk.empty()) return;
-    chunks_.push_back(std::move(chunk));
+    chunks_.emplace_back(std::move(chunk));
+}
+
+void Stream::PushSharedChunk(std::shared_ptr<const std::string> owner, std::string_view chunk) {
+    if (chunk.empty()) return;
+    chunks_.emplace_back(std::move(owner), chunk);
 }
 
 ssize_t Stream::GetMaxSize(std::size_t max_len, std::uint32_t* flags) {
@@ -110,7 +115,7 @@ void Stream::Send(engine::io::Socket& socket, std::string_view data_frame_header
         }
         UASSERT(chunk.size() > pos_in_first_chunk_);
         const auto part =
-            std::string_view{chunk}.substr(pos_in_first_chunk_, std::min(chunk.size() - pos_in_first_chunk_, budget));
+            chunk.GetView().substr(pos_in_first_chunk_, std::min(chunk.size() - pos_in_first_chunk_, budget));
         parts.push_back({part.data(), part.size()});
         pos_in_first_chunk_ += part.size();
         if (pos_in_first_chunk_ >= chunk.size()) {
@@ -1,5 +1,9 @@
 #pragma once
 
+#include <memory>
+#include <string>
+#include <string_view>
+
 #include <nghttp2/nghttp2.h>
 #include <boost/container/small_vector.hpp>
 
@@ -42,17 +46,34 @@ public:
 
     bool CheckUrlComplete();
     void PushChunk(std::string&& chunk);
+    // Sends a part of the `owner` without copying it
+    void PushSharedChunk(std::shared_ptr<const std::string> owner, std::string_view chunk);
     ssize_t GetMaxSize(std::size_t max_len, std::uint32_t* flags);
     void Send(engine::io::Socket& socket, std::string_view data_frame_header, std::size_t max_len);
     nghttp2_data_provider* GetNativeProvider() { return &nghttp2_provider_; }
 
 private:
+    class Chunk final {
+    public:
+        explicit Chunk(std::string&& data) : data_(std::move(data)) {}
+        Chunk(std::shared_ptr<const std::string> owner, std::string_view view)
+            : owner_(std::move(owner)), view_(view) {}
+
+        std::string_view GetView() const noexcept { return owner_ ? view_ : std::string_view{data_}; }
+        std::size_t size() const noexcept { return GetView().size(); }
+
+    private:
+        std::string data_;
+        std::shared_ptr<const std::string> owner_;
+        std::string_view view_;
+    };
+
     bool url_complete_{false};
     HttpRequestConstructor constructor_;
     const Id id_;
     // Body sending
     nghttp2_data_provider nghttp2_provider_{};
-    boost::container::small_vector<std::string, 16> chunks_{};
+    boost::container::small_vector<Chunk, 16> chunks_{};
     std::size_t pos_in_first_chunk_{0};
     // for the streaming API
     bool is_streaming_{false};
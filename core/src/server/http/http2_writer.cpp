@@ -102,11 +102,12 @@ public:
 
     void WriteHttpResponse() {
         auto data = response_.ExtractData();
+        const bool has_file_body = data.empty() && response_.file_body_;
 
         auto headers = GetHeaders();
         const bool is_body_forbidden = IsBodyForbiddenForStatus(response_.status_);
 
-        if (is_body_forbidden && !data.empty()) {
+        if (is_body_forbidden && (!data.empty() || has_file_body)) {
             LOG_LIMITED_WARNING() << "Non-empty body provided for response with HTTP2 code "
                                   << static_cast<int>(response_.status_)
                                   << " which does not allow one, it will be dropped";
@@ -114,12 +115,17 @@ public:
 
         const auto stream_id = response_.GetStreamId().value();
         auto& stream = http2_session_.GetStreamChecked(Stream::Id{stream_id});
-        stream.SetStreaming(response_.IsBodyStreamed() && data.empty());
+        stream.SetStreaming(response_.IsBodyStreamed() && data.empty() && !has_file_body);
 
         std::size_t bytes = headers.GetSize();
         nghttp2_data_provider* provider{nullptr};
         if (response_.request_.GetMethod() != HttpMethod::kHead && !is_body_forbidden) {
-            if (!stream.IsStreaming()) {
+            if (has_file_body) {
+                // The cached file contents outlive the stream, no copy is needed
+                const auto body = response_.GetFileBodyView();
+                bytes += body.size();
+                stream.PushSharedChunk(response_.file_body_->contents, body);
+            } else if (!stream.IsStreaming()) {
                 bytes += data.size();
                 stream.PushChunk(std::move(data));
             }
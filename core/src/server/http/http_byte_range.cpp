@@ -0,0 +1,78 @@
+#include <server/http/http_byte_range.hpp>
+
+#include <algorithm>
+#include <charconv>
+#include <optional>
+
+#include <userver/utils/str_icase.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http::impl {
+
+namespace {
+
+constexpr std::string_view kBytesUnit = "bytes";
+
+std::optional<std::size_t> ParsePosition(std::string_view str) {
+    if (str.empty()) return std::nullopt;
+    std::size_t value{0};
+    const auto [ptr, ec] = std::from_chars(str.data(), str.data() + str.size(), value);
+    if (ec != std::errc{} || ptr != str.data() + str.size()) return std::nullopt;
+    return value;
+}
+
+std::string_view TrimSpaces(std::string_view str) {
+    while (!str.empty() && (str.front() == ' ' || str.front() == '\t')) str.remove_prefix(1);
+    while (!str.empty() && (str.back() == ' ' || str.back() == '\t')) str.remove_suffix(1);
+    return str;
+}
+
+}  // namespace
+
+ByteRangeRequest ParseByteRange(std::string_view range_header, std::size_t content_length) {
+    using Kind = ByteRangeRequest::Kind;
+
+    const auto eq_pos = range_header.find('=');
+    if (eq_pos == std::string_view::npos ||
+        !utils::StrIcaseEqual{}(TrimSpaces(range_header.substr(0, eq_pos)), kBytesUnit)) {
+        return {};
+    }
+
+    const auto range_spec = TrimSpaces(range_header.substr(eq_pos + 1));
+    if (range_spec.find(',') != std::string_view::npos) {
+        // multipart/byteranges responses are not supported
+        return {};
+    }
+
+    const auto dash_pos = range_spec.find('-');
+    if (dash_pos == std::string_view::npos) return {};
+    const auto first_str = TrimSpaces(range_spec.substr(0, dash_pos));
+    const auto last_str = TrimSpaces(range_spec.substr(dash_pos + 1));
+
+    if (first_str.empty()) {
+        // suffix-range: the last N bytes
+        const auto suffix_length = ParsePosition(last_str);
+        if (!suffix_length) return {};
+        if (*suffix_length == 0 || content_length == 0) return {Kind::kUnsatisfiable};
+        const auto size = std::min(*suffix_length, content_length);
+        return {Kind::kPartial, content_length - size, size};
+    }
+
+    const auto first = ParsePosition(first_str);
+    if (!first) return {};
+
+    std::size_t last = content_length == 0 ? 0 : content_length - 1;
+    if (!last_str.empty()) {
+        const auto parsed_last = ParsePosition(last_str);
+        if (!parsed_last || *parsed_last < *first) return {};
+        last = std::min(*parsed_last, last);
+    }
+
+    if (*first >= content_length) return {Kind::kUnsatisfiable};
+    return {Kind::kPartial, *first, last - *first + 1};
+}
+
+}  // namespace server::http::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http::impl {
+
+/// @brief Result of matching a `Range: bytes=...` request header against a
+/// representation of a known size, RFC 9110 14.2
+struct ByteRangeRequest final {
+    enum class Kind {
+        kWhole,           ///< no range or an ignored one, send the whole body
+        kPartial,         ///< send `offset` and `size` with 206
+        kUnsatisfiable,   ///< respond with 416
+    };
+
+    Kind kind{Kind::kWhole};
+    std::size_t offset{0};
+    std::size_t size{0};
+};
+
+/// @brief Parses the Range header value for a body of `content_length` bytes.
+///
+/// Only a single range is served, requests for multiple ranges, ranges in
+/// other units and malformed headers result in ByteRangeRequest::Kind::kWhole
+/// as the RFC allows ignoring the header.
+ByteRangeRequest ParseByteRange(std::string_view range_header, std::size_t content_length);
+
+}  // namespace server::http::impl
+
+USERVER_NAMESPACE_END
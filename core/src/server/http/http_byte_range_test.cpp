@@ -0,0 +1,52 @@
+#include <server/http/http_byte_range.hpp>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using server::http::impl::ByteRangeRequest;
+using server::http::impl::ParseByteRange;
+using Kind = ByteRangeRequest::Kind;
+
+void ExpectPartial(const ByteRangeRequest& range, std::size_t offset, std::size_t size) {
+    EXPECT_EQ(range.kind, Kind::kPartial);
+    EXPECT_EQ(range.offset, offset);
+    EXPECT_EQ(range.size, size);
+}
+
+}  // namespace
+
+TEST(HttpByteRange, Partial) {
+    ExpectPartial(ParseByteRange("bytes=0-499", 10000), 0, 500);
+    ExpectPartial(ParseByteRange("bytes=500-999", 10000), 500, 500);
+    ExpectPartial(ParseByteRange("bytes=9500-", 10000), 9500, 500);
+    ExpectPartial(ParseByteRange("bytes=-500", 10000), 9500, 500);
+    ExpectPartial(ParseByteRange("Bytes = 0-0", 10000), 0, 1);
+}
+
+TEST(HttpByteRange, ClampedToLength) {
+    ExpectPartial(ParseByteRange("bytes=9000-20000", 10000), 9000, 1000);
+    ExpectPartial(ParseByteRange("bytes=-20000", 10000), 0, 10000);
+}
+
+TEST(HttpByteRange, Unsatisfiable) {
+    EXPECT_EQ(ParseByteRange("bytes=10000-", 10000).kind, Kind::kUnsatisfiable);
+    EXPECT_EQ(ParseByteRange("bytes=20000-30000", 10000).kind, Kind::kUnsatisfiable);
+    EXPECT_EQ(ParseByteRange("bytes=-0", 10000).kind, Kind::kUnsatisfiable);
+    EXPECT_EQ(ParseByteRange("bytes=0-", 0).kind, Kind::kUnsatisfiable);
+    EXPECT_EQ(ParseByteRange("bytes=-1", 0).kind, Kind::kUnsatisfiable);
+}
+
+TEST(HttpByteRange, Ignored) {
+    EXPECT_EQ(ParseByteRange("", 10000).kind, Kind::kWhole);
+    EXPECT_EQ(ParseByteRange("items=0-1", 10000).kind, Kind::kWhole);
+    EXPECT_EQ(ParseByteRange("bytes=0-1, 5-6", 10000).kind, Kind::kWhole);
+    EXPECT_EQ(ParseByteRange("bytes=5-1", 10000).kind, Kind::kWhole);
+    EXPECT_EQ(ParseByteRange("bytes=a-b", 10000).kind, Kind::kWhole);
+    EXPECT_EQ(ParseByteRange("bytes=-", 10000).kind, Kind::kWhole);
+    EXPECT_EQ(ParseByteRange("bytes 0-1", 10000).kind, Kind::kWhole);
+}
+
+USERVER_NAMESPACE_END
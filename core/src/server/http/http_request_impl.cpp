@@ -74,8 +74,20 @@ namespace server::http {
 // unordered_maps because we don't need different seeds and want to avoid its
 // overhead.
 HttpRequestImpl::HttpRequestImpl(request::ResponseDataAccounter& data_accounter, engine::io::Sockaddr remote_address)
-    : form_data_args_(kZeroAllocationBucketCount, request_args_.hash_function()),
-      path_args_by_name_index_(kZeroAllocationBucketCount, request_args_.hash_function()),
+    : request_args_(
+          kZeroAllocationBucketCount,
+          utils::StrCaseHash{},
+          std::equal_to<>{},
+          utils::ArenaAllocator<decltype(request_args_)::value_type>{arena_}
+      ),
+      form_data_args_(kZeroAllocationBucketCount, request_args_.hash_function()),
+      path_args_(utils::ArenaAllocator<std::string>{arena_}),
+      path_args_by_name_index_(
+          kZeroAllocationBucketCount,
+          request_args_.hash_function(),
+          std::equal_to<>{},
+          utils::ArenaAllocator<decltype(path_args_by_name_index_)::value_type>{arena_}
+      ),
       headers_(kBucketCount),
       cookies_(kZeroAllocationBucketCount, request_args_.hash_function()),
       response_(*this, data_accounter, StartTime(), cookies_.hash_function()),
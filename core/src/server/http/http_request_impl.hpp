@@ -17,6 +17,8 @@
 #include <userver/utils/impl/transparent_hash.hpp>
 #include <userver/utils/str_icase.hpp>
 
+#include <utils/monotonic_arena.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace server {
@@ -135,9 +137,27 @@ public:
     void SetResponseStreamId(std::int32_t);
     void SetStreamProducer(impl::Http2StreamEventProducer&& producer);
 
+    // Statistics of the per-request arena, for benchmarks and tests
+    utils::MonotonicArena::Stats GetArenaStats() const { return arena_.GetStats(); }
+
     friend class HttpRequestConstructor;
 
 private:
+    template <typename Value>
+    using ArenaArgsMap = utils::impl::TransparentMap<
+        std::string,
+        Value,
+        utils::StrCaseHash,
+        std::equal_to<>,
+        utils::ArenaAllocator<std::pair<const std::string, Value>>>;
+
+    // Per-request storage for the nodes and buckets of the containers that are
+    // not exposed to users by type. The argument names and values are
+    // std::string and still allocate if they do not fit into SSO. Fits the
+    // containers of a few arguments, must be declared before them, as it
+    // outlives them.
+    utils::MonotonicArena arena_;
+
     HttpMethod method_{HttpMethod::kUnknown};
     unsigned short http_major_{1};
     unsigned short http_minor_{1};
@@ -145,10 +165,10 @@ private:
     std::string request_path_;
     std::string request_body_;
     std::string path_suffix_;
-    utils::impl::TransparentMap<std::string, std::vector<std::string>, utils::StrCaseHash> request_args_;
+    ArenaArgsMap<std::vector<std::string>> request_args_;
     utils::impl::TransparentMap<std::string, std::vector<FormDataArg>, utils::StrCaseHash> form_data_args_;
-    std::vector<std::string> path_args_;
-    utils::impl::TransparentMap<std::string, size_t, utils::StrCaseHash> path_args_by_name_index_;
+    std::vector<std::string, utils::ArenaAllocator<std::string>> path_args_;
+    ArenaArgsMap<size_t> path_args_by_name_index_;
     HttpRequest::HeadersMap headers_;
     HttpRequest::CookiesMap cookies_;
     bool is_final_{false};
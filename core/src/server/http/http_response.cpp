@@ -1,12 +1,14 @@
 #include <userver/server/http/http_response.hpp>
 
 #include <array>
+#include <utility>
 
 #include <cctz/time_zone.h>
 #include <fmt/compile.h>
 
 #include <userver/engine/deadline.hpp>
 #include <userver/engine/io/socket.hpp>
+#include <userver/fs/blocking/file_descriptor.hpp>
 #include <userver/hostinfo/blocking/get_hostname.hpp>
 #include <userver/http/common_headers.hpp>
 #include <userver/http/content_type.hpp>
@@ -291,6 +293,8 @@ void HttpResponse::SendResponse(engine::io::RwBase& socket) {
 
     if (IsBodyStreamed() && GetData().empty()) {
         sent_bytes = SetBodyStreamed(socket, header);
+    } else if (file_body_ && GetData().empty()) {
+        sent_bytes = SetBodyFromFile(socket, header);
     } else {
         // e.g. a CustomHandlerException
         sent_bytes = SetBodyNotStreamed(socket, header);
@@ -327,6 +331,53 @@ HttpResponse::SetBodyNotStreamed(engine::io::RwBase& socket, USERVER_NAMESPACE::
     return sent_bytes;
 }
 
+std::size_t
+HttpResponse::SetBodyFromFile(engine::io::RwBase& socket, USERVER_NAMESPACE::http::headers::HeadersString& header) {
+    UASSERT(file_body_);
+    const bool is_body_forbidden = IsBodyForbiddenForStatus(status_);
+    const bool is_head_request = request_.GetMethod() == HttpMethod::kHead;
+
+    if (!is_body_forbidden) {
+        impl::OutputHeader(
+            header, USERVER_NAMESPACE::http::headers::kContentLength, fmt::format(FMT_COMPILE("{}"), file_body_->size)
+        );
+    }
+    header.append(kCrlf);
+
+    if (is_head_request || is_body_forbidden) {
+        return socket.WriteAll(header.data(), header.size(), engine::Deadline{});
+    }
+
+    // TLS sockets encrypt the data in user space, so only a plain socket can
+    // send the file without copying it
+    auto* plain_socket = dynamic_cast<engine::io::Socket*>(&socket);
+    if (!file_body_->file || !plain_socket) {
+        const auto body = GetFileBodyView();
+        return socket.WriteAll({{header.data(), header.size()}, {body.data(), body.size()}}, engine::Deadline{});
+    }
+
+    auto sent_bytes = plain_socket->SendAll(header.data(), header.size(), engine::Deadline{});
+    if (sent_bytes != header.size()) return sent_bytes;
+
+    const auto file_sent_bytes = plain_socket->SendFile(
+        file_body_->file->GetNative(), file_body_->offset, file_body_->size, engine::Deadline{}
+    );
+    sent_bytes += file_sent_bytes;
+    if (file_sent_bytes != file_body_->size) {
+        // The declared Content-Length can not be honored anymore, the
+        // connection must not be reused
+        throw engine::io::IoException(
+            fmt::format("File body was sent partially: {} of {} bytes", file_sent_bytes, file_body_->size)
+        );
+    }
+    return sent_bytes;
+}
+
+std::string_view HttpResponse::GetFileBodyView() const {
+    UASSERT(file_body_ && file_body_->contents);
+    return std::string_view{*file_body_->contents}.substr(file_body_->offset, file_body_->size);
+}
+
 std::size_t
 HttpResponse::SetBodyStreamed(engine::io::RwBase& socket, USERVER_NAMESPACE::http::headers::HeadersString& header) {
     const bool is_body_forbidden = IsBodyForbiddenForStatus(status_);
@@ -415,6 +466,18 @@ HttpResponse::Producer HttpResponse::GetBodyProducer() {
     return res;
 }
 
+void HttpResponse::SetBodyStreamEncoder(BodyStreamEncoder encoder) { body_stream_encoder_ = std::move(encoder); }
+
+std::optional<HttpResponse::BodyStreamEncoder> HttpResponse::ExtractBodyStreamEncoder() {
+    return std::exchange(body_stream_encoder_, std::nullopt);
+}
+
+void HttpResponse::SetFileBody(FileBody body) {
+    UINVARIANT(body.contents, "File contents must be set");
+    UINVARIANT(body.offset + body.size <= body.contents->size(), "File body is out of the contents bounds");
+    file_body_ = std::move(body);
+}
+
 }  // namespace server::http
 
 USERVER_NAMESPACE_END
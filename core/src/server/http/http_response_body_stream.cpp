@@ -1,5 +1,9 @@
 #include <userver/server/http/http_response_body_stream.hpp>
 
+#include <utility>
+
+#include <userver/http/common_headers.hpp>
+#include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/overloaded.hpp>
 
@@ -11,9 +15,27 @@ ResponseBodyStream::ResponseBodyStream(
     server::http::HttpResponse::Producer&& queue_producer,
     server::http::HttpResponse& http_response
 )
-    : queue_producer_(std::move(queue_producer)), http_response_(http_response) {}
+    : queue_producer_(std::move(queue_producer)),
+      http_response_(http_response),
+      encoder_(http_response.ExtractBodyStreamEncoder()) {}
+
+ResponseBodyStream::ResponseBodyStream(ResponseBodyStream&& other)
+    : headers_ended_(other.headers_ended_),
+      queue_producer_(std::move(other.queue_producer_)),
+      http_response_(other.http_response_),
+      encoder_(std::exchange(other.encoder_, std::nullopt)) {}
 
 ResponseBodyStream::~ResponseBodyStream() {
+    if (encoder_ && headers_ended_) {
+        try {
+            // Terminates the encoding, e.g. writes the compression trailer
+            auto trailer = encoder_->encode({}, /*is_last=*/true);
+            if (!trailer.empty()) PushEncodedChunk(std::move(trailer), engine::Deadline{});
+        } catch (const std::exception& e) {
+            LOG_WARNING() << "Failed to finish the response body encoding: " << e;
+        }
+    }
+
     if (http_response_.GetStreamId().has_value()) {
         UASSERT(queue_producer_.index() == 2);
         std::get<impl::Http2StreamEventProducer>(queue_producer_).CloseStream(*http_response_.GetStreamId());
@@ -22,6 +44,14 @@ ResponseBodyStream::~ResponseBodyStream() {
 
 void ResponseBodyStream::PushBodyChunk(std::string&& chunk, engine::Deadline deadline) {
     UASSERT_MSG(headers_ended_, "SetEndOfHeaders() was not called before PushBodyChunk()");
+    if (encoder_) {
+        chunk = encoder_->encode(chunk, /*is_last=*/false);
+        if (chunk.empty()) return;
+    }
+    PushEncodedChunk(std::move(chunk), deadline);
+}
+
+void ResponseBodyStream::PushEncodedChunk(std::string&& chunk, engine::Deadline deadline) {
     std::visit(
         utils::Overloaded{
             [&chunk, &deadline](HttpResponse::Queue::Producer& queue_producer) mutable {
@@ -46,6 +76,15 @@ void ResponseBodyStream::SetHeader(std::string_view name, const std::string& val
 }
 
 void ResponseBodyStream::SetEndOfHeaders() {
+    if (encoder_) {
+        if (http_response_.HasHeader(USERVER_NAMESPACE::http::headers::kContentEncoding)) {
+            // The handler has encoded the body by itself
+            encoder_.reset();
+        } else {
+            http_response_.SetContentEncoding(encoder_->content_encoding);
+        }
+    }
+
     headers_ended_ = true;
     http_response_.SetHeadersEnd();
 }
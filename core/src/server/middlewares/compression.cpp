@@ -0,0 +1,313 @@
+#include <server/middlewares/compression.hpp>
+
+#include <algorithm>
+#include <memory>
+
+#include <fmt/format.h>
+
+#include <compression/gzip.hpp>
+#include <userver/compression/zstd.hpp>
+
+#include <userver/components/component_config.hpp>
+#include <userver/formats/parse/common_containers.hpp>
+#include <userver/formats/yaml/serialize.hpp>
+#include <userver/http/common_headers.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/server/http/http_request.hpp>
+#include <userver/server/http/http_response.hpp>
+#include <userver/tracing/scope_time.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/from_string.hpp>
+#include <userver/utils/str_icase.hpp>
+#include <userver/utils/text_light.hpp>
+#include <userver/yaml_config/merge_schemas.hpp>
+#include <userver/yaml_config/schema.hpp>
+#include <userver/yaml_config/yaml_config.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::middlewares {
+
+namespace impl {
+
+namespace {
+
+constexpr std::string_view kGzip = "gzip";
+constexpr std::string_view kZstd = "zstd";
+
+// Properties are shared by the static config of the factory and by the
+// per-handler middleware config
+constexpr std::string_view kSettingsSchemaProperties = R"(
+    enabled:
+        type: boolean
+        description: whether to compress responses
+        defaultDescription: false
+    compress-streams:
+        type: boolean
+        description: whether to compress responses of handlers with response-body-stream enabled
+        defaultDescription: true
+    min-size:
+        type: integer
+        minimum: 0
+        description: responses with a smaller body are sent uncompressed
+        defaultDescription: 1024
+    codecs:
+        type: array
+        description: codecs to use, in the order of preference
+        defaultDescription: '[zstd, gzip]'
+        items:
+            type: string
+            description: codec name
+            enum:
+              - zstd
+              - gzip
+    gzip-level:
+        type: integer
+        minimum: 1
+        maximum: 9
+        description: gzip compression level
+        defaultDescription: 6
+    zstd-level:
+        type: integer
+        minimum: 1
+        maximum: 22
+        description: zstd compression level
+        defaultDescription: 3
+)";
+
+std::string MakeSettingsSchema(std::string_view description) {
+    return fmt::format(
+        R"(
+type: object
+description: {}
+additionalProperties: false
+properties:{})",
+        description,
+        kSettingsSchemaProperties
+    );
+}
+
+// Returns the weight of a single Accept-Encoding element, std::nullopt if the
+// element is malformed.
+std::optional<double> ParseWeight(std::string_view params) {
+    double weight = 1.0;
+    for (const auto param : utils::text::SplitIntoStringViewVector(params, ";")) {
+        const auto trimmed = utils::text::Trim(std::string{param});
+        if (trimmed.empty()) continue;
+        if (trimmed.size() < 2 || (trimmed[0] != 'q' && trimmed[0] != 'Q') || trimmed[1] != '=') continue;
+
+        try {
+            weight = utils::FromString<double>(trimmed.substr(2));
+        } catch (const std::exception&) {
+            return std::nullopt;
+        }
+        if (weight < 0 || weight > 1) return std::nullopt;
+    }
+    return weight;
+}
+
+}  // namespace
+
+std::string_view ToString(CompressionCodec codec) {
+    switch (codec) {
+        case CompressionCodec::kGzip:
+            return kGzip;
+        case CompressionCodec::kZstd:
+            return kZstd;
+    }
+    UINVARIANT(false, "Unexpected compression codec");
+}
+
+CompressionCodec Parse(const yaml_config::YamlConfig& value, formats::parse::To<CompressionCodec>) {
+    const auto& str = value.As<std::string>();
+    if (str == kGzip) return CompressionCodec::kGzip;
+    if (str == kZstd) return CompressionCodec::kZstd;
+    throw std::runtime_error("can't parse CompressionCodec from '" + str + '\'');
+}
+
+std::optional<CompressionCodec>
+NegotiateCompressionCodec(std::string_view accept_encoding, const std::vector<CompressionCodec>& preferred) {
+    // RFC 9110, 12.5.3. A codec that is not listed is acceptable only if '*'
+    // is present, 'q=0' means "not acceptable".
+    std::vector<std::optional<double>> weights(preferred.size());
+    std::optional<double> wildcard_weight;
+
+    for (const auto element : utils::text::SplitIntoStringViewVector(accept_encoding, ",")) {
+        const auto params_pos = element.find(';');
+        const auto coding = utils::text::Trim(std::string{element.substr(0, params_pos)});
+        if (coding.empty()) continue;
+
+        const auto weight =
+            ParseWeight(params_pos == std::string_view::npos ? std::string_view{} : element.substr(params_pos + 1));
+        if (!weight) continue;
+
+        if (coding == "*") {
+            wildcard_weight = *weight;
+            continue;
+        }
+        for (std::size_t i = 0; i < preferred.size(); ++i) {
+            if (utils::StrIcaseEqual{}(coding, ToString(preferred[i]))) {
+                weights[i] = *weight;
+            }
+        }
+    }
+
+    std::optional<CompressionCodec> result;
+    double best_weight = 0;
+    for (std::size_t i = 0; i < preferred.size(); ++i) {
+        const auto weight = weights[i] ? *weights[i] : wildcard_weight.value_or(0);
+        if (weight > best_weight) {
+            best_weight = weight;
+            result = preferred[i];
+        }
+    }
+    return result;
+}
+
+CompressionSettings ParseCompressionSettings(const yaml_config::YamlConfig& value, CompressionSettings defaults) {
+    CompressionSettings settings;
+    settings.enabled = value["enabled"].As<bool>(defaults.enabled);
+    settings.compress_streams = value["compress-streams"].As<bool>(defaults.compress_streams);
+    settings.min_size = value["min-size"].As<std::size_t>(defaults.min_size);
+    settings.codecs = value["codecs"].As<std::vector<CompressionCodec>>(std::move(defaults.codecs));
+    settings.gzip_level = value["gzip-level"].As<int>(defaults.gzip_level);
+    settings.zstd_level = value["zstd-level"].As<int>(defaults.zstd_level);
+    return settings;
+}
+
+}  // namespace impl
+
+namespace {
+
+bool IsCompressibleStatus(http::HttpStatus status) {
+    const auto code = static_cast<int>(status);
+    // Content-Range of a partial response refers to the uncompressed body
+    return code >= 200 && status != http::HttpStatus::kNoContent && status != http::HttpStatus::kNotModified &&
+           status != http::HttpStatus::kPartialContent;
+}
+
+void AddVaryAcceptEncoding(http::HttpResponse& response) {
+    const auto& vary = response.GetHeader(USERVER_NAMESPACE::http::headers::kVary);
+    if (vary.empty()) {
+        response.SetHeader(
+            USERVER_NAMESPACE::http::headers::kVary, std::string{USERVER_NAMESPACE::http::headers::kAcceptEncoding}
+        );
+    } else if (vary.find(USERVER_NAMESPACE::http::headers::kAcceptEncoding) == std::string::npos) {
+        response.SetHeader(
+            USERVER_NAMESPACE::http::headers::kVary,
+            fmt::format("{}, {}", vary, std::string_view{USERVER_NAMESPACE::http::headers::kAcceptEncoding})
+        );
+    }
+}
+
+}  // namespace
+
+Compression::Compression(impl::CompressionSettings settings) : settings_(std::move(settings)) {}
+
+void Compression::HandleRequest(http::HttpRequest& request, request::RequestContext& context) const {
+    if (!settings_.enabled || request.GetMethod() == http::HttpMethod::kHead) {
+        Next(request, context);
+        return;
+    }
+
+    const auto codec = impl::NegotiateCompressionCodec(
+        request.GetHeader(USERVER_NAMESPACE::http::headers::kAcceptEncoding), settings_.codecs
+    );
+    auto& response = request.GetHttpResponse();
+
+    if (response.IsBodyStreamed()) {
+        if (codec && settings_.compress_streams) {
+            SetStreamEncoder(response, *codec);
+        }
+        Next(request, context);
+        return;
+    }
+
+    Next(request, context);
+
+    if (codec) {
+        CompressResponseBody(response, *codec);
+    }
+}
+
+void Compression::SetStreamEncoder(http::HttpResponse& response, impl::CompressionCodec codec) const {
+    http::HttpResponse::BodyStreamEncoder encoder;
+    encoder.content_encoding = std::string{impl::ToString(codec)};
+
+    switch (codec) {
+        case impl::CompressionCodec::kGzip: {
+            auto compressor = std::make_shared<compression::gzip::Compressor>(settings_.gzip_level);
+            encoder.encode = [compressor](std::string_view chunk, bool is_last) {
+                return is_last ? compressor->Finish(chunk) : compressor->Flush(chunk);
+            };
+            break;
+        }
+        case impl::CompressionCodec::kZstd: {
+            auto compressor = std::make_shared<compression::zstd::Compressor>(settings_.zstd_level);
+            encoder.encode = [compressor](std::string_view chunk, bool is_last) {
+                return is_last ? compressor->Finish(chunk) : compressor->Flush(chunk);
+            };
+            break;
+        }
+    }
+
+    AddVaryAcceptEncoding(response);
+    response.SetBodyStreamEncoder(std::move(encoder));
+}
+
+void Compression::CompressResponseBody(http::HttpResponse& response, impl::CompressionCodec codec) const {
+    const auto& data = response.GetData();
+    if (response.HasFileBody() || data.size() < settings_.min_size || !IsCompressibleStatus(response.GetStatus()) ||
+        response.HasHeader(USERVER_NAMESPACE::http::headers::kContentEncoding)) {
+        return;
+    }
+
+    const auto scope_time = tracing::ScopeTime::CreateOptionalScopeTime("http_compress_response_body");
+
+    std::string compressed;
+    try {
+        switch (codec) {
+            case impl::CompressionCodec::kGzip:
+                compressed = compression::gzip::Compress(data, settings_.gzip_level);
+                break;
+            case impl::CompressionCodec::kZstd:
+                compressed = compression::zstd::Compress(data, settings_.zstd_level);
+                break;
+        }
+    } catch (const std::exception& e) {
+        LOG_WARNING() << "Failed to compress response body, sending it as is: " << e;
+        return;
+    }
+
+    AddVaryAcceptEncoding(response);
+    if (compressed.size() >= data.size()) return;
+
+    response.SetContentEncoding(std::string{impl::ToString(codec)});
+    response.SetData(std::move(compressed));
+}
+
+CompressionFactory::CompressionFactory(
+    const components::ComponentConfig& config,
+    const components::ComponentContext& context
+)
+    : HttpMiddlewareFactoryBase(config, context), defaults_(impl::ParseCompressionSettings(config, {})) {}
+
+std::unique_ptr<HttpMiddlewareBase>
+CompressionFactory::Create(const handlers::HttpHandlerBase&, yaml_config::YamlConfig middleware_config) const {
+    return std::make_unique<Compression>(impl::ParseCompressionSettings(middleware_config, defaults_));
+}
+
+yaml_config::Schema CompressionFactory::GetMiddlewareConfigSchema() const {
+    return formats::yaml::FromString(impl::MakeSettingsSchema("per-handler overrides of the response compression settings"))
+        .As<yaml_config::Schema>();
+}
+
+yaml_config::Schema CompressionFactory::GetStaticConfigSchema() {
+    return yaml_config::MergeSchemas<components::ComponentBase>(
+        impl::MakeSettingsSchema("Compresses response bodies according to the Accept-Encoding request header")
+    );
+}
+
+}  // namespace server::middlewares
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+#include <userver/server/middlewares/builtin.hpp>
+#include <userver/server/middlewares/http_middleware_base.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+class HttpResponse;
+}
+
+namespace server::middlewares {
+
+namespace impl {
+
+enum class CompressionCodec {
+    kGzip,
+    kZstd,
+};
+
+std::string_view ToString(CompressionCodec codec);
+
+/// Chooses a codec with the highest weight in the Accept-Encoding header value.
+/// Ties are resolved in favour of the codec that goes first in `preferred`.
+std::optional<CompressionCodec>
+NegotiateCompressionCodec(std::string_view accept_encoding, const std::vector<CompressionCodec>& preferred);
+
+struct CompressionSettings final {
+    bool enabled{false};
+    bool compress_streams{true};
+    std::size_t min_size{1024};
+    std::vector<CompressionCodec> codecs{CompressionCodec::kZstd, CompressionCodec::kGzip};
+    int gzip_level{6};
+    int zstd_level{3};
+};
+
+CompressionSettings ParseCompressionSettings(const yaml_config::YamlConfig& value, CompressionSettings defaults);
+
+}  // namespace impl
+
+class Compression final : public HttpMiddlewareBase {
+public:
+    static constexpr std::string_view kName = builtin::kCompression;
+
+    explicit Compression(impl::CompressionSettings settings);
+
+private:
+    void HandleRequest(http::HttpRequest& request, request::RequestContext& context) const override;
+
+    void SetStreamEncoder(http::HttpResponse& response, impl::CompressionCodec codec) const;
+
+    void CompressResponseBody(http::HttpResponse& response, impl::CompressionCodec codec) const;
+
+    const impl::CompressionSettings settings_;
+};
+
+class CompressionFactory final : public HttpMiddlewareFactoryBase {
+public:
+    static constexpr std::string_view kName = Compression::kName;
+
+    CompressionFactory(const components::ComponentConfig&, const components::ComponentContext&);
+
+    static yaml_config::Schema GetStaticConfigSchema();
+
+private:
+    std::unique_ptr<HttpMiddlewareBase> Create(const handlers::HttpHandlerBase&, yaml_config::YamlConfig)
+        const override;
+
+    yaml_config::Schema GetMiddlewareConfigSchema() const override;
+
+    const impl::CompressionSettings defaults_;
+};
+
+}  // namespace server::middlewares
+
+template <>
+inline constexpr bool components::kHasValidate<server::middlewares::CompressionFactory> = true;
+
+template <>
+inline constexpr auto components::kConfigFileMode<server::middlewares::CompressionFactory> =
+    ConfigFileMode::kNotRequired;
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,46 @@
+#include <server/middlewares/compression.hpp>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using server::middlewares::impl::CompressionCodec;
+using server::middlewares::impl::NegotiateCompressionCodec;
+
+const std::vector<CompressionCodec> kPreferred{CompressionCodec::kZstd, CompressionCodec::kGzip};
+
+}  // namespace
+
+TEST(CompressionMiddleware, NegotiateNoHeader) { EXPECT_EQ(NegotiateCompressionCodec("", kPreferred), std::nullopt); }
+
+TEST(CompressionMiddleware, NegotiateSingle) {
+    EXPECT_EQ(NegotiateCompressionCodec("gzip", kPreferred), CompressionCodec::kGzip);
+    EXPECT_EQ(NegotiateCompressionCodec("GZip", kPreferred), CompressionCodec::kGzip);
+    EXPECT_EQ(NegotiateCompressionCodec("br, identity", kPreferred), std::nullopt);
+}
+
+TEST(CompressionMiddleware, NegotiatePreferenceOnTie) {
+    EXPECT_EQ(NegotiateCompressionCodec("gzip, deflate, br, zstd", kPreferred), CompressionCodec::kZstd);
+    EXPECT_EQ(
+        NegotiateCompressionCodec("gzip, zstd", {CompressionCodec::kGzip, CompressionCodec::kZstd}),
+        CompressionCodec::kGzip
+    );
+}
+
+TEST(CompressionMiddleware, NegotiateWeights) {
+    EXPECT_EQ(NegotiateCompressionCodec("zstd;q=0.5, gzip", kPreferred), CompressionCodec::kGzip);
+    EXPECT_EQ(NegotiateCompressionCodec("zstd;q=0, gzip;q=0.1", kPreferred), CompressionCodec::kGzip);
+    EXPECT_EQ(NegotiateCompressionCodec("zstd; q=0, gzip ;Q=0", kPreferred), std::nullopt);
+    EXPECT_EQ(NegotiateCompressionCodec("zstd;q=abc, gzip;q=2", kPreferred), std::nullopt);
+}
+
+TEST(CompressionMiddleware, NegotiateWildcard) {
+    EXPECT_EQ(NegotiateCompressionCodec("*", kPreferred), CompressionCodec::kZstd);
+    EXPECT_EQ(NegotiateCompressionCodec("zstd;q=0, *", kPreferred), CompressionCodec::kGzip);
+    EXPECT_EQ(NegotiateCompressionCodec("gzip;q=0.2, *;q=0.1", kPreferred), CompressionCodec::kGzip);
+    EXPECT_EQ(NegotiateCompressionCodec("*;q=0", kPreferred), std::nullopt);
+}
+
+USERVER_NAMESPACE_END
@@ -60,6 +60,7 @@ void Connection::Process() {
 
     ListenForRequests();
 
+    CancelPipelinedRequests();
     Shutdown();
 }
 
@@ -98,8 +99,14 @@ void Connection::ListenForRequests() noexcept {
             auto deadline = engine::Deadline::FromDuration(config_.keepalive_timeout);
 
             if (pending_data_size_ == 0) {
+                SendPipelinedResponses();
+                if (!is_accepting_requests_) break;
+
                 if (!WaitOnSocket(deadline)) {
-                    return;
+                    // The requests the peer has sent before closing its side
+                    // of the connection are still answered below
+                    is_peer_read_closed_ = true;
+                    break;
                 }
             }
 
@@ -124,13 +131,23 @@ void Connection::ListenForRequests() noexcept {
             }
             pending_data_size_ = 0;
 
+            const bool is_pipelining_enabled = IsPipeliningEnabled();
             for (auto&& request : pending_requests_) {
-                ProcessRequest(std::move(request));
+                if (is_pipelining_enabled) {
+                    StartPipelinedRequest(std::move(request));
+                } else {
+                    ProcessRequest(std::move(request));
+                }
             }
             pending_requests_.resize(0);
             if (should_stop_accepting_requests) is_accepting_requests_ = false;
         }
 
+        // The rest are cancelled once the responses can not be sent
+        while (!pipelined_requests_.empty() && is_response_chain_valid_) {
+            FinishPipelinedRequest();
+        }
+
         LOG_TRACE() << "Gracefully stopping ListenForRequests()";
     } catch (const engine::io::IoTimeout&) {
         LOG_INFO() << "Closing idle connection on timeout";
@@ -196,7 +213,9 @@ bool Connection::WaitOnSocket(engine::Deadline deadline) {
         // See also: https://github.com/httpwg/http-core/issues/22
         //
         // It is faster (and probably more efficient) for us to cancel
-        // currently processing and pending requests.
+        // currently processing and pending requests. Pipelined requests that
+        // were already received are answered though, as the peer is
+        // probably waiting for their responses.
         return false;
     }
     LOG_TRACE() << "Received " << pending_data_size_ << " byte(s) from " << Getpeername() << " on fd " << Fd();
@@ -228,7 +247,10 @@ bool Connection::ReadSome() {
             engine::Deadline::Passed()
         );
         pending_data_size_ += count;
-        if (count == 0) return false;
+        if (count == 0) {
+            is_peer_read_closed_ = true;
+            return false;
+        }
     } catch (const engine::io::IoTimeout&) {
         // Read only a part of SSL Record, not a EOF
     } catch (const std::exception& e) {
@@ -242,18 +264,22 @@ bool Connection::ReadSome() {
 engine::TaskWithResult<void> Connection::HandleQueueItem(const std::shared_ptr<request::RequestBase>& request
 ) noexcept {
     auto request_task = request_handler_.StartRequestTask(request);
+    WaitRequestTask(*request, request_task);
+    return request_task;
+}
 
+void Connection::WaitRequestTask(request::RequestBase& request, engine::TaskWithResult<void>& request_task) noexcept {
     if (engine::current_task::IsCancelRequested()) {
         // We could've packed all remaining requests into a vector and cancel them
         // in parallel. But pipelining is almost never used so why bother.
         request_task.SyncCancel();
         LOG_DEBUG() << "Request processing interrupted";
         is_response_chain_valid_ = false;
-        return request_task;  // avoids throwing and catching exception down below
+        return;  // avoids throwing and catching exception down below
     }
 
     try {
-        auto& response = request->GetResponse();
+        auto& response = request.GetResponse();
         if (response.IsBodyStreamed()) {
             // TODO: wait for TCP connection closure too
             response.WaitForHeadersEnd();
@@ -269,14 +295,19 @@ engine::TaskWithResult<void> Connection::HandleQueueItem(const std::shared_ptr<r
             // overhead is not too expensive compared to the await time and we can
             // tolerate its cost.
 
+            //
+            // After the peer has half-closed the connection the socket is
+            // always readable, and the handler is awaited until it finishes.
+
             request_task.WaitFor(config_.abort_check_delay);
-            if (!request_task.IsFinished()) {
+            if (!request_task.IsFinished() && !is_peer_read_closed_) {
                 // Slow path for not-so-fast handlers
                 engine::io::ReadableBase& peer_read = *peer_socket_;
                 const auto task_num = engine::WaitAny(peer_read, request_task);
 
                 if (task_num == 0) {
-                    if (!ReadSome()) {
+                    // A half-closed pipelining peer still waits for the responses
+                    if (!ReadSome() && !(is_peer_read_closed_ && IsPipeliningEnabled())) {
                         // TCP connection is closed, cancel the user task
                         LOG_DEBUG() << "Cancelling request due to closed socket";
                         request_task.RequestCancel();
@@ -292,7 +323,7 @@ engine::TaskWithResult<void> Connection::HandleQueueItem(const std::shared_ptr<r
         auto lvl =
             reason == engine::TaskCancellationReason::kUserRequest ? logging::Level::kWarning : logging::Level::kError;
         LOG_LIMITED(lvl) << "Handler task was cancelled with reason: " << ToString(reason);
-        auto& response = request->GetResponse();
+        auto& response = request.GetResponse();
         if (!response.IsReady()) {
             response.SetReady();
             response.SetStatusServiceUnavailable();
@@ -302,9 +333,8 @@ engine::TaskWithResult<void> Connection::HandleQueueItem(const std::shared_ptr<r
         is_response_chain_valid_ = false;
     } catch (const std::exception& e) {
         LOG_WARNING() << "Request failed with unhandled exception: " << e;
-        request->MarkAsInternalServerError();
+        request.MarkAsInternalServerError();
     }
-    return request_task;
 }
 
 void Connection::SendResponse(request::RequestBase& request) {
@@ -363,6 +393,7 @@ void Connection::SendResponse(request::RequestBase& request) {
             auto log_level = ex.Code().value() == static_cast<int>(std::errc::broken_pipe) ? logging::Level::kWarning
                                                                                            : logging::Level::kError;
             LOG(log_level) << "I/O error while sending data: " << ex;
+            is_response_chain_valid_ = false;
             response.SetSendFailed(std::chrono::steady_clock::now());
         } catch (const std::exception& ex) {
             LOG_ERROR() << "Error while sending data: " << ex;
@@ -378,6 +409,76 @@ void Connection::SendResponse(request::RequestBase& request) {
     request.WriteAccessLogs(request_handler_.LoggerAccess(), request_handler_.LoggerAccessTskv(), peer_name_);
 }
 
+bool Connection::IsPipeliningEnabled() const noexcept {
+    // HTTP/2 multiplexes the streams by itself, and an upgrade to it replaces
+    // the parser in the middle of the request chain
+    return config_.pipeline_window > 1 && config_.http_version == USERVER_NAMESPACE::http::HttpVersion::k11;
+}
+
+void Connection::StartPipelinedRequest(std::shared_ptr<request::RequestBase>&& request_ptr) {
+    if (request_ptr->IsFinal()) {
+        is_accepting_requests_ = false;
+    }
+
+    while (pipelined_requests_.size() >= config_.pipeline_window) {
+        FinishPipelinedRequest();
+    }
+    if (!peer_socket_) {
+        // The connection was upgraded to a websocket by a previous request
+        return;
+    }
+
+    stats_->active_request_count.Add(1);
+
+    auto task = request_handler_.StartRequestTask(request_ptr);
+    pipelined_requests_.push_back(PipelinedRequest{std::move(request_ptr), std::move(task)});
+}
+
+void Connection::SendPipelinedResponses() {
+    // Responses are sent in the order of requests, as required by RFC 9112.
+    // Returns as soon as the peer sends more data to start more handlers
+    // while the first one is still running.
+    while (!pipelined_requests_.empty()) {
+        auto& front = pipelined_requests_.front();
+        if (!front.request->GetResponse().IsBodyStreamed() && !front.task.IsFinished()) {
+            engine::io::ReadableBase& peer_read = *peer_socket_;
+            if (engine::WaitAny(peer_read, front.task) == 0) return;
+        }
+        FinishPipelinedRequest();
+    }
+}
+
+void Connection::FinishPipelinedRequest() {
+    UASSERT(!pipelined_requests_.empty());
+    auto [request_ptr, task] = std::move(pipelined_requests_.front());
+    pipelined_requests_.pop_front();
+
+    WaitRequestTask(*request_ptr, task);
+    SendResponse(*request_ptr);
+
+    if (request_ptr->IsUpgradeWebsocket()) {
+        is_accepting_requests_ = false;
+        CancelPipelinedRequests();
+        request_ptr->DoUpgrade(std::move(peer_socket_), std::move(remote_address_));
+    }
+}
+
+void Connection::CancelPipelinedRequests() noexcept {
+    if (pipelined_requests_.empty()) return;
+
+    LOG_DEBUG() << "Cancelling " << pipelined_requests_.size() << " pipelined request(s)";
+    for (auto& [request_ptr, task] : pipelined_requests_) {
+        task.RequestCancel();
+    }
+    is_response_chain_valid_ = false;
+    while (!pipelined_requests_.empty()) {
+        auto& [request_ptr, task] = pipelined_requests_.front();
+        task.SyncCancel();
+        SendResponse(*request_ptr);
+        pipelined_requests_.pop_front();
+    }
+}
+
 std::string Connection::Getpeername() const { return peer_name_; }
 
 std::unique_ptr<request::RequestParser> Connection::MakeParser(USERVER_NAMESPACE::http::HttpVersion ver) {
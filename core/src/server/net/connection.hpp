@@ -1,5 +1,6 @@
 #pragma once
 
+#include <deque>
 #include <memory>
 #include <string>
 
@@ -12,6 +13,7 @@
 #include <server/http/http_request_parser.hpp>
 //
 #include <userver/engine/io/socket.hpp>
+#include <userver/engine/task/task_with_result.hpp>
 #include <userver/server/request/request_base.hpp>
 #include <userver/server/request/request_config.hpp>
 
@@ -49,8 +51,15 @@ private:
     bool WaitOnSocket(engine::Deadline deadline);
 
     engine::TaskWithResult<void> HandleQueueItem(const std::shared_ptr<request::RequestBase>& request) noexcept;
+    void WaitRequestTask(request::RequestBase& request, engine::TaskWithResult<void>& request_task) noexcept;
     void SendResponse(request::RequestBase& request);
 
+    bool IsPipeliningEnabled() const noexcept;
+    void StartPipelinedRequest(std::shared_ptr<request::RequestBase>&& request_ptr);
+    void SendPipelinedResponses();
+    void FinishPipelinedRequest();
+    void CancelPipelinedRequests() noexcept;
+
     std::string Getpeername() const;
 
     bool ReadSome();
@@ -69,6 +78,13 @@ private:
     using RequestBasePtr = std::shared_ptr<request::RequestBase>;
     std::vector<RequestBasePtr> pending_requests_;
 
+    struct PipelinedRequest {
+        RequestBasePtr request;
+        engine::TaskWithResult<void> task;
+    };
+    // Requests with running handlers, in the order of arrival
+    std::deque<PipelinedRequest> pipelined_requests_;
+
     engine::io::Sockaddr remote_address_;
     std::string peer_name_;
 
@@ -77,6 +93,7 @@ private:
 
     bool is_accepting_requests_{true};
     bool is_response_chain_valid_{true};
+    bool is_peer_read_closed_{false};
 };
 
 }  // namespace server::net
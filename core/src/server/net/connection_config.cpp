@@ -1,5 +1,7 @@
 #include <server/net/connection_config.hpp>
 
+#include <stdexcept>
+
 #include <userver/yaml_config/yaml_config.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -26,6 +28,11 @@ ConnectionConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<
         config.abort_check_delay = utils::StringToDuration(value["stream_close_check_delay"].As<std::string>());
     }
 
+    config.pipeline_window = value["pipeline_window"].As<std::size_t>(config.pipeline_window);
+    if (config.pipeline_window == 0) {
+        throw std::runtime_error("Invalid pipeline_window in " + value.GetPath() + ", must be positive");
+    }
+
     config.http_version = value["http-version"].As<USERVER_NAMESPACE::http::HttpVersion>(config.http_version);
 
     config.http2_session_config = value["http2-session"].As<Http2SessionConfig>(config.http2_session_config);
@@ -29,6 +29,9 @@ struct ConnectionConfig {
     size_t requests_queue_size_threshold = 100;
     std::chrono::seconds keepalive_timeout{10 * 60};
     std::chrono::milliseconds abort_check_delay{kDefaultAbortCheckDelay};
+    /// Max number of pipelined HTTP/1.1 requests of a connection that are
+    /// handled concurrently, 1 handles the requests one by one
+    std::size_t pipeline_window = 1;
     USERVER_NAMESPACE::http::HttpVersion http_version = USERVER_NAMESPACE::http::HttpVersion::k11;
     Http2SessionConfig http2_session_config;
 };
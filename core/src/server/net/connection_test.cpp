@@ -1,5 +1,9 @@
 #include <server/net/connection.hpp>
 
+#include <sys/socket.h>
+
+#include <array>
+
 #include <fmt/format.h>
 
 #include <server/handlers/http_handler_base_statistics.hpp>
@@ -23,9 +27,10 @@ constexpr auto kAcceptTimeout = utest::kMaxTestWaitTime;
 
 class TestHttprequestHandler : public server::http::RequestHandlerBase {
 public:
-    enum class Behaviors { kNoop, kHang };
+    enum class Behaviors { kNoop, kHang, kWaitConcurrent, kSlow };
 
-    explicit TestHttprequestHandler(Behaviors behavior = Behaviors::kNoop) : behavior_(behavior) {}
+    explicit TestHttprequestHandler(Behaviors behavior = Behaviors::kNoop, std::size_t concurrency = 1)
+        : behavior_(behavior), concurrency_(concurrency) {}
 
     engine::TaskWithResult<void> StartRequestTask(std::shared_ptr<server::request::RequestBase> request
     ) const override {
@@ -44,6 +49,22 @@ public:
                     ASSERT_TRUE(engine::current_task::IsCancelRequested());
                     ++asyncs_finished;
                 });
+            case Behaviors::kWaitConcurrent:
+                return engine::AsyncNoSpan([this]() {
+                    // Finishes only if `concurrency_` handlers run simultaneously
+                    ++asyncs_started;
+                    const auto deadline = engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+                    while (asyncs_started < concurrency_ && !deadline.IsReached()) {
+                        engine::SleepFor(std::chrono::milliseconds{1});
+                    }
+                    ++asyncs_finished;
+                });
+            case Behaviors::kSlow:
+                return engine::AsyncNoSpan([this]() {
+                    // Slower than abort_check_delay, so the connection watches the socket
+                    engine::InterruptibleSleepFor(std::chrono::milliseconds{50});
+                    if (!engine::current_task::IsCancelRequested()) ++asyncs_finished;
+                });
         }
 
         UINVARIANT(false, "Unexpected behavior");
@@ -54,11 +75,14 @@ public:
     const logging::LoggerPtr& LoggerAccess() const noexcept override { return no_logger_; };
     const logging::LoggerPtr& LoggerAccessTskv() const noexcept override { return no_logger_; };
 
+    // NOLINTNEXTLINE(misc-non-private-member-variables-in-classes)
+    mutable std::atomic<std::size_t> asyncs_started{0};
     // NOLINTNEXTLINE(misc-non-private-member-variables-in-classes)
     mutable std::atomic<std::size_t> asyncs_finished{0};
 
 private:
     const Behaviors behavior_;
+    const std::size_t concurrency_;
     logging::LoggerPtr no_logger_;
     server::http::HandlerInfoIndex handler_info_index_;
 };
@@ -358,4 +382,189 @@ UTEST_P(ServerNetConnection, CancelMultipleInFlight) {
     FAIL() << "Failed to simulate cancellation of multiple requests";
 }
 
+UTEST(ServerNetConnection, PipelinedRequestsRunConcurrently) {
+    constexpr std::size_t kPipelinedRequests = 4;
+    net::ListenerConfig config = CreateConfig();
+    config.connection_config.pipeline_window = kPipelinedRequests;
+    auto request_socket = net::CreateSocket(config);
+
+    auto addr = engine::io::Sockaddr::MakeLoopbackAddress();
+    addr.SetPort(request_socket.Getsockname().Port());
+    engine::io::Socket client{addr.Domain(), engine::io::SocketType::kStream};
+    const auto deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+    client.Connect(addr, deadline);
+
+    auto peer = request_socket.Accept(Deadline::FromDuration(kAcceptTimeout));
+    ASSERT_TRUE(peer.IsValid());
+    auto stats = std::make_shared<net::Stats>();
+    server::request::ResponseDataAccounter data_accounter;
+    TestHttprequestHandler handler{TestHttprequestHandler::Behaviors::kWaitConcurrent, kPipelinedRequests};
+
+    auto task = engine::AsyncNoSpan([&] {
+        net::Connection connection(
+            config.connection_config,
+            config.handler_defaults,
+            std::make_unique<engine::io::Socket>(std::move(peer)),
+            {},
+            handler,
+            stats,
+            data_accounter
+        );
+
+        connection.Process();
+    });
+
+    std::string requests;
+    for (std::size_t i = 0; i < kPipelinedRequests; ++i) {
+        requests += fmt::format("GET /{} HTTP/1.1\r\nHost: localhost\r\n\r\n", i);
+    }
+    ASSERT_EQ(client.SendAll(requests.data(), requests.size(), deadline), requests.size());
+
+    std::string responses;
+    std::size_t responses_count = 0;
+    while (responses_count < kPipelinedRequests) {
+        std::array<char, 4096> buffer{};
+        const auto received = client.RecvSome(buffer.data(), buffer.size(), deadline);
+        ASSERT_NE(received, 0) << "Connection closed after " << responses_count << " responses";
+        responses.append(buffer.data(), received);
+
+        responses_count = 0;
+        for (auto pos = responses.find("HTTP/1.1 "); pos != std::string::npos;
+             pos = responses.find("HTTP/1.1 ", pos + 1)) {
+            ++responses_count;
+        }
+    }
+    EXPECT_EQ(handler.asyncs_finished, kPipelinedRequests);
+    EXPECT_FALSE(deadline.IsReached()) << "Handlers did not run concurrently";
+
+    task.RequestCancel();
+    task.WaitFor(utest::kMaxTestWaitTime);
+    EXPECT_TRUE(task.IsFinished());
+}
+
+UTEST(ServerNetConnection, PipelinedRequestsAnsweredAfterHalfClose) {
+    constexpr std::size_t kPipelinedRequests = 3;
+    net::ListenerConfig config = CreateConfig();
+    config.connection_config.pipeline_window = kPipelinedRequests;
+    auto request_socket = net::CreateSocket(config);
+
+    auto addr = engine::io::Sockaddr::MakeLoopbackAddress();
+    addr.SetPort(request_socket.Getsockname().Port());
+    engine::io::Socket client{addr.Domain(), engine::io::SocketType::kStream};
+    const auto deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+    client.Connect(addr, deadline);
+
+    auto peer = request_socket.Accept(Deadline::FromDuration(kAcceptTimeout));
+    ASSERT_TRUE(peer.IsValid());
+    auto stats = std::make_shared<net::Stats>();
+    server::request::ResponseDataAccounter data_accounter;
+    TestHttprequestHandler handler{TestHttprequestHandler::Behaviors::kWaitConcurrent, kPipelinedRequests};
+
+    auto task = engine::AsyncNoSpan([&] {
+        net::Connection connection(
+            config.connection_config,
+            config.handler_defaults,
+            std::make_unique<engine::io::Socket>(std::move(peer)),
+            {},
+            handler,
+            stats,
+            data_accounter
+        );
+
+        connection.Process();
+    });
+
+    std::string requests;
+    for (std::size_t i = 0; i < kPipelinedRequests; ++i) {
+        requests += fmt::format("GET /{} HTTP/1.1\r\nHost: localhost\r\n\r\n", i);
+    }
+    ASSERT_EQ(client.SendAll(requests.data(), requests.size(), deadline), requests.size());
+    // Wait for the handlers to start, so that the EOF arrives while they run
+    while (handler.asyncs_started < kPipelinedRequests && !deadline.IsReached()) {
+        engine::SleepFor(std::chrono::milliseconds{1});
+    }
+    ASSERT_EQ(::shutdown(client.Fd(), SHUT_WR), 0);
+
+    std::string responses;
+    while (true) {
+        std::array<char, 4096> buffer{};
+        const auto received = client.RecvSome(buffer.data(), buffer.size(), deadline);
+        if (received == 0) break;
+        responses.append(buffer.data(), received);
+    }
+
+    std::size_t responses_count = 0;
+    for (auto pos = responses.find("HTTP/1.1 200 "); pos != std::string::npos;
+         pos = responses.find("HTTP/1.1 200 ", pos + 1)) {
+        ++responses_count;
+    }
+    EXPECT_EQ(responses_count, kPipelinedRequests) << responses;
+    EXPECT_EQ(handler.asyncs_finished, kPipelinedRequests);
+
+    task.WaitFor(utest::kMaxTestWaitTime);
+    EXPECT_TRUE(task.IsFinished());
+}
+
+UTEST(ServerNetConnection, PipelinedRequestsOverWindowAnsweredAfterHalfClose) {
+    constexpr std::size_t kPipelineWindow = 2;
+    constexpr std::size_t kPipelinedRequests = 5;
+    net::ListenerConfig config = CreateConfig();
+    config.connection_config.pipeline_window = kPipelineWindow;
+    auto request_socket = net::CreateSocket(config);
+
+    auto addr = engine::io::Sockaddr::MakeLoopbackAddress();
+    addr.SetPort(request_socket.Getsockname().Port());
+    engine::io::Socket client{addr.Domain(), engine::io::SocketType::kStream};
+    const auto deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+    client.Connect(addr, deadline);
+
+    auto peer = request_socket.Accept(Deadline::FromDuration(kAcceptTimeout));
+    ASSERT_TRUE(peer.IsValid());
+    auto stats = std::make_shared<net::Stats>();
+    server::request::ResponseDataAccounter data_accounter;
+    TestHttprequestHandler handler{TestHttprequestHandler::Behaviors::kSlow};
+
+    auto task = engine::AsyncNoSpan([&] {
+        net::Connection connection(
+            config.connection_config,
+            config.handler_defaults,
+            std::make_unique<engine::io::Socket>(std::move(peer)),
+            {},
+            handler,
+            stats,
+            data_accounter
+        );
+
+        connection.Process();
+    });
+
+    // The requests over the window are started only after the EOF is seen
+    // while waiting for the first handlers
+    std::string requests;
+    for (std::size_t i = 0; i < kPipelinedRequests; ++i) {
+        requests += fmt::format("GET /{} HTTP/1.1\r\nHost: localhost\r\n\r\n", i);
+    }
+    ASSERT_EQ(client.SendAll(requests.data(), requests.size(), deadline), requests.size());
+    ASSERT_EQ(::shutdown(client.Fd(), SHUT_WR), 0);
+
+    std::string responses;
+    while (true) {
+        std::array<char, 4096> buffer{};
+        const auto received = client.RecvSome(buffer.data(), buffer.size(), deadline);
+        if (received == 0) break;
+        responses.append(buffer.data(), received);
+    }
+
+    std::size_t responses_count = 0;
+    for (auto pos = responses.find("HTTP/1.1 200 "); pos != std::string::npos;
+         pos = responses.find("HTTP/1.1 200 ", pos + 1)) {
+        ++responses_count;
+    }
+    EXPECT_EQ(responses_count, kPipelinedRequests) << responses;
+    EXPECT_EQ(handler.asyncs_finished, kPipelinedRequests);
+
+    task.WaitFor(utest::kMaxTestWaitTime);
+    EXPECT_TRUE(task.IsFinished());
+}
+
 USERVER_NAMESPACE_END
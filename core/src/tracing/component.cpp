@@ -5,6 +5,8 @@
 #include <userver/tracing/tracer.hpp>
 #include <userver/yaml_config/merge_schemas.hpp>
 
+#include <tracing/sampler.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace components {
@@ -35,6 +37,7 @@ Tracer::Tracer(const ComponentConfig& config, const ComponentContext& context) {
         tracing::Tracer::SetTracer(
             tracing::MakeTracer(std::move(service_name), std::move(opentracing_logger), tracer_type)
         );
+        tracing::Tracer::SetSamplingSettings(config["sampling"].As<tracing::SamplingSettings>({}));
     } else {
         throw std::runtime_error("Tracer type is not supported: " + tracer_type);
     }
@@ -54,6 +57,28 @@ properties:
         type: string
         description: type of the tracer to trace, currently supported only 'native'
         defaultDescription: 'native'
+    sampling:
+        type: object
+        description: sampling of the new traces, all the traces are logged by default
+        additionalProperties: false
+        properties:
+            ratio:
+                type: number
+                description: probability to log a new trace
+                defaultDescription: 1.0
+            max-traces-per-second:
+                type: integer
+                description: max number of logged traces per second for each root span name, 0 for no limit
+                defaultDescription: 0
+                minimum: 0
+            tail-latency-threshold:
+                type: string
+                description: unsampled traces with a span that takes longer are logged anyway, 0 to disable
+                defaultDescription: 0ms
+            tail-keep-errors:
+                type: boolean
+                description: unsampled traces with a span with the `error` tag are logged anyway
+                defaultDescription: false
 )");
 }
 
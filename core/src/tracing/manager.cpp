@@ -1,11 +1,16 @@
 #include <userver/tracing/manager.hpp>
 
+#include <charconv>
+#include <optional>
+
 #include <userver/engine/task/inherited_variable.hpp>
 #include <userver/http/common_headers.hpp>
 #include <userver/server/http/http_request.hpp>
 #include <userver/tracing/opentelemetry.hpp>
 #include <userver/utils/trivial_map.hpp>
 
+#include <tracing/sampler.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace tracing {
@@ -16,6 +21,8 @@ constexpr std::string_view kSampledTag = "sampled";
 // default value for Sampled flag is '01' as we always write spans by
 // default
 constexpr std::string_view kDefaultOtelTraceFlags = "01";
+constexpr unsigned kOtelSampledFlag = 0x01;
+constexpr std::string_view kB3DebugSampled = "d";
 
 // The order matter for TryFillSpanBuilderFromRequest as it returns on first
 // success
@@ -40,6 +47,24 @@ engine::TaskInheritedVariable<OTelTracingHeadersInheritedData> kOTelTracingHeade
 /// @see TracingHeadersInheritedData for details on the contents.
 engine::TaskInheritedVariable<std::string> kB3TracingSampledInheritedData;
 
+std::optional<bool> ParseB3Sampled(std::string_view sampled) {
+    if (sampled == "1" || sampled == kB3DebugSampled || sampled == "true") return true;
+    if (sampled == "0" || sampled == "false") return false;
+    return std::nullopt;
+}
+
+// Without the sampling config every span is logged, as it always was. The
+// upstream flags then are only passed through to the downstream services.
+bool IsSamplingConfigured() { return GetSampler() != nullptr; }
+
+std::optional<unsigned> ParseOtelTraceFlags(std::string_view traceflags) {
+    unsigned flags = 0;
+    const auto* const end = traceflags.data() + traceflags.size();
+    const auto [ptr, ec] = std::from_chars(traceflags.data(), end, flags, 16);
+    if (traceflags.size() != 2 || ec != std::errc{} || ptr != end) return std::nullopt;
+    return flags;
+}
+
 bool B3TryFillSpanBuilderFromRequest(const server::http::HttpRequest& request, tracing::SpanBuilder& span_builder) {
     namespace b3 = http::headers::b3;
     const auto& trace_id = request.GetHeader(b3::kTraceId);
@@ -56,6 +81,11 @@ bool B3TryFillSpanBuilderFromRequest(const server::http::HttpRequest& request, t
     span_builder.SetTraceId(trace_id);
     span_builder.SetParentSpanId(request.GetHeader(b3::kSpanId));
     span_builder.AddTagFrozen(std::string{kSampledTag}, sampled);
+    if (IsSamplingConfigured()) {
+        if (const auto is_sampled = ParseB3Sampled(sampled)) {
+            span_builder.SetSampled(*is_sampled);
+        }
+    }
     return true;
 }
 
@@ -66,8 +96,12 @@ void B3FillWithTracingContext(const tracing::Span& span, T& target) {
     target.SetHeader(b3::kSpanId, span.GetSpanId());
     target.SetHeader(b3::kParentSpanId, span.GetParentId());
 
+    // With the sampling configured propagate the decision of our own trace.
+    // The debug flag forces the sampling in all the downstream services.
     const auto* sampled = kB3TracingSampledInheritedData.GetOptional();
-    if (sampled && !sampled->empty()) {
+    if (IsSamplingConfigured() && !(sampled && *sampled == kB3DebugSampled)) {
+        target.SetHeader(b3::kSampled, span.IsSampled() ? "1" : "0");
+    } else if (sampled && !sampled->empty()) {
         target.SetHeader(b3::kSampled, *sampled);
     } else {
         target.SetHeader(b3::kSampled, "1");
@@ -101,6 +135,11 @@ bool OpenTelemetryTryFillSpanBuilderFromRequest(
     if (data.trace_flags.empty()) {
         data.trace_flags = std::string{kDefaultOtelTraceFlags};
     }
+    if (IsSamplingConfigured()) {
+        if (const auto flags = ParseOtelTraceFlags(data.trace_flags)) {
+            span_builder.SetSampled(*flags & kOtelSampledFlag);
+        }
+    }
 
     const auto& tracestate = request.GetHeader(opentelemetry::kTraceState);
     kOTelTracingHeadersInheritedData.Set({
@@ -114,10 +153,19 @@ template <class T>
 void OpenTelemetryFillWithTracingContext(const tracing::Span& span, T& target, const logging::Level log_level) {
     const auto* data = kOTelTracingHeadersInheritedData.GetOptional();
 
-    std::string_view traceflags = kDefaultOtelTraceFlags;
+    std::string_view incoming_traceflags = kDefaultOtelTraceFlags;
     if (data) {
-        traceflags = data->traceflags;
+        incoming_traceflags = data->traceflags;
+    }
+    // With the sampling configured keep the other incoming flags, but
+    // propagate the decision of our own trace
+    std::string traceflags{incoming_traceflags};
+    if (IsSamplingConfigured()) {
+        auto flags = ParseOtelTraceFlags(incoming_traceflags).value_or(kOtelSampledFlag);
+        flags = span.IsSampled() ? (flags | kOtelSampledFlag) : (flags & ~kOtelSampledFlag);
+        traceflags = fmt::format("{:02x}", flags);
     }
+
     auto traceparent_result = opentelemetry::BuildTraceParentHeader(span.GetTraceId(), span.GetSpanId(), traceflags);
 
     if (!traceparent_result.has_value()) {
@@ -0,0 +1,92 @@
+#include <tracing/sampler.hpp>
+
+#include <stdexcept>
+
+#include <userver/utils/assert.hpp>
+#include <userver/utils/rand.hpp>
+#include <userver/yaml_config/yaml_config.hpp>
+
+#include <tracing/span_impl.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace tracing {
+
+SamplingSettings Parse(const yaml_config::YamlConfig& value, formats::parse::To<SamplingSettings>) {
+    SamplingSettings settings;
+    settings.ratio = value["ratio"].As<double>(settings.ratio);
+    if (settings.ratio < 0 || settings.ratio > 1) {
+        throw std::runtime_error("Invalid tracer sampling ratio, it must be in [0, 1]");
+    }
+    settings.max_traces_per_second = value["max-traces-per-second"].As<std::size_t>(settings.max_traces_per_second);
+    settings.tail_latency_threshold =
+        value["tail-latency-threshold"].As<std::chrono::milliseconds>(settings.tail_latency_threshold);
+    settings.tail_keep_errors = value["tail-keep-errors"].As<bool>(settings.tail_keep_errors);
+    return settings;
+}
+
+bool operator==(const SamplingSettings& lhs, const SamplingSettings& rhs) noexcept {
+    return lhs.ratio == rhs.ratio && lhs.max_traces_per_second == rhs.max_traces_per_second &&
+           lhs.tail_latency_threshold == rhs.tail_latency_threshold && lhs.tail_keep_errors == rhs.tail_keep_errors;
+}
+
+Sampler::Sampler(SamplingSettings settings) : settings_(settings) {}
+
+bool Sampler::ShouldSample(const std::string& root_span_name) {
+    if (settings_.ratio < 1.0 && utils::RandRange(1.0) >= settings_.ratio) {
+        return false;
+    }
+    if (settings_.max_traces_per_second == 0) {
+        return true;
+    }
+
+    auto rate_limiter = rate_limiters_.Get(root_span_name);
+    if (!rate_limiter) {
+        const utils::TokenBucket::RefillPolicy policy{
+            1, utils::TokenBucket::Duration{std::chrono::seconds{1}} / settings_.max_traces_per_second};
+        rate_limiter = rate_limiters_.Emplace(root_span_name, settings_.max_traces_per_second, policy).value;
+    }
+    return rate_limiter->Obtain();
+}
+
+bool Sampler::HasTailSampling() const noexcept {
+    return settings_.tail_keep_errors || settings_.tail_latency_threshold.count() > 0;
+}
+
+bool Sampler::ShouldKeepSlow(std::chrono::steady_clock::duration duration) const noexcept {
+    return settings_.tail_latency_threshold.count() > 0 && duration >= settings_.tail_latency_threshold;
+}
+
+bool Sampler::ShouldKeepErrors() const noexcept { return settings_.tail_keep_errors; }
+
+TailSampledTrace::TailSampledTrace(std::shared_ptr<const Sampler> sampler) : sampler_(std::move(sampler)) {
+    UASSERT(sampler_);
+}
+
+// The spans left in the buffer of a trace whose root span was never finished
+// are dropped
+TailSampledTrace::~TailSampledTrace() = default;
+
+TailSampledTrace::Decision
+TailSampledTrace::OnSpanFinished(bool keep, utils::function_ref<std::unique_ptr<Span::Impl>()> make_buffered) {
+    const std::lock_guard lock{mutex_};
+    if (decision_ != Decision::kPending) return decision_;
+
+    keep_requested_ = keep_requested_ || keep;
+    if (buffered_spans_.size() < kMaxBufferedSpans) {
+        buffered_spans_.push_back(make_buffered());
+    }
+    return Decision::kPending;
+}
+
+std::vector<std::unique_ptr<Span::Impl>> TailSampledTrace::OnRootFinished(bool keep, bool& trace_kept) {
+    const std::lock_guard lock{mutex_};
+    UASSERT(decision_ == Decision::kPending);
+    trace_kept = keep_requested_ || keep;
+    decision_ = trace_kept ? Decision::kKeep : Decision::kDrop;
+    return std::move(buffered_spans_);
+}
+
+}  // namespace tracing
+
+USERVER_NAMESPACE_END
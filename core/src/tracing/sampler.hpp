@@ -0,0 +1,109 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <userver/formats/parse/to.hpp>
+#include <userver/rcu/rcu_map.hpp>
+#include <userver/tracing/span.hpp>
+#include <userver/utils/function_ref.hpp>
+#include <userver/utils/token_bucket.hpp>
+#include <userver/yaml_config/fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace tracing {
+
+struct SamplingSettings {
+    /// Probability to sample a new trace
+    double ratio{1.0};
+
+    /// Max number of sampled traces per second for each root span name,
+    /// zero means no limit
+    std::size_t max_traces_per_second{0};
+
+    /// Unsampled traces with a span that takes longer are logged anyway, zero
+    /// disables
+    std::chrono::milliseconds tail_latency_threshold{0};
+
+    /// Unsampled traces with a span with the `error` tag are logged anyway
+    bool tail_keep_errors{false};
+};
+
+bool operator==(const SamplingSettings& lhs, const SamplingSettings& rhs) noexcept;
+
+SamplingSettings Parse(const yaml_config::YamlConfig& value, formats::parse::To<SamplingSettings>);
+
+/// Makes the sampling decisions for spans. The head decision is made once for
+/// a root span and is inherited by all of its children, the tail decision is
+/// made for a whole unsampled trace when its root span ends.
+class Sampler final {
+public:
+    explicit Sampler(SamplingSettings settings);
+
+    /// Head sampling of a trace that starts at the span `root_span_name`
+    bool ShouldSample(const std::string& root_span_name);
+
+    /// @returns true if some of the unsampled spans may be logged on their end,
+    /// so their tags must be collected
+    bool HasTailSampling() const noexcept;
+
+    /// Tail sampling of an unsampled trace by the duration of its span
+    bool ShouldKeepSlow(std::chrono::steady_clock::duration duration) const noexcept;
+
+    /// Tail sampling of the unsampled traces with the `error` tag on a span
+    bool ShouldKeepErrors() const noexcept;
+
+private:
+    const SamplingSettings settings_;
+    rcu::RcuMap<std::string, utils::TokenBucket> rate_limiters_;
+};
+
+/// Returns the sampler that was set by tracing::Tracer::SetSamplingSettings,
+/// nullptr if every trace is sampled
+std::shared_ptr<Sampler> GetSampler();
+
+/// The finished spans of an unsampled trace in this process, buffered until
+/// its root span ends. Then the tail sampling keeps or drops all of them.
+class TailSampledTrace final {
+public:
+    enum class Decision {
+        kPending,
+        kKeep,
+        kDrop,
+    };
+
+    /// Max number of buffered spans of a trace, the further spans are dropped
+    static constexpr std::size_t kMaxBufferedSpans = 1000;
+
+    explicit TailSampledTrace(std::shared_ptr<const Sampler> sampler);
+
+    TailSampledTrace(TailSampledTrace&&) = delete;
+    TailSampledTrace& operator=(TailSampledTrace&&) = delete;
+    ~TailSampledTrace();
+
+    const Sampler& GetSampler() const noexcept { return *sampler_; }
+
+    /// Called for a finished non-root span. If the trace is not decided yet,
+    /// buffers the span made by `make_buffered` and returns kPending.
+    Decision OnSpanFinished(bool keep, utils::function_ref<std::unique_ptr<Span::Impl>()> make_buffered);
+
+    /// Called for the finished root span. Returns the buffered spans, that must
+    /// be logged if the trace is kept.
+    std::vector<std::unique_ptr<Span::Impl>> OnRootFinished(bool keep, bool& trace_kept);
+
+private:
+    const std::shared_ptr<const Sampler> sampler_;
+    std::mutex mutex_;
+    Decision decision_{Decision::kPending};
+    bool keep_requested_{false};
+    std::vector<std::unique_ptr<Span::Impl>> buffered_spans_;
+};
+
+}  // namespace tracing
+
+USERVER_NAMESPACE_END
@@ -1,16 +1,20 @@
 #include <tracing/span_impl.hpp>
 
 #include <type_traits>
+#include <variant>
 
+#include <boost/container/small_vector.hpp>
 #include <fmt/compile.h>
 #include <fmt/format.h>
 
 #include <engine/task/task_context.hpp>
 #include <logging/log_helper_impl.hpp>
+#include <tracing/sampler.hpp>
 #include <userver/engine/task/local_variable.hpp>
 #include <userver/logging/impl/logger_base.hpp>
 #include <userver/logging/impl/tag_writer.hpp>
 #include <userver/tracing/span.hpp>
+#include <userver/tracing/tags.hpp>
 #include <userver/tracing/tracer.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/encoding/hex.hpp>
@@ -67,6 +71,19 @@ std::string GenerateSpanId() {
     return utils::encoding::ToHex(&random_value, 8);
 }
 
+bool IsTrue(const logging::LogExtra::Value& value) {
+    return std::visit(
+        [](const auto& alternative) {
+            if constexpr (std::is_same_v<std::decay_t<decltype(alternative)>, std::string>) {
+                return alternative == "true";
+            } else {
+                return alternative != 0;
+            }
+        },
+        value
+    );
+}
+
 }  // namespace
 
 Span::Impl::Impl(
@@ -106,6 +123,11 @@ Span::Impl::Impl(
     if (parent) {
         log_extra_inheritable_ = parent->log_extra_inheritable_;
         local_log_level_ = parent->local_log_level_;
+        sampled_ = parent->sampled_;
+        tail_trace_ = parent->tail_trace_;
+    } else if (auto sampler = GetSampler()) {
+        const bool sampled = sampler->ShouldSample(name_);
+        StartTrace(sampled, std::move(sampler));
     }
 }
 
@@ -113,6 +135,18 @@ Span::Impl::~Impl() {
     if (!ShouldLog()) {
         return;
     }
+    if (!end_steady_time_) end_steady_time_ = std::chrono::steady_clock::now();
+    if (!sampled_ && !FinishUnsampled()) {
+        return;
+    }
+
+    if (IsSpanExporterSet()) {
+        const auto exporter = ReadSpanExporter();
+        if (*exporter) {
+            (*exporter)->Export(FinishedSpan{*this, GetDuration()});
+            if (!(*exporter)->ShouldAlsoLog()) return;
+        }
+    }
 
     {
         const impl::DetachLocalSpansScope ignore_local_span;
@@ -123,8 +157,7 @@ Span::Impl::~Impl() {
 }
 
 void Span::Impl::PutIntoLogger(logging::impl::TagWriter writer) && {
-    const auto steady_now = std::chrono::steady_clock::now();
-    const auto duration = steady_now - start_steady_time_;
+    const auto duration = GetDuration();
     const auto total_time_ms = std::chrono::duration_cast<RealMilliseconds>(duration).count();
     const auto timestamp_buffer = StartTsToString(start_system_time_);
     const auto ref_type = GetReferenceType() == ReferenceType::kChild ? kReferenceTypeChild : kReferenceTypeFollows;
@@ -153,6 +186,23 @@ void Span::Impl::LogTo(logging::impl::TagWriter writer) {
     tracer_->LogSpanContextTo(*this, writer);
 }
 
+void Span::Impl::VisitTags(FinishedSpan::TagVisitor visitor) const {
+    // Same precedence as in PutIntoLogger: local tags override the inheritable
+    // ones, unless the latter are frozen
+    const auto is_overridden = [this](const auto& item) {
+        return log_extra_local_ && !item.second.IsFrozen() && log_extra_local_->Find(item.first);
+    };
+    for (const auto& item : *log_extra_inheritable_.extra_) {
+        if (!is_overridden(item)) visitor(item.first, item.second.GetValue());
+    }
+    if (!log_extra_local_) return;
+
+    for (const auto& item : *log_extra_local_->extra_) {
+        const auto* inheritable = log_extra_inheritable_.Find(item.first);
+        if (!inheritable || !inheritable->second.IsFrozen()) visitor(item.first, item.second.GetValue());
+    }
+}
+
 void Span::Impl::DetachFromCoroStack() { unlink(); }
 
 void Span::Impl::AttachToCoroStack() {
@@ -186,7 +236,18 @@ std::string Span::Impl::GetParentIdForLogging(const Span::Impl* parent) {
     return {};
 }
 
+void Span::Impl::SetSampled(bool sampled) {
+    StartTrace(sampled, sampled ? nullptr : GetSampler());
+}
+
+std::chrono::steady_clock::duration Span::Impl::GetDuration() const {
+    return end_steady_time_.value_or(std::chrono::steady_clock::now()) - start_steady_time_;
+}
+
 bool Span::Impl::ShouldLog() const {
+    // Unsampled spans are never logged unless the tail sampling may keep them
+    if (!sampled_ && !tail_trace_) return false;
+
     /* We must honour default log level, but use span's level from ourselves,
      * not the previous span's.
      */
@@ -194,6 +255,52 @@ bool Span::Impl::ShouldLog() const {
            local_log_level_.value_or(logging::Level::kTrace) <= log_level_;
 }
 
+void Span::Impl::StartTrace(bool sampled, std::shared_ptr<Sampler> sampler) {
+    sampled_ = sampled;
+    tail_trace_.reset();
+    is_tail_trace_root_ = false;
+    if (!sampled_ && sampler && sampler->HasTailSampling()) {
+        tail_trace_ = std::make_shared<TailSampledTrace>(std::move(sampler));
+        is_tail_trace_root_ = true;
+    }
+}
+
+bool Span::Impl::FinishUnsampled() {
+    UASSERT(tail_trace_);
+    const bool keep = ShouldKeepUnsampled(GetDuration());
+
+    if (is_tail_trace_root_) {
+        bool trace_kept = false;
+        auto buffered_spans = tail_trace_->OnRootFinished(keep, trace_kept);
+        for (auto& span : buffered_spans) {
+            // The destructor logs the span only if it is marked as sampled
+            span->sampled_ = trace_kept;
+        }
+        buffered_spans.clear();
+        return trace_kept;
+    }
+
+    // Keeps the trace alive while this span is moved out into its buffer
+    const auto trace = tail_trace_;
+    const auto decision = trace->OnSpanFinished(keep, [this] {
+        auto buffered_span = std::make_unique<Impl>(std::move(*this));
+        // The trace owns its buffer, so the buffered spans must not own the trace
+        buffered_span->tail_trace_.reset();
+        buffered_span->span_ = nullptr;
+        return buffered_span;
+    });
+    return decision == TailSampledTrace::Decision::kKeep;
+}
+
+bool Span::Impl::ShouldKeepUnsampled(std::chrono::steady_clock::duration duration) const {
+    UASSERT(tail_trace_);
+    const auto& sampler = tail_trace_->GetSampler();
+    if (sampler.ShouldKeepSlow(duration)) return true;
+    if (!sampler.ShouldKeepErrors()) return false;
+    return IsTrue(log_extra_inheritable_.GetValue(kErrorFlag)) ||
+           (log_extra_local_ && IsTrue(log_extra_local_->GetValue(kErrorFlag)));
+}
+
 void Span::OptionalDeleter::operator()(Span::Impl* impl) const noexcept {
     if (do_delete) {
         std::default_delete<Impl>{}(impl);
@@ -321,11 +428,13 @@ tracing::ScopeTime Span::CreateScopeTime() { return ScopeTime(pimpl_->GetTimeSto
 tracing::ScopeTime Span::CreateScopeTime(std::string name) { return {pimpl_->GetTimeStorage(), std::move(name)}; }
 
 void Span::AddNonInheritableTag(std::string key, logging::LogExtra::Value value) {
+    if (!pimpl_->ShouldCollectLocalTags()) return;
     if (!pimpl_->log_extra_local_) pimpl_->log_extra_local_.emplace();
     pimpl_->log_extra_local_->Extend(std::move(key), std::move(value));
 }
 
 void Span::AddNonInheritableTags(const logging::LogExtra& log_extra) {
+    if (!pimpl_->ShouldCollectLocalTags()) return;
     if (!pimpl_->log_extra_local_) pimpl_->log_extra_local_.emplace();
     pimpl_->log_extra_local_->Extend(log_extra);
 }
@@ -376,6 +485,8 @@ void Span::LogTo(logging::impl::TagWriter writer) const& { pimpl_->LogTo(writer)
 
 bool Span::ShouldLogDefault() const noexcept { return pimpl_->ShouldLog(); }
 
+bool Span::IsSampled() const noexcept { return pimpl_->IsSampled(); }
+
 void Span::DetachFromCoroStack() {
     if (pimpl_) pimpl_->DetachFromCoroStack();
 }
@@ -44,6 +44,8 @@ void SpanBuilder::AddNonInheritableTag(std::string key, logging::LogExtra::Value
     pimpl_->log_extra_local_->Extend(std::move(key), std::move(value));
 }
 
+void SpanBuilder::SetSampled(bool sampled) { pimpl_->SetSampled(sampled); }
+
 void SpanBuilder::SetParentLink(std::string parent_link) { AddTagFrozen(kParentLinkTag, std::move(parent_link)); }
 
 Span SpanBuilder::Build() && { return Span(std::move(pimpl_)); }
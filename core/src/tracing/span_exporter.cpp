@@ -0,0 +1,58 @@
+#include <userver/tracing/span_exporter.hpp>
+
+#include <atomic>
+
+#include <userver/rcu/rcu.hpp>
+
+#include <tracing/span_impl.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace tracing {
+
+namespace {
+
+auto& GlobalSpanExporter() {
+    static rcu::Variable<std::shared_ptr<SpanExporter>> exporter{};
+    return exporter;
+}
+
+std::atomic<bool> is_span_exporter_set{false};
+
+}  // namespace
+
+const std::string& FinishedSpan::GetName() const noexcept { return impl_.name_; }
+
+const std::string& FinishedSpan::GetTraceId() const noexcept { return impl_.GetTraceId(); }
+
+const std::string& FinishedSpan::GetSpanId() const noexcept { return impl_.GetSpanId(); }
+
+const std::string& FinishedSpan::GetParentId() const noexcept { return impl_.GetParentId(); }
+
+ReferenceType FinishedSpan::GetReferenceType() const noexcept { return impl_.GetReferenceType(); }
+
+logging::Level FinishedSpan::GetLogLevel() const noexcept { return impl_.log_level_; }
+
+std::chrono::system_clock::time_point FinishedSpan::GetStartSystemTime() const noexcept {
+    return impl_.start_system_time_;
+}
+
+void FinishedSpan::VisitTags(TagVisitor visitor) const { impl_.VisitTags(visitor); }
+
+void FinishedSpan::VisitScopeTimes(ScopeTimeVisitor visitor) const { impl_.GetTimeStorage().Visit(visitor); }
+
+SpanExporter::~SpanExporter() = default;
+
+void SetSpanExporter(std::shared_ptr<SpanExporter> exporter) {
+    const bool is_set = exporter != nullptr;
+    GlobalSpanExporter().Assign(std::move(exporter));
+    is_span_exporter_set.store(is_set);
+}
+
+bool IsSpanExporterSet() noexcept { return is_span_exporter_set.load(std::memory_order_relaxed); }
+
+rcu::ReadablePtr<std::shared_ptr<SpanExporter>> ReadSpanExporter() { return GlobalSpanExporter().Read(); }
+
+}  // namespace tracing
+
+USERVER_NAMESPACE_END
@@ -2,6 +2,7 @@
 
 #include <chrono>
 #include <list>
+#include <memory>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -13,8 +14,10 @@
 #include <userver/logging/log_extra.hpp>
 #include <userver/logging/log_filepath.hpp>
 #include <userver/logging/log_helper.hpp>
+#include <userver/rcu/rcu.hpp>
 #include <userver/tracing/scope_time.hpp>
 #include <userver/tracing/span.hpp>
+#include <userver/tracing/span_exporter.hpp>
 #include <userver/tracing/tracer.hpp>
 #include <userver/utils/impl/source_location.hpp>
 
@@ -27,6 +30,9 @@ namespace tracing {
 inline const std::string kLinkTag = "link";
 inline const std::string kParentLinkTag = "parent_link";
 
+class Sampler;
+class TailSampledTrace;
+
 class Span::Impl : public boost::intrusive::list_base_hook<boost::intrusive::link_mode<boost::intrusive::auto_unlink>> {
 public:
     explicit Impl(
@@ -58,6 +64,9 @@ public:
     // Add the context of this Span a non-Span-specific log record
     void LogTo(logging::impl::TagWriter writer);
 
+    // Visit the tags that PutIntoLogger would write
+    void VisitTags(FinishedSpan::TagVisitor visitor) const;
+
     const std::string& GetTraceId() const& noexcept { return trace_id_; }
     const std::string& GetSpanId() const& noexcept { return span_id_; }
     const std::string& GetParentId() const& noexcept { return parent_id_; }
@@ -72,6 +81,20 @@ public:
 
     ReferenceType GetReferenceType() const noexcept { return reference_type_; }
 
+    // Non-inheritable tags are written only to the span's own log record,
+    // there is no point in collecting them for the spans that are never logged
+    bool ShouldCollectLocalTags() const noexcept { return sampled_ || tail_trace_; }
+
+    // Overrides the head sampling decision of a root span, e.g. with the one
+    // that came from the upstream service
+    void SetSampled(bool sampled);
+
+    bool IsSampled() const noexcept { return sampled_; }
+
+    // Time from the start to the end of the span, or to now if it is not
+    // finished yet
+    std::chrono::steady_clock::duration GetDuration() const;
+
     void DetachFromCoroStack();
     void AttachToCoroStack();
 
@@ -82,6 +105,10 @@ private:
 
     static std::string GetParentIdForLogging(const Span::Impl* parent);
     bool ShouldLog() const;
+    void StartTrace(bool sampled, std::shared_ptr<Sampler> sampler);
+    // Returns true if the span of an unsampled trace must be logged right away
+    bool FinishUnsampled();
+    bool ShouldKeepUnsampled(std::chrono::steady_clock::duration duration) const;
 
     const std::string name_;
     const bool is_no_log_span_;
@@ -91,6 +118,13 @@ private:
     std::shared_ptr<Tracer> tracer_;
     logging::LogExtra log_extra_inheritable_;
 
+    // Head sampling decision of the trace, inherited from the parent
+    bool sampled_{true};
+    // Set only for the unsampled spans that may be kept by the tail sampling
+    std::shared_ptr<TailSampledTrace> tail_trace_;
+    // The span that decides whether its tail sampled trace is kept
+    bool is_tail_trace_root_{false};
+
     Span* span_{nullptr};
 
     std::optional<logging::LogExtra> log_extra_local_;
@@ -98,6 +132,7 @@ private:
 
     const std::chrono::system_clock::time_point start_system_time_;
     const std::chrono::steady_clock::time_point start_steady_time_;
+    std::optional<std::chrono::steady_clock::time_point> end_steady_time_;
 
     std::string trace_id_;
     std::string span_id_;
@@ -108,6 +143,7 @@ private:
     friend class Span;
     friend class SpanBuilder;
     friend class TagScope;
+    friend class FinishedSpan;
 };
 
 // Use list instead of stack to avoid UB in case of "pop non-last item"
@@ -116,6 +152,12 @@ using SpanStack = boost::intrusive::list<Span::Impl, boost::intrusive::constant_
 
 const Span::Impl* GetParentSpanImpl();
 
+// Cheap check for the hot path: most of the services have no exporter
+bool IsSpanExporterSet() noexcept;
+
+// Reads the exporter set by SetSpanExporter without copying the shared_ptr
+rcu::ReadablePtr<std::shared_ptr<SpanExporter>> ReadSpanExporter();
+
 template <typename... Args>
 Span::Impl* AllocateImpl(Args&&... args) {
     return new Span::Impl(std::forward<Args>(args)...);
@@ -3,10 +3,17 @@
 
 #include <logging/log_helper_impl.hpp>
 #include <logging/logging_test.hpp>
+#include <server/http/create_parser_test.hpp>
+#include <server/http/http_request_impl.hpp>
 #include <tracing/no_log_spans.hpp>
+#include <tracing/sampler.hpp>
 #include <userver/engine/sleep.hpp>
 #include <userver/formats/json/serialize.hpp>
+#include <userver/http/common_headers.hpp>
+#include <userver/tracing/manager.hpp>
 #include <userver/tracing/span.hpp>
+#include <userver/tracing/span_builder.hpp>
+#include <userver/tracing/tags.hpp>
 #include <userver/tracing/tracer.hpp>
 #include <userver/utest/utest.hpp>
 #include <userver/utils/regex.hpp>
@@ -688,4 +695,194 @@ UTEST_F(Span, MakeSpanWithParentIdTraceIdLinkWithExisting) {
     }
 }
 
+UTEST_F(Span, UnsampledTrace) {
+    tracing::SamplingSettings sampling;
+    sampling.ratio = 0;
+    tracing::Tracer::SetSamplingSettings(sampling);
+
+    {
+        auto root_span = tracing::Span::MakeRootSpan("unsampled_root_span");
+        EXPECT_FALSE(root_span.ShouldLogDefault());
+
+        tracing::Span child_span("unsampled_child_span");
+        EXPECT_FALSE(child_span.ShouldLogDefault());
+        LOG_INFO() << "regular log record";
+    }
+    logging::LogFlush();
+
+    EXPECT_THAT(GetStreamString(), Not(HasSubstr("unsampled_root_span")));
+    EXPECT_THAT(GetStreamString(), Not(HasSubstr("unsampled_child_span")));
+    EXPECT_THAT(GetStreamString(), HasSubstr("regular log record"));
+
+    tracing::Tracer::SetSamplingSettings(tracing::SamplingSettings{});
+}
+
+UTEST_F(Span, TailSamplingKeepsErrors) {
+    tracing::SamplingSettings sampling;
+    sampling.ratio = 0;
+    sampling.tail_keep_errors = true;
+    tracing::Tracer::SetSamplingSettings(sampling);
+
+    {
+        auto root_span = tracing::Span::MakeRootSpan("unsampled_root_span");
+        EXPECT_TRUE(root_span.ShouldLogDefault());
+        {
+            tracing::Span child_span("failed_child_span");
+            child_span.AddNonInheritableTag(tracing::kErrorFlag, true);
+        }
+    }
+    logging::LogFlush();
+
+    EXPECT_THAT(GetStreamString(), HasSubstr("unsampled_root_span"));
+    EXPECT_THAT(GetStreamString(), HasSubstr("failed_child_span"));
+
+    tracing::Tracer::SetSamplingSettings(tracing::SamplingSettings{});
+}
+
+UTEST_F(Span, TailSamplingKeepsWholeTrace) {
+    tracing::SamplingSettings sampling;
+    sampling.ratio = 0;
+    sampling.tail_latency_threshold = std::chrono::milliseconds{10};
+    tracing::Tracer::SetSamplingSettings(sampling);
+
+    {
+        auto root_span = tracing::Span::MakeRootSpan("slow_root_span");
+        { tracing::Span child_span("fast_child_span"); }
+        engine::SleepFor(std::chrono::milliseconds{20});
+    }
+    {
+        auto root_span = tracing::Span::MakeRootSpan("fast_root_span");
+        { tracing::Span child_span("other_fast_child_span"); }
+    }
+    logging::LogFlush();
+
+    EXPECT_THAT(GetStreamString(), HasSubstr("slow_root_span"));
+    EXPECT_THAT(GetStreamString(), HasSubstr("fast_child_span"));
+    EXPECT_THAT(GetStreamString(), Not(HasSubstr("fast_root_span")));
+    EXPECT_THAT(GetStreamString(), Not(HasSubstr("other_fast_child_span")));
+
+    tracing::Tracer::SetSamplingSettings(tracing::SamplingSettings{});
+}
+
+UTEST_F(Span, TailSamplingLogsSpansFinishedAfterRoot) {
+    tracing::SamplingSettings sampling;
+    sampling.ratio = 0;
+    sampling.tail_keep_errors = true;
+    tracing::Tracer::SetSamplingSettings(sampling);
+
+    {
+        std::optional<tracing::Span> late_child_span;
+        {
+            auto root_span = tracing::Span::MakeRootSpan("failed_root_span");
+            late_child_span.emplace("late_child_span");
+            late_child_span->DetachFromCoroStack();
+            root_span.AddNonInheritableTag(tracing::kErrorFlag, true);
+        }
+    }
+    logging::LogFlush();
+
+    EXPECT_THAT(GetStreamString(), HasSubstr("failed_root_span"));
+    EXPECT_THAT(GetStreamString(), HasSubstr("late_child_span"));
+
+    tracing::Tracer::SetSamplingSettings(tracing::SamplingSettings{});
+}
+
+UTEST_F(Span, InheritsUpstreamSamplingDecision) {
+    {
+        tracing::SpanBuilder builder("upstream_unsampled_span");
+        builder.SetSampled(false);
+        auto span = std::move(builder).Build();
+        EXPECT_FALSE(span.IsSampled());
+        EXPECT_FALSE(span.ShouldLogDefault());
+
+        tracing::Span child_span("upstream_unsampled_child_span");
+        EXPECT_FALSE(child_span.IsSampled());
+    }
+
+    tracing::SamplingSettings sampling;
+    sampling.ratio = 0;
+    tracing::Tracer::SetSamplingSettings(sampling);
+    {
+        tracing::SpanBuilder builder("upstream_sampled_span");
+        builder.SetSampled(true);
+        auto span = std::move(builder).Build();
+        EXPECT_TRUE(span.IsSampled());
+        EXPECT_TRUE(span.ShouldLogDefault());
+    }
+    logging::LogFlush();
+
+    EXPECT_THAT(GetStreamString(), Not(HasSubstr("upstream_unsampled_span")));
+    EXPECT_THAT(GetStreamString(), HasSubstr("upstream_sampled_span"));
+
+    tracing::Tracer::SetSamplingSettings(tracing::SamplingSettings{});
+}
+
+UTEST_F(Span, UpstreamUnsampledLoggedWithoutSampling) {
+    const tracing::GenericTracingManager tracing_manager{
+        tracing::Format::kB3Alternative | utils::Flags<tracing::Format>(tracing::Format::kOpenTelemetry),
+        tracing::Format::kB3Alternative,
+    };
+    std::size_t parsed = 0;
+    auto parser = server::CreateTestParser([&](std::shared_ptr<server::request::RequestBase>&& request) {
+        ++parsed;
+        auto& http_request_impl = dynamic_cast<server::http::HttpRequestImpl&>(*request);
+        const server::http::HttpRequest http_request(http_request_impl);
+
+        tracing::SpanBuilder builder(fmt::format("upstream_unsampled_span_{}", parsed));
+        EXPECT_TRUE(tracing_manager.TryFillSpanBuilderFromRequest(http_request, builder));
+        auto span = std::move(builder).Build();
+        EXPECT_TRUE(span.IsSampled());
+        EXPECT_TRUE(span.ShouldLogDefault());
+        { tracing::Span child_span(fmt::format("upstream_unsampled_child_span_{}", parsed)); }
+
+        // The upstream flags are passed through unchanged
+        auto& response = http_request_impl.GetHttpResponse();
+        tracing_manager.FillResponseWithTracingContext(span, response);
+        if (!http_request.GetHeader(http::headers::b3::kSampled).empty()) {
+            EXPECT_EQ(response.GetHeader(http::headers::b3::kSampled), "0");
+        } else {
+            EXPECT_THAT(response.GetHeader(http::headers::opentelemetry::kTraceParent), testing::EndsWith("-00"));
+        }
+    });
+
+    parser->Parse(
+        "GET / HTTP/1.1\r\n"
+        "X-B3-TraceId: 80f198ee56343ba864fe8b2a57d3eff7\r\n"
+        "X-B3-SpanId: e457b5a2e4d86bd1\r\n"
+        "X-B3-Sampled: 0\r\n\r\n"
+    );
+    parser->Parse(
+        "GET / HTTP/1.1\r\n"
+        "traceparent: 00-0af7651916cd43dd8448eb211c80319c-b7ad6b7169203331-00\r\n\r\n"
+    );
+    EXPECT_EQ(parsed, 2);
+    logging::LogFlush();
+
+    EXPECT_THAT(GetStreamString(), HasSubstr("upstream_unsampled_span_1"));
+    EXPECT_THAT(GetStreamString(), HasSubstr("upstream_unsampled_child_span_1"));
+    EXPECT_THAT(GetStreamString(), HasSubstr("upstream_unsampled_span_2"));
+    EXPECT_THAT(GetStreamString(), HasSubstr("upstream_unsampled_child_span_2"));
+}
+
+UTEST_F(Span, SamplingRateLimit) {
+    tracing::SamplingSettings sampling;
+    sampling.max_traces_per_second = 1;
+    tracing::Tracer::SetSamplingSettings(sampling);
+
+    {
+        auto first_span = tracing::Span::MakeRootSpan("rate_limited_span");
+        EXPECT_TRUE(first_span.ShouldLogDefault());
+    }
+    {
+        auto second_span = tracing::Span::MakeRootSpan("rate_limited_span");
+        EXPECT_FALSE(second_span.ShouldLogDefault());
+    }
+    {
+        auto other_span = tracing::Span::MakeRootSpan("other_span");
+        EXPECT_TRUE(other_span.ShouldLogDefault());
+    }
+
+    tracing::Tracer::SetSamplingSettings(tracing::SamplingSettings{});
+}
+
 USERVER_NAMESPACE_END
@@ -48,6 +48,12 @@ void TimeStorage::MergeInto(logging::impl::TagWriter writer) {
     }
 }
 
+void TimeStorage::Visit(utils::function_ref<void(std::string_view key, Duration value)> visitor) const {
+    for (const auto& [key, value] : data_) {
+        visitor(key, value);
+    }
+}
+
 }  // namespace tracing::impl
 
 USERVER_NAMESPACE_END
@@ -5,6 +5,7 @@
 #include <unordered_map>
 
 #include <userver/logging/log_extra.hpp>
+#include <userver/utils/function_ref.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -32,6 +33,8 @@ public:
 
     void MergeInto(logging::impl::TagWriter writer);
 
+    void Visit(utils::function_ref<void(std::string_view key, Duration value)> visitor) const;
+
 private:
     std::unordered_map<std::string, Duration> data_;
 };
@@ -7,6 +7,7 @@
 #include <userver/utils/uuid4.hpp>
 
 #include <tracing/no_log_spans.hpp>
+#include <tracing/sampler.hpp>
 #include <tracing/span_impl.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -37,6 +38,16 @@ auto& GlobalNoLogSpans() {
     return spans;
 }
 
+// nullptr if every trace is sampled
+auto& GlobalSampler() {
+    static rcu::Variable<std::shared_ptr<Sampler>> sampler(std::shared_ptr<Sampler>{});
+    return sampler;
+}
+
+// Lets the root spans skip reading GlobalSampler() while every trace is
+// sampled, which is the default
+std::atomic<bool> is_sampling_enabled{false};
+
 auto& GlobalTracer() {
     static rcu::Variable<TracerPtr> tracer(tracing::MakeTracer({}, {}));
     return tracer;
@@ -77,6 +88,17 @@ bool Tracer::IsNoLogSpan(const std::string& name) {
     return ValueMatchesOneOfPrefixes(name, spans->prefixes) || spans->names.find(name) != spans->names.end();
 }
 
+void Tracer::SetSamplingSettings(const SamplingSettings& settings) {
+    const bool is_enabled = !(settings == SamplingSettings{});
+    GlobalSampler().Assign(is_enabled ? std::make_shared<Sampler>(settings) : nullptr);
+    is_sampling_enabled.store(is_enabled);
+}
+
+std::shared_ptr<Sampler> GetSampler() {
+    if (!is_sampling_enabled.load(std::memory_order_relaxed)) return nullptr;
+    return GlobalSampler().ReadCopy();
+}
+
 void Tracer::SetTracer(std::shared_ptr<Tracer> tracer) { GlobalTracer().Assign(std::move(tracer)); }
 
 std::shared_ptr<Tracer> Tracer::GetTracer() { return GlobalTracer().ReadCopy(); }
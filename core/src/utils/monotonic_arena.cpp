@@ -0,0 +1,59 @@
+#include <utils/monotonic_arena.hpp>
+
+#include <algorithm>
+#include <new>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils {
+
+namespace {
+
+constexpr std::size_t kFirstHeapBlockSize = 1024;
+constexpr std::size_t kMaxHeapBlockSize = 64 * 1024;
+
+}  // namespace
+
+struct alignas(std::max_align_t) MonotonicArena::BlockHeader final {
+    BlockHeader* next;
+};
+
+MonotonicArena::MonotonicArena() noexcept
+    : current_(inline_block_), end_(inline_block_ + kInlineSize), next_block_size_(kFirstHeapBlockSize) {}
+
+MonotonicArena::~MonotonicArena() { Release(); }
+
+void MonotonicArena::Release() noexcept {
+    while (heap_blocks_) {
+        auto* next = heap_blocks_->next;
+        ::operator delete(heap_blocks_);
+        heap_blocks_ = next;
+    }
+    current_ = inline_block_;
+    end_ = inline_block_ + kInlineSize;
+    next_block_size_ = kFirstHeapBlockSize;
+}
+
+void* MonotonicArena::AllocateSlow(std::size_t size, std::size_t alignment) {
+    const auto block_size = std::max(next_block_size_, sizeof(BlockHeader) + size + alignment);
+    auto* block = new (::operator new(block_size)) BlockHeader{heap_blocks_};
+    heap_blocks_ = block;
+    ++stats_.heap_blocks;
+    next_block_size_ = std::min(next_block_size_ * 2, kMaxHeapBlockSize);
+
+    current_ = reinterpret_cast<char*>(block + 1);
+    end_ = reinterpret_cast<char*>(block) + block_size;
+
+    void* ptr = current_;
+    std::size_t space = end_ - current_;
+    [[maybe_unused]] const auto* aligned = std::align(alignment, size, ptr, space);
+    UASSERT(aligned);
+    current_ = static_cast<char*>(ptr) + size;
+    return ptr;
+}
+
+}  // namespace utils
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <new>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils {
+
+/// Bump allocator that releases all the memory at once on destruction or
+/// Release(). The first block is stored inline, so an arena embedded into an
+/// object serves small workloads without touching the global allocator.
+/// The inline block is kept small, as it grows every object embedding the
+/// arena; larger workloads go to geometrically growing heap blocks.
+///
+/// Deallocation is a no-op. Not thread-safe.
+class MonotonicArena final {
+public:
+    static constexpr std::size_t kInlineSize = 256;
+
+    struct Stats final {
+        // allocations served by the arena
+        std::size_t allocations{0};
+        std::size_t bytes{0};
+        // allocations made by the arena from the global allocator
+        std::size_t heap_blocks{0};
+    };
+
+    MonotonicArena() noexcept;
+    ~MonotonicArena();
+
+    MonotonicArena(const MonotonicArena&) = delete;
+    MonotonicArena& operator=(const MonotonicArena&) = delete;
+
+    void* Allocate(std::size_t size, std::size_t alignment) {
+        ++stats_.allocations;
+        stats_.bytes += size;
+
+        void* ptr = current_;
+        std::size_t space = end_ - current_;
+        if (std::align(alignment, size, ptr, space)) {
+            current_ = static_cast<char*>(ptr) + size;
+            return ptr;
+        }
+        return AllocateSlow(size, alignment);
+    }
+
+    /// Frees all the heap blocks, memory returned by Allocate() becomes invalid
+    void Release() noexcept;
+
+    Stats GetStats() const noexcept { return stats_; }
+
+private:
+    struct BlockHeader;
+
+    void* AllocateSlow(std::size_t size, std::size_t alignment);
+
+    char* current_;
+    char* end_;
+    BlockHeader* heap_blocks_{nullptr};
+    std::size_t next_block_size_;
+    Stats stats_;
+    alignas(std::max_align_t) char inline_block_[kInlineSize];
+};
+
+/// STL allocator that draws memory from a MonotonicArena. The arena must
+/// outlive the containers that use it.
+template <typename T>
+class ArenaAllocator {
+public:
+    using value_type = T;
+
+    explicit ArenaAllocator(MonotonicArena& arena) noexcept : arena_(&arena) {}
+
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) noexcept : arena_(other.arena_) {}
+
+    T* allocate(std::size_t n) {
+        if (n > static_cast<std::size_t>(-1) / sizeof(T)) throw std::bad_array_new_length();
+        return static_cast<T*>(arena_->Allocate(n * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T*, std::size_t) noexcept {}
+
+    template <typename U>
+    bool operator==(const ArenaAllocator<U>& other) const noexcept {
+        return arena_ == other.arena_;
+    }
+
+    template <typename U>
+    bool operator!=(const ArenaAllocator<U>& other) const noexcept {
+        return arena_ != other.arena_;
+    }
+
+private:
+    template <typename U>
+    friend class ArenaAllocator;
+
+    MonotonicArena* arena_;
+};
+
+}  // namespace utils
+
+USERVER_NAMESPACE_END
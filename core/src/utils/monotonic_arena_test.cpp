@@ -0,0 +1,62 @@
+#include <utils/monotonic_arena.hpp>
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+TEST(MonotonicArena, InlineBlock) {
+    utils::MonotonicArena arena;
+
+    auto* first = arena.Allocate(1, 1);
+    auto* second = arena.Allocate(8, 8);
+    EXPECT_NE(first, second);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(second) % 8, 0);
+
+    const auto stats = arena.GetStats();
+    EXPECT_EQ(stats.allocations, 2);
+    EXPECT_EQ(stats.bytes, 9);
+    EXPECT_EQ(stats.heap_blocks, 0);
+}
+
+TEST(MonotonicArena, HeapBlocks) {
+    utils::MonotonicArena arena;
+
+    arena.Allocate(utils::MonotonicArena::kInlineSize, 1);
+    EXPECT_EQ(arena.GetStats().heap_blocks, 0);
+
+    auto* ptr = static_cast<char*>(arena.Allocate(100 * 1024, 64));
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(ptr) % 64, 0);
+    ptr[100 * 1024 - 1] = 'x';
+    EXPECT_EQ(arena.GetStats().heap_blocks, 1);
+
+    arena.Release();
+    arena.Allocate(utils::MonotonicArena::kInlineSize, 1);
+    EXPECT_EQ(arena.GetStats().heap_blocks, 1);
+}
+
+TEST(MonotonicArena, Containers) {
+    utils::MonotonicArena arena;
+
+    std::vector<std::string, utils::ArenaAllocator<std::string>> vector{utils::ArenaAllocator<std::string>{arena}};
+    for (int i = 0; i < 100; ++i) vector.push_back(std::to_string(i));
+    EXPECT_EQ(vector[42], "42");
+
+    using Map = std::unordered_map<
+        std::string,
+        int,
+        std::hash<std::string>,
+        std::equal_to<>,
+        utils::ArenaAllocator<std::pair<const std::string, int>>>;
+    Map map{utils::ArenaAllocator<Map::value_type>{arena}};
+    for (int i = 0; i < 100; ++i) map.emplace(std::to_string(i), i);
+    EXPECT_EQ(map.at("42"), 42);
+
+    EXPECT_GT(arena.GetStats().allocations, 100);
+}
+
+USERVER_NAMESPACE_END
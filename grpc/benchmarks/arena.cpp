@@ -0,0 +1,125 @@
+#include <cstdlib>
+#include <memory>
+#include <string>
+
+#include <google/protobuf/arena.h>
+
+#include <userver/ugrpc/impl/arena_pool.hpp>
+#include <userver/utils/assert.hpp>
+
+#include <tests/protobuf.pb.h>
+
+#include <benchmark/benchmark.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+// Counts the arena blocks allocated from the heap. The global operator new is
+// not replaced, so that the benchmark binary keeps its allocator.
+std::size_t arena_block_count = 0;
+
+void* AllocateArenaBlock(std::size_t size) {
+    ++arena_block_count;
+    return std::malloc(size);
+}
+
+void DeallocateArenaBlock(void* block, std::size_t /*size*/) { std::free(block); }
+
+google::protobuf::ArenaOptions MakeCountingArenaOptions(char* initial_block) {
+    const ugrpc::ArenaSettings settings;
+    google::protobuf::ArenaOptions options;
+    options.start_block_size = settings.initial_block_size;
+    options.max_block_size = settings.max_block_size;
+    if (initial_block) {
+        options.initial_block = initial_block;
+        options.initial_block_size = settings.initial_block_size;
+    }
+    options.block_alloc = &AllocateArenaBlock;
+    options.block_dealloc = &DeallocateArenaBlock;
+    return options;
+}
+
+std::string MakeSerializedMessage(int nested_count) {
+    sample::ugrpc::MessageWithDifferentTypes message;
+    message.set_required_string(std::string(64, 'a'));
+    message.mutable_required_nested()->set_required_string(std::string(64, 'b'));
+    message.mutable_required_recursive()->mutable_required_nested()->set_required_string(std::string(64, 'c'));
+    for (int i = 0; i < nested_count; ++i) {
+        message.add_repeated_primitive(std::string(32, 'd'));
+        auto& nested = *message.add_repeated_message();
+        nested.set_required_string(std::string(32, 'e'));
+        nested.set_required_int(i);
+        (*message.mutable_nested_map())[std::to_string(i)].set_required_string(std::string(32, 'f'));
+    }
+    return message.SerializeAsString();
+}
+
+template <typename Func>
+void RunParseBenchmark(benchmark::State& state, Func parse) {
+    const auto serialized = MakeSerializedMessage(state.range(0));
+    for ([[maybe_unused]] auto _ : state) {
+        parse(serialized);
+    }
+}
+
+void ParseInArena(google::protobuf::Arena& arena, const std::string& serialized) {
+    auto* const message = ugrpc::impl::CreateArenaMessage<sample::ugrpc::MessageWithDifferentTypes>(&arena);
+    UINVARIANT(message->ParseFromString(serialized), "Failed to parse");
+    benchmark::DoNotOptimize(message);
+}
+
+void ReportArenaBlocks(benchmark::State& state, std::size_t blocks_before) {
+    state.counters["arena_blocks_per_message"] = benchmark::Counter(
+        static_cast<double>(arena_block_count - blocks_before), benchmark::Counter::kAvgIterations
+    );
+}
+
+}  // namespace
+
+void ArenaParseHeap(benchmark::State& state) {
+    RunParseBenchmark(state, [](const std::string& serialized) {
+        sample::ugrpc::MessageWithDifferentTypes message;
+        UINVARIANT(message.ParseFromString(serialized), "Failed to parse");
+        benchmark::DoNotOptimize(message);
+    });
+}
+BENCHMARK(ArenaParseHeap)->RangeMultiplier(4)->Range(1, 256);
+
+void ArenaParsePooled(benchmark::State& state) {
+    ugrpc::impl::ArenaPool pool{ugrpc::ArenaSettings{}};
+    RunParseBenchmark(state, [&pool](const std::string& serialized) {
+        const auto arena = pool.Acquire();
+        auto* const message = ugrpc::impl::CreateArenaMessage<sample::ugrpc::MessageWithDifferentTypes>(arena.Get());
+        UINVARIANT(message->ParseFromString(serialized), "Failed to parse");
+        benchmark::DoNotOptimize(message);
+    });
+}
+BENCHMARK(ArenaParsePooled)->RangeMultiplier(4)->Range(1, 256);
+
+// A new arena per message, as without ArenaPool
+void ArenaParseFreshBlocks(benchmark::State& state) {
+    const auto blocks_before = arena_block_count;
+    RunParseBenchmark(state, [](const std::string& serialized) {
+        google::protobuf::Arena arena{MakeCountingArenaOptions(nullptr)};
+        ParseInArena(arena, serialized);
+    });
+    ReportArenaBlocks(state, blocks_before);
+}
+BENCHMARK(ArenaParseFreshBlocks)->RangeMultiplier(4)->Range(1, 256);
+
+// A reset arena with a kept initial block, as in ArenaPool
+void ArenaParseReusedBlocks(benchmark::State& state) {
+    const auto initial_block = std::make_unique<char[]>(ugrpc::ArenaSettings{}.initial_block_size);
+    google::protobuf::Arena arena{MakeCountingArenaOptions(initial_block.get())};
+
+    const auto blocks_before = arena_block_count;
+    RunParseBenchmark(state, [&arena](const std::string& serialized) {
+        ParseInArena(arena, serialized);
+        arena.Reset();
+    });
+    ReportArenaBlocks(state, blocks_before);
+}
+BENCHMARK(ArenaParseReusedBlocks)->RangeMultiplier(4)->Range(1, 256);
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,35 @@
+#pragma once
+
+/// @file userver/ugrpc/arena_settings.hpp
+/// @brief @copybrief ugrpc::ArenaSettings
+
+#include <cstddef>
+
+#include <userver/formats/parse/to.hpp>
+#include <userver/yaml_config/fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc {
+
+/// @brief Settings of the per-call google::protobuf::Arena allocation
+///
+/// Each RPC gets its own arena, taken from a pool and returned into it
+/// after the RPC is destroyed. The first block of a pooled arena is kept
+/// between the RPCs, so that small RPCs do not allocate at all.
+struct ArenaSettings final {
+    /// Size of the first arena block, that is reused between the RPCs
+    std::size_t initial_block_size{4 * 1024};
+
+    /// Maximum size of the subsequent arena blocks
+    std::size_t max_block_size{64 * 1024};
+
+    /// Maximum number of idle arenas kept in the pool
+    std::size_t max_pooled_arenas{1024};
+};
+
+ArenaSettings Parse(const yaml_config::YamlConfig& value, formats::parse::To<ArenaSettings>);
+
+}  // namespace ugrpc
+
+USERVER_NAMESPACE_END
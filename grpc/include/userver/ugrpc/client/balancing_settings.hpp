@@ -0,0 +1,59 @@
+#pragma once
+
+/// @file userver/ugrpc/client/balancing_settings.hpp
+/// @brief @copybrief ugrpc::client::BalancingSettings
+
+#include <chrono>
+#include <cstddef>
+
+#include <userver/formats/parse/to.hpp>
+#include <userver/yaml_config/fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::client {
+
+/// @brief Settings of the balancing of RPCs between the backends of an endpoint
+///
+/// The balancing needs the endpoint to list the backend addresses, e.g.
+/// `ipv4:10.0.0.1:8080,10.0.0.2:8080`. Then `channel-count` channels are opened
+/// to each of the backends, and each RPC goes to the better of two random
+/// backends ("power of two choices"). The cost of a backend is its peak-EWMA
+/// latency multiplied by the number of its RPCs in flight plus one. So slow or
+/// overloaded replicas get less traffic. The EWMA of an idle backend decays
+/// towards zero, so that a recovered backend is probed again. An endpoint that
+/// is a single address or a DNS name is a single backend, so its RPCs are not
+/// balanced. Only unary RPCs are accounted in the load; streams are placed by
+/// it, but their lifetime is not a latency and they are not counted as in
+/// flight.
+///
+/// A backend may be temporarily ejected after several consecutive RPCs failed
+/// with `UNAVAILABLE`, `INTERNAL` or `UNKNOWN`. `DEADLINE_EXCEEDED` does not
+/// count, as the deadline is set by the caller.
+struct BalancingSettings final {
+    /// Time constant of the latency EWMA
+    std::chrono::milliseconds ewma_decay_time{10'000};
+
+    /// Number of consecutive failed RPCs after which a backend is ejected,
+    /// `0` disables the ejection
+    std::size_t ejection_consecutive_failures{0};
+
+    /// How long an ejected backend gets no RPCs
+    std::chrono::milliseconds ejection_time{30'000};
+
+    /// Maximum percent of the backends of an endpoint that may be ejected at
+    /// the same time
+    std::size_t max_ejection_percent{50};
+
+    /// Whether each channel opens its own connection instead of sharing it
+    /// with the other channels to the same backend
+    /// (`GRPC_ARG_USE_LOCAL_SUBCHANNEL_POOL`). Multiplies the number of
+    /// connections to each backend by `channel-count`.
+    bool local_subchannel_pool{false};
+};
+
+BalancingSettings Parse(const yaml_config::YamlConfig& value, formats::parse::To<BalancingSettings>);
+
+}  // namespace ugrpc::client
+
+USERVER_NAMESPACE_END
@@ -5,6 +5,7 @@
 
 #include <cstddef>
 #include <memory>
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -18,11 +19,13 @@
 #include <userver/logging/level.hpp>
 #include <userver/storages/secdist/secdist.hpp>
 #include <userver/testsuite/grpc_control.hpp>
+#include <userver/utils/statistics/fwd.hpp>
 
 #include <userver/ugrpc/client/client_factory_settings.hpp>
 #include <userver/ugrpc/client/fwd.hpp>
 #include <userver/ugrpc/client/impl/channel_cache.hpp>
 #include <userver/ugrpc/client/middlewares/base.hpp>
+#include <userver/ugrpc/impl/arena_pool.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -101,6 +104,9 @@ public:
         testsuite::GrpcControl& testsuite_grpc,
         dynamic_config::Source source
     );
+
+    // For internal use only. Writes the load of the balanced backends.
+    void WriteStatistics(utils::statistics::Writer& writer);
     /// @endcond
 
 private:
@@ -117,6 +123,7 @@ private:
     ugrpc::impl::StatisticsStorage& client_statistics_storage_;
     const dynamic_config::Source config_source_;
     testsuite::GrpcControl& testsuite_grpc_;
+    std::optional<ugrpc::impl::ArenaPool> arena_pool_;
 };
 
 template <typename Client>
@@ -4,6 +4,7 @@
 /// @brief @copybrief ugrpc::client::ClientFactoryComponent
 
 #include <userver/components/component_base.hpp>
+#include <userver/utils/statistics/entry.hpp>
 
 #include <userver/ugrpc/client/client_factory.hpp>
 
@@ -48,6 +49,21 @@ namespace ugrpc::client {
 /// default-service-config | default service config, see above | -
 /// channel-count | Number of underlying grpc::Channel objects | 1
 /// middlewares | middlewares names to use | -
+/// arena.enabled | give each RPC a protobuf arena, see ugrpc::client::CallAnyBase::GetArena | true if `arena` is set
+/// arena.initial-block-size | size of the first arena block, that is reused between RPCs | 4096
+/// arena.max-block-size | max size of the subsequent arena blocks | 65536
+/// arena.max-pooled-arenas | max number of idle arenas kept for reuse | 1024
+/// balancing.enabled | balance RPCs between the backends listed in an endpoint (`ipv4:addr1:port1,addr2:port2`) by their load, see ugrpc::client::BalancingSettings | true if `balancing` is set
+/// balancing.ewma-decay-time | time constant of the backend latency EWMA | 10s
+/// balancing.ejection-consecutive-failures | eject a backend after this many consecutive failed RPCs, 0 to never eject | 0
+/// balancing.ejection-time | how long an ejected backend gets no RPCs | 30s
+/// balancing.max-ejection-percent | max percent of the backends of an endpoint that may be ejected at once | 50
+/// balancing.local-subchannel-pool | give each channel its own connection, multiplies the connections to each backend by `channel-count` | false
+///
+/// With `balancing` enabled, `channel-count` channels are opened to each
+/// backend, and the load of each backend is reported as
+/// `grpc.client.channels` metrics, labeled by `grpc_endpoint` and
+/// `grpc_backend`.
 ///
 /// @see https://grpc.github.io/grpc/core/group__grpc__arg__keys.html
 
@@ -61,12 +77,15 @@ public:
 
     ClientFactoryComponent(const components::ComponentConfig& config, const components::ComponentContext& context);
 
+    ~ClientFactoryComponent() override;
+
     ClientFactory& GetFactory();
 
     static yaml_config::Schema GetStaticConfigSchema();
 
 private:
     std::optional<ClientFactory> factory_;
+    utils::statistics::Entry channel_statistics_holder_;
 };
 
 }  // namespace ugrpc::client
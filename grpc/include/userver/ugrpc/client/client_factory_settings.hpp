@@ -4,6 +4,7 @@
 /// @brief @copybrief ugrpc::client::ClientFactorySettings
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <unordered_map>
 
@@ -11,6 +12,8 @@
 #include <grpcpp/support/channel_arguments.h>
 
 #include <userver/logging/level.hpp>
+#include <userver/ugrpc/arena_settings.hpp>
+#include <userver/ugrpc/client/balancing_settings.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -39,6 +42,14 @@ struct ClientFactorySettings final {
     /// Number of underlying channels that will be created for every client
     /// in this factory.
     std::size_t channel_count{1};
+
+    /// If set, each RPC gets a google::protobuf::Arena from a pool,
+    /// see ugrpc::client::CallAnyBase::GetArena
+    std::optional<ArenaSettings> arena{};
+
+    /// If set, RPCs are balanced between the backends listed in the endpoint by
+    /// their load, see ugrpc::client::BalancingSettings
+    std::optional<BalancingSettings> balancing{};
 };
 
 }  // namespace ugrpc::client
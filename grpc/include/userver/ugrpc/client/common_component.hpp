@@ -7,6 +7,7 @@
 
 #include <userver/components/component_base.hpp>
 #include <userver/engine/task/task_processor_fwd.hpp>
+#include <userver/utils/statistics/entry.hpp>
 
 #include <userver/ugrpc/client/impl/completion_queue_pool.hpp>
 #include <userver/ugrpc/impl/completion_queue_pool_base.hpp>
@@ -29,6 +30,10 @@ namespace ugrpc::client {
 /// ---- | ----------- | -------------
 /// blocking-task-processor | the task processor for blocking channel creation | -
 /// native-log-level | min log level for the native gRPC library | 'error'
+/// completion-queue-count | count of completion queues to create, if the service has no grpc-server | 1
+/// completion-queue-polling.task-processor | poll the completion queues from this task processor instead of the dedicated threads | -
+/// completion-queue-polling.pollers-per-queue | count of the poller tasks per completion queue | 1
+/// completion-queue-polling.idle-yields | count of the empty polls before an idle poller parks | 100
 ///
 /// @see ugrpc::client::ClientFactoryComponent
 
@@ -51,6 +56,7 @@ private:
     std::optional<impl::CompletionQueuePool> client_completion_queues_;
     ugrpc::impl::CompletionQueuePoolBase& completion_queues_;
     ugrpc::impl::StatisticsStorage client_statistics_storage_;
+    utils::statistics::Entry queue_statistics_holder_;
 };
 
 }  // namespace ugrpc::client
@@ -21,6 +21,7 @@
 #include <userver/ugrpc/client/exceptions.hpp>
 #include <userver/ugrpc/client/impl/async_method_invocation.hpp>
 #include <userver/ugrpc/client/impl/call_params.hpp>
+#include <userver/ugrpc/impl/arena_pool.hpp>
 #include <userver/ugrpc/impl/async_method_invocation.hpp>
 #include <userver/ugrpc/impl/maybe_owned_string.hpp>
 #include <userver/ugrpc/impl/statistics_scope.hpp>
@@ -121,6 +122,10 @@ public:
 
     grpc::Status& GetStatus() noexcept;
 
+    google::protobuf::Arena* GetArena() const noexcept;
+
+    InFlightRpc& GetInFlightRpc() noexcept;
+
     class AsyncMethodInvocationGuard {
     public:
         AsyncMethodInvocationGuard(RpcData& data) noexcept;
@@ -136,6 +141,8 @@ public:
     };
 
 private:
+    // Owns the arena-allocated messages, so must outlive them
+    ugrpc::impl::PooledArena arena_;
     std::unique_ptr<grpc::ClientContext> context_;
     std::string client_name_;
     ugrpc::impl::MaybeOwnedString call_name_;
@@ -145,6 +152,7 @@ private:
 
     std::optional<tracing::InPlaceSpan> span_;
     ugrpc::impl::RpcStatisticsScope stats_scope_;
+    InFlightRpc in_flight_;
     grpc::CompletionQueue& queue_;
     RpcConfigValues config_values_;
     const Middlewares& mws_;
@@ -26,13 +26,16 @@ struct CallParams {
     std::unique_ptr<grpc::ClientContext> context;
     ugrpc::impl::MethodStatistics& statistics;
     const Middlewares& mws;
+    ugrpc::impl::ArenaPool* arena_pool;
+    InFlightRpc in_flight;
 };
 
 CallParams CreateCallParams(
     const ClientData& client_data,
     std::size_t method_id,
     std::unique_ptr<grpc::ClientContext> client_context,
-    const Qos& qos
+    const Qos& qos,
+    InFlightRpc&& in_flight
 );
 
 CallParams CreateGenericCallParams(
@@ -40,7 +43,8 @@ CallParams CreateGenericCallParams(
     std::string_view call_name,
     std::unique_ptr<grpc::ClientContext> client_context,
     const Qos& qos,
-    std::optional<std::string_view> metrics_call_name
+    std::optional<std::string_view> metrics_call_name,
+    InFlightRpc&& in_flight
 );
 
 }  // namespace ugrpc::client::impl
@@ -0,0 +1,125 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <grpcpp/support/status.h>
+
+#include <userver/utils/fixed_array.hpp>
+#include <userver/utils/statistics/fwd.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
+
+#include <userver/ugrpc/client/balancing_settings.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::client::impl {
+
+class ChannelBalancer;
+
+/// The load of a single backend, all the times are steady_clock nanoseconds
+struct BackendLoad final {
+    std::atomic<std::uint64_t> in_flight{0};
+    std::atomic<std::int64_t> latency_ewma{0};
+    std::atomic<std::int64_t> latency_ewma_update_time{0};
+    std::atomic<std::uint64_t> consecutive_failures{0};
+    std::atomic<std::int64_t> ejected_until{0};
+    utils::statistics::RateCounter failures{0};
+    utils::statistics::RateCounter ejections{0};
+};
+
+void DumpMetric(utils::statistics::Writer& writer, const BackendLoad& load);
+
+/// Whether an RPC finished with `code` hints that its backend is unhealthy.
+/// `DEADLINE_EXCEEDED` is not, as the deadline is imposed by the caller.
+bool IsBackendFailure(grpc::StatusCode code) noexcept;
+
+/// Splits an `ipv4:` or `ipv6:` endpoint with a list of addresses into an
+/// endpoint per address, returns any other endpoint as is
+std::vector<std::string> SplitBackendAddresses(std::string_view endpoint);
+
+/// The backends to open the channels to: the addresses of the endpoint with
+/// the balancing, the endpoint itself without it
+std::vector<std::string> MakeBackends(std::string_view endpoint, const std::optional<BalancingSettings>& balancing);
+
+/// Accounts an RPC in flight on a backend, picked by ChannelBalancer
+class InFlightRpc final {
+public:
+    InFlightRpc() noexcept = default;
+
+    InFlightRpc(InFlightRpc&&) noexcept;
+    InFlightRpc& operator=(InFlightRpc&&) noexcept;
+    ~InFlightRpc();
+
+    /// Accounts the latency of the RPC and whether the backend has failed it.
+    /// Subsequent calls are ignored.
+    void Finish(bool backend_failed) noexcept;
+
+private:
+    friend class ChannelBalancer;
+
+    InFlightRpc(ChannelBalancer& balancer, BackendLoad& load) noexcept;
+
+    ChannelBalancer* balancer_{nullptr};
+    BackendLoad* load_{nullptr};
+    std::chrono::steady_clock::time_point start_;
+};
+
+struct PickedChannel final {
+    std::size_t index;
+    InFlightRpc rpc;
+};
+
+/// @brief Picks a channel of an endpoint for each RPC
+///
+/// The channels are grouped by backend: `channels_per_backend` consecutive
+/// channels go to each of the `backends`. The load is tracked per backend, the
+/// channel of the picked backend is random.
+///
+/// Without BalancingSettings picks a random channel and tracks nothing.
+/// @see ugrpc::client::BalancingSettings
+class ChannelBalancer final {
+public:
+    ChannelBalancer(
+        std::vector<std::string> backends,
+        std::size_t channels_per_backend,
+        const std::optional<BalancingSettings>& settings
+    );
+
+    ChannelBalancer(ChannelBalancer&&) = delete;
+    ChannelBalancer& operator=(ChannelBalancer&&) = delete;
+
+    PickedChannel Pick();
+
+    std::size_t GetBackendCount() const noexcept { return backends_.size(); }
+
+    /// Writes the load of each backend, labeled by `grpc_endpoint` and
+    /// `grpc_backend`
+    void WriteStatistics(utils::statistics::Writer& writer, std::string_view endpoint) const;
+
+private:
+    friend class InFlightRpc;
+
+    std::size_t PickBackend();
+
+    std::int64_t GetCost(const BackendLoad& load, std::int64_t now) const noexcept;
+
+    void OnFinished(BackendLoad& load, std::int64_t latency, bool backend_failed) noexcept;
+
+    void TryEject(BackendLoad& load, std::int64_t now) noexcept;
+
+    const std::optional<BalancingSettings> settings_;
+    const std::vector<std::string> backends_;
+    const std::size_t channels_per_backend_;
+    utils::FixedArray<BackendLoad> loads_;
+};
+
+}  // namespace ugrpc::client::impl
+
+USERVER_NAMESPACE_END
@@ -3,8 +3,10 @@
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <optional>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include <grpcpp/channel.h>
 #include <grpcpp/security/credentials.h>
@@ -12,6 +14,10 @@
 
 #include <userver/concurrent/variable.hpp>
 #include <userver/utils/fixed_array.hpp>
+#include <userver/utils/statistics/fwd.hpp>
+
+#include <userver/ugrpc/client/balancing_settings.hpp>
+#include <userver/ugrpc/client/impl/channel_balancer.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -22,7 +28,8 @@ public:
     ChannelCache(
         std::shared_ptr<grpc::ChannelCredentials>&& credentials,
         const grpc::ChannelArguments& channel_args,
-        std::size_t channel_count
+        std::size_t channel_count,
+        const std::optional<BalancingSettings>& balancing
     );
 
     ~ChannelCache();
@@ -33,16 +40,30 @@ public:
     // alive.
     Token Get(const std::string& endpoint);
 
+    // Writes the load of the channels of each cached endpoint
+    void WriteStatistics(utils::statistics::Writer& writer);
+
 private:
     struct CountedChannel final {
         CountedChannel(
             const std::string& endpoint,
             const std::shared_ptr<grpc::ChannelCredentials>& credentials,
             const grpc::ChannelArguments& channel_args,
-            std::size_t count
+            std::size_t count,
+            const std::optional<BalancingSettings>& balancing
+        );
+
+        CountedChannel(
+            std::vector<std::string>&& backends,
+            const std::shared_ptr<grpc::ChannelCredentials>& credentials,
+            const grpc::ChannelArguments& channel_args,
+            std::size_t count,
+            const std::optional<BalancingSettings>& balancing
         );
 
+        // `count` consecutive channels to each of the backends
         utils::FixedArray<std::shared_ptr<grpc::Channel>> channels;
+        ChannelBalancer balancer;
         std::uint64_t counter{0};
     };
 
@@ -51,6 +72,7 @@ private:
     const std::shared_ptr<grpc::ChannelCredentials> credentials_;
     const grpc::ChannelArguments channel_args_;
     const std::size_t channel_count_;
+    const std::optional<BalancingSettings> balancing_;
     concurrent::Variable<Map> channels_;
 };
 
@@ -69,6 +91,8 @@ public:
 
     const std::shared_ptr<grpc::Channel>& GetChannel(std::size_t index) const noexcept;
 
+    ChannelBalancer& GetBalancer() const noexcept;
+
 private:
     ChannelCache* cache_{nullptr};
     const std::string* endpoint_{nullptr};
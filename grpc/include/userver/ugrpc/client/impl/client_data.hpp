@@ -11,10 +11,12 @@
 
 #include <userver/dynamic_config/source.hpp>
 #include <userver/testsuite/grpc_control.hpp>
+#include <userver/utils/assert.hpp>
 #include <userver/utils/fixed_array.hpp>
 
 #include <userver/ugrpc/client/client_factory_settings.hpp>
 #include <userver/ugrpc/client/fwd.hpp>
+#include <userver/ugrpc/client/impl/channel_balancer.hpp>
 #include <userver/ugrpc/client/impl/channel_cache.hpp>
 #include <userver/ugrpc/client/middlewares/fwd.hpp>
 #include <userver/ugrpc/impl/static_metadata.hpp>
@@ -24,6 +26,7 @@
 USERVER_NAMESPACE_BEGIN
 
 namespace ugrpc::impl {
+class ArenaPool;
 class StatisticsStorage;
 class CompletionQueuePoolBase;
 }  // namespace ugrpc::impl
@@ -47,12 +50,20 @@ struct ClientDependencies final {
     const dynamic_config::Key<ClientQos>* qos{nullptr};
     const ClientFactorySettings& settings;
     DedicatedMethodsConfig dedicated_methods_config;
+    ugrpc::impl::ArenaPool* arena_pool{nullptr};
 };
 
 struct GenericClientTag final {
     explicit GenericClientTag() = default;
 };
 
+/// A stub for an RPC together with the load accounting of its channel
+template <typename Stub>
+struct PickedStub final {
+    Stub& stub;
+    InFlightRpc in_flight;
+};
+
 /// The internal state of generated gRPC clients
 class ClientData final {
 public:
@@ -67,7 +78,8 @@ public:
           metadata_(metadata),
           service_statistics_(&GetServiceStatistics()),
           default_stubs_(MakeStubs<Service>(dependencies_.channel_token)),
-          dedicated_stubs_(MakeDedicatedStubs<Service>(dependencies_, metadata)) {}
+          dedicated_stubs_(MakeDedicatedStubs<Service>(dependencies_, metadata)),
+          dedicated_balancers_(MakeDedicatedBalancers(dependencies_, dedicated_stubs_)) {}
 
     template <typename Service>
     ClientData(ClientDependencies&& dependencies, GenericClientTag, std::in_place_type_t<Service>)
@@ -80,16 +92,16 @@ public:
     ClientData& operator=(const ClientData&) = delete;
 
     template <typename Service>
-    Stub<Service>& NextStubFromMethodId(std::size_t method_id) const {
+    PickedStub<Stub<Service>> NextStubFromMethodId(std::size_t method_id) const {
         if (!dedicated_stubs_[method_id].empty()) {
-            return *static_cast<Stub<Service>*>(NextStubPtr(dedicated_stubs_[method_id]).get());
+            return PickStub<Service>(dedicated_stubs_[method_id], dedicated_balancers_[method_id]);
         }
         return NextGenericStub<Service>();
     }
 
     template <typename Service>
-    Stub<Service>& NextGenericStub() const {
-        return *static_cast<Stub<Service>*>(NextStubPtr(default_stubs_).get());
+    PickedStub<Stub<Service>> NextGenericStub() const {
+        return PickStub<Service>(default_stubs_, dependencies_.channel_token.GetBalancer());
     }
 
     grpc::CompletionQueue& NextQueue() const;
@@ -114,6 +126,8 @@ public:
 
     std::size_t GetDedicatedChannelCount(std::size_t method_id) const;
 
+    ugrpc::impl::ArenaPool* GetArenaPool() const { return dependencies_.arena_pool; }
+
 private:
     static std::shared_ptr<grpc::Channel>
     CreateChannelImpl(const ClientDependencies& dependencies, const grpc::string& endpoint);
@@ -146,16 +160,26 @@ private:
     static utils::FixedArray<StubPool>
     MakeDedicatedStubs(ClientDependencies& dependencies, const ugrpc::impl::StaticServiceMetadata& meta) {
         const auto& method_full_names = meta.method_full_names;
-        const auto endpoint_string = ugrpc::impl::ToGrpcString(dependencies.endpoint);
+        const auto backends = MakeBackends(dependencies.endpoint, dependencies.settings.balancing);
         return utils::GenerateFixedArray(method_full_names.size(), [&](std::size_t method_id) {
+            // `count_of_channels` consecutive channels to each of the backends
             const auto count_of_channels = GetDedicatedChannelCountImpl(dependencies, method_id, meta);
-            return utils::GenerateFixedArray(count_of_channels, [&](std::size_t) {
-                return StubPtr(Service::NewStub(CreateChannelImpl(dependencies, endpoint_string)).release(), &StubDeleter<Service>);
+            return utils::GenerateFixedArray(backends.size() * count_of_channels, [&](std::size_t index) {
+                const auto backend = ugrpc::impl::ToGrpcString(backends[index / count_of_channels]);
+                return StubPtr(Service::NewStub(CreateChannelImpl(dependencies, backend)).release(), &StubDeleter<Service>);
             });
         });
     }
 
-    const StubPtr& NextStubPtr(const utils::FixedArray<StubPtr>& stubs) const;
+    template <typename Service>
+    static PickedStub<Stub<Service>> PickStub(const StubPool& stubs, ChannelBalancer& balancer) {
+        auto picked = balancer.Pick();
+        UASSERT(picked.index < stubs.size());
+        return {*static_cast<Stub<Service>*>(stubs[picked.index].get()), std::move(picked.rpc)};
+    }
+
+    static utils::FixedArray<ChannelBalancer>
+    MakeDedicatedBalancers(const ClientDependencies& dependencies, const utils::FixedArray<StubPool>& dedicated_stubs);
 
     ugrpc::impl::ServiceStatistics& GetServiceStatistics();
 
@@ -165,6 +189,8 @@ private:
     utils::FixedArray<StubPtr> default_stubs_;
     // method_id -> stub_pool
     utils::FixedArray<StubPool> dedicated_stubs_;
+    // method_id -> balancer of the stub_pool, picking is thread-safe
+    mutable utils::FixedArray<ChannelBalancer> dedicated_balancers_;
 };
 
 template <typename Client>
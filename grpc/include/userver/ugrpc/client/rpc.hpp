@@ -158,6 +158,25 @@ public:
     /// @returns RPC span
     tracing::Span& GetSpan();
 
+    /// @brief Returns the per-RPC arena, if it is enabled by the `arena`
+    /// option of the client factory
+    ///
+    /// The messages created with `google::protobuf::Arena::CreateMessage` in this
+    /// arena live until the RPC object is destroyed, and the arena memory is
+    /// reused by the next RPCs. Moving a message to or from a different arena
+    /// (or the heap) makes a deep copy.
+    ///
+    /// ## Example usage:
+    ///
+    /// @code
+    /// auto call = client.SayHello(request);
+    /// auto& response = *google::protobuf::Arena::CreateMessage<GreetingResponse>(call.GetArena());
+    /// call.FinishAsync(response).Get();
+    /// @endcode
+    ///
+    /// @returns `nullptr` if the arena allocation is disabled
+    google::protobuf::Arena* GetArena() const;
+
 protected:
     impl::RpcData& GetData();
 
@@ -0,0 +1,47 @@
+#pragma once
+
+/// @file userver/ugrpc/completion_queue_polling.hpp
+/// @brief @copybrief ugrpc::CompletionQueuePollingSettings
+
+#include <cstddef>
+
+#include <userver/engine/task/task_processor_fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc {
+
+/// @brief Settings of the completion queue polling from the task processor
+///
+/// By default each completion queue is served by its own thread, and every
+/// event is handed over from that thread to the task processor. If
+/// `task_processor` is set, the completion queues are instead drained by
+/// `pollers_per_queue` tasks per queue running on its workers.
+///
+/// The pollers are ordinary tasks and are not pinned: any worker may run
+/// any of them. A poller never blocks its worker in the completion queue: after
+/// `idle_yields` empty polls it parks, and once all the pollers of a queue are
+/// parked, the queue is waited for by its own thread, which wakes the pollers up
+/// on the next event. The task processor must have more workers than the total
+/// number of pollers (completion queues count * `pollers_per_queue`), which is
+/// checked on the start.
+///
+/// In both modes the `grpc.completion-queues` metrics contain the event rate
+/// (`events`) and the event-to-coroutine wakeup latency in microseconds
+/// (`hop-timings-us`) for each queue, labeled by `grpc_queue`.
+struct CompletionQueuePollingSettings final {
+    /// The task processor, which workers poll the completion queues. If
+    /// `nullptr`, each completion queue is served by its own thread
+    engine::TaskProcessor* task_processor{nullptr};
+
+    /// Number of the poller tasks per completion queue
+    std::size_t pollers_per_queue{1};
+
+    /// Number of the empty polls, after each a poller just yields, before it
+    /// parks until the next event
+    std::size_t idle_yields{100};
+};
+
+}  // namespace ugrpc
+
+USERVER_NAMESPACE_END
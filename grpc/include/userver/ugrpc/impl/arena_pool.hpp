@@ -0,0 +1,86 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+#include <google/protobuf/arena.h>
+
+#include <userver/concurrent/impl/intrusive_hooks.hpp>
+#include <userver/concurrent/impl/intrusive_stack.hpp>
+
+#include <userver/ugrpc/arena_settings.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::impl {
+
+class ArenaPool;
+
+/// Creates a message that uses `arena` for itself and for its fields,
+/// or a heap-allocated message if `arena` is `nullptr`
+template <typename Message>
+Message* CreateArenaMessage(google::protobuf::Arena* arena) {
+#if GOOGLE_PROTOBUF_VERSION >= 5026000
+    return google::protobuf::Arena::Create<Message>(arena);
+#else
+    // Before 26.x Arena::Create does not pass the arena to the message
+    return google::protobuf::Arena::CreateMessage<Message>(arena);
+#endif
+}
+
+struct ArenaPoolNode final {
+    explicit ArenaPoolNode(const ArenaSettings& settings);
+
+    // The first block of the arena, it survives google::protobuf::Arena::Reset
+    std::unique_ptr<char[]> initial_block;
+    google::protobuf::Arena arena;
+    concurrent::impl::SinglyLinkedHook<ArenaPoolNode> free_list_hook;
+};
+
+/// Holds an arena taken from an ArenaPool, returns it on destruction
+class PooledArena final {
+public:
+    PooledArena() noexcept = default;
+    PooledArena(PooledArena&&) noexcept;
+    PooledArena& operator=(PooledArena&&) noexcept;
+    ~PooledArena();
+
+    /// @returns the arena, `nullptr` for an empty PooledArena
+    google::protobuf::Arena* Get() const noexcept;
+
+private:
+    friend class ArenaPool;
+
+    PooledArena(ArenaPool& pool, ArenaPoolNode& node) noexcept;
+
+    ArenaPool* pool_{nullptr};
+    ArenaPoolNode* node_{nullptr};
+};
+
+/// A thread-safe pool of google::protobuf::Arena, one arena per RPC
+class ArenaPool final {
+public:
+    explicit ArenaPool(const ArenaSettings& settings);
+
+    ArenaPool(ArenaPool&&) = delete;
+    ArenaPool& operator=(ArenaPool&&) = delete;
+    ~ArenaPool();
+
+    /// @returns an empty arena, either reused or newly created
+    PooledArena Acquire();
+
+private:
+    friend class PooledArena;
+
+    void Release(ArenaPoolNode& node) noexcept;
+
+    const ArenaSettings settings_;
+    concurrent::impl::IntrusiveStack<ArenaPoolNode, concurrent::impl::MemberHook<&ArenaPoolNode::free_list_hook>>
+        free_list_;
+    std::atomic<std::size_t> pooled_count_{0};
+};
+
+}  // namespace ugrpc::impl
+
+USERVER_NAMESPACE_END
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <chrono>
+
 #include <userver/engine/deadline.hpp>
 #include <userver/engine/single_use_event.hpp>
 
@@ -7,6 +9,8 @@ USERVER_NAMESPACE_BEGIN
 
 namespace ugrpc::impl {
 
+struct CompletionQueueStatistics;
+
 class EventBase {
 public:
     /// @brief For use from the blocking call queue
@@ -61,8 +65,13 @@ protected:
     void WaitWhileBusy();
 
 private:
+    void AccountHop() noexcept;
+
     bool ok_{false};
     bool busy_{false};
+    // The queue that has delivered the event, to account the wakeup latency
+    CompletionQueueStatistics* queue_statistics_{nullptr};
+    std::chrono::steady_clock::time_point notify_time_;
     engine::SingleUseEvent event_;
 };
 
@@ -5,6 +5,10 @@
 #include <grpcpp/completion_queue.h>
 
 #include <userver/utils/fixed_array.hpp>
+#include <userver/utils/statistics/fwd.hpp>
+
+#include <userver/ugrpc/completion_queue_polling.hpp>
+#include <userver/ugrpc/impl/completion_queue_statistics.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -23,14 +27,21 @@ public:
 
     grpc::CompletionQueue& NextQueue();
 
+    /// Writes the event rate and the hop timings of each queue
+    void WriteStatistics(utils::statistics::Writer& writer) const;
+
 protected:
-    explicit CompletionQueuePoolBase(utils::FixedArray<std::unique_ptr<grpc::CompletionQueue>> queues);
+    CompletionQueuePoolBase(
+        utils::FixedArray<std::unique_ptr<grpc::CompletionQueue>> queues,
+        const CompletionQueuePollingSettings& polling
+    );
 
     // protected to prevent destruction via pointer to base.
     ~CompletionQueuePoolBase();
 
 private:
     utils::FixedArray<std::unique_ptr<grpc::CompletionQueue>> queues_;
+    utils::FixedArray<CompletionQueueStatistics> queue_statistics_;
     utils::FixedArray<QueueRunner> queue_runners_;
 };
 
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstdint>
+
+#include <userver/utils/statistics/fwd.hpp>
+#include <userver/utils/statistics/percentile.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
+#include <userver/utils/statistics/recentperiod.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::impl {
+
+/// Per-queue statistics of a grpc::CompletionQueue
+struct CompletionQueueStatistics final {
+    using Percentile = utils::statistics::Percentile<2000, std::uint32_t, 256, 100>;
+
+    /// Events taken from the queue
+    utils::statistics::RateCounter events{0};
+
+    /// Microseconds from an event being taken from the queue to the waiting
+    /// coroutine being resumed
+    utils::statistics::RecentPeriod<Percentile, Percentile> hop_timings;
+};
+
+void DumpMetric(utils::statistics::Writer& writer, const CompletionQueueStatistics& stats);
+
+/// @returns statistics of the queue, which event is being processed by the
+/// current thread, `nullptr` outside of event processing
+CompletionQueueStatistics* GetCurrentQueueStatistics() noexcept;
+
+/// Marks the current thread as processing events of a queue
+class CurrentQueueStatisticsScope final {
+public:
+    explicit CurrentQueueStatisticsScope(CompletionQueueStatistics& stats) noexcept;
+
+    CurrentQueueStatisticsScope(CurrentQueueStatisticsScope&&) = delete;
+    CurrentQueueStatisticsScope& operator=(CurrentQueueStatisticsScope&&) = delete;
+    ~CurrentQueueStatisticsScope();
+
+private:
+    CompletionQueueStatistics* const old_stats_;
+};
+
+}  // namespace ugrpc::impl
+
+USERVER_NAMESPACE_END
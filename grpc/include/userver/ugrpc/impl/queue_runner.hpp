@@ -1,21 +1,55 @@
 #pragma once
 
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+
 #include <grpcpp/completion_queue.h>
 
+#include <userver/engine/single_consumer_event.hpp>
 #include <userver/engine/single_use_event.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/utils/fixed_array.hpp>
+
+#include <userver/ugrpc/completion_queue_polling.hpp>
+#include <userver/ugrpc/impl/completion_queue_statistics.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace ugrpc::impl {
 
+/// Dispatches the events of a grpc::CompletionQueue, either from a dedicated
+/// thread or from the poller tasks, if `polling.task_processor` is set
 class QueueRunner final {
 public:
-    explicit QueueRunner(grpc::CompletionQueue& queue);
+    QueueRunner(
+        grpc::CompletionQueue& queue,
+        CompletionQueueStatistics& statistics,
+        const CompletionQueuePollingSettings& polling
+    );
     ~QueueRunner();
 
 private:
+    void Poll(std::size_t poller, CompletionQueueStatistics& statistics, std::size_t idle_yields);
+
+    void Park(std::size_t poller);
+
+    void OnPollerExit();
+
+    void WaitWhileParked(CompletionQueueStatistics& statistics) noexcept;
+
     grpc::CompletionQueue& queue_;
     engine::SingleUseEvent completion_;
+
+    // Idle pollers park on their events. While all of them are parked, the
+    // dedicated thread waits in the queue and wakes them up on an event.
+    utils::FixedArray<engine::SingleConsumerEvent> poller_wakeups_;
+    std::mutex parked_mutex_;
+    std::condition_variable all_parked_;
+    std::size_t parked_pollers_{0};
+    std::size_t exited_pollers_{0};
+
+    utils::FixedArray<engine::TaskWithResult<void>> pollers_;
 };
 
 }  // namespace ugrpc::impl
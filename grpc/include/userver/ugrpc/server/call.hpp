@@ -81,6 +81,11 @@ public:
     /// @endcode
     utils::AnyStorage<StorageContext>& GetStorageContext() { return params_.storage_context; }
 
+    /// @brief Per-RPC arena for protobuf messages, that lives until the RPC
+    /// is finished, see ugrpc::server::CallContext::GetArena
+    /// @returns `nullptr` if the arena allocation is disabled for the service
+    google::protobuf::Arena* GetArena() const { return params_.arena; }
+
     /// @brief Useful for generic error reporting via @ref FinishWithError
     virtual bool IsFinished() const = 0;
 
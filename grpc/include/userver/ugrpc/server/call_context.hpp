@@ -3,6 +3,7 @@
 /// @file userver/ugrpc/server/call_context.hpp
 /// @brief @copybrief ugrpc::server::CallContext
 
+#include <google/protobuf/arena.h>
 #include <grpcpp/server_context.h>
 
 #include <userver/ugrpc/server/storage_context.hpp>
@@ -57,6 +58,33 @@ public:
     /// @endcode
     utils::AnyStorage<StorageContext>& GetStorageContext();
 
+    /// @brief Returns the per-RPC arena, if it is enabled for the service by
+    /// the `arena` static config option
+    ///
+    /// The request message of unary and server-streaming RPCs is allocated in
+    /// the arena, and so are the messages created by the handler with
+    /// `google::protobuf::Arena::CreateMessage`. All of them are freed at once after
+    /// the RPC is finished, and the arena memory is reused by the next RPCs.
+    ///
+    /// Moving a message to or from a different arena (or the heap) makes a
+    /// deep copy, so handlers should use the request in place. The returned
+    /// responses are stored by value, so the arena is mostly useful for the
+    /// stream messages.
+    ///
+    /// ## Example usage:
+    ///
+    /// @code
+    /// auto& request = *google::protobuf::Arena::CreateMessage<StreamGreetingRequest>(context.GetArena());
+    /// auto& response = *google::protobuf::Arena::CreateMessage<StreamGreetingResponse>(context.GetArena());
+    /// while (stream.Read(request)) {
+    ///   response.set_name("Hello " + request.name());
+    ///   stream.Write(response);
+    /// }
+    /// @endcode
+    ///
+    /// @returns `nullptr` if the arena allocation is disabled
+    google::protobuf::Arena* GetArena() const;
+
 protected:
     /// @cond
     const CallAnyBase& GetCall() const;
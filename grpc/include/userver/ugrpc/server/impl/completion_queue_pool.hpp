@@ -14,7 +14,11 @@ namespace ugrpc::server::impl {
 /// instances are destroyed.
 class CompletionQueuePool final : public ugrpc::impl::CompletionQueuePoolBase {
 public:
-    explicit CompletionQueuePool(std::size_t queue_count, grpc::ServerBuilder& server_builder);
+    CompletionQueuePool(
+        std::size_t queue_count,
+        grpc::ServerBuilder& server_builder,
+        const CompletionQueuePollingSettings& polling
+    );
 
     grpc::ServerCompletionQueue& GetQueue(std::size_t idx) {
         // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
@@ -2,6 +2,7 @@
 
 #include <cstddef>
 #include <memory>
+#include <optional>
 #include <string_view>
 #include <vector>
 
@@ -14,6 +15,7 @@
 #include <userver/utils/fixed_array.hpp>
 #include <userver/utils/statistics/fwd.hpp>
 
+#include <userver/ugrpc/arena_settings.hpp>
 #include <userver/ugrpc/impl/static_metadata.hpp>
 #include <userver/ugrpc/impl/statistics_storage.hpp>
 #include <userver/ugrpc/server/impl/completion_queue_pool.hpp>
@@ -31,6 +33,7 @@ struct ServiceSettings final {
     Middlewares middlewares;
     logging::LoggerPtr access_tskv_logger;
     const dynamic_config::Source config_source;
+    std::optional<ArenaSettings> arena;
 };
 
 /// @brief Listens to requests for a gRPC service, forwarding them to a
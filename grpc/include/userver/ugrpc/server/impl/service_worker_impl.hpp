@@ -7,6 +7,7 @@
 #include <type_traits>
 #include <utility>
 
+#include <google/protobuf/arena.h>
 #include <grpcpp/completion_queue.h>
 #include <grpcpp/impl/service_type.h>
 #include <grpcpp/server_context.h>
@@ -22,6 +23,7 @@
 #include <userver/utils/lazy_prvalue.hpp>
 #include <userver/utils/statistics/entry.hpp>
 
+#include <userver/ugrpc/impl/arena_pool.hpp>
 #include <userver/ugrpc/impl/static_metadata.hpp>
 #include <userver/ugrpc/impl/statistics.hpp>
 #include <userver/ugrpc/impl/statistics_scope.hpp>
@@ -77,13 +79,17 @@ void ParseGenericCallName(
 template <typename GrpcppService>
 struct ServiceData final {
     ServiceData(const ServiceSettings& settings, const ugrpc::impl::StaticServiceMetadata& metadata)
-        : settings(settings), metadata(metadata) {}
+        : settings(settings), metadata(metadata) {
+        if (settings.arena) arena_pool.emplace(*settings.arena);
+    }
 
     ~ServiceData() { wait_tokens.WaitForAllTokens(); }
 
     const ServiceSettings settings;
     const ugrpc::impl::StaticServiceMetadata metadata;
     AsyncService<GrpcppService> async_service{metadata.method_full_names.size()};
+    // Must outlive the calls, which return their arenas into the pool
+    std::optional<ugrpc::impl::ArenaPool> arena_pool;
     utils::impl::WaitTokenStorage wait_tokens;
     ugrpc::impl::ServiceStatistics& service_statistics{
         settings.statistics_storage.GetServiceStatistics(metadata, std::nullopt)};
@@ -108,7 +114,10 @@ template <typename GrpcppService, typename CallTraits>
 class CallData final {
 public:
     explicit CallData(const MethodData<GrpcppService, CallTraits>& method_data)
-        : wait_token_(method_data.service_data.wait_tokens.GetToken()), method_data_(method_data) {
+        : wait_token_(method_data.service_data.wait_tokens.GetToken()),
+          method_data_(method_data),
+          arena_(AcquireArena(method_data.service_data)),
+          initial_request_(MakeInitialRequest(arena_.Get(), initial_request_storage_)) {
         UASSERT(method_data.method_id < method_data.service_data.metadata.method_full_names.size());
     }
 
@@ -126,7 +135,7 @@ public:
 
         // the request for an incoming RPC must be performed synchronously
         method_data_.service_data.async_service.template Prepare<CallTraits>(
-            method_data_.method_id, context_, initial_request_, raw_responder_, queue, queue, prepare_.GetTag()
+            method_data_.method_id, context_, *initial_request_, raw_responder_, queue, queue, prepare_.GetTag()
         );
 
         // Note: we ignore task cancellations here. Even if notify_when_done has
@@ -167,6 +176,19 @@ private:
     using RawCall = typename CallTraits::RawCall;
     using Call = typename CallTraits::Call;
 
+    static ugrpc::impl::PooledArena AcquireArena(ServiceData<GrpcppService>& service_data) {
+        if (!service_data.arena_pool) return {};
+        return service_data.arena_pool->Acquire();
+    }
+
+    static InitialRequest*
+    MakeInitialRequest([[maybe_unused]] google::protobuf::Arena* arena, InitialRequest& storage) {
+        if constexpr (!std::is_same_v<InitialRequest, NoInitialRequest>) {
+            if (arena) return ugrpc::impl::CreateArenaMessage<InitialRequest>(arena);
+        }
+        return &storage;
+    }
+
     void HandleRpc() {
         auto call_name = method_data_.call_name;
         auto service_name = method_data_.service_data.metadata.service_full_name;
@@ -196,21 +218,22 @@ private:
                 *access_tskv_logger,
                 span_->Get(),
                 storage_context,
-                middlewares},
+                middlewares,
+                arena_.Get()},
             raw_responder_
         );
         auto do_call = [&] {
             if constexpr (std::is_same_v<InitialRequest, NoInitialRequest>) {
                 (method_data_.service.*(method_data_.service_method))(responder);
             } else {
-                (method_data_.service.*(method_data_.service_method))(responder, std::move(initial_request_));
+                (method_data_.service.*(method_data_.service_method))(responder, std::move(*initial_request_));
             }
         };
 
         try {
             ::google::protobuf::Message* initial_request = nullptr;
             if constexpr (!std::is_same_v<InitialRequest, NoInitialRequest>) {
-                initial_request = &initial_request_;
+                initial_request = initial_request_;
             }
 
             MiddlewareCallContext middleware_context(
@@ -240,8 +263,13 @@ private:
 
     MethodData<GrpcppService, CallTraits> method_data_;
 
+    // Owns the arena-allocated messages, so must outlive them
+    ugrpc::impl::PooledArena arena_;
+
     typename CallTraits::ContextType context_{};
-    InitialRequest initial_request_{};
+    InitialRequest initial_request_storage_{};
+    // Points either into 'arena_' or to 'initial_request_storage_'
+    InitialRequest* const initial_request_;
     RawCall raw_responder_{&context_};
     ugrpc::impl::AsyncMethodInvocation prepare_;
     std::optional<tracing::InPlaceSpan> span_{};
@@ -20,6 +20,7 @@
 #include <userver/utils/statistics/fwd.hpp>
 #include <userver/yaml_config/fwd.hpp>
 
+#include <userver/ugrpc/completion_queue_polling.hpp>
 #include <userver/ugrpc/impl/statistics.hpp>
 #include <userver/ugrpc/server/middlewares/fwd.hpp>
 #include <userver/ugrpc/server/service_base.hpp>
@@ -60,6 +61,10 @@ struct ServerConfig final {
     /// of worker threads for best RPS.
     std::size_t completion_queue_num{2};
 
+    /// Allows to poll the completion queues from the task processor workers
+    /// instead of the dedicated threads
+    CompletionQueuePollingSettings completion_queue_polling{};
+
     /// Optional grpc-core channel args
     /// @see https://grpc.github.io/grpc/core/group__grpc__arg__keys.html
     std::unordered_map<std::string, std::string> channel_args{};
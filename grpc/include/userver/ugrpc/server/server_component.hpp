@@ -30,6 +30,9 @@ struct ServiceDefaults;
 /// port | the port to use for all gRPC services, or 0 to pick any available | -
 /// unix-socket-path | unix socket absolute path to listen to, instead of listening on `port` | -
 /// completion-queue-count | count of completion queues to create | 2
+/// completion-queue-polling.task-processor | poll the completion queues from this task processor instead of the dedicated threads | -
+/// completion-queue-polling.pollers-per-queue | count of the poller tasks per completion queue | 1
+/// completion-queue-polling.idle-yields | count of the empty polls before an idle poller parks | 100
 /// channel-args | a map of channel arguments, see gRPC Core docs | {}
 /// native-log-level | min log level for the native gRPC library | 'error'
 /// enable-channelz | initialize service with runtime info about gRPC connections | false
@@ -3,8 +3,12 @@
 /// @file userver/ugrpc/server/service_base.hpp
 /// @brief @copybrief ugrpc::server::ServiceBase
 
+#include <optional>
+
 #include <userver/engine/task/task_processor_fwd.hpp>
 
+#include <userver/ugrpc/arena_settings.hpp>
+
 #include <userver/ugrpc/server/call_context.hpp>
 #include <userver/ugrpc/server/impl/service_worker.hpp>
 #include <userver/ugrpc/server/middlewares/fwd.hpp>
@@ -20,6 +24,10 @@ struct ServiceConfig final {
 
     /// Server middlewares to use for the gRPC service.
     Middlewares middlewares;
+
+    /// If set, each RPC gets a google::protobuf::Arena from a pool, that holds
+    /// the request message, see ugrpc::server::CallContext::GetArena.
+    std::optional<ArenaSettings> arena{};
 };
 
 /// @brief The type-erased base class for all gRPC service implementations
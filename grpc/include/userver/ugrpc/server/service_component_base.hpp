@@ -29,6 +29,10 @@ class GenericServiceBase;
 /// ---- | ----------- | -------------
 /// task-processor | the task processor to use for responses | taken from grpc-server.service-defaults
 /// middlewares | middleware component names to use for each RPC call, can be empty array ([]) | taken from grpc-server.service-defaults
+/// arena.enabled | allocate the request messages in a per-RPC protobuf arena, see ugrpc::server::CallContext::GetArena | true if `arena` is set
+/// arena.initial-block-size | size of the first arena block, that is reused between RPCs | 4096
+/// arena.max-block-size | max size of the subsequent arena blocks | 65536
+/// arena.max-pooled-arenas | max number of idle arenas kept for reuse | 1024
 
 // clang-format on
 
@@ -0,0 +1,25 @@
+#include <userver/ugrpc/arena_settings.hpp>
+
+#include <stdexcept>
+
+#include <userver/yaml_config/yaml_config.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc {
+
+ArenaSettings Parse(const yaml_config::YamlConfig& value, formats::parse::To<ArenaSettings>) {
+    ArenaSettings settings;
+    settings.initial_block_size = value["initial-block-size"].As<std::size_t>(settings.initial_block_size);
+    settings.max_block_size = value["max-block-size"].As<std::size_t>(settings.max_block_size);
+    settings.max_pooled_arenas = value["max-pooled-arenas"].As<std::size_t>(settings.max_pooled_arenas);
+
+    if (settings.max_block_size < settings.initial_block_size) {
+        throw std::runtime_error("'max-block-size' cannot be less than 'initial-block-size' at " + value.GetPath());
+    }
+    return settings;
+}
+
+}  // namespace ugrpc
+
+USERVER_NAMESPACE_END
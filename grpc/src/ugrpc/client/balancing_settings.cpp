@@ -0,0 +1,31 @@
+#include <userver/ugrpc/client/balancing_settings.hpp>
+
+#include <stdexcept>
+
+#include <userver/yaml_config/yaml_config.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::client {
+
+BalancingSettings Parse(const yaml_config::YamlConfig& value, formats::parse::To<BalancingSettings>) {
+    BalancingSettings settings;
+    settings.ewma_decay_time = value["ewma-decay-time"].As<std::chrono::milliseconds>(settings.ewma_decay_time);
+    settings.ejection_consecutive_failures =
+        value["ejection-consecutive-failures"].As<std::size_t>(settings.ejection_consecutive_failures);
+    settings.ejection_time = value["ejection-time"].As<std::chrono::milliseconds>(settings.ejection_time);
+    settings.max_ejection_percent = value["max-ejection-percent"].As<std::size_t>(settings.max_ejection_percent);
+    settings.local_subchannel_pool = value["local-subchannel-pool"].As<bool>(settings.local_subchannel_pool);
+
+    if (settings.ewma_decay_time.count() <= 0) {
+        throw std::runtime_error("'ewma-decay-time' must be positive at " + value.GetPath());
+    }
+    if (settings.max_ejection_percent > 100) {
+        throw std::runtime_error("'max-ejection-percent' cannot exceed 100 at " + value.GetPath());
+    }
+    return settings;
+}
+
+}  // namespace ugrpc::client
+
+USERVER_NAMESPACE_END
@@ -1,7 +1,11 @@
 #include <userver/ugrpc/client/client_factory.hpp>
 
+#include <grpc/grpc.h>
+
 #include <userver/engine/async.hpp>
 #include <userver/utils/algo.hpp>
+#include <userver/utils/impl/internal_tag.hpp>
+#include <userver/utils/statistics/writer.hpp>
 
 #include <ugrpc/impl/logging.hpp>
 
@@ -9,6 +13,19 @@ USERVER_NAMESPACE_BEGIN
 
 namespace ugrpc::client {
 
+namespace {
+
+ClientFactorySettings&& PrepareSettings(ClientFactorySettings&& settings) {
+    if (settings.balancing && settings.balancing->local_subchannel_pool) {
+        // By default, the channels to a backend share their subchannels, and
+        // thus the connections
+        settings.channel_args.SetInt(GRPC_ARG_USE_LOCAL_SUBCHANNEL_POOL, 1);
+    }
+    return std::move(settings);
+}
+
+}  // namespace
+
 ClientFactory::ClientFactory(
     ClientFactorySettings&& settings,
     engine::TaskProcessor& channel_task_processor,
@@ -18,14 +35,15 @@ ClientFactory::ClientFactory(
     testsuite::GrpcControl& testsuite_grpc,
     dynamic_config::Source source
 )
-    : settings_(std::move(settings)),
+    : settings_(PrepareSettings(std::move(settings))),
       channel_task_processor_(channel_task_processor),
       mws_(mws),
       completion_queues_(completion_queues),
       channel_cache_(
           testsuite_grpc.IsTlsEnabled() ? settings_.credentials : grpc::InsecureChannelCredentials(),
           settings_.channel_args,
-          settings_.channel_count
+          settings_.channel_count,
+          settings_.balancing
       ),
       client_statistics_storage_(statistics_storage),
       config_source_(source),
@@ -33,16 +51,30 @@ ClientFactory::ClientFactory(
     ugrpc::impl::SetupNativeLogging();
     ugrpc::impl::UpdateNativeLogLevel(settings_.native_log_level);
 
+    if (settings_.arena) {
+        arena_pool_.emplace(*settings_.arena);
+    }
+
     for (auto& [client_name, creds] : settings_.client_credentials) {
         client_channel_cache_.try_emplace(
             std::string{client_name},
             testsuite_grpc.IsTlsEnabled() ? creds : grpc::InsecureChannelCredentials(),
             settings_.channel_args,
-            settings_.channel_count
+            settings_.channel_count,
+            settings_.balancing
         );
     }
 }
 
+void ClientFactory::WriteStatistics(utils::statistics::Writer& writer) {
+    channel_cache_.WriteStatistics(writer);
+    for (auto& [client_name, channel_cache] : client_channel_cache_) {
+        writer.WithLabels(utils::impl::InternalTag{}, {"grpc_client", client_name}, [&](auto& client_writer) {
+            channel_cache.WriteStatistics(client_writer);
+        });
+    }
+}
+
 impl::ChannelCache::Token ClientFactory::GetChannel(const std::string& client_name, const std::string& endpoint) {
     // Spawn a blocking task creating a gRPC channel
     // This is third party code, no use of span inside it
@@ -74,6 +106,7 @@ impl::ClientDependencies ClientFactory::MakeClientDependencies(ClientSettings&&
         settings.client_qos,
         settings_,
         std::move(settings.dedicated_methods_config),
+        arena_pool_ ? &*arena_pool_ : nullptr,
     };
 }
 
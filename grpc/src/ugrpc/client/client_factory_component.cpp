@@ -3,8 +3,10 @@
 #include <userver/components/component_config.hpp>
 #include <userver/components/component_context.hpp>
 #include <userver/dynamic_config/storage/component.hpp>
+#include <userver/components/statistics_storage.hpp>
 #include <userver/storages/secdist/component.hpp>
 #include <userver/testsuite/testsuite_support.hpp>
+#include <userver/utils/statistics/writer.hpp>
 #include <userver/yaml_config/merge_schemas.hpp>
 
 #include <ugrpc/client/impl/client_factory_config.hpp>
@@ -49,6 +51,7 @@ ClientFactoryComponent::ClientFactoryComponent(
     auto middlewares = FindMiddlewareFactories(config["middlewares"].As<std::vector<std::string>>(), context);
 
     auto factory_config = config.As<impl::ClientFactoryConfig>();
+    const bool balancing_enabled = factory_config.balancing.has_value();
 
     const auto* secdist = GetSecdist(context);
 
@@ -61,8 +64,18 @@ ClientFactoryComponent::ClientFactoryComponent(
         testsuite_grpc,  //
         config_source
     );
+
+    if (balancing_enabled) {
+        channel_statistics_holder_ = context.FindComponent<components::StatisticsStorage>().GetStorage().RegisterWriter(
+            "grpc.client.channels",
+            [this](utils::statistics::Writer& writer) { factory_->WriteStatistics(writer); },
+            {{"grpc_client_factory", config.Name()}}
+        );
+    }
 }
 
+ClientFactoryComponent::~ClientFactoryComponent() { channel_statistics_holder_.Unregister(); }
+
 ClientFactory& ClientFactoryComponent::GetFactory() { return *factory_; }
 
 yaml_config::Schema ClientFactoryComponent::GetStaticConfigSchema() {
@@ -109,6 +122,62 @@ properties:
             description: middleware name
         description: middlewares names
         defaultDescription: '[]'
+    arena:
+        type: object
+        description: per-RPC protobuf arena allocation settings
+        additionalProperties: false
+        properties:
+            enabled:
+                type: boolean
+                description: give each RPC an arena, see ugrpc::client::CallAnyBase::GetArena
+                defaultDescription: true
+            initial-block-size:
+                type: integer
+                description: size of the first arena block, reused between RPCs
+                defaultDescription: 4096
+                minimum: 1
+            max-block-size:
+                type: integer
+                description: max size of the subsequent arena blocks
+                defaultDescription: 65536
+                minimum: 1
+            max-pooled-arenas:
+                type: integer
+                description: max number of idle arenas kept for reuse
+                defaultDescription: 1024
+                minimum: 0
+    balancing:
+        type: object
+        description: load balancing of RPCs between the backends listed in an endpoint
+        additionalProperties: false
+        properties:
+            enabled:
+                type: boolean
+                description: balance RPCs by the backend load instead of randomly
+                defaultDescription: true
+            ewma-decay-time:
+                type: string
+                description: time constant of the backend latency EWMA
+                defaultDescription: 10s
+            ejection-consecutive-failures:
+                type: integer
+                description: eject a backend after this many consecutive failed RPCs, 0 to never eject
+                defaultDescription: 0
+                minimum: 0
+            ejection-time:
+                type: string
+                description: how long an ejected backend gets no RPCs
+                defaultDescription: 30s
+            max-ejection-percent:
+                type: integer
+                description: max percent of the backends of an endpoint that may be ejected at once
+                defaultDescription: 50
+                minimum: 0
+                maximum: 100
+            local-subchannel-pool:
+                type: boolean
+                description: give each channel its own connection, multiplies the connections to each backend by channel-count
+                defaultDescription: false
 )");
 }
 
@@ -3,8 +3,10 @@
 #include <userver/components/component.hpp>
 #include <userver/components/statistics_storage.hpp>
 #include <userver/logging/level_serialization.hpp>
+#include <userver/utils/statistics/storage.hpp>
 #include <userver/yaml_config/merge_schemas.hpp>
 
+#include <ugrpc/impl/completion_queue_polling.hpp>
 #include <ugrpc/impl/logging.hpp>
 #include <userver/ugrpc/client/middlewares/base.hpp>
 #include <userver/ugrpc/server/server_component.hpp>
@@ -20,6 +22,7 @@ constexpr std::size_t kDefaultCompletionQueueCount = 1;
 ugrpc::impl::CompletionQueuePoolBase& FindOrEmplaceCompletionQueues(
     std::optional<impl::CompletionQueuePool>& holder,
     std::size_t queue_count,
+    const CompletionQueuePollingSettings& polling,
     const components::ComponentContext& context
 ) {
     if (auto* const server = context.FindComponentOptional<server::ServerComponent>()) {
@@ -29,9 +32,15 @@ ugrpc::impl::CompletionQueuePoolBase& FindOrEmplaceCompletionQueues(
             "meaningless and should not be specified if the service has a "
             "grpc-server. Use grpc-server.completion-queue-count instead"
         );
+        UINVARIANT(
+            !polling.task_processor,
+            "grpc-client-common.completion-queue-polling option is "
+            "meaningless and should not be specified if the service has a "
+            "grpc-server. Use grpc-server.completion-queue-polling instead"
+        );
         return server->GetServer().GetCompletionQueues(utils::impl::InternalTag{});
     }
-    holder.emplace(queue_count);
+    holder.emplace(queue_count, polling);
     return *holder;
 }
 
@@ -43,6 +52,7 @@ CommonComponent::CommonComponent(const components::ComponentConfig& config, cons
       completion_queues_(FindOrEmplaceCompletionQueues(
           client_completion_queues_,
           config["completion-queue-count"].As<std::size_t>(kDefaultCompletionQueueCount),
+          ugrpc::impl::ParseCompletionQueuePolling(config["completion-queue-polling"], context),
           context
       )),
       client_statistics_storage_(
@@ -51,9 +61,17 @@ CommonComponent::CommonComponent(const components::ComponentConfig& config, cons
       ) {
     ugrpc::impl::SetupNativeLogging();
     ugrpc::impl::UpdateNativeLogLevel(config["native-log-level"].As<logging::Level>(logging::Level::kError));
+
+    if (client_completion_queues_) {
+        // Otherwise the queues are owned and reported by the grpc-server
+        queue_statistics_holder_ = context.FindComponent<components::StatisticsStorage>().GetStorage().RegisterWriter(
+            "grpc.completion-queues",
+            [this](utils::statistics::Writer& writer) { client_completion_queues_->WriteStatistics(writer); }
+        );
+    }
 }
 
-CommonComponent::~CommonComponent() = default;
+CommonComponent::~CommonComponent() { queue_statistics_holder_.Unregister(); }
 
 yaml_config::Schema CommonComponent::GetStaticConfigSchema() {
     return yaml_config::MergeSchemas<components::ComponentBase>(R"(
@@ -78,6 +96,26 @@ properties:
             completion queue count to create. Should be ~2 times less than worker
             threads for best RPS.
         minimum: 1
+    completion-queue-polling:
+        type: object
+        description: |
+            poll the completion queues from the task processor workers instead
+            of the dedicated threads
+        additionalProperties: false
+        properties:
+            task-processor:
+                type: string
+                description: the task processor which workers poll the completion queues
+            pollers-per-queue:
+                type: integer
+                description: count of the poller tasks per completion queue
+                defaultDescription: 1
+                minimum: 1
+            idle-yields:
+                type: integer
+                description: count of the empty polls before an idle poller parks
+                defaultDescription: 100
+                minimum: 0
 )");
 }
 
@@ -33,11 +33,17 @@ client::UnaryCall<grpc::ByteBuffer> GenericClient::UnaryCall(
     std::unique_ptr<grpc::ClientContext> context,
     const GenericOptions& generic_options
 ) const {
-    auto& stub = impl_.NextGenericStub<GenericStubService>();
+    auto picked = impl_.NextGenericStub<GenericStubService>();
+    auto& stub = picked.stub;
     auto grpcpp_call_name = utils::StrCat<grpc::string>("/", call_name);
     return {
         impl::CreateGenericCallParams(
-            impl_, call_name, std::move(context), generic_options.qos, generic_options.metrics_call_name
+            impl_,
+            call_name,
+            std::move(context),
+            generic_options.qos,
+            generic_options.metrics_call_name,
+            std::move(picked.in_flight)
         ),
         [&stub, &grpcpp_call_name](
             grpc::ClientContext* context, const grpc::ByteBuffer& request, grpc::CompletionQueue* cq
@@ -2,6 +2,7 @@
 
 #include <ugrpc/impl/status.hpp>
 #include <userver/ugrpc/client/impl/async_methods.hpp>
+#include <userver/ugrpc/client/impl/channel_balancer.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -27,6 +28,7 @@ FinishAsyncMethodInvocation::~FinishAsyncMethodInvocation() { WaitWhileBusy(); }
 
 void FinishAsyncMethodInvocation::Notify(bool ok) noexcept {
     if (ok) {
+        rpc_data_.GetInFlightRpc().Finish(IsBackendFailure(status_.error_code()));
         try {
             rpc_data_.GetStatsScope().OnExplicitFinish(status_.error_code());
 
@@ -70,6 +70,16 @@ void SetErrorForSpan(RpcData& data, std::string&& message) {
     data.ResetSpan();
 }
 
+InFlightRpc TakeInFlightRpc(InFlightRpc&& in_flight, CallKind call_kind) noexcept {
+    // The lifetime of a stream is not a latency, and long-lived streams would
+    // pin their channel as loaded, so only unary RPCs are accounted
+    if (call_kind != CallKind::kUnaryCall) {
+        [[maybe_unused]] const InFlightRpc released = std::move(in_flight);
+        return {};
+    }
+    return std::move(in_flight);
+}
+
 }  // namespace
 
 RpcConfigValues::RpcConfigValues(const dynamic_config::Snapshot& config)
@@ -96,10 +106,12 @@ RpcData* FutureImpl::GetData() noexcept { return data_; }
 void FutureImpl::ClearData() noexcept { data_ = nullptr; }
 
 RpcData::RpcData(impl::CallParams&& params, CallKind call_kind)
-    : context_(std::move(params.context)),
+    : arena_(params.arena_pool ? params.arena_pool->Acquire() : ugrpc::impl::PooledArena{}),
+      context_(std::move(params.context)),
       client_name_(params.client_name),
       call_name_(std::move(params.call_name)),
       stats_scope_(params.statistics),
+      in_flight_(TakeInFlightRpc(std::move(params.in_flight), call_kind)),
       queue_(params.queue),
       config_values_(params.config),
       mws_(params.mws),
@@ -129,6 +141,10 @@ grpc::ClientContext& RpcData::GetContext() noexcept {
     return *context_;
 }
 
+google::protobuf::Arena* RpcData::GetArena() const noexcept { return arena_.Get(); }
+
+InFlightRpc& RpcData::GetInFlightRpc() noexcept { return in_flight_; }
+
 grpc::CompletionQueue& RpcData::GetQueue() const noexcept {
     UASSERT(context_);
     return queue_;
@@ -256,6 +272,7 @@ RpcData::AsyncMethodInvocationGuard::~AsyncMethodInvocationGuard() noexcept {
 void CheckOk(RpcData& data, AsyncMethodInvocation::WaitStatus status, std::string_view stage) {
     if (status == impl::AsyncMethodInvocation::WaitStatus::kError) {
         data.SetFinished();
+        data.GetInFlightRpc().Finish(/*backend_failed=*/true);
         data.GetStatsScope().OnNetworkError();
         data.GetStatsScope().Flush();
         SetErrorForSpan(data, fmt::format("Network error at '{}'", stage));
@@ -79,7 +79,8 @@ CallParams CreateCallParams(
     const ClientData& client_data,
     std::size_t method_id,
     std::unique_ptr<grpc::ClientContext> client_context,
-    const Qos& qos
+    const Qos& qos,
+    InFlightRpc&& in_flight
 ) {
     const auto& metadata = client_data.GetMetadata();
     const auto call_name = metadata.method_full_names[method_id];
@@ -98,6 +99,8 @@ CallParams CreateCallParams(
         std::move(client_context),
         client_data.GetStatistics(method_id),
         client_data.GetMiddlewares(),
+        client_data.GetArenaPool(),
+        std::move(in_flight),
     };
 }
 
@@ -106,7 +109,8 @@ CallParams CreateGenericCallParams(
     std::string_view call_name,
     std::unique_ptr<grpc::ClientContext> client_context,
     const Qos& qos,
-    std::optional<std::string_view> metrics_call_name
+    std::optional<std::string_view> metrics_call_name,
+    InFlightRpc&& in_flight
 ) {
     CheckValidCallName(call_name);
     if (metrics_call_name) {
@@ -127,6 +131,8 @@ CallParams CreateGenericCallParams(
         std::move(client_context),
         client_data.GetGenericStatistics(metrics_call_name.value_or(call_name)),
         client_data.GetMiddlewares(),
+        client_data.GetArenaPool(),
+        std::move(in_flight),
     };
 }
 
@@ -0,0 +1,219 @@
+#include <userver/ugrpc/client/impl/channel_balancer.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include <userver/utils/assert.hpp>
+#include <userver/utils/rand.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::client::impl {
+
+namespace {
+
+// The cost of a backend that has RPCs in flight, but no latency yet
+constexpr std::int64_t kUnprobedPenalty = std::chrono::nanoseconds{std::chrono::seconds{1}}.count();
+
+std::int64_t ToNanoseconds(std::chrono::steady_clock::duration duration) noexcept {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+}
+
+std::int64_t Now() noexcept { return ToNanoseconds(std::chrono::steady_clock::now().time_since_epoch()); }
+
+bool IsEjected(const BackendLoad& load, std::int64_t now) noexcept {
+    return load.ejected_until.load(std::memory_order_relaxed) > now;
+}
+
+}  // namespace
+
+void DumpMetric(utils::statistics::Writer& writer, const BackendLoad& load) {
+    writer["in-flight"] = load.in_flight.load(std::memory_order_relaxed);
+    writer["latency-ewma-us"] = load.latency_ewma.load(std::memory_order_relaxed) / 1000;
+    writer["ejected"] = IsEjected(load, Now()) ? 1 : 0;
+    writer["failures"] = load.failures;
+    writer["ejections"] = load.ejections;
+}
+
+bool IsBackendFailure(grpc::StatusCode code) noexcept {
+    switch (code) {
+        case grpc::StatusCode::UNAVAILABLE:
+        case grpc::StatusCode::INTERNAL:
+        case grpc::StatusCode::UNKNOWN:
+            return true;
+        default:
+            return false;
+    }
+}
+
+std::vector<std::string> SplitBackendAddresses(std::string_view endpoint) {
+    for (const std::string_view scheme : {"ipv4:", "ipv6:"}) {
+        if (endpoint.substr(0, scheme.size()) != scheme) continue;
+
+        std::vector<std::string> backends;
+        auto addresses = endpoint.substr(scheme.size());
+        while (!addresses.empty()) {
+            const auto address = addresses.substr(0, addresses.find(','));
+            addresses.remove_prefix(std::min(address.size() + 1, addresses.size()));
+            if (!address.empty()) backends.push_back(fmt::format("{}{}", scheme, address));
+        }
+        if (!backends.empty()) return backends;
+    }
+    return {std::string{endpoint}};
+}
+
+std::vector<std::string> MakeBackends(std::string_view endpoint, const std::optional<BalancingSettings>& balancing) {
+    if (!balancing) return {std::string{endpoint}};
+    return SplitBackendAddresses(endpoint);
+}
+
+InFlightRpc::InFlightRpc(ChannelBalancer& balancer, BackendLoad& load) noexcept
+    : balancer_(&balancer), load_(&load), start_(std::chrono::steady_clock::now()) {
+    load.in_flight.fetch_add(1, std::memory_order_relaxed);
+}
+
+InFlightRpc::InFlightRpc(InFlightRpc&& other) noexcept
+    : balancer_(std::exchange(other.balancer_, nullptr)),
+      load_(std::exchange(other.load_, nullptr)),
+      start_(other.start_) {}
+
+InFlightRpc& InFlightRpc::operator=(InFlightRpc&& other) noexcept {
+    std::swap(balancer_, other.balancer_);
+    std::swap(load_, other.load_);
+    std::swap(start_, other.start_);
+    return *this;
+}
+
+InFlightRpc::~InFlightRpc() {
+    // An abandoned or cancelled RPC says nothing about the backend
+    if (load_) load_->in_flight.fetch_sub(1, std::memory_order_relaxed);
+}
+
+void InFlightRpc::Finish(bool backend_failed) noexcept {
+    if (!balancer_) return;
+    UASSERT(load_);
+    const auto latency = ToNanoseconds(std::chrono::steady_clock::now() - start_);
+    std::exchange(balancer_, nullptr)->OnFinished(*std::exchange(load_, nullptr), latency, backend_failed);
+}
+
+ChannelBalancer::ChannelBalancer(
+    std::vector<std::string> backends,
+    std::size_t channels_per_backend,
+    const std::optional<BalancingSettings>& settings
+)
+    : settings_(settings),
+      backends_(std::move(backends)),
+      channels_per_backend_(channels_per_backend),
+      loads_(backends_.size()) {
+    UASSERT(!backends_.empty());
+    UASSERT(!settings_ || settings_->ewma_decay_time.count() > 0);
+}
+
+PickedChannel ChannelBalancer::Pick() {
+    const auto channel_count = backends_.size() * channels_per_backend_;
+    UASSERT(channel_count != 0);
+    if (!settings_) {
+        return {channel_count == 1 ? 0 : utils::RandRange(channel_count), InFlightRpc{}};
+    }
+
+    const auto backend = PickBackend();
+    const auto channel = channels_per_backend_ == 1 ? 0 : utils::RandRange(channels_per_backend_);
+    return {backend * channels_per_backend_ + channel, InFlightRpc{*this, loads_[backend]}};
+}
+
+void ChannelBalancer::WriteStatistics(utils::statistics::Writer& writer, std::string_view endpoint) const {
+    for (std::size_t i = 0; i < loads_.size(); ++i) {
+        writer.ValueWithLabels(loads_[i], {{"grpc_endpoint", endpoint}, {"grpc_backend", backends_[i]}});
+    }
+}
+
+std::size_t ChannelBalancer::PickBackend() {
+    const auto backend_count = loads_.size();
+    if (backend_count == 1) return 0;
+
+    const auto now = Now();
+    const auto first = utils::RandRange(backend_count);
+    auto second = utils::RandRange(backend_count - 1);
+    if (second >= first) ++second;
+
+    const bool first_ejected = IsEjected(loads_[first], now);
+    const bool second_ejected = IsEjected(loads_[second], now);
+    if (first_ejected && second_ejected) {
+        for (std::size_t i = 0; i < backend_count; ++i) {
+            const auto candidate = (first + i) % backend_count;
+            if (!IsEjected(loads_[candidate], now)) return candidate;
+        }
+        return first;
+    }
+    if (first_ejected) return second;
+    if (second_ejected) return first;
+    return GetCost(loads_[second], now) < GetCost(loads_[first], now) ? second : first;
+}
+
+std::int64_t ChannelBalancer::GetCost(const BackendLoad& load, std::int64_t now) const noexcept {
+    const auto in_flight = static_cast<std::int64_t>(load.in_flight.load(std::memory_order_relaxed));
+    const auto latency_ewma = load.latency_ewma.load(std::memory_order_relaxed);
+    if (latency_ewma == 0) {
+        return in_flight * kUnprobedPenalty;
+    }
+    if (in_flight != 0) {
+        return latency_ewma * (in_flight + 1);
+    }
+
+    // Let the latency of an idle backend decay, so that it is probed again
+    const auto idle_time = now - load.latency_ewma_update_time.load(std::memory_order_relaxed);
+    const auto decay_time = static_cast<double>(ToNanoseconds(settings_->ewma_decay_time));
+    return static_cast<std::int64_t>(latency_ewma * std::exp(-static_cast<double>(idle_time) / decay_time));
+}
+
+void ChannelBalancer::OnFinished(BackendLoad& load, std::int64_t latency, bool backend_failed) noexcept {
+    UASSERT(settings_);
+    const auto now = Now();
+
+    // Concurrent updates may lose a sample, which is fine for an estimate
+    const auto last_update_time = load.latency_ewma_update_time.exchange(now, std::memory_order_relaxed);
+    const auto old_ewma = load.latency_ewma.load(std::memory_order_relaxed);
+    auto new_ewma = latency;
+    if (old_ewma != 0 && latency < old_ewma) {
+        const auto decay_time = static_cast<double>(ToNanoseconds(settings_->ewma_decay_time));
+        const auto weight = std::exp(-static_cast<double>(now - last_update_time) / decay_time);
+        new_ewma = static_cast<std::int64_t>(old_ewma * weight + latency * (1 - weight));
+    }
+    // Zero means "no latency yet"
+    load.latency_ewma.store(std::max<std::int64_t>(new_ewma, 1), std::memory_order_relaxed);
+
+    if (backend_failed) {
+        ++load.failures;
+        const auto failures = load.consecutive_failures.fetch_add(1, std::memory_order_relaxed) + 1;
+        if (settings_->ejection_consecutive_failures != 0 && failures >= settings_->ejection_consecutive_failures) {
+            TryEject(load, now);
+        }
+    } else {
+        load.consecutive_failures.store(0, std::memory_order_relaxed);
+    }
+
+    load.in_flight.fetch_sub(1, std::memory_order_relaxed);
+}
+
+void ChannelBalancer::TryEject(BackendLoad& load, std::int64_t now) noexcept {
+    if (IsEjected(load, now)) return;
+
+    std::size_t ejected_count = 0;
+    for (const auto& other : loads_) {
+        if (IsEjected(other, now)) ++ejected_count;
+    }
+    if ((ejected_count + 1) * 100 > settings_->max_ejection_percent * loads_.size()) return;
+
+    load.ejected_until.store(now + ToNanoseconds(settings_->ejection_time), std::memory_order_relaxed);
+    load.consecutive_failures.store(0, std::memory_order_relaxed);
+    ++load.ejections;
+}
+
+}  // namespace ugrpc::client::impl
+
+USERVER_NAMESPACE_END
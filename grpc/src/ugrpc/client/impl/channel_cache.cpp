@@ -3,10 +3,13 @@
 #include <algorithm>
 #include <utility>
 
+#include <fmt/format.h>
 #include <grpcpp/create_channel.h>
 #include <grpcpp/security/credentials.h>
 
+#include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/statistics/writer.hpp>
 
 #include <userver/ugrpc/impl/to_string.hpp>
 
@@ -53,25 +56,57 @@ std::size_t ChannelCache::Token::GetChannelCount() const noexcept {
     return counted_channel_->channels.size();
 }
 
+ChannelBalancer& ChannelCache::Token::GetBalancer() const noexcept {
+    UASSERT(counted_channel_);
+    return counted_channel_->balancer;
+}
+
 ChannelCache::CountedChannel::CountedChannel(
     const std::string& endpoint,
     const std::shared_ptr<grpc::ChannelCredentials>& credentials,
     const grpc::ChannelArguments& channel_args,
-    std::size_t count
-) {
-    const auto endpoint_string = ugrpc::impl::ToGrpcString(endpoint);
-    channels = utils::GenerateFixedArray(count, [&](std::size_t) {
-        return grpc::CreateCustomChannel(endpoint_string, credentials, channel_args);
-    });
+    std::size_t count,
+    const std::optional<BalancingSettings>& balancing
+)
+    : CountedChannel(MakeBackends(endpoint, balancing), credentials, channel_args, count, balancing) {
+    if (balancing && balancer.GetBackendCount() == 1) {
+        LOG_WARNING() << fmt::format(
+            "gRPC balancing has a single backend for endpoint '{}', list the backends as "
+            "'ipv4:addr1:port1,addr2:port2' to balance between them",
+            endpoint
+        );
+    }
+}
+
+ChannelCache::CountedChannel::CountedChannel(
+    std::vector<std::string>&& backends,
+    const std::shared_ptr<grpc::ChannelCredentials>& credentials,
+    const grpc::ChannelArguments& channel_args,
+    std::size_t count,
+    const std::optional<BalancingSettings>& balancing
+)
+    : channels(utils::GenerateFixedArray(
+          backends.size() * count,
+          [&](std::size_t index) {
+              return grpc::CreateCustomChannel(
+                  ugrpc::impl::ToGrpcString(backends[index / count]), credentials, channel_args
+              );
+          }
+      )),
+      balancer(std::move(backends), count, balancing) {
     UASSERT(count > 0);
 }
 
 ChannelCache::ChannelCache(
     std::shared_ptr<grpc::ChannelCredentials>&& credentials,
     const grpc::ChannelArguments& channel_args,
-    std::size_t channel_count
+    std::size_t channel_count,
+    const std::optional<BalancingSettings>& balancing
 )
-    : credentials_(std::move(credentials)), channel_args_(channel_args), channel_count_(channel_count) {
+    : credentials_(std::move(credentials)),
+      channel_args_(channel_args),
+      channel_count_(channel_count),
+      balancing_(balancing) {
     UINVARIANT(channel_count > 0, "Channels count must be greater than zero");
 }
 
@@ -79,10 +114,18 @@ ChannelCache::~ChannelCache() = default;
 
 ChannelCache::Token ChannelCache::Get(const std::string& endpoint) {
     auto channels = channels_.Lock();
-    const auto [it, _] = channels->try_emplace(endpoint, endpoint, credentials_, channel_args_, channel_count_);
+    const auto [it, _] =
+        channels->try_emplace(endpoint, endpoint, credentials_, channel_args_, channel_count_, balancing_);
     return {*this, it->first, it->second};
 }
 
+void ChannelCache::WriteStatistics(utils::statistics::Writer& writer) {
+    const auto channels = channels_.Lock();
+    for (const auto& [endpoint, counted_channel] : *channels) {
+        counted_channel.balancer.WriteStatistics(writer, endpoint);
+    }
+}
+
 }  // namespace ugrpc::client::impl
 
 USERVER_NAMESPACE_END
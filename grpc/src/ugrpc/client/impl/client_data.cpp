@@ -10,7 +10,6 @@
 #include <userver/ugrpc/impl/statistics_storage.hpp>
 #include <userver/utils/algo.hpp>
 #include <userver/utils/assert.hpp>
-#include <userver/utils/rand.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -52,8 +51,16 @@ const ugrpc::impl::StaticServiceMetadata& ClientData::GetMetadata() const {
 
 const dynamic_config::Key<ClientQos>* ClientData::GetClientQos() const { return dependencies_.qos; }
 
-const ClientData::StubPtr& ClientData::NextStubPtr(const utils::FixedArray<StubPtr>& stubs) const {
-    return stubs[utils::RandRange(stubs.size())];
+utils::FixedArray<ChannelBalancer> ClientData::MakeDedicatedBalancers(
+    const ClientDependencies& dependencies,
+    const utils::FixedArray<StubPool>& dedicated_stubs
+) {
+    const auto backends = MakeBackends(dependencies.endpoint, dependencies.settings.balancing);
+    return utils::GenerateFixedArray(dedicated_stubs.size(), [&](std::size_t method_id) {
+        return ChannelBalancer(
+            backends, dedicated_stubs[method_id].size() / backends.size(), dependencies.settings.balancing
+        );
+    });
 }
 
 ugrpc::impl::ServiceStatistics& ClientData::GetServiceStatistics() {
@@ -59,6 +59,16 @@ ClientFactoryConfig Parse(const yaml_config::YamlConfig& value, formats::parse::
     config.channel_args = MakeChannelArgs(value["channel-args"], value["default-service-config"]);
     config.channel_count = value["channel-count"].As<std::size_t>(config.channel_count);
 
+    const auto arena = value["arena"];
+    if (!arena.IsMissing() && arena["enabled"].As<bool>(true)) {
+        config.arena = arena.As<ArenaSettings>();
+    }
+
+    const auto balancing = value["balancing"];
+    if (!balancing.IsMissing() && balancing["enabled"].As<bool>(true)) {
+        config.balancing = balancing.As<BalancingSettings>();
+    }
+
     return config;
 }
 
@@ -83,6 +93,8 @@ MakeFactorySettings(ClientFactoryConfig&& config, const storages::secdist::Secdi
         config.channel_args,
         logging::Level::kError,
         config.channel_count,
+        config.arena,
+        config.balancing,
     };
 }
 
@@ -24,6 +24,12 @@ struct ClientFactoryConfig final {
     /// Number of underlying channels that will be created for every client
     /// in this factory.
     std::size_t channel_count{1};
+
+    /// Per-RPC protobuf arena settings, disabled if not set
+    std::optional<ArenaSettings> arena{};
+
+    /// Load balancing between the backends, random channel if not set
+    std::optional<BalancingSettings> balancing{};
 };
 
 ClientFactoryConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<ClientFactoryConfig>);
@@ -6,10 +6,14 @@ USERVER_NAMESPACE_BEGIN
 
 namespace ugrpc::client::impl {
 
-CompletionQueuePool::CompletionQueuePool(std::size_t queue_count)
-    : CompletionQueuePoolBase(utils::GenerateFixedArray(queue_count, [](std::size_t) {
-          return std::make_unique<grpc::CompletionQueue>();
-      })) {}
+CompletionQueuePool::CompletionQueuePool(
+    std::size_t queue_count,
+    const CompletionQueuePollingSettings& polling
+)
+    : CompletionQueuePoolBase(
+          utils::GenerateFixedArray(queue_count, [](std::size_t) { return std::make_unique<grpc::CompletionQueue>(); }),
+          polling
+      ) {}
 
 }  // namespace ugrpc::client::impl
 
@@ -0,0 +1,78 @@
+#include <userver/ugrpc/impl/arena_pool.hpp>
+
+#include <utility>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::impl {
+
+namespace {
+
+google::protobuf::ArenaOptions MakeArenaOptions(const ArenaSettings& settings, char* initial_block) {
+    google::protobuf::ArenaOptions options;
+    options.start_block_size = settings.initial_block_size;
+    options.max_block_size = settings.max_block_size;
+    options.initial_block = initial_block;
+    options.initial_block_size = settings.initial_block_size;
+    return options;
+}
+
+}  // namespace
+
+ArenaPoolNode::ArenaPoolNode(const ArenaSettings& settings)
+    : initial_block(std::make_unique<char[]>(settings.initial_block_size)),
+      arena(MakeArenaOptions(settings, initial_block.get())) {}
+
+PooledArena::PooledArena(ArenaPool& pool, ArenaPoolNode& node) noexcept : pool_(&pool), node_(&node) {}
+
+PooledArena::PooledArena(PooledArena&& other) noexcept
+    : pool_(std::exchange(other.pool_, nullptr)), node_(std::exchange(other.node_, nullptr)) {}
+
+PooledArena& PooledArena::operator=(PooledArena&& other) noexcept {
+    if (this == &other) return *this;
+    [[maybe_unused]] auto for_destruction = std::move(*this);
+    pool_ = std::exchange(other.pool_, nullptr);
+    node_ = std::exchange(other.node_, nullptr);
+    return *this;
+}
+
+PooledArena::~PooledArena() {
+    if (node_) pool_->Release(*node_);
+}
+
+google::protobuf::Arena* PooledArena::Get() const noexcept { return node_ ? &node_->arena : nullptr; }
+
+ArenaPool::ArenaPool(const ArenaSettings& settings) : settings_(settings) {
+    UINVARIANT(settings_.initial_block_size > 0, "Arena initial block size must be positive");
+}
+
+ArenaPool::~ArenaPool() {
+    free_list_.DisposeUnsafe([](ArenaPoolNode& node) { delete &node; });
+}
+
+PooledArena ArenaPool::Acquire() {
+    if (auto* const node = free_list_.TryPop()) {
+        --pooled_count_;
+        return PooledArena{*this, *node};
+    }
+    return PooledArena{*this, *new ArenaPoolNode(settings_)};
+}
+
+void ArenaPool::Release(ArenaPoolNode& node) noexcept {
+    // Frees all the blocks except for the initial one
+    node.arena.Reset();
+
+    // The limit is approximate under contention, which is fine
+    if (pooled_count_.load(std::memory_order_relaxed) >= settings_.max_pooled_arenas) {
+        delete &node;
+        return;
+    }
+    ++pooled_count_;
+    free_list_.Push(node);
+}
+
+}  // namespace ugrpc::impl
+
+USERVER_NAMESPACE_END
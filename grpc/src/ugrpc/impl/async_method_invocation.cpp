@@ -2,6 +2,8 @@
 
 #include <userver/engine/task/cancel.hpp>
 
+#include <userver/ugrpc/impl/completion_queue_statistics.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace ugrpc::impl {
@@ -12,6 +14,8 @@ AsyncMethodInvocation::~AsyncMethodInvocation() { WaitWhileBusy(); }
 
 void AsyncMethodInvocation::Notify(bool ok) noexcept {
     ok_ = ok;
+    queue_statistics_ = GetCurrentQueueStatistics();
+    if (queue_statistics_) notify_time_ = std::chrono::steady_clock::now();
     event_.Send();
 }
 
@@ -31,6 +35,8 @@ AsyncMethodInvocation::WaitStatus AsyncMethodInvocation::WaitUntil(engine::Deadl
         return WaitStatus::kCancelled;
     }
 
+    // Only the wakeups of a sleeping coroutine are accounted as hops
+    const bool was_ready = event_.IsReady();
     const engine::FutureStatus future_status = event_.WaitUntil(deadline);
     switch (future_status) {
         case engine::FutureStatus::kCancelled: {
@@ -40,6 +46,7 @@ AsyncMethodInvocation::WaitStatus AsyncMethodInvocation::WaitUntil(engine::Deadl
             return WaitStatus::kDeadline;
         }
         case engine::FutureStatus::kReady: {
+            if (!was_ready) AccountHop();
             busy_ = false;
             return ok_ ? WaitStatus::kOk : WaitStatus::kError;
         }
@@ -55,6 +62,14 @@ engine::impl::ContextAccessor* AsyncMethodInvocation::TryGetContextAccessor() no
 
 bool AsyncMethodInvocation::IsReady() const noexcept { return event_.IsReady(); }
 
+void AsyncMethodInvocation::AccountHop() noexcept {
+    if (!queue_statistics_) return;
+    const auto hop = std::chrono::steady_clock::now() - notify_time_;
+    queue_statistics_->hop_timings.GetCurrentCounter().Account(
+        std::chrono::duration_cast<std::chrono::microseconds>(hop).count()
+    );
+}
+
 void AsyncMethodInvocation::WaitWhileBusy() {
     if (busy_) {
         engine::TaskCancellationBlocker blocker;
@@ -0,0 +1,25 @@
+#include <ugrpc/impl/completion_queue_polling.hpp>
+
+#include <string>
+
+#include <userver/components/component_context.hpp>
+#include <userver/yaml_config/yaml_config.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::impl {
+
+CompletionQueuePollingSettings
+ParseCompletionQueuePolling(const yaml_config::YamlConfig& value, const components::ComponentContext& context) {
+    CompletionQueuePollingSettings settings;
+    if (value.IsMissing()) return settings;
+
+    settings.task_processor = &context.GetTaskProcessor(value["task-processor"].As<std::string>());
+    settings.pollers_per_queue = value["pollers-per-queue"].As<std::size_t>(settings.pollers_per_queue);
+    settings.idle_yields = value["idle-yields"].As<std::size_t>(settings.idle_yields);
+    return settings;
+}
+
+}  // namespace ugrpc::impl
+
+USERVER_NAMESPACE_END
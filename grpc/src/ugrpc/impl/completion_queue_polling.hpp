@@ -0,0 +1,18 @@
+#pragma once
+
+#include <userver/components/component_fwd.hpp>
+#include <userver/yaml_config/fwd.hpp>
+
+#include <userver/ugrpc/completion_queue_polling.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::impl {
+
+// Parses the optional 'completion-queue-polling' section of the static config
+CompletionQueuePollingSettings
+ParseCompletionQueuePolling(const yaml_config::YamlConfig& value, const components::ComponentContext& context);
+
+}  // namespace ugrpc::impl
+
+USERVER_NAMESPACE_END
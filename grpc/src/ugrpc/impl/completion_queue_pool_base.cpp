@@ -1,9 +1,13 @@
 #include <userver/ugrpc/impl/completion_queue_pool_base.hpp>
 
+#include <string>
 #include <type_traits>
 
+#include <userver/engine/task/task_base.hpp>
 #include <userver/ugrpc/impl/queue_runner.hpp>
+#include <userver/utils/assert.hpp>
 #include <userver/utils/rand.hpp>
+#include <userver/utils/statistics/writer.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -11,15 +15,47 @@ namespace ugrpc::impl {
 
 static_assert(std::has_virtual_destructor_v<grpc::CompletionQueue>);
 
-CompletionQueuePoolBase::CompletionQueuePoolBase(utils::FixedArray<std::unique_ptr<grpc::CompletionQueue>> queues)
-    : queues_(std::move(queues)), queue_runners_(utils::GenerateFixedArray(queues_.size(), [&](std::size_t idx) {
-          return QueueRunner{*queues_[idx]};
-      })) {}
+namespace {
+
+utils::FixedArray<QueueRunner> MakeQueueRunners(
+    utils::FixedArray<std::unique_ptr<grpc::CompletionQueue>>& queues,
+    utils::FixedArray<CompletionQueueStatistics>& queue_statistics,
+    const CompletionQueuePollingSettings& polling
+) {
+    if (polling.task_processor) {
+        // Otherwise the pollers may occupy all the workers, starving the tasks
+        // they wake up
+        UINVARIANT(
+            queues.size() * polling.pollers_per_queue < engine::impl::GetWorkerCount(*polling.task_processor),
+            "The completion queue polling task processor must have more workers than the completion queue pollers"
+        );
+    }
+
+    return utils::GenerateFixedArray(queues.size(), [&](std::size_t idx) {
+        return QueueRunner{*queues[idx], queue_statistics[idx], polling};
+    });
+}
+
+}  // namespace
+
+CompletionQueuePoolBase::CompletionQueuePoolBase(
+    utils::FixedArray<std::unique_ptr<grpc::CompletionQueue>> queues,
+    const CompletionQueuePollingSettings& polling
+)
+    : queues_(std::move(queues)),
+      queue_statistics_(queues_.size()),
+      queue_runners_(MakeQueueRunners(queues_, queue_statistics_, polling)) {}
 
 CompletionQueuePoolBase::~CompletionQueuePoolBase() = default;
 
 grpc::CompletionQueue& CompletionQueuePoolBase::NextQueue() { return *queues_[utils::RandRange(queues_.size())]; }
 
+void CompletionQueuePoolBase::WriteStatistics(utils::statistics::Writer& writer) const {
+    for (std::size_t idx = 0; idx < queue_statistics_.size(); ++idx) {
+        writer.ValueWithLabels(queue_statistics_[idx], {"grpc_queue", std::to_string(idx)});
+    }
+}
+
 }  // namespace ugrpc::impl
 
 USERVER_NAMESPACE_END
@@ -0,0 +1,40 @@
+#include <userver/ugrpc/impl/completion_queue_statistics.hpp>
+
+#include <utility>
+
+#include <userver/compiler/thread_local.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::impl {
+
+namespace {
+
+compiler::ThreadLocal current_queue_statistics = []() -> CompletionQueueStatistics* { return nullptr; };
+
+CompletionQueueStatistics* ExchangeCurrentQueueStatistics(CompletionQueueStatistics* stats) noexcept {
+    auto current = current_queue_statistics.Use();
+    return std::exchange(*current, stats);
+}
+
+}  // namespace
+
+void DumpMetric(utils::statistics::Writer& writer, const CompletionQueueStatistics& stats) {
+    writer["events"] = stats.events;
+    writer["hop-timings-us"] = stats.hop_timings.GetStatsForPeriod();
+}
+
+CompletionQueueStatistics* GetCurrentQueueStatistics() noexcept {
+    auto current = current_queue_statistics.Use();
+    return *current;
+}
+
+CurrentQueueStatisticsScope::CurrentQueueStatisticsScope(CompletionQueueStatistics& stats) noexcept
+    : old_stats_(ExchangeCurrentQueueStatistics(&stats)) {}
+
+CurrentQueueStatisticsScope::~CurrentQueueStatisticsScope() { ExchangeCurrentQueueStatistics(old_stats_); }
+
+}  // namespace ugrpc::impl
+
+USERVER_NAMESPACE_END
@@ -2,6 +2,11 @@
 
 #include <thread>
 
+#include <grpc/support/time.h>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/cancel.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/thread_name.hpp>
 
@@ -13,16 +18,31 @@ namespace ugrpc::impl {
 
 namespace {
 
-void ProcessQueue(grpc::CompletionQueue& queue, engine::SingleUseEvent& completion) noexcept {
+// The woken up tasks are queued behind the poller, so the poller gives them
+// a chance to run after a batch of events
+constexpr std::size_t kMaxEventsPerPoll = 32;
+
+void NotifyEvent(void* tag, bool ok, CompletionQueueStatistics& statistics) noexcept {
+    auto* call = static_cast<EventBase*>(tag);
+    UASSERT(call != nullptr);
+    ++statistics.events;
+
+    const CurrentQueueStatisticsScope statistics_scope{statistics};
+    call->Notify(ok);
+}
+
+void ProcessQueue(
+    grpc::CompletionQueue& queue,
+    CompletionQueueStatistics& statistics,
+    engine::SingleUseEvent& completion
+) noexcept {
     utils::SetCurrentThreadName("grpc-queue");
 
     void* tag = nullptr;
     bool ok = false;
 
     while (queue.Next(&tag, &ok)) {
-        auto* call = static_cast<EventBase*>(tag);
-        UASSERT(call != nullptr);
-        call->Notify(ok);
+        NotifyEvent(tag, ok, statistics);
     }
 
     completion.Send();
@@ -30,15 +50,118 @@ void ProcessQueue(grpc::CompletionQueue& queue, engine::SingleUseEvent& completi
 
 }  // namespace
 
-QueueRunner::QueueRunner(grpc::CompletionQueue& queue) : queue_(queue) {
-    std::thread([this] { ProcessQueue(queue_, completion_); }).detach();
+QueueRunner::QueueRunner(
+    grpc::CompletionQueue& queue,
+    CompletionQueueStatistics& statistics,
+    const CompletionQueuePollingSettings& polling
+)
+    : queue_(queue) {
+    if (polling.task_processor) {
+        UINVARIANT(polling.pollers_per_queue != 0, "There must be at least one poller per completion queue");
+        poller_wakeups_ = utils::FixedArray<engine::SingleConsumerEvent>(polling.pollers_per_queue);
+        pollers_ = utils::GenerateFixedArray(polling.pollers_per_queue, [&](std::size_t poller) {
+            return engine::CriticalAsyncNoSpan(*polling.task_processor, [this, poller, &statistics, polling] {
+                Poll(poller, statistics, polling.idle_yields);
+            });
+        });
+        std::thread([this, &statistics] { WaitWhileParked(statistics); }).detach();
+        return;
+    }
+
+    std::thread([this, &statistics] { ProcessQueue(queue_, statistics, completion_); }).detach();
 }
 
 QueueRunner::~QueueRunner() {
     queue_.Shutdown();
+
+    if (!pollers_.empty()) {
+        const engine::TaskCancellationBlocker cancellation_blocker;
+        for (auto& poller : pollers_) {
+            poller.Wait();
+        }
+    }
     completion_.WaitNonCancellable();
 }
 
+void QueueRunner::Poll(std::size_t poller, CompletionQueueStatistics& statistics, std::size_t idle_yields) {
+    // The poller must drain the queue until the shutdown
+    const engine::TaskCancellationBlocker cancellation_blocker;
+
+    std::size_t idle_polls = 0;
+    while (true) {
+        std::size_t events = 0;
+        while (events < kMaxEventsPerPoll) {
+            void* tag = nullptr;
+            bool ok = false;
+            // Never blocks the worker in the queue
+            const auto status = queue_.AsyncNext(&tag, &ok, gpr_time_0(GPR_CLOCK_MONOTONIC));
+            if (status == grpc::CompletionQueue::SHUTDOWN) {
+                OnPollerExit();
+                return;
+            }
+            if (status == grpc::CompletionQueue::TIMEOUT) break;
+
+            NotifyEvent(tag, ok, statistics);
+            ++events;
+        }
+
+        if (events != 0) {
+            idle_polls = 0;
+        } else if (++idle_polls > idle_yields) {
+            idle_polls = 0;
+            Park(poller);
+            continue;
+        }
+        engine::Yield();
+    }
+}
+
+void QueueRunner::Park(std::size_t poller) {
+    {
+        const std::lock_guard lock{parked_mutex_};
+        ++parked_pollers_;
+        if (parked_pollers_ + exited_pollers_ == poller_wakeups_.size()) all_parked_.notify_one();
+    }
+    [[maybe_unused]] const bool woken_up = poller_wakeups_[poller].WaitForEvent();
+    UASSERT_MSG(woken_up, "The cancellation of a poller is blocked");
+}
+
+void QueueRunner::OnPollerExit() {
+    const std::lock_guard lock{parked_mutex_};
+    ++exited_pollers_;
+    if (parked_pollers_ + exited_pollers_ == poller_wakeups_.size()) all_parked_.notify_one();
+}
+
+void QueueRunner::WaitWhileParked(CompletionQueueStatistics& statistics) noexcept {
+    utils::SetCurrentThreadName("grpc-queue");
+
+    const auto poller_count = poller_wakeups_.size();
+    while (true) {
+        {
+            std::unique_lock lock{parked_mutex_};
+            all_parked_.wait(lock, [&] { return parked_pollers_ + exited_pollers_ == poller_count; });
+            if (exited_pollers_ == poller_count) break;
+        }
+
+        // Every poller is parked, so the queue is waited for here instead of
+        // in an engine worker
+        void* tag = nullptr;
+        bool ok = false;
+        const bool has_event = queue_.Next(&tag, &ok);
+        if (has_event) NotifyEvent(tag, ok, statistics);
+
+        {
+            const std::lock_guard lock{parked_mutex_};
+            parked_pollers_ = 0;
+        }
+        // On shutdown the pollers are woken up to see it themselves
+        for (auto& wakeup : poller_wakeups_) wakeup.Send();
+        if (!has_event) break;
+    }
+
+    completion_.Send();
+}
+
 }  // namespace ugrpc::impl
 
 USERVER_NAMESPACE_END
@@ -18,6 +18,8 @@ std::string_view CallContext::GetMethodName() const { return GetCall().GetMethod
 
 utils::AnyStorage<StorageContext>& CallContext::GetStorageContext() { return GetCall().GetStorageContext(); }
 
+google::protobuf::Arena* CallContext::GetArena() const { return GetCall().GetArena(); }
+
 const CallAnyBase& CallContext::GetCall() const { return call_; }
 
 CallAnyBase& CallContext::GetCall() { return call_; }
@@ -9,6 +9,7 @@
 #include <userver/storages/secdist/component.hpp>
 #include <userver/utils/algo.hpp>
 
+#include <ugrpc/impl/completion_queue_polling.hpp>
 #include <userver/ugrpc/server/middlewares/base.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -19,6 +20,7 @@ namespace {
 
 constexpr std::string_view kTaskProcessorKey = "task-processor";
 constexpr std::string_view kMiddlewaresKey = "middlewares";
+constexpr std::string_view kArenaKey = "arena";
 
 template <typename ParserFunc>
 auto ParseOptional(
@@ -57,6 +59,12 @@ ParseMiddlewares(const yaml_config::YamlConfig& field, const components::Compone
     return field.As<std::vector<std::string>>();
 }
 
+std::optional<ArenaSettings>
+ParseArena(const yaml_config::YamlConfig& field, const components::ComponentContext& /*context*/) {
+    if (field.IsMissing() || !field["enabled"].As<bool>(true)) return std::nullopt;
+    return field.As<ArenaSettings>();
+}
+
 Middlewares FindMiddlewares(const std::vector<std::string>& names, const components::ComponentContext& context) {
     return utils::AsContainer<Middlewares>(
         names | boost::adaptors::transformed([&](const std::string& name) {
@@ -73,6 +81,7 @@ ParseServiceDefaults(const yaml_config::YamlConfig& value, const components::Com
         /*task_processor=*/ParseOptional(value[kTaskProcessorKey], context, ParseTaskProcessor),
         /*middleware_names=*/
         ParseOptional(value[kMiddlewaresKey], context, ParseMiddlewares),
+        /*arena=*/ParseOptional(value[kArenaKey], context, ParseArena),
     };
 }
 
@@ -87,6 +96,7 @@ server::ServiceConfig ParseServiceConfig(
         FindMiddlewares(
             MergeField(value[kMiddlewaresKey], defaults.middleware_names, context, ParseMiddlewares), context
         ),
+        /*arena=*/MergeField(value[kArenaKey], defaults.arena, context, ParseArena),
     };
 }
 
@@ -95,6 +105,8 @@ ServerConfig ParseServerConfig(const yaml_config::YamlConfig& value, const compo
     config.unix_socket_path = value["unix-socket-path"].As<std::optional<std::string>>();
     config.port = value["port"].As<std::optional<int>>();
     config.completion_queue_num = value["completion-queue-count"].As<std::size_t>(2);
+    config.completion_queue_polling =
+        ugrpc::impl::ParseCompletionQueuePolling(value["completion-queue-polling"], context);
     config.channel_args = value["channel-args"].As<decltype(config.channel_args)>({});
     config.native_log_level = value["native-log-level"].As<logging::Level>(logging::Level::kError);
     config.enable_channelz = value["enable-channelz"].As<bool>(false);
@@ -1,11 +1,13 @@
 #pragma once
 
+#include <optional>
 #include <string>
 #include <vector>
 
 #include <boost/optional/optional.hpp>
 
 #include <userver/engine/task/task_processor_fwd.hpp>
+#include <userver/ugrpc/arena_settings.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -15,6 +17,7 @@ struct ServiceDefaults final {
     // using boost::optional to easily generalize to references
     boost::optional<engine::TaskProcessor&> task_processor;
     boost::optional<std::vector<std::string>> middleware_names;
+    boost::optional<std::optional<ArenaSettings>> arena;
 };
 
 }  // namespace ugrpc::server::impl
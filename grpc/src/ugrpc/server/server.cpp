@@ -16,6 +16,7 @@
 #include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/fixed_array.hpp>
+#include <userver/utils/statistics/storage.hpp>
 
 #include <ugrpc/impl/logging.hpp>
 #include <ugrpc/server/impl/generic_service_worker.hpp>
@@ -123,6 +124,7 @@ private:
     ugrpc::impl::StatisticsStorage statistics_storage_;
     const dynamic_config::Source config_source_;
     logging::LoggerPtr access_tskv_logger_;
+    utils::statistics::Entry queue_statistics_holder_;
 };
 
 Server::Impl::Impl(
@@ -145,7 +147,11 @@ Server::Impl::Impl(
     }
     server_builder_.emplace();
     ApplyChannelArgs(*server_builder_, config);
-    completion_queues_.emplace(config.completion_queue_num, *server_builder_);
+    completion_queues_.emplace(config.completion_queue_num, *server_builder_, config.completion_queue_polling);
+    queue_statistics_holder_ =
+        statistics_storage.RegisterWriter("grpc.completion-queues", [this](utils::statistics::Writer& writer) {
+            if (completion_queues_) completion_queues_->WriteStatistics(writer);
+        });
 
     if (config.unix_socket_path) AddListeningUnixSocket(*config.unix_socket_path, config.tls);
 
@@ -196,6 +202,7 @@ impl::ServiceSettings Server::Impl::MakeServiceSettings(ServiceConfig&& config)
         std::move(config.middlewares),
         access_tskv_logger_,
         config_source_,
+        config.arena,
     };
 }
 
@@ -270,6 +277,7 @@ void Server::Impl::Stop() noexcept {
     }
     service_workers_.clear();
     generic_service_workers_.clear();
+    queue_statistics_holder_.Unregister();
     completion_queues_.reset();
     server_.reset();
 
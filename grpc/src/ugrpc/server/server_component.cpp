@@ -56,6 +56,26 @@ properties:
             completion queue count to create. Should be ~2 times less than worker
             threads for best RPS.
         minimum: 1
+    completion-queue-polling:
+        type: object
+        description: |
+            poll the completion queues from the task processor workers instead
+            of the dedicated threads
+        additionalProperties: false
+        properties:
+            task-processor:
+                type: string
+                description: the task processor which workers poll the completion queues
+            pollers-per-queue:
+                type: integer
+                description: count of the poller tasks per completion queue
+                defaultDescription: 1
+                minimum: 1
+            idle-yields:
+                type: integer
+                description: count of the empty polls before an idle poller parks
+                defaultDescription: 100
+                minimum: 0
     channel-args:
         type: object
         description: a map of channel arguments, see gRPC Core docs
@@ -110,6 +130,30 @@ properties:
                 items:
                     type: string
                     description: middleware component name
+            arena:
+                type: object
+                description: per-RPC protobuf arena allocation settings
+                additionalProperties: false
+                properties:
+                    enabled:
+                        type: boolean
+                        description: allocate the request messages in a per-RPC arena
+                        defaultDescription: true
+                    initial-block-size:
+                        type: integer
+                        description: size of the first arena block, reused between RPCs
+                        defaultDescription: 4096
+                        minimum: 1
+                    max-block-size:
+                        type: integer
+                        description: max size of the subsequent arena blocks
+                        defaultDescription: 65536
+                        minimum: 1
+                    max-pooled-arenas:
+                        type: integer
+                        description: max number of idle arenas kept for reuse
+                        defaultDescription: 1024
+                        minimum: 0
 )");
 }
 
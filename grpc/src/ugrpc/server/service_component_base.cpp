@@ -48,6 +48,31 @@ properties:
         items:
             type: string
             description: middleware component name
+    arena:
+        type: object
+        description: per-RPC protobuf arena allocation settings
+        defaultDescription: uses grpc-server.service-defaults.arena
+        additionalProperties: false
+        properties:
+            enabled:
+                type: boolean
+                description: allocate the request messages in a per-RPC arena
+                defaultDescription: true
+            initial-block-size:
+                type: integer
+                description: size of the first arena block, reused between RPCs
+                defaultDescription: 4096
+                minimum: 1
+            max-block-size:
+                type: integer
+                description: max size of the subsequent arena blocks
+                defaultDescription: 65536
+                minimum: 1
+            max-pooled-arenas:
+                type: integer
+                description: max number of idle arenas kept for reuse
+                defaultDescription: 1024
+                minimum: 0
 )");
 }
 
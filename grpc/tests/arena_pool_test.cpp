@@ -0,0 +1,123 @@
+#include <userver/ugrpc/impl/arena_pool.hpp>
+
+#include <memory>
+
+#include <userver/engine/task/task_base.hpp>
+#include <userver/utest/utest.hpp>
+
+#include <userver/ugrpc/tests/service_fixtures.hpp>
+
+#include <tests/messages.pb.h>
+#include <tests/unit_test_client.usrv.pb.hpp>
+#include <tests/unit_test_service.usrv.pb.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+class ArenaEchoService final : public sample::ugrpc::UnitTestServiceBase {
+public:
+    SayHelloResult SayHello(CallContext& context, sample::ugrpc::GreetingRequest&& request) override {
+        request_arena = request.GetArena();
+        context_arena = context.GetArena();
+        sample::ugrpc::GreetingResponse response;
+        response.set_name("Hello " + request.name());
+        return response;
+    }
+
+    google::protobuf::Arena* request_arena{nullptr};
+    google::protobuf::Arena* context_arena{nullptr};
+};
+
+class ArenaServiceTest : public ugrpc::tests::ServiceFixtureBase {
+protected:
+    ArenaServiceTest() {
+        GetServer().AddService(
+            service_, ugrpc::server::ServiceConfig{engine::current_task::GetTaskProcessor(), {}, ugrpc::ArenaSettings{}}
+        );
+        StartServer();
+    }
+
+    ~ArenaServiceTest() override { StopServer(); }
+
+    ArenaEchoService& GetService() { return service_; }
+
+private:
+    ArenaEchoService service_;
+};
+
+using NoArenaServiceTest = ugrpc::tests::ServiceFixture<ArenaEchoService>;
+
+sample::ugrpc::GreetingResponse SayHello(sample::ugrpc::UnitTestServiceClient& client) {
+    sample::ugrpc::GreetingRequest request;
+    request.set_name("userver");
+    return client.SayHello(request).Finish();
+}
+
+}  // namespace
+
+UTEST_F(ArenaServiceTest, UnaryRequestInArena) {
+    auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+    EXPECT_EQ(SayHello(client).name(), "Hello userver");
+
+    EXPECT_NE(GetService().context_arena, nullptr);
+    EXPECT_EQ(GetService().request_arena, GetService().context_arena);
+}
+
+UTEST_F(NoArenaServiceTest, UnaryRequestOnHeap) {
+    auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+    EXPECT_EQ(SayHello(client).name(), "Hello userver");
+
+    EXPECT_EQ(GetService().context_arena, nullptr);
+    EXPECT_EQ(GetService().request_arena, nullptr);
+}
+
+TEST(ArenaPool, MessagesUseArena) {
+    ugrpc::impl::ArenaPool pool{ugrpc::ArenaSettings{}};
+    const auto arena = pool.Acquire();
+    ASSERT_NE(arena.Get(), nullptr);
+
+    auto* const message = ugrpc::impl::CreateArenaMessage<sample::ugrpc::GreetingRequest>(arena.Get());
+    message->set_name("userver");
+    EXPECT_EQ(message->GetArena(), arena.Get());
+}
+
+TEST(ArenaPool, ReusesArenas) {
+    ugrpc::impl::ArenaPool pool{ugrpc::ArenaSettings{}};
+
+    google::protobuf::Arena* first_arena = nullptr;
+    {
+        const auto arena = pool.Acquire();
+        first_arena = arena.Get();
+        ugrpc::impl::CreateArenaMessage<sample::ugrpc::GreetingRequest>(arena.Get())->set_name("userver");
+    }
+
+    const auto arena = pool.Acquire();
+    EXPECT_EQ(arena.Get(), first_arena);
+    // The arena is reset on release, only the reused initial block remains
+    EXPECT_LE(arena.Get()->SpaceUsed(), ugrpc::ArenaSettings{}.initial_block_size);
+
+    const auto other_arena = pool.Acquire();
+    EXPECT_NE(other_arena.Get(), first_arena);
+}
+
+TEST(ArenaPool, MaxPooledArenas) {
+    ugrpc::ArenaSettings settings;
+    settings.max_pooled_arenas = 0;
+    ugrpc::impl::ArenaPool pool{settings};
+
+    { [[maybe_unused]] const auto arena = pool.Acquire(); }
+    const auto arena = pool.Acquire();
+    EXPECT_NE(arena.Get(), nullptr);
+}
+
+TEST(ArenaPool, Empty) {
+    ugrpc::impl::PooledArena arena;
+    EXPECT_EQ(arena.Get(), nullptr);
+
+    const std::unique_ptr<sample::ugrpc::GreetingRequest> message{
+        ugrpc::impl::CreateArenaMessage<sample::ugrpc::GreetingRequest>(arena.Get())};
+    EXPECT_EQ(message->GetArena(), nullptr);
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,104 @@
+#include <userver/ugrpc/client/impl/channel_balancer.hpp>
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+const std::vector<std::string> kBackends{"ipv4:127.0.0.1:8080", "ipv4:127.0.0.2:8080"};
+
+ugrpc::client::BalancingSettings MakeEjectingSettings() {
+    ugrpc::client::BalancingSettings settings;
+    settings.ejection_consecutive_failures = 1;
+    settings.max_ejection_percent = 50;
+    return settings;
+}
+
+std::size_t GetBackend(std::size_t channel_index, std::size_t channels_per_backend) {
+    return channel_index / channels_per_backend;
+}
+
+}  // namespace
+
+TEST(ChannelBalancer, SplitBackendAddresses) {
+    using ugrpc::client::impl::SplitBackendAddresses;
+    EXPECT_EQ(
+        SplitBackendAddresses("ipv4:127.0.0.1:8080,127.0.0.2:8080"),
+        (std::vector<std::string>{"ipv4:127.0.0.1:8080", "ipv4:127.0.0.2:8080"})
+    );
+    EXPECT_EQ(
+        SplitBackendAddresses("ipv6:[::1]:8080,[::2]:8080"),
+        (std::vector<std::string>{"ipv6:[::1]:8080", "ipv6:[::2]:8080"})
+    );
+    EXPECT_EQ(SplitBackendAddresses("ipv4:127.0.0.1:8080"), (std::vector<std::string>{"ipv4:127.0.0.1:8080"}));
+    EXPECT_EQ(SplitBackendAddresses("localhost:8080"), (std::vector<std::string>{"localhost:8080"}));
+}
+
+TEST(ChannelBalancer, DeadlineIsNotBackendFailure) {
+    EXPECT_TRUE(ugrpc::client::impl::IsBackendFailure(grpc::StatusCode::UNAVAILABLE));
+    EXPECT_FALSE(ugrpc::client::impl::IsBackendFailure(grpc::StatusCode::DEADLINE_EXCEEDED));
+    EXPECT_FALSE(ugrpc::client::impl::IsBackendFailure(grpc::StatusCode::NOT_FOUND));
+}
+
+TEST(ChannelBalancer, RandomWithoutSettings) {
+    ugrpc::client::impl::ChannelBalancer balancer{kBackends, 2, std::nullopt};
+    for (int i = 0; i < 100; ++i) {
+        auto picked = balancer.Pick();
+        EXPECT_LT(picked.index, std::size_t{4});
+        picked.rpc.Finish(/*backend_failed=*/true);
+    }
+}
+
+TEST(ChannelBalancer, PrefersIdleBackend) {
+    constexpr std::size_t kChannelsPerBackend = 3;
+    ugrpc::client::impl::ChannelBalancer balancer{kBackends, kChannelsPerBackend, ugrpc::client::BalancingSettings{}};
+
+    auto busy = balancer.Pick();
+    const auto busy_backend = GetBackend(busy.index, kChannelsPerBackend);
+    for (int i = 0; i < 100; ++i) {
+        auto picked = balancer.Pick();
+        // Any channel of the busy backend is avoided, not just the busy channel
+        EXPECT_NE(GetBackend(picked.index, kChannelsPerBackend), busy_backend);
+        picked.rpc.Finish(/*backend_failed=*/false);
+    }
+}
+
+TEST(ChannelBalancer, EjectsFailingBackend) {
+    constexpr std::size_t kChannelsPerBackend = 2;
+    ugrpc::client::impl::ChannelBalancer balancer{kBackends, kChannelsPerBackend, MakeEjectingSettings()};
+
+    auto failing = balancer.Pick();
+    const auto failing_backend = GetBackend(failing.index, kChannelsPerBackend);
+    failing.rpc.Finish(/*backend_failed=*/true);
+
+    std::vector<ugrpc::client::impl::PickedChannel> in_flight;
+    for (int i = 0; i < 100; ++i) {
+        in_flight.push_back(balancer.Pick());
+        EXPECT_NE(GetBackend(in_flight.back().index, kChannelsPerBackend), failing_backend);
+    }
+}
+
+TEST(ChannelBalancer, RespectsMaxEjectionPercent) {
+    ugrpc::client::impl::ChannelBalancer balancer{kBackends, 1, MakeEjectingSettings()};
+
+    auto first = balancer.Pick();
+    const auto first_index = first.index;
+    first.rpc.Finish(/*backend_failed=*/true);
+
+    auto second = balancer.Pick();
+    ASSERT_NE(second.index, first_index);
+    second.rpc.Finish(/*backend_failed=*/true);
+
+    // Ejecting the second backend would exceed 50%, so it still gets RPCs
+    for (int i = 0; i < 100; ++i) {
+        auto picked = balancer.Pick();
+        EXPECT_EQ(picked.index, second.index);
+        picked.rpc.Finish(/*backend_failed=*/false);
+    }
+}
+
+USERVER_NAMESPACE_END
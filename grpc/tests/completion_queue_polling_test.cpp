@@ -0,0 +1,83 @@
+#include <userver/utest/utest.hpp>
+
+#include <chrono>
+#include <vector>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/utils/statistics/testing.hpp>
+
+#include <userver/ugrpc/tests/service.hpp>
+
+#include <tests/unit_test_client.usrv.pb.hpp>
+#include <tests/unit_test_service.usrv.pb.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+class UnitTestServiceEcho final : public sample::ugrpc::UnitTestServiceBase {
+public:
+    void SayHello(SayHelloCall& call, sample::ugrpc::GreetingRequest&& request) override {
+        sample::ugrpc::GreetingResponse response;
+        response.set_name("Hello " + request.name());
+        call.Finish(response);
+    }
+};
+
+ugrpc::server::ServerConfig MakePollingServerConfig() {
+    ugrpc::server::ServerConfig config;
+    // 2 pollers on 4 workers: the workers must outnumber the pollers
+    config.completion_queue_num = 2;
+    config.completion_queue_polling.task_processor = &engine::current_task::GetTaskProcessor();
+    config.completion_queue_polling.pollers_per_queue = 1;
+    return config;
+}
+
+}  // namespace
+
+UTEST_MT(CompletionQueuePolling, Unary, 4) {
+    constexpr std::size_t kTaskCount = 8;
+    constexpr std::size_t kCallsPerTask = 50;
+
+    ugrpc::tests::Service<UnitTestServiceEcho> service{MakePollingServerConfig()};
+    auto client = service.MakeClient<sample::ugrpc::UnitTestServiceClient>();
+
+    std::vector<engine::TaskWithResult<void>> tasks;
+    for (std::size_t i = 0; i < kTaskCount; ++i) {
+        tasks.push_back(engine::AsyncNoSpan([&client] {
+            for (std::size_t call = 0; call < kCallsPerTask; ++call) {
+                sample::ugrpc::GreetingRequest request;
+                request.set_name("userver");
+                EXPECT_EQ(client.SayHello(request).Finish().name(), "Hello userver");
+            }
+        }));
+    }
+    for (auto& task : tasks) task.Get();
+
+    const utils::statistics::Snapshot stats{service.GetStatisticsStorage(), "grpc.completion-queues"};
+    utils::statistics::Rate events{};
+    for (const auto* queue : {"0", "1"}) {
+        events += stats.SingleMetric("events", {{"grpc_queue", queue}}).AsRate();
+    }
+    EXPECT_GE(events.value, kTaskCount * kCallsPerTask);
+}
+
+UTEST_MT(CompletionQueuePolling, IdlePollersWakeUp, 4) {
+    auto config = MakePollingServerConfig();
+    config.completion_queue_polling.idle_yields = 0;
+
+    ugrpc::tests::Service<UnitTestServiceEcho> service{std::move(config)};
+    auto client = service.MakeClient<sample::ugrpc::UnitTestServiceClient>();
+
+    sample::ugrpc::GreetingRequest request;
+    request.set_name("userver");
+    for (int i = 0; i < 3; ++i) {
+        // Let the pollers park, the next event must wake them up
+        engine::SleepFor(std::chrono::milliseconds{50});
+        EXPECT_EQ(client.SayHello(request).Finish().name(), "Hello userver");
+    }
+}
+
+USERVER_NAMESPACE_END
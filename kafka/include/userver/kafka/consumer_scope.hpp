@@ -44,7 +44,8 @@ class Consumer;
 /// connection errors.
 ///
 /// @note Each ConsumerScope instance is not thread-safe. To speed up the topic
-/// messages processing, create more consumers with the same `group_id`.
+/// messages processing, create more consumers with the same `group_id` or
+/// enable `process_partitions_in_parallel` in the consumer static config.
 ///
 /// @see https://docs.confluent.io/platform/current/clients/consumer.html for
 /// basic consumer concepts
@@ -70,6 +71,12 @@ public:
     /// @warning If callback throws, it called over and over again with the batch
     /// with the same messages, until successful invocation.
     /// Though, user should consider idempotent message processing mechanism.
+    /// @note With `process_partitions_in_parallel` enabled each batch contains
+    /// messages of a single topic partition, the callback is invoked
+    /// concurrently for different partitions, and the offsets of the
+    /// successfully processed batches are committed automatically, so
+    /// AsyncCommit does nothing. If a callback throws, the batches of the
+    /// failed partitions come again.
     using Callback = std::function<void(MessageBatchView)>;
 
     /// @brief Stops the consumer (if not yet stopped).
@@ -112,6 +119,11 @@ public:
     /// Commit, indeed, restricts other consumers in consumers group from reading
     /// messages already processed (committed) by the current consumer if current
     /// has stopped and leaved the group
+    ///
+    /// @note Does nothing with `process_partitions_in_parallel` enabled, as
+    /// the offsets of each partition are committed automatically after its
+    /// batch is processed, and committing the whole assignment from one
+    /// callback would commit the partitions other callbacks are processing.
     void AsyncCommit();
 
 private:
@@ -43,6 +43,14 @@ struct ConsumerExecutionParams final {
     /// @brief Time consumer suspends execution after user-callback exception.
     /// @note After consumer restart, all uncommitted messages come again.
     std::chrono::milliseconds restart_after_failure_delay{10000};
+
+    /// @brief Split each polled batch into per-partition batches and invoke
+    /// the callback for them concurrently.
+    /// Messages of a partition are still processed in order. Offsets of each
+    /// partition are committed as soon as its batch is processed, so a
+    /// failure of one partition does not make others' messages come again.
+    /// ConsumerScope::AsyncCommit does nothing in this mode.
+    bool process_partitions_in_parallel{false};
 };
 
 class Consumer final {
@@ -102,6 +110,14 @@ private:
     /// @brief Subscribes for configured topics and starts polling loop.
     void RunConsuming(ConsumerScope::Callback callback);
 
+    /// @brief Invokes `callback` on the whole polled batch.
+    void ProcessBatch(const ConsumerScope::Callback& callback, MessageBatchView polled_messages);
+
+    /// @brief Invokes `callback` concurrently on per-partition parts of the
+    /// polled batch and commits each partition as soon as its part is
+    /// processed.
+    void ProcessPartitionsInParallel(const ConsumerScope::Callback& callback, std::vector<Message>&& polled_messages);
+
 private:
     std::atomic<bool> processing_{false};
     Stats stats_;
@@ -1,6 +1,11 @@
 #pragma once
 
 #include <cstdint>
+#include <exception>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
 
 #include <userver/engine/task/task_processor_fwd.hpp>
 #include <userver/engine/task/task_with_result.hpp>
@@ -22,6 +27,19 @@ struct Secret;
 
 }  // namespace impl
 
+/// @brief Message to send with Producer::SendMany.
+struct ProducerMessage final {
+    std::string key;
+    std::string payload;
+    /// If not set, partition is chosen by internal Kafka partitioner.
+    std::optional<std::uint32_t> partition{};
+};
+
+/// @brief Delivery results of Producer::SendMany in the order of messages.
+/// Each result is nullptr if the message is delivered, or the exception that
+/// Producer::Send would throw for the message.
+using SendManyResult = std::vector<std::exception_ptr>;
+
 /// @ingroup userver_clients
 ///
 /// @brief Apache Kafka Producer Client.
@@ -114,6 +132,34 @@ public:
         std::optional<std::uint32_t> partition = std::nullopt
     ) const;
 
+    /// @brief Sends all the `messages` to topic `topic_name` and
+    /// asynchronously waits until all of them are delivered or failed.
+    ///
+    /// The messages are enqueued with a single `librdkafka` call, and there is
+    /// a single wait for all the delivery reports. That is much cheaper than a
+    /// Producer::Send or Producer::SendAsync call per message, and lets
+    /// `librdkafka` pack the messages into as few requests as the
+    /// `queue_buffering_max` (`linger.ms`) option allows.
+    ///
+    /// No payload data is copied. Method holds the data until messages are
+    /// delivered.
+    ///
+    /// Thread-safe and can be called from any number of threads
+    /// concurrently.
+    ///
+    /// @returns per-message delivery results. Does not throw on a delivery
+    /// error of some messages, see SendManyResult.
+    ///
+    /// @warning As with Producer::SendAsync, the order messages are written
+    /// to partition may differ from the order of `messages`, if some of them
+    /// are retried by the library.
+    SendManyResult SendMany(const std::string& topic_name, const std::vector<ProducerMessage>& messages) const;
+
+    /// @brief Same as Producer::SendMany, but returns the task which can be
+    /// used to wait the messages delivery manually.
+    [[nodiscard]] engine::TaskWithResult<SendManyResult>
+    SendManyAsync(std::string topic_name, std::vector<ProducerMessage> messages) const;
+
     /// @brief Dumps per topic messages produce statistics. No expected to be
     /// called manually.
     /// @see kafka/impl/stats.hpp
@@ -127,6 +173,8 @@ private:
         std::optional<std::uint32_t> partition
     ) const;
 
+    SendManyResult SendManyImpl(const std::string& topic_name, const std::vector<ProducerMessage>& messages) const;
+
 private:
     const std::string name_;
     engine::TaskProcessor& producer_task_processor_;
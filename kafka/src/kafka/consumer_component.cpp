@@ -36,6 +36,8 @@ ConsumerComponent::ConsumerComponent(
               params.restart_after_failure_delay =
                   config["restart_after_failure_delay"].As<std::chrono::milliseconds>(params.restart_after_failure_delay
                   );
+              params.process_partitions_in_parallel =
+                  config["process_partitions_in_parallel"].As<bool>(params.process_partitions_in_parallel);
 
               return params;
           }()
@@ -94,6 +96,13 @@ properties:
         type: string
         description: backoff consumer waits until restart after user-callback exception.
         defaultDescription: 10s
+    process_partitions_in_parallel:
+        type: boolean
+        description: |
+            split each polled batch into per-partition batches, process them
+            concurrently and commit the offsets of each partition as soon as
+            its batch is processed
+        defaultDescription: false
     auto_offset_reset:
         type: string
         description: |
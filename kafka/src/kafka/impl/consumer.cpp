@@ -1,10 +1,14 @@
 #include <userver/kafka/impl/consumer.hpp>
 
+#include <algorithm>
+#include <exception>
 #include <string_view>
+#include <vector>
 
 #include <fmt/format.h>
 
 #include <userver/engine/sleep.hpp>
+#include <userver/engine/wait_any.hpp>
 #include <userver/formats/json/value_builder.hpp>
 #include <userver/kafka/impl/configuration.hpp>
 #include <userver/kafka/impl/stats.hpp>
@@ -47,6 +51,47 @@ std::function<void()> CreateDurationNotifier(std::chrono::milliseconds max_callb
     };
 }
 
+struct PartitionsSplit final {
+    std::vector<Message> messages;
+    /// Views of `messages`, one per partition
+    std::vector<MessageBatchView> batches;
+};
+
+/// Groups the messages by partitions, keeping the order of messages within
+/// each partition.
+PartitionsSplit SplitByPartitions(std::vector<Message>&& polled_messages) {
+    struct Partition final {
+        const std::string* topic;
+        int partition;
+        std::vector<std::size_t> indices;
+    };
+
+    std::vector<Partition> partitions;
+    for (std::size_t i = 0; i < polled_messages.size(); ++i) {
+        const auto& message = polled_messages[i];
+        auto it = std::find_if(partitions.begin(), partitions.end(), [&message](const Partition& partition) {
+            return partition.partition == message.GetPartition() && *partition.topic == message.GetTopic();
+        });
+        if (it == partitions.end()) {
+            it = partitions.insert(partitions.end(), Partition{&message.GetTopic(), message.GetPartition(), {}});
+        }
+        it->indices.push_back(i);
+    }
+
+    PartitionsSplit split;
+    split.messages.reserve(polled_messages.size());
+    split.batches.reserve(partitions.size());
+    for (const auto& partition : partitions) {
+        const auto begin = split.messages.size();
+        for (const auto index : partition.indices) {
+            split.messages.push_back(std::move(polled_messages[index]));
+        }
+        /// No reallocations because of the reserve, the views stay valid
+        split.batches.emplace_back(split.messages.data() + begin, partition.indices.size());
+    }
+    return split;
+}
+
 }  // namespace
 
 Consumer::Consumer(
@@ -109,21 +154,70 @@ void Consumer::RunConsuming(ConsumerScope::Callback callback) {
 
         TESTPOINT(fmt::format("tp_{}_polled", name_), {});
 
-        auto batch_processing_task =
-            utils::Async(main_task_processor_, "messages_processing", callback, utils::span{polled_messages});
         const utils::ScopeGuard callback_duration_notifier{
             CreateDurationNotifier(execution_params.max_callback_duration)};
 
+        if (execution_params.process_partitions_in_parallel) {
+            ProcessPartitionsInParallel(callback, std::move(polled_messages));
+        } else {
+            ProcessBatch(callback, polled_messages);
+        }
+        TESTPOINT(fmt::format("tp_{}", name_), {});
+    }
+}
+
+void Consumer::ProcessBatch(const ConsumerScope::Callback& callback, MessageBatchView polled_messages) {
+    auto batch_processing_task = utils::Async(main_task_processor_, "messages_processing", callback, polled_messages);
+
+    try {
+        batch_processing_task.Get();
+
+        consumer_->AccountMessageBatchProcessingSucceeded(polled_messages);
+    } catch (const std::exception& e) {
+        consumer_->AccountMessageBatchProcessingFailed(polled_messages);
+        throw;
+    }
+}
+
+void Consumer::ProcessPartitionsInParallel(
+    const ConsumerScope::Callback& callback,
+    std::vector<Message>&& polled_messages
+) {
+    const auto split = SplitByPartitions(std::move(polled_messages));
+
+    std::vector<engine::TaskWithResult<void>> processing_tasks;
+    processing_tasks.reserve(split.batches.size());
+    for (const auto batch : split.batches) {
+        processing_tasks.push_back(utils::Async(main_task_processor_, "partition_messages_processing", callback, batch)
+        );
+    }
+
+    /// Partitions are committed in the order of completion, so that a slow or
+    /// failed partition does not hold back the others. The first error is
+    /// rethrown after all the partitions are done, to restart the consumer
+    /// and get the failed partitions messages again.
+    std::exception_ptr first_error;
+    for (std::size_t remaining = processing_tasks.size(); remaining > 0; --remaining) {
+        const auto completed = engine::WaitAny(processing_tasks);
+        UINVARIANT(completed.has_value(), "Partition processing task must complete, as cancellation is blocked");
+
+        const auto batch = split.batches[*completed];
         try {
-            batch_processing_task.Get();
+            processing_tasks[*completed].Get();
 
-            consumer_->AccountMessageBatchProcessingSucceeded(polled_messages);
-            TESTPOINT(fmt::format("tp_{}", name_), {});
+            consumer_->AccountMessageBatchProcessingSucceeded(batch);
+            consumer_->AsyncCommit(batch);
         } catch (const std::exception& e) {
-            consumer_->AccountMessageBatchProcessingFailed(polled_messages);
-            throw;
+            consumer_->AccountMessageBatchProcessingFailed(batch);
+            if (!first_error) {
+                first_error = std::current_exception();
+            }
         }
     }
+
+    if (first_error) {
+        std::rethrow_exception(first_error);
+    }
 }
 
 void Consumer::StartMessageProcessing(ConsumerScope::Callback callback) {
@@ -157,6 +251,13 @@ void Consumer::StartMessageProcessing(ConsumerScope::Callback callback) {
 void Consumer::AsyncCommit() {
     UINVARIANT(processing_.load(), "Message processing is not currently started");
 
+    if (execution_params.process_partitions_in_parallel) {
+        /// Committing the current assignment would also commit the partitions
+        /// whose batches are still processed by other callbacks. Each partition
+        /// is committed after its own batch is processed instead.
+        return;
+    }
+
     utils::Async(consumer_task_processor_, "consumer_committing", [this] {
         ExtendCurrentSpan();
 
@@ -1,5 +1,6 @@
 #include <kafka/impl/consumer_impl.hpp>
 
+#include <algorithm>
 #include <chrono>
 
 #include <fmt/format.h>
@@ -292,6 +293,25 @@ void ConsumerImpl::Commit() { rd_kafka_commit(consumer_.GetHandle(), nullptr, /*
 
 void ConsumerImpl::AsyncCommit() { rd_kafka_commit(consumer_.GetHandle(), nullptr, /*async=*/1); }
 
+void ConsumerImpl::AsyncCommit(MessageBatchView processed) {
+    if (processed.empty()) {
+        return;
+    }
+
+    TopicPartitionsListHolder offsets{rd_kafka_topic_partition_list_new(1)};
+    for (const auto& message : processed) {
+        const auto& topic = message.GetTopic();
+        auto* partition = rd_kafka_topic_partition_list_find(offsets.GetHandle(), topic.c_str(), message.GetPartition());
+        if (!partition) {
+            partition = rd_kafka_topic_partition_list_add(offsets.GetHandle(), topic.c_str(), message.GetPartition());
+        }
+        /// Committed offset is the offset of the next message to consume
+        partition->offset = std::max(partition->offset, message.GetOffset() + 1);
+    }
+
+    rd_kafka_commit(consumer_.GetHandle(), offsets.GetHandle(), /*async=*/1);
+}
+
 EventHolder ConsumerImpl::PollEvent() {
     return EventHolder{rd_kafka_queue_poll(consumer_.GetQueue(), /*timeout_ms=*/0)};
 }
@@ -435,7 +455,7 @@ void ConsumerImpl::AccountMessageProcessingSucceeded(const Message& message) {
     ++GetTopicStats(message.GetTopic())->messages_counts.messages_success;
 }
 
-void ConsumerImpl::AccountMessageBatchProcessingSucceeded(const MessageBatch& batch) {
+void ConsumerImpl::AccountMessageBatchProcessingSucceeded(MessageBatchView batch) {
     for (const auto& message : batch) {
         AccountMessageProcessingSucceeded(message);
     }
@@ -444,7 +464,7 @@ void ConsumerImpl::AccountMessageProcessingFailed(const Message& message) {
     ++GetTopicStats(message.GetTopic())->messages_counts.messages_error;
 }
 
-void ConsumerImpl::AccountMessageBatchProcessingFailed(const MessageBatch& batch) {
+void ConsumerImpl::AccountMessageBatchProcessingFailed(MessageBatchView batch) {
     for (const auto& message : batch) {
         AccountMessageProcessingFailed(message);
     }
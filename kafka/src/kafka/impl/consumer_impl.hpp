@@ -37,14 +37,18 @@ public:
     /// @brief Schedules the commitment task.
     void AsyncCommit();
 
+    /// @brief Schedules the commitment of the offsets that follow the
+    /// `processed` messages in their partitions.
+    void AsyncCommit(MessageBatchView processed);
+
     /// @brief Effectively calls `PollMessage` until `deadline` is reached
     /// and no more than `max_batch_size` messages polled.
     MessageBatch PollBatch(std::size_t max_batch_size, engine::Deadline deadline);
 
     void AccountMessageProcessingSucceeded(const Message& message);
-    void AccountMessageBatchProcessingSucceeded(const MessageBatch& batch);
+    void AccountMessageBatchProcessingSucceeded(MessageBatchView batch);
     void AccountMessageProcessingFailed(const Message& message);
-    void AccountMessageBatchProcessingFailed(const MessageBatch& batch);
+    void AccountMessageBatchProcessingFailed(MessageBatchView batch);
 
     void EventCallback();
 
@@ -1,5 +1,7 @@
 #include <kafka/impl/delivery_waiter.hpp>
 
+#include <userver/utils/assert.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace kafka::impl {
@@ -20,6 +22,44 @@ void DeliveryWaiter::SetDeliveryResult(DeliveryResult delivery_result) {
     wait_handle_.set_value(std::move(delivery_result));
 }
 
+void DeliveryWaiter::OnDeliveryReport(DeliveryResult delivery_result) {
+    SetDeliveryResult(std::move(delivery_result));
+    delete this;
+}
+
+BatchDeliveryWaiter::BatchDeliveryWaiter(std::size_t size)
+    : slots_(size, Slot{*this}), results_(size), remaining_(size) {
+    UASSERT(size > 0);
+}
+
+engine::Future<std::vector<DeliveryResult>> BatchDeliveryWaiter::GetFuture() { return wait_handle_.get_future(); }
+
+DeliveryReceiver& BatchDeliveryWaiter::GetReceiver(std::size_t index) { return slots_[index]; }
+
+void BatchDeliveryWaiter::Slot::OnDeliveryReport(DeliveryResult delivery_result) {
+    batch_->SetDeliveryResult(*this, std::move(delivery_result));
+}
+
+void BatchDeliveryWaiter::SetDeliveryResult(const Slot& slot, DeliveryResult delivery_result) {
+    const auto index = static_cast<std::size_t>(&slot - slots_.data());
+    UASSERT(index < results_.size() && !results_[index].has_value());
+    results_[index].emplace(std::move(delivery_result));
+
+    /// Delivery reports of a batch may be handled by different tasks
+    /// concurrently, the last one publishes the results
+    if (remaining_.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+        return;
+    }
+
+    std::vector<DeliveryResult> results;
+    results.reserve(results_.size());
+    for (auto& result : results_) {
+        results.push_back(std::move(*result));
+    }
+    wait_handle_.set_value(std::move(results));
+    delete this;
+}
+
 }  // namespace kafka::impl
 
 USERVER_NAMESPACE_END
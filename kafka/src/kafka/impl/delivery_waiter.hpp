@@ -1,5 +1,10 @@
 #pragma once
 
+#include <atomic>
+#include <cstddef>
+#include <optional>
+#include <vector>
+
 #include <librdkafka/rdkafka.h>
 
 #include <userver/engine/future.hpp>
@@ -26,9 +31,20 @@ private:
     std::optional<rd_kafka_msg_status_t> message_status_;
 };
 
+/// @brief Receiver of a message delivery report. Its pointer is passed to
+/// `librdkafka` as the message opaque.
+class DeliveryReceiver {
+public:
+    /// @brief Called exactly once for each message, may destroy the receiver.
+    virtual void OnDeliveryReport(DeliveryResult delivery_result) = 0;
+
+protected:
+    ~DeliveryReceiver() = default;
+};
+
 /// @brief State for waiting delivery callback invoked after producer send
 /// called
-class DeliveryWaiter final {
+class DeliveryWaiter final : public DeliveryReceiver {
 public:
     DeliveryWaiter() = default;
 
@@ -36,10 +52,51 @@ public:
 
     void SetDeliveryResult(DeliveryResult delivery_result);
 
+    /// @brief Sets the result and destroys the waiter.
+    void OnDeliveryReport(DeliveryResult delivery_result) override;
+
 private:
     engine::Promise<DeliveryResult> wait_handle_;
 };
 
+/// @brief State for waiting delivery callbacks of all the messages of a batch
+/// with a single future.
+///
+/// Must be allocated with `new`, destroys itself after the last result is set.
+class BatchDeliveryWaiter final {
+public:
+    explicit BatchDeliveryWaiter(std::size_t size);
+
+    BatchDeliveryWaiter(const BatchDeliveryWaiter&) = delete;
+    BatchDeliveryWaiter& operator=(const BatchDeliveryWaiter&) = delete;
+
+    /// @returns the future for the delivery results in the order of messages.
+    engine::Future<std::vector<DeliveryResult>> GetFuture();
+
+    /// @returns the receiver to pass as the opaque of the `index`-th message.
+    DeliveryReceiver& GetReceiver(std::size_t index);
+
+private:
+    class Slot final : public DeliveryReceiver {
+    public:
+        explicit Slot(BatchDeliveryWaiter& batch) noexcept : batch_(&batch) {}
+
+        void OnDeliveryReport(DeliveryResult delivery_result) override;
+
+    private:
+        BatchDeliveryWaiter* batch_;
+    };
+
+    ~BatchDeliveryWaiter() = default;
+
+    void SetDeliveryResult(const Slot& slot, DeliveryResult delivery_result);
+
+    std::vector<Slot> slots_;
+    std::vector<std::optional<DeliveryResult>> results_;
+    std::atomic<std::size_t> remaining_;
+    engine::Promise<std::vector<DeliveryResult>> wait_handle_;
+};
+
 }  // namespace kafka::impl
 
 USERVER_NAMESPACE_END
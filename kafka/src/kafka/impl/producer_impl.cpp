@@ -51,7 +51,7 @@ void ProducerImpl::LogCallback(const char* facility, const char* message, int lo
         << logging::LogExtra{{{"kafka_callback", "log_callback"}, {"facility", facility}}} << message;
 }
 
-void ProducerImpl::DeliveryReportCallback(const rd_kafka_message_t* message) const {
+void ProducerImpl::DeliveryReportCallback(const rd_kafka_message_t* message, TopicStats& topic_stats) const {
     static constexpr utils::TrivialBiMap kMessageStatus{[](auto selector) {
         return selector()
             .Case(RD_KAFKA_MSG_STATUS_NOT_PERSISTED, "MSG_STATUS_NOT_PERSISTED")
@@ -59,15 +59,11 @@ void ProducerImpl::DeliveryReportCallback(const rd_kafka_message_t* message) con
             .Case(RD_KAFKA_MSG_STATUS_PERSISTED, "MSG_STATUS_PERSISTED");
     }};
 
-    tracing::Span span{"delivery_report_callback"};
-    span.AddTag("kafka_callback", "delivery_report_callback");
-
     const char* topic_name = rd_kafka_topic_name(message->rkt);
 
-    auto* complete_handle = static_cast<DeliveryWaiter*>(message->_private);
+    auto* complete_handle = static_cast<DeliveryReceiver*>(message->_private);
 
-    auto& topic_stats = stats_.topics_stats[topic_name];
-    ++topic_stats->messages_counts.messages_total;
+    ++topic_stats.messages_counts.messages_total;
 
     const auto message_status = rd_kafka_message_status(message);
     DeliveryResult delivery_result{message->err, message_status};
@@ -80,10 +76,10 @@ void ProducerImpl::DeliveryReportCallback(const rd_kafka_message_t* message) con
         message_latency_ms.count()
     );
 
-    topic_stats->avg_ms_spent_time.GetCurrentCounter().Account(message_latency_ms.count());
+    topic_stats.avg_ms_spent_time.GetCurrentCounter().Account(message_latency_ms.count());
 
     if (delivery_result.IsSuccess()) {
-        ++topic_stats->messages_counts.messages_success;
+        ++topic_stats.messages_counts.messages_success;
 
         LOG_INFO() << fmt::format(
             "Message to topic '{}' delivered successfully to "
@@ -95,14 +91,13 @@ void ProducerImpl::DeliveryReportCallback(const rd_kafka_message_t* message) con
             message_latency_ms.count()
         );
     } else {
-        ++topic_stats->messages_counts.messages_error;
+        ++topic_stats.messages_counts.messages_error;
 
         LOG_WARNING(
         ) << fmt::format("Failed to delivery message to topic '{}': {}", topic_name, rd_kafka_err2str(message->err));
     }
 
-    complete_handle->SetDeliveryResult(std::move(delivery_result));
-    delete complete_handle;
+    complete_handle->OnDeliveryReport(std::move(delivery_result));
 }
 
 ProducerImpl::ProducerImpl(Configuration&& configuration)
@@ -136,6 +131,20 @@ DeliveryResult ProducerImpl::Send(
     return delivery_result_future.get();
 }
 
+std::vector<DeliveryResult>
+ProducerImpl::SendMany(const std::string& topic_name, const std::vector<ProducerMessage>& messages) const {
+    if (messages.empty()) {
+        return {};
+    }
+
+    LOG_INFO() << fmt::format("{} messages to topic '{}' are requested to send", messages.size(), topic_name);
+    auto delivery_results_future = ScheduleMessagesDelivery(topic_name, messages);
+
+    WaitUntilDeliveryReported(delivery_results_future);
+
+    return delivery_results_future.get();
+}
+
 engine::Future<DeliveryResult> ProducerImpl::ScheduleMessageDelivery(
     const std::string& topic_name,
     std::string_view key,
@@ -181,7 +190,7 @@ engine::Future<DeliveryResult> ProducerImpl::ScheduleMessageDelivery(
         RD_KAFKA_V_VALUE(const_cast<char*>(message.data()), message.size()),
         RD_KAFKA_V_MSGFLAGS(0),
         RD_KAFKA_V_PARTITION(partition.value_or(RD_KAFKA_PARTITION_UA)),
-        RD_KAFKA_V_OPAQUE(waiter.get()),
+        RD_KAFKA_V_OPAQUE(static_cast<DeliveryReceiver*>(waiter.get())),
         RD_KAFKA_V_END
     );
     // NOLINTEND(clang-analyzer-cplusplus.NewDeleteLeaks,cppcoreguidelines-pro-type-const-cast)
@@ -201,6 +210,72 @@ engine::Future<DeliveryResult> ProducerImpl::ScheduleMessageDelivery(
     return wait_handle;
 }
 
+engine::Future<std::vector<DeliveryResult>>
+ProducerImpl::ScheduleMessagesDelivery(const std::string& topic_name, const std::vector<ProducerMessage>& messages)
+    const {
+    UASSERT(!messages.empty());
+
+    /// Freed by the last delivery report of the batch, as a single message
+    /// waiter in ScheduleMessageDelivery
+    auto* waiter = new BatchDeliveryWaiter{messages.size()};
+    auto wait_handle = waiter->GetFuture();
+
+    std::vector<rd_kafka_message_t> rd_messages(messages.size());
+    for (std::size_t i = 0; i < messages.size(); ++i) {
+        const auto& message = messages[i];
+        auto& rd_message = rd_messages[i];
+        // NOLINTBEGIN(cppcoreguidelines-pro-type-const-cast)
+        rd_message.key = const_cast<char*>(message.key.data());
+        rd_message.key_len = message.key.size();
+        rd_message.payload = const_cast<char*>(message.payload.data());
+        rd_message.len = message.payload.size();
+        // NOLINTEND(cppcoreguidelines-pro-type-const-cast)
+        rd_message.partition = message.partition.has_value() ? static_cast<std::int32_t>(*message.partition)
+                                                             : RD_KAFKA_PARTITION_UA;
+        rd_message._private = &waiter->GetReceiver(i);
+    }
+
+    /// A single enqueue call for the whole batch takes the `librdkafka` locks
+    /// once, and the messages are sent in as few requests as `linger.ms`
+    /// allows. As in ScheduleMessageDelivery, 0 msgflags implies no copying
+    /// of the data, RD_KAFKA_MSG_F_PARTITION makes the per-message
+    /// partitions used, messages with RD_KAFKA_PARTITION_UA are assigned by
+    /// the partitioner.
+    const TopicHolder topic{rd_kafka_topic_new(producer_.GetHandle(), topic_name.c_str(), nullptr)};
+    if (!topic) {
+        const auto error = rd_kafka_last_error();
+        LOG_WARNING() << fmt::format("Failed to create topic handle for '{}': {}", topic_name, rd_kafka_err2str(error));
+        for (std::size_t i = 0; i < messages.size(); ++i) {
+            waiter->GetReceiver(i).OnDeliveryReport(DeliveryResult{error});
+        }
+        return wait_handle;
+    }
+
+    const int enqueued = rd_kafka_produce_batch(
+        topic.GetHandle(),
+        RD_KAFKA_PARTITION_UA,
+        RD_KAFKA_MSG_F_PARTITION,
+        rd_messages.data(),
+        static_cast<int>(rd_messages.size())
+    );
+
+    if (static_cast<std::size_t>(enqueued) != rd_messages.size()) {
+        LOG_WARNING() << fmt::format(
+            "Failed to enqueue {} of {} messages to Kafka local queue",
+            rd_messages.size() - static_cast<std::size_t>(enqueued),
+            rd_messages.size()
+        );
+        /// Messages that are not enqueued never get a delivery report
+        for (auto& rd_message : rd_messages) {
+            if (rd_message.err != RD_KAFKA_RESP_ERR_NO_ERROR) {
+                static_cast<DeliveryReceiver*>(rd_message._private)->OnDeliveryReport(DeliveryResult{rd_message.err});
+            }
+        }
+    }
+
+    return wait_handle;
+}
+
 EventHolder ProducerImpl::PollEvent() const {
     /// zero `timeout_ms` means no logical blocking wait for new events in
     /// producer queue. Actually, `rd_kafka_queue_poll` locks some pthread
@@ -224,8 +299,19 @@ void ProducerImpl::DispatchEvent(const EventHolder& event_holder) const {
             UASSERT_MSG(message_count > 0, "No messages in RD_KAFKA_EVENT_DR");
             LOG_DEBUG() << fmt::format("Delivery report event with {} messages", message_count);
 
+            tracing::Span span{"delivery_report_callback"};
+            span.AddTag("kafka_callback", "delivery_report_callback");
+
+            /// Messages of an event are usually of the same topic, so the topic
+            /// statistics are looked up once per a run of same topic messages
+            const rd_kafka_topic_t* current_topic{nullptr};
+            std::shared_ptr<TopicStats> topic_stats;
             while (const auto* message = rd_kafka_event_message_next(event)) {
-                DeliveryReportCallback(message);
+                if (message->rkt != current_topic || !topic_stats) {
+                    current_topic = message->rkt;
+                    topic_stats = stats_.topics_stats[rd_kafka_topic_name(message->rkt)];
+                }
+                DeliveryReportCallback(message, *topic_stats);
             }
         } break;
         case RD_KAFKA_EVENT_ERROR: {
@@ -255,7 +341,8 @@ std::size_t ProducerImpl::HandleEvents(std::string_view context) const {
     return handled;
 }
 
-void ProducerImpl::WaitUntilDeliveryReported(engine::Future<DeliveryResult>& delivery_result) const {
+template <typename DeliveryResultType>
+void ProducerImpl::WaitUntilDeliveryReported(engine::Future<DeliveryResultType>& delivery_result) const {
     /// While this task is waiting for corresponding message delivery, it can
     /// handle other messages delivery reports and errors.
     /// Waiting strategy is as follows:
@@ -3,10 +3,12 @@
 #include <chrono>
 #include <cstdint>
 #include <optional>
+#include <vector>
 
 #include <librdkafka/rdkafka.h>
 
 #include <userver/kafka/impl/stats.hpp>
+#include <userver/kafka/producer.hpp>
 #include <userver/utils/periodic_task.hpp>
 
 #include <kafka/impl/concurrent_event_waiter.hpp>
@@ -34,6 +36,13 @@ public:
         std::optional<std::uint32_t> partition
     ) const;
 
+    /// @brief Sends the messages with a single enqueue call and waits for the
+    /// delivery of all of them.
+    /// While waiting handles other messages delivery reports, errors and logs.
+    /// @returns delivery results in the order of `messages`.
+    [[nodiscard]] std::vector<DeliveryResult>
+    SendMany(const std::string& topic_name, const std::vector<ProducerMessage>& messages) const;
+
     /// @brief Waits until scheduled messages are delivered for
     /// at most 2 x `delivery_timeout`.
     ///
@@ -54,6 +63,11 @@ private:
         std::optional<std::uint32_t> partition
     ) const;
 
+    /// @brief Shedules the delivery of all the messages.
+    /// @returns the future for delivery results, which must be awaited.
+    [[nodiscard]] engine::Future<std::vector<DeliveryResult>>
+    ScheduleMessagesDelivery(const std::string& topic_name, const std::vector<ProducerMessage>& messages) const;
+
     /// @brief Poll a delivery or error event from producer's queue.
     EventHolder PollEvent() const;
 
@@ -68,7 +82,8 @@ private:
 
     /// @brief Waits until message delivery status reported by `librdkafka`.
     /// Suspends for no more than `delivery_timeout` milliseconds.
-    void WaitUntilDeliveryReported(engine::Future<DeliveryResult>& delivery_result) const;
+    template <typename DeliveryResultType>
+    void WaitUntilDeliveryReported(engine::Future<DeliveryResultType>& delivery_result) const;
 
     /// @brief Callback called on error in `librdkafka` work.
     void ErrorCallback(rd_kafka_resp_err_t error, const char* reason, bool is_fatal) const;
@@ -79,9 +94,10 @@ private:
     /// @brief Callback called on each succeeded/failed message delivery.
     /// @param message represents the delivered (or not) message. Its `_private`
     /// field contains and `opaque` argument, which was passed to
-    /// `rd_kafka_producev`, i.e. the Promise which must be setted to notify
-    /// waiter about the delivery.
-    void DeliveryReportCallback(const rd_kafka_message_s* message) const;
+    /// `rd_kafka_producev`, i.e. the DeliveryReceiver which must be notified
+    /// about the delivery.
+    /// @param topic_stats statistics of the message topic.
+    void DeliveryReportCallback(const rd_kafka_message_s* message, TopicStats& topic_stats) const;
 
 private:
     const std::chrono::milliseconds delivery_timeout_;
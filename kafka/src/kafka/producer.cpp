@@ -104,6 +104,23 @@ engine::TaskWithResult<void> Producer::SendAsync(
     );
 }
 
+SendManyResult Producer::SendMany(const std::string& topic_name, const std::vector<ProducerMessage>& messages) const {
+    return utils::Async(producer_task_processor_, "producer_send_many", [this, &topic_name, &messages] {
+        return SendManyImpl(topic_name, messages);
+    }).Get();
+}
+
+engine::TaskWithResult<SendManyResult>
+Producer::SendManyAsync(std::string topic_name, std::vector<ProducerMessage> messages) const {
+    return utils::Async(
+        producer_task_processor_,
+        "producer_send_many_async",
+        [this, topic_name = std::move(topic_name), messages = std::move(messages)] {
+            return SendManyImpl(topic_name, messages);
+        }
+    );
+}
+
 void Producer::DumpMetric(utils::statistics::Writer& writer) const { impl::DumpMetric(writer, producer_->GetStats()); }
 
 void Producer::SendImpl(
@@ -122,6 +139,29 @@ void Producer::SendImpl(
     SendToTestPoint(name_, topic_name, key, message, partition);
 }
 
+SendManyResult Producer::SendManyImpl(const std::string& topic_name, const std::vector<ProducerMessage>& messages)
+    const {
+    tracing::Span::CurrentSpan().AddTag("kafka_producer", name_);
+
+    const auto delivery_results = producer_->SendMany(topic_name, messages);
+    UASSERT(delivery_results.size() == messages.size());
+
+    SendManyResult result(messages.size());
+    for (std::size_t i = 0; i < messages.size(); ++i) {
+        const auto& message = messages[i];
+        if (delivery_results[i].IsSuccess()) {
+            SendToTestPoint(name_, topic_name, message.key, message.payload, message.partition);
+        } else {
+            try {
+                ThrowSendError(delivery_results[i]);
+            } catch (const SendException&) {
+                result[i] = std::current_exception();
+            }
+        }
+    }
+    return result;
+}
+
 }  // namespace kafka
 
 USERVER_NAMESPACE_END
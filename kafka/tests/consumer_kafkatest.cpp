@@ -1,13 +1,20 @@
 #include <userver/kafka/utest/kafka_fixture.hpp>
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <cstdint>
+#include <iterator>
+#include <map>
+#include <stdexcept>
 #include <unordered_set>
 #include <vector>
 
 #include <gmock/gmock-matchers.h>
 
+#include <userver/concurrent/variable.hpp>
 #include <userver/engine/single_use_event.hpp>
+#include <userver/engine/sleep.hpp>
 #include <userver/utils/async.hpp>
 #include <userver/utils/fixed_array.hpp>
 
@@ -22,6 +29,28 @@ const std::string kLargeTopic2{"lt-2"};
 
 constexpr std::size_t kNumPartitionsLargeTopic{4};
 
+constexpr std::size_t kMessagesPerPartition{5};
+
+std::vector<kafka::utest::Message> MakePerPartitionMessages() {
+    std::vector<kafka::utest::Message> messages;
+    for (std::uint32_t partition{0}; partition < kNumPartitionsLargeTopic; ++partition) {
+        for (std::size_t i{0}; i < kMessagesPerPartition; ++i) {
+            messages.push_back(kafka::utest::Message{
+                kLargeTopic1, fmt::format("key-{}", i), fmt::format("msg-{}-{}", partition, i), partition});
+        }
+    }
+    return messages;
+}
+
+kafka::impl::ConsumerExecutionParams MakeParallelExecutionParams() {
+    kafka::impl::ConsumerExecutionParams params{};
+    params.max_batch_size = 100;
+    params.poll_timeout = utest::kMaxTestWaitTime / 2;
+    params.restart_after_failure_delay = std::chrono::milliseconds{10};
+    params.process_partitions_in_parallel = true;
+    return params;
+}
+
 }  // namespace
 
 UTEST_F(ConsumerTest, BrokenConfiguration) {
@@ -213,4 +242,108 @@ UTEST_F(ConsumerTest, LargeBatch) {
     EXPECT_LT(callback_calls.load(), kMessagesCount) << callback_calls.load();
 }
 
+UTEST_F(ConsumerTest, ParallelPartitionsProcessing) {
+    const auto messages = MakePerPartitionMessages();
+    std::map<int, std::vector<std::string>> expected_payloads;
+    for (const auto& message : messages) {
+        expected_payloads[static_cast<int>(*message.partition)].push_back(message.payload);
+    }
+    SendMessages(messages);
+
+    auto consumer = MakeConsumer(
+        "kafka-consumer", {kLargeTopic1}, kafka::impl::ConsumerConfiguration{}, MakeParallelExecutionParams()
+    );
+    auto consumer_scope = consumer.MakeConsumerScope();
+
+    concurrent::Variable<std::map<int, std::vector<std::string>>> received_payloads;
+    std::atomic<std::size_t> consumed{0};
+    std::atomic<std::size_t> in_flight{0};
+    std::atomic<std::size_t> max_in_flight{0};
+    std::atomic<bool> mixed_partitions{false};
+    engine::SingleUseEvent consumed_event;
+    consumer_scope.Start([&](kafka::MessageBatchView batch) {
+        const auto current_in_flight = ++in_flight;
+        auto observed_max = max_in_flight.load();
+        while (observed_max < current_in_flight &&
+               !max_in_flight.compare_exchange_weak(observed_max, current_in_flight)) {
+        }
+        {
+            auto received = received_payloads.Lock();
+            for (const auto& message : batch) {
+                if (message.GetPartition() != batch.begin()->GetPartition()) {
+                    mixed_partitions = true;
+                }
+                (*received)[message.GetPartition()].emplace_back(message.GetPayload());
+            }
+        }
+        // Keeps the callback in flight long enough for the other partitions to overlap with it
+        engine::SleepFor(std::chrono::milliseconds{100});
+        --in_flight;
+
+        if (consumed.fetch_add(batch.size()) + batch.size() == messages.size()) {
+            consumed_event.Send();
+        }
+    });
+
+    UEXPECT_NO_THROW(consumed_event.Wait());
+    consumer_scope.Stop();
+
+    EXPECT_FALSE(mixed_partitions.load());
+    EXPECT_GT(max_in_flight.load(), std::size_t{1});
+    const auto received = received_payloads.Lock();
+    EXPECT_EQ(*received, expected_payloads);
+}
+
+UTEST_F(ConsumerTest, ParallelPartitionsCommitSeparately) {
+    constexpr int kFailingPartition{0};
+
+    const auto messages = MakePerPartitionMessages();
+    std::vector<kafka::utest::Message> failing_partition_messages;
+    std::copy_if(
+        messages.begin(),
+        messages.end(),
+        std::back_inserter(failing_partition_messages),
+        [](const kafka::utest::Message& message) { return *message.partition == kFailingPartition; }
+    );
+    SendMessages(messages);
+
+    {
+        auto consumer = MakeConsumer(
+            "kafka-consumer", {kLargeTopic1}, kafka::impl::ConsumerConfiguration{}, MakeParallelExecutionParams()
+        );
+        auto consumer_scope = consumer.MakeConsumerScope();
+
+        const auto succeeded_expected = messages.size() - failing_partition_messages.size();
+        std::atomic<std::size_t> succeeded{0};
+        std::atomic<bool> failed{false};
+        std::atomic<bool> notified{false};
+        engine::SingleUseEvent processed_event;
+        const auto notify_if_processed = [&] {
+            if (succeeded.load() >= succeeded_expected && failed.load() && !notified.exchange(true)) {
+                processed_event.Send();
+            }
+        };
+        consumer_scope.Start([&](kafka::MessageBatchView batch) {
+            // Must not commit the failing partition, that is processed concurrently
+            consumer_scope.AsyncCommit();
+
+            if (batch.begin()->GetPartition() == kFailingPartition) {
+                failed = true;
+                notify_if_processed();
+                throw std::runtime_error{"failing partition"};
+            }
+            succeeded += batch.size();
+            notify_if_processed();
+        });
+
+        UEXPECT_NO_THROW(processed_event.Wait());
+        consumer_scope.Stop();
+    }
+
+    // Only the messages of the failed partition come again to the group
+    auto consumer = MakeConsumer("kafka-consumer", {kLargeTopic1});
+    const auto received = ReceiveMessages(consumer, failing_partition_messages.size());
+    EXPECT_THAT(received, ::testing::UnorderedElementsAreArray(failing_partition_messages));
+}
+
 USERVER_NAMESPACE_END
@@ -194,6 +194,48 @@ UTEST_F(ProducerTest, OneProducerManySendAsync) {
     /// [Producer batch send async]
 }
 
+UTEST_F(ProducerTest, OneProducerSendMany) {
+    constexpr std::size_t kSendCount{100};
+
+    auto producer = MakeProducer("kafka-producer");
+    const auto topic = GenerateTopic();
+
+    /// [Producer send many]
+    std::vector<kafka::ProducerMessage> messages;
+    messages.reserve(kSendCount);
+    for (std::size_t send{0}; send < kSendCount; ++send) {
+        messages.push_back({fmt::format("test-key-{}", send), fmt::format("test-msg-{}", send)});
+    }
+
+    const kafka::SendManyResult results = producer.SendMany(topic, messages);
+    ASSERT_EQ(results.size(), kSendCount);
+    for (const auto& error : results) {
+        EXPECT_FALSE(error);
+    }
+    /// [Producer send many]
+
+    UEXPECT_NO_THROW(producer.SendManyAsync(topic, std::move(messages)).Get());
+    EXPECT_TRUE(producer.SendMany(topic, {}).empty());
+}
+
+UTEST_F(ProducerTest, SendManyPartialFailure) {
+    auto producer = MakeProducer("kafka-producer");
+
+    const kafka::SendManyResult results = producer.SendMany(
+        GenerateTopic(),
+        {
+            {"test-key-0", "test-msg-0"},
+            {"test-key-1", "test-msg-1", /*partition=*/100500},
+            {"test-key-2", "test-msg-2", /*partition=*/0},
+        }
+    );
+    ASSERT_EQ(results.size(), 3);
+    EXPECT_FALSE(results[0]);
+    ASSERT_TRUE(results[1]);
+    UEXPECT_THROW(std::rethrow_exception(results[1]), kafka::UnknownPartitionException);
+    EXPECT_FALSE(results[2]);
+}
+
 UTEST_F(ProducerTest, ManyProducersManySendSync) {
     constexpr std::size_t kProducerCount{4};
     constexpr std::size_t kSendCount{100};
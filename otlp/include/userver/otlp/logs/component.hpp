@@ -29,6 +29,8 @@ class Logger;
 /// endpoint | URI of otel collector (e.g. 127.0.0.1:4317) | -
 /// max-queue-size | Maximum async queue size | 65535
 /// max-batch-delay | Maximum batch delay | 100ms
+/// max-batch-size | Maximum number of logs or spans in a single batch | 512
+/// compression | Compression of the requests to the collector (none\|gzip) | none
 /// service-name | Service name | unknown_service
 /// attributes | Extra attributes for OTLP, object of key/value strings | -
 /// sinks | List of sinks | -
@@ -39,6 +41,9 @@ class Logger;
 /// * `otlp`: OTLP exporter
 /// * `default`: _default_ logger from the `logging` component
 /// * `both`: _default_ logger and OTLP exporter
+///
+/// Spans are exported to OTLP directly from the tracing::Span data, without
+/// formatting and parsing their log records.
 
 // clang-format on
 class LoggerComponent final : public components::RawComponentBase {
@@ -0,0 +1,62 @@
+#pragma once
+
+/// @file userver/otlp/metrics/component.hpp
+/// @brief @copybrief otlp::MetricsExporterComponent
+
+#include <memory>
+#include <string>
+
+#include <userver/components/component_base.hpp>
+#include <userver/components/component_fwd.hpp>
+#include <userver/utils/periodic_task.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace otlp {
+
+class MetricsExporter;
+
+// clang-format off
+
+/// @ingroup userver_components
+///
+/// @brief Component that periodically exports the metrics of
+/// components::StatisticsStorage to an OTLP collector.
+///
+/// Integer and double metrics are exported as gauges, utils::statistics::Rate
+/// as cumulative monotonic sums, utils::statistics::HistogramView as
+/// cumulative histograms. Metric labels become the data point attributes.
+///
+/// ## Static options:
+/// Name | Description | Default value
+/// ---- | ----------- | -------------
+/// endpoint | URI of otel collector (e.g. 127.0.0.1:4317) | -
+/// export-interval | Interval between the exports | 10s
+/// service-name | Service name | unknown_service
+/// extra-attributes | Extra OTLP resource attributes, object of key/value strings | -
+/// compression | Compression of the requests to the collector (none\|gzip) | none
+
+// clang-format on
+class MetricsExporterComponent final : public components::ComponentBase {
+public:
+    /// @ingroup userver_component_names
+    /// @brief The default name of otlp::MetricsExporterComponent
+    static constexpr std::string_view kName = "otlp-metrics-exporter";
+
+    MetricsExporterComponent(const components::ComponentConfig&, const components::ComponentContext&);
+
+    ~MetricsExporterComponent() override;
+
+    static yaml_config::Schema GetStaticConfigSchema();
+
+private:
+    std::unique_ptr<MetricsExporter> exporter_;
+    utils::PeriodicTask export_task_;
+};
+
+}  // namespace otlp
+
+template <>
+inline constexpr bool components::kHasValidate<otlp::MetricsExporterComponent> = true;
+
+USERVER_NAMESPACE_END
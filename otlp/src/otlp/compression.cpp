@@ -0,0 +1,32 @@
+#include <otlp/compression.hpp>
+
+#include <userver/utils/trivial_map.hpp>
+#include <userver/yaml_config/yaml_config.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace otlp {
+
+namespace {
+
+constexpr utils::TrivialBiMap kCompressions = [](auto selector) {
+    return selector().Case("none", Compression::kNone).Case("gzip", Compression::kGzip);
+};
+
+}  // namespace
+
+Compression Parse(const yaml_config::YamlConfig& value, formats::parse::To<Compression>) {
+    return utils::ParseFromValueString(value, kCompressions);
+}
+
+std::unique_ptr<grpc::ClientContext> MakeClientContext(Compression compression) {
+    auto context = std::make_unique<grpc::ClientContext>();
+    if (compression == Compression::kGzip) {
+        context->set_compression_algorithm(GRPC_COMPRESS_GZIP);
+    }
+    return context;
+}
+
+}  // namespace otlp
+
+USERVER_NAMESPACE_END
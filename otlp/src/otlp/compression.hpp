@@ -0,0 +1,23 @@
+#pragma once
+
+#include <memory>
+
+#include <grpcpp/client_context.h>
+
+#include <userver/formats/parse/to.hpp>
+#include <userver/yaml_config/fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace otlp {
+
+enum class Compression { kNone, kGzip };
+
+Compression Parse(const yaml_config::YamlConfig& value, formats::parse::To<Compression>);
+
+/// Makes a context for a request to the OTLP collector
+std::unique_ptr<grpc::ClientContext> MakeClientContext(Compression compression);
+
+}  // namespace otlp
+
+USERVER_NAMESPACE_END
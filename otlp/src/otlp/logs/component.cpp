@@ -11,6 +11,7 @@
 #include <userver/logging/level_serialization.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/logging/null_logger.hpp>
+#include <userver/tracing/span_exporter.hpp>
 
 #include <userver/ugrpc/client/client_factory_component.hpp>
 #include <userver/yaml_config/merge_schemas.hpp>
@@ -39,6 +40,8 @@ LoggerComponent::LoggerComponent(const components::ComponentConfig& config, cons
     LoggerConfig logger_config;
     logger_config.max_queue_size = config["max-queue-size"].As<size_t>(65535);
     logger_config.max_batch_delay = config["max-batch-delay"].As<std::chrono::milliseconds>(100);
+    logger_config.max_batch_size = config["max-batch-size"].As<size_t>(logger_config.max_batch_size);
+    logger_config.compression = config["compression"].As<Compression>(Compression::kNone);
     logger_config.service_name = config["service-name"].As<std::string>("unknown_service");
     logger_config.log_level = config["log-level"].As<USERVER_NAMESPACE::logging::Level>();
     logger_config.extra_attributes = config["extra-attributes"].As<std::unordered_map<std::string, std::string>>({});
@@ -80,6 +83,10 @@ LoggerComponent::LoggerComponent(const components::ComponentConfig& config, cons
     logging::impl::SetDefaultLoggerRef(*logger_);
     old_logger_.ForwardTo(&*logger_);
 
+    if (logger_config.tracing_sink != SinkType::kDefault) {
+        tracing::SetSpanExporter(logger_);
+    }
+
     auto* const statistics_storage = context.FindComponentOptional<components::StatisticsStorage>();
     if (statistics_storage) {
         statistics_holder_ =
@@ -90,6 +97,7 @@ LoggerComponent::LoggerComponent(const components::ComponentConfig& config, cons
 }
 
 LoggerComponent::~LoggerComponent() {
+    tracing::SetSpanExporter(nullptr);
     old_logger_.ForwardTo(nullptr);
     logging::impl::SetDefaultLoggerRef(old_logger_);
 
@@ -119,6 +127,16 @@ properties:
     max-batch-delay:
         type: string
         description: max delay between send batches (e.g. 100ms or 1s)
+    max-batch-size:
+        type: integer
+        description: max number of logs or spans in a single send batch
+        defaultDescription: 512
+        minimum: 1
+    compression:
+        type: string
+        enum: [none, gzip]
+        description: compression of the gRPC requests to the collector
+        defaultDescription: none
     service-name:
         type: string
         description: service name
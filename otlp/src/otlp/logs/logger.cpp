@@ -1,7 +1,9 @@
 #include "logger.hpp"
 
 #include <chrono>
+#include <cstdint>
 #include <iostream>
+#include <variant>
 
 #include <userver/engine/async.hpp>
 #include <userver/formats/parse/common_containers.hpp>
@@ -25,6 +27,30 @@ constexpr std::string_view kTelemetrySdkName = "telemetry.sdk.name";
 constexpr std::string_view kServiceName = "service.name";
 
 const std::string kTimestampFormat = "%Y-%m-%dT%H:%M:%E*S";
+
+constexpr std::string_view kErrorTag = "error";
+constexpr std::string_view kTimerSuffix = "_time";
+
+void SetAttributeValue(::opentelemetry::proto::common::v1::AnyValue& result, const logging::LogExtra::Value& value) {
+    std::visit(
+        utils::Overloaded{
+            [&result](const std::string& value) { result.set_string_value(value); },
+            [&result](float value) { result.set_double_value(value); },
+            [&result](double value) { result.set_double_value(value); },
+            [&result](auto value) { result.set_int_value(static_cast<std::int64_t>(value)); }},
+        value
+    );
+}
+
+bool IsErrorValue(const logging::LogExtra::Value& value) {
+    return std::visit(
+        utils::Overloaded{
+            [](const std::string& value) { return value == "true"; },
+            [](auto value) { return value != 0; }},
+        value
+    );
+}
+
 }  // namespace
 
 SinkType Parse(const yaml_config::YamlConfig& value, formats::parse::To<SinkType>) {
@@ -90,7 +116,7 @@ void Logger::Log(logging::Level level, std::string_view msg) {
     ::opentelemetry::proto::logs::v1::LogRecord log_record;
     std::chrono::system_clock::time_point timestamp;
 
-    ++stats_.by_level[static_cast<int>(level)];
+    stats_.by_level[static_cast<int>(level)].Add(1);
 
     [[maybe_unused]] auto parse_ok =
         utils::encoding::TskvReadRecord(parser, [&](std::string_view key, std::string_view value) {
@@ -132,67 +158,57 @@ void Logger::Log(logging::Level level, std::string_view msg) {
 }
 
 void Logger::Trace(logging::Level level, std::string_view msg) {
+    // Spans are sent to OTLP via Logger::Export, the span log records are
+    // written only for the default logger
     if (config_.tracing_sink == SinkType::kDefault || config_.tracing_sink == SinkType::kBoth) {
         if (default_logger_) default_logger_->Trace(level, msg);
-        if (config_.tracing_sink == SinkType::kDefault) {
-            return;
-        }
     }
+}
 
-    utils::encoding::TskvParser parser{msg};
-
+void Logger::Export(const tracing::FinishedSpan& finished_span) {
     ::opentelemetry::proto::trace::v1::Span span;
+    span.set_trace_id(utils::encoding::FromHex(finished_span.GetTraceId()));
+    span.set_span_id(utils::encoding::FromHex(finished_span.GetSpanId()));
+    if (!finished_span.GetParentId().empty()) {
+        span.set_parent_span_id(utils::encoding::FromHex(finished_span.GetParentId()));
+    }
+    span.set_name(finished_span.GetName());
+
+    const auto start_time =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(finished_span.GetStartSystemTime().time_since_epoch());
+    span.set_start_time_unix_nano(start_time.count());
+    span.set_end_time_unix_nano(
+        (start_time + std::chrono::duration_cast<std::chrono::nanoseconds>(finished_span.GetDuration())).count()
+    );
+
+    finished_span.VisitTags([&](std::string_view key, const logging::LogExtra::Value& value) {
+        if (key == kErrorTag && IsErrorValue(value)) {
+            span.mutable_status()->set_code(::opentelemetry::proto::trace::v1::Status::STATUS_CODE_ERROR);
+        }
+        auto* attribute = span.add_attributes();
+        attribute->set_key(std::string{MapAttribute(key)});
+        SetAttributeValue(*attribute->mutable_value(), value);
+    });
 
-    std::string start_timestamp;
-    std::string total_time;
-
-    [[maybe_unused]] auto parse_ok =
-        utils::encoding::TskvReadRecord(parser, [&](std::string_view key, std::string_view value) {
-            if (key == "trace_id") {
-                span.set_trace_id(utils::encoding::FromHex(value));
-                return true;
-            }
-            if (key == "span_id") {
-                span.set_span_id(utils::encoding::FromHex(value));
-                return true;
-            }
-            if (key == "parent_id") {
-                span.set_parent_span_id(utils::encoding::FromHex(value));
-                return true;
-            }
-            if (key == "stopwatch_name") {
-                span.set_name(std::string(value));
-                return true;
-            }
-            if (key == "total_time") {
-                total_time = value;
-                return true;
-            }
-            if (key == "start_timestamp") {
-                start_timestamp = value;
-                return true;
-            }
-            if (key == "timestamp" || key == "text") {
-                return true;
-            }
-
-            auto attributes = span.add_attributes();
-            attributes->set_key(std::string{MapAttribute(key)});
-            attributes->mutable_value()->set_string_value(std::string{value});
-            return true;
-        });
+    std::string scope_time_key;
+    finished_span.VisitScopeTimes([&](std::string_view name, std::chrono::nanoseconds duration) {
+        scope_time_key.assign(name);
+        scope_time_key.append(kTimerSuffix);
 
-    auto start_timestamp_double = std::stod(start_timestamp);
-    span.set_start_time_unix_nano(start_timestamp_double * 1'000'000'000);
-    span.set_end_time_unix_nano((start_timestamp_double + std::stod(total_time) / 1'000) * 1'000'000'000LL);
+        auto* attribute = span.add_attributes();
+        attribute->set_key(std::string{MapAttribute(scope_time_key)});
+        attribute->mutable_value()->set_double_value(std::chrono::duration<double, std::milli>(duration).count());
+    });
 
-    // Drop a trace if overflown
+    // Drop a span if overflown
     auto ok = queue_producer_.PushNoblock(std::move(span));
     if (!ok) {
         ++stats_.dropped;
     }
 }
 
+bool Logger::ShouldAlsoLog() const noexcept { return config_.tracing_sink == SinkType::kBoth; }
+
 void Logger::SendingLoop(Queue::Consumer& consumer, LogClient& log_client, TraceClient& trace_client) {
     // Create dummy span to completely disable logging in current coroutine
     tracing::Span span("");
@@ -214,26 +230,27 @@ void Logger::SendingLoop(Queue::Consumer& consumer, LogClient& log_client, Trace
         scope_spans->clear_spans();
 
         auto deadline = engine::Deadline::FromDuration(config_.max_batch_delay);
+        size_t batch_size = 0;
 
+        // Cleared messages are kept by the repeated fields and reused by the
+        // next batches, swapping avoids deep copies and most of the allocations
         do {
             std::visit(
                 utils::Overloaded{
-                    [&scope_spans](const opentelemetry::proto::trace::v1::Span& action) {
-                        auto span = scope_spans->add_spans();
-                        *span = action;
+                    [&scope_spans](opentelemetry::proto::trace::v1::Span& action) {
+                        scope_spans->add_spans()->Swap(&action);
                     },
-                    [&scope_logs](const opentelemetry::proto::logs::v1::LogRecord& action) {
-                        auto log_records = scope_logs->add_log_records();
-                        *log_records = action;
+                    [&scope_logs](opentelemetry::proto::logs::v1::LogRecord& action) {
+                        scope_logs->add_log_records()->Swap(&action);
                     }},
                 action
             );
-        } while (consumer.Pop(action, deadline));
+        } while (++batch_size < config_.max_batch_size && consumer.Pop(action, deadline));
 
-        if (config_.logs_sink == SinkType::kBoth || config_.logs_sink == SinkType::kOtlp) {
+        if (scope_logs->log_records_size() > 0) {
             DoLog(log_request, log_client);
         }
-        if (config_.tracing_sink == SinkType::kBoth || config_.tracing_sink == SinkType::kOtlp) {
+        if (scope_spans->spans_size() > 0) {
             DoTrace(trace_request, trace_client);
         }
     }
@@ -270,7 +287,7 @@ void Logger::DoLog(
     LogClient& client
 ) {
     try {
-        auto call = client.Export(request);
+        auto call = client.Export(request, MakeClientContext(config_.compression));
         auto response = call.Finish();
     } catch (const ugrpc::client::RpcCancelledError&) {
         std::cerr << "Stopping OTLP sender task\n";
@@ -286,7 +303,7 @@ void Logger::DoTrace(
     TraceClient& trace_client
 ) {
     try {
-        auto call = trace_client.Export(request);
+        auto call = trace_client.Export(request, MakeClientContext(config_.compression));
         auto response = call.Finish();
     } catch (const ugrpc::client::RpcCancelledError&) {
         std::cerr << "Stopping OTLP sender task\n";
@@ -11,8 +11,11 @@
 #include <userver/formats/yaml.hpp>
 #include <userver/logging/impl/log_stats.hpp>
 #include <userver/logging/impl/logger_base.hpp>
+#include <userver/tracing/span_exporter.hpp>
 #include <userver/yaml_config/yaml_config.hpp>
 
+#include <otlp/compression.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace otlp {
@@ -24,6 +27,8 @@ SinkType Parse(const yaml_config::YamlConfig& value, formats::parse::To<SinkType
 struct LoggerConfig {
     size_t max_queue_size{10000};
     std::chrono::milliseconds max_batch_delay{};
+    size_t max_batch_size{512};
+    Compression compression{Compression::kNone};
     SinkType logs_sink{SinkType::kOtlp};
     SinkType tracing_sink{SinkType::kOtlp};
     std::string service_name;
@@ -32,7 +37,8 @@ struct LoggerConfig {
     logging::Level log_level{logging::Level::kInfo};
 };
 
-class Logger final : public logging::impl::LoggerBase {
+// NOLINTNEXTLINE(fuchsia-multiple-inheritance)
+class Logger final : public logging::impl::LoggerBase, public tracing::SpanExporter {
 public:
     using LogClient = opentelemetry::proto::collector::logs::v1::LogsServiceClient;
     using TraceClient = opentelemetry::proto::collector::trace::v1::TraceServiceClient;
@@ -45,6 +51,10 @@ public:
 
     void Trace(logging::Level level, std::string_view msg) override;
 
+    void Export(const tracing::FinishedSpan& span) override;
+
+    bool ShouldAlsoLog() const noexcept override;
+
     void PrependCommonTags(logging::impl::TagWriter writer) const override;
 
     void Stop() noexcept;
@@ -0,0 +1,78 @@
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+
+#include <userver/engine/run_standalone.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/tracing/span.hpp>
+#include <userver/tracing/span_exporter.hpp>
+#include <userver/ugrpc/tests/service.hpp>
+
+#include <opentelemetry/proto/collector/logs/v1/logs_service_client.usrv.pb.hpp>
+#include <opentelemetry/proto/collector/trace/v1/trace_service_client.usrv.pb.hpp>
+#include <opentelemetry/proto/collector/trace/v1/trace_service_service.usrv.pb.hpp>
+
+#include <otlp/logs/logger.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+class TraceService final : public opentelemetry::proto::collector::trace::v1::TraceServiceBase {
+public:
+    ExportResult Export(
+        CallContext& /*context*/,
+        ::opentelemetry::proto::collector::trace::v1::ExportTraceServiceRequest&& request
+    ) override {
+        // Don't emit new traces to avoid recursive traces
+        tracing::Span::CurrentSpan().SetLogLevel(logging::Level::kNone);
+        for (const auto& resource_spans : request.resource_spans()) {
+            for (const auto& scope_spans : resource_spans.scope_spans()) {
+                exported_spans += scope_spans.spans_size();
+            }
+        }
+        return ::opentelemetry::proto::collector::trace::v1::ExportTraceServiceResponse{};
+    }
+
+    std::atomic<std::size_t> exported_spans{0};
+};
+
+// Measures the export of finished spans to OTLP on a single core, including
+// the conversion to protobuf and the batched sending
+void otlp_span_export(benchmark::State& state) {
+    engine::RunStandalone([&] {
+        ugrpc::tests::Service<TraceService> service;
+
+        otlp::LoggerConfig config;
+        config.max_queue_size = 1 << 16;
+        config.max_batch_delay = std::chrono::milliseconds{10};
+        auto logger = std::make_shared<otlp::Logger>(
+            service.MakeClient<opentelemetry::proto::collector::logs::v1::LogsServiceClient>(),
+            service.MakeClient<opentelemetry::proto::collector::trace::v1::TraceServiceClient>(),
+            std::move(config)
+        );
+        const logging::DefaultLoggerGuard logger_guard{logger};
+        tracing::SetSpanExporter(logger);
+
+        std::size_t i = 0;
+        for ([[maybe_unused]] auto _ : state) {
+            tracing::Span span("benchmark_span");
+            span.AddTag("meta_code", 200);
+            span.AddNonInheritableTag("http.url", "http://example.com/example");
+            span.AddNonInheritableTag("iteration", ++i);
+        }
+
+        tracing::SetSpanExporter(nullptr);
+        logger->Stop();
+
+        // Spans dropped by the full queue are not counted
+        const auto exported_spans = static_cast<double>(service.GetService().exported_spans.load());
+        state.counters["exported_spans_per_second"] = benchmark::Counter(exported_spans, benchmark::Counter::kIsRate);
+        state.counters["dropped"] = benchmark::Counter(static_cast<double>(logger->GetStatistics().dropped.Load().value));
+    });
+}
+BENCHMARK(otlp_span_export);
+
+}  // namespace
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,81 @@
+#include <userver/otlp/metrics/component.hpp>
+
+#include <unordered_map>
+
+#include <userver/components/component_config.hpp>
+#include <userver/components/component_context.hpp>
+#include <userver/components/statistics_storage.hpp>
+#include <userver/formats/parse/common_containers.hpp>
+#include <userver/tracing/span.hpp>
+#include <userver/ugrpc/client/client_factory_component.hpp>
+#include <userver/yaml_config/merge_schemas.hpp>
+
+#include <otlp/metrics/exporter.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace otlp {
+
+MetricsExporterComponent::MetricsExporterComponent(
+    const components::ComponentConfig& config,
+    const components::ComponentContext& context
+)
+    : ComponentBase(config, context) {
+    auto& client_factory = context.FindComponent<ugrpc::client::ClientFactoryComponent>().GetFactory();
+    auto& storage = context.FindComponent<components::StatisticsStorage>().GetStorage();
+
+    auto client = client_factory.MakeClient<MetricsExporter::Client>("otlp-metrics", config["endpoint"].As<std::string>());
+
+    MetricsExporterConfig exporter_config;
+    exporter_config.service_name = config["service-name"].As<std::string>("unknown_service");
+    exporter_config.extra_attributes =
+        config["extra-attributes"].As<std::unordered_map<std::string, std::string>>({});
+    exporter_config.compression = config["compression"].As<Compression>(Compression::kNone);
+
+    exporter_ = std::make_unique<MetricsExporter>(std::move(client), storage, std::move(exporter_config));
+
+    const auto export_interval = config["export-interval"].As<std::chrono::milliseconds>(std::chrono::seconds{10});
+    export_task_.Start(kName, {export_interval}, [this] {
+        // Don't trace the export itself
+        tracing::Span::CurrentSpan().SetLocalLogLevel(logging::Level::kNone);
+        exporter_->Export();
+    });
+}
+
+MetricsExporterComponent::~MetricsExporterComponent() { export_task_.Stop(); }
+
+yaml_config::Schema MetricsExporterComponent::GetStaticConfigSchema() {
+    return yaml_config::MergeSchemas<components::ComponentBase>(R"(
+type: object
+description: Component that periodically exports the metrics to an OTLP collector
+additionalProperties: false
+properties:
+    endpoint:
+        type: string
+        description: Hostname:port of otel collector (gRPC)
+    export-interval:
+        type: string
+        description: interval between the exports (e.g. 10s)
+        defaultDescription: 10s
+    service-name:
+        type: string
+        description: service name
+        defaultDescription: unknown_service
+    extra-attributes:
+        type: object
+        description: extra OTLP resource attributes
+        properties: {}
+        additionalProperties:
+            type: string
+            description: attribute value
+    compression:
+        type: string
+        enum: [none, gzip]
+        description: compression of the gRPC requests to the collector
+        defaultDescription: none
+)");
+}
+
+}  // namespace otlp
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,161 @@
+#include <otlp/metrics/exporter.hpp>
+
+#include <cstdint>
+#include <iostream>
+
+#include <google/protobuf/arena.h>
+
+#include <userver/ugrpc/client/exceptions.hpp>
+#include <userver/utils/overloaded.hpp>
+#include <userver/utils/statistics/histogram_view.hpp>
+#include <userver/utils/statistics/storage.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace otlp {
+
+namespace {
+
+namespace metrics_proto = ::opentelemetry::proto::metrics::v1;
+
+constexpr std::string_view kTelemetrySdkLanguage = "telemetry.sdk.language";
+constexpr std::string_view kTelemetrySdkName = "telemetry.sdk.name";
+constexpr std::string_view kServiceName = "service.name";
+
+std::uint64_t ToUnixNano(std::chrono::system_clock::time_point time_point) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(time_point.time_since_epoch()).count();
+}
+
+void AddAttribute(
+    google::protobuf::RepeatedPtrField<::opentelemetry::proto::common::v1::KeyValue>& attributes,
+    std::string_view key,
+    std::string_view value
+) {
+    auto* attribute = attributes.Add();
+    attribute->set_key(std::string{key});
+    attribute->mutable_value()->set_string_value(std::string{value});
+}
+
+class MetricsBuilder final : public utils::statistics::BaseFormatBuilder {
+public:
+    MetricsBuilder(metrics_proto::ScopeMetrics& scope_metrics, std::uint64_t start_time, std::uint64_t time)
+        : scope_metrics_(scope_metrics), start_time_(start_time), time_(time) {}
+
+    void HandleMetric(
+        std::string_view path,
+        utils::statistics::LabelsSpan labels,
+        const utils::statistics::MetricValue& value
+    ) override {
+        auto& metric = GetMetric(path);
+        value.Visit(utils::Overloaded{
+            [&](std::int64_t value) { MakeDataPoint(*metric.mutable_gauge(), labels).set_as_int(value); },
+            [&](double value) { MakeDataPoint(*metric.mutable_gauge(), labels).set_as_double(value); },
+            [&](utils::statistics::Rate value) {
+                auto& sum = *metric.mutable_sum();
+                sum.set_aggregation_temporality(metrics_proto::AGGREGATION_TEMPORALITY_CUMULATIVE);
+                sum.set_is_monotonic(true);
+                MakeDataPoint(sum, labels).set_as_int(static_cast<std::int64_t>(value.value));
+            },
+            [&](utils::statistics::HistogramView value) {
+                auto& histogram = *metric.mutable_histogram();
+                histogram.set_aggregation_temporality(metrics_proto::AGGREGATION_TEMPORALITY_CUMULATIVE);
+                auto& data_point = MakeDataPoint(histogram, labels);
+                data_point.set_count(value.GetTotalCount());
+                for (std::size_t i = 0; i < value.GetBucketCount(); ++i) {
+                    data_point.add_explicit_bounds(value.GetUpperBoundAt(i));
+                    data_point.add_bucket_counts(value.GetValueAt(i));
+                }
+                data_point.add_bucket_counts(value.GetValueAtInf());
+            },
+        });
+    }
+
+private:
+    // All the data points of a path belong to a single metric
+    metrics_proto::Metric& GetMetric(std::string_view path) {
+        if (last_metric_ && last_metric_->name() == path) return *last_metric_;
+
+        auto it = metrics_.find(path);
+        if (it == metrics_.end()) {
+            auto* metric = scope_metrics_.add_metrics();
+            metric->set_name(std::string{path});
+            it = metrics_.emplace(metric->name(), metric).first;
+        }
+        last_metric_ = it->second;
+        return *last_metric_;
+    }
+
+    template <typename Data>
+    auto& MakeDataPoint(Data& data, utils::statistics::LabelsSpan labels) {
+        auto& data_point = *data.add_data_points();
+        for (const auto& label : labels) {
+            AddAttribute(*data_point.mutable_attributes(), label.Name(), label.Value());
+        }
+        data_point.set_start_time_unix_nano(start_time_);
+        data_point.set_time_unix_nano(time_);
+        return data_point;
+    }
+
+    metrics_proto::ScopeMetrics& scope_metrics_;
+    const std::uint64_t start_time_;
+    const std::uint64_t time_;
+    std::unordered_map<std::string_view, metrics_proto::Metric*> metrics_;
+    metrics_proto::Metric* last_metric_{nullptr};
+};
+
+}  // namespace
+
+MetricsExporter::MetricsExporter(
+    Client client,
+    const utils::statistics::Storage& storage,
+    MetricsExporterConfig&& config
+)
+    : client_(std::move(client)),
+      storage_(storage),
+      config_(std::move(config)),
+      start_time_(std::chrono::system_clock::now()) {}
+
+void MetricsExporter::Export() {
+    // The request is built from thousands of small messages and is dropped as
+    // a whole, so allocate it on an arena
+    google::protobuf::Arena arena;
+    auto* request =
+        google::protobuf::Arena::CreateMessage<opentelemetry::proto::collector::metrics::v1::ExportMetricsServiceRequest>(
+            &arena
+        );
+    FillRequest(*request);
+
+    try {
+        auto call = client_.Export(*request, MakeClientContext(config_.compression));
+        auto response = call.Finish();
+    } catch (const ugrpc::client::RpcCancelledError&) {
+        throw;
+    } catch (const std::exception& e) {
+        std::cerr << "Failed to write down OTLP metrics: " << e.what() << typeid(e).name() << "\n";
+    }
+}
+
+void MetricsExporter::FillRequest(
+    opentelemetry::proto::collector::metrics::v1::ExportMetricsServiceRequest& request
+) const {
+    auto& resource_metrics = *request.add_resource_metrics();
+
+    auto& resource_attributes = *resource_metrics.mutable_resource()->mutable_attributes();
+    AddAttribute(resource_attributes, kTelemetrySdkLanguage, "cpp");
+    AddAttribute(resource_attributes, kTelemetrySdkName, "userver");
+    AddAttribute(resource_attributes, kServiceName, config_.service_name);
+    for (const auto& [key, value] : config_.extra_attributes) {
+        AddAttribute(resource_attributes, key, value);
+    }
+
+    MetricsBuilder builder{
+        *resource_metrics.add_scope_metrics(),
+        ToUnixNano(start_time_),
+        ToUnixNano(std::chrono::system_clock::now()),
+    };
+    storage_.VisitMetrics(builder);
+}
+
+}  // namespace otlp
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <chrono>
+#include <string>
+#include <unordered_map>
+
+#include <opentelemetry/proto/collector/metrics/v1/metrics_service_client.usrv.pb.hpp>
+
+#include <userver/utils/statistics/fwd.hpp>
+
+#include <otlp/compression.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace otlp {
+
+struct MetricsExporterConfig {
+    std::string service_name;
+    std::unordered_map<std::string, std::string> extra_attributes;
+    Compression compression{Compression::kNone};
+};
+
+/// Converts the utils::statistics::Storage snapshots into OTLP metrics and
+/// sends them to the collector
+class MetricsExporter final {
+public:
+    using Client = opentelemetry::proto::collector::metrics::v1::MetricsServiceClient;
+
+    MetricsExporter(Client client, const utils::statistics::Storage& storage, MetricsExporterConfig&& config);
+
+    /// Sends a single snapshot of all the metrics
+    void Export();
+
+private:
+    void FillRequest(opentelemetry::proto::collector::metrics::v1::ExportMetricsServiceRequest& request) const;
+
+    Client client_;
+    const utils::statistics::Storage& storage_;
+    const MetricsExporterConfig config_;
+    // Start of the cumulative sums and histograms
+    const std::chrono::system_clock::time_point start_time_;
+};
+
+}  // namespace otlp
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,125 @@
+#include <userver/utest/utest.hpp>
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <otlp/metrics/exporter.hpp>
+#include <userver/utils/statistics/histogram.hpp>
+#include <userver/utils/statistics/rate.hpp>
+#include <userver/utils/statistics/storage.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+#include <userver/ugrpc/tests/service_fixtures.hpp>
+
+#include <opentelemetry/proto/collector/metrics/v1/metrics_service_client.usrv.pb.hpp>
+#include <opentelemetry/proto/collector/metrics/v1/metrics_service_service.usrv.pb.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+namespace metrics_proto = ::opentelemetry::proto::metrics::v1;
+
+class MetricsService final : public opentelemetry::proto::collector::metrics::v1::MetricsServiceBase {
+public:
+    ExportResult Export(
+        CallContext& /*context*/,
+        ::opentelemetry::proto::collector::metrics::v1::ExportMetricsServiceRequest&& request
+    ) override {
+        requests.push_back(std::move(request));
+        return ::opentelemetry::proto::collector::metrics::v1::ExportMetricsServiceResponse{};
+    }
+
+    // no sync as there is only a single grpc client
+    std::vector<::opentelemetry::proto::collector::metrics::v1::ExportMetricsServiceRequest> requests;
+};
+
+using MetricsExporterTest = ugrpc::tests::ServiceFixture<MetricsService>;
+
+constexpr double kHistogramBounds[] = {10, 100};
+
+std::unordered_map<std::string, std::string> GetAttributes(const metrics_proto::NumberDataPoint& data_point) {
+    std::unordered_map<std::string, std::string> attributes;
+    for (const auto& attribute : data_point.attributes()) {
+        attributes.emplace(attribute.key(), attribute.value().string_value());
+    }
+    return attributes;
+}
+
+}  // namespace
+
+UTEST_F(MetricsExporterTest, Export) {
+    utils::statistics::Histogram histogram{kHistogramBounds};
+    histogram.Account(5);
+    histogram.Account(50, 2);
+    histogram.Account(500);
+
+    utils::statistics::Storage storage;
+    auto holder = storage.RegisterWriter("test", [&](utils::statistics::Writer& writer) {
+        writer["gauge"].ValueWithLabels(42, {{"label", "first"}});
+        writer["gauge"].ValueWithLabels(43, {{"label", "second"}});
+        writer["ratio"] = 0.5;
+        writer["requests"] = utils::statistics::Rate{7};
+        writer["timings"] = histogram;
+    });
+
+    otlp::MetricsExporterConfig config;
+    config.service_name = "metrics-test";
+    otlp::MetricsExporter exporter{
+        MakeClient<opentelemetry::proto::collector::metrics::v1::MetricsServiceClient>(),
+        storage,
+        std::move(config),
+    };
+    exporter.Export();
+    holder.Unregister();
+
+    ASSERT_EQ(GetService().requests.size(), std::size_t{1});
+    const auto& request = GetService().requests[0];
+    ASSERT_EQ(request.resource_metrics_size(), 1);
+    const auto& resource_metrics = request.resource_metrics(0);
+
+    std::unordered_map<std::string, std::string> resource_attributes;
+    for (const auto& attribute : resource_metrics.resource().attributes()) {
+        resource_attributes.emplace(attribute.key(), attribute.value().string_value());
+    }
+    EXPECT_EQ(resource_attributes["service.name"], "metrics-test");
+
+    ASSERT_EQ(resource_metrics.scope_metrics_size(), 1);
+    std::unordered_map<std::string, metrics_proto::Metric> metrics;
+    for (const auto& metric : resource_metrics.scope_metrics(0).metrics()) {
+        // All the data points of a path must be in a single metric
+        EXPECT_TRUE(metrics.emplace(metric.name(), metric).second) << metric.name();
+    }
+    ASSERT_EQ(metrics.size(), std::size_t{4});
+
+    const auto& gauge = metrics["test.gauge"].gauge();
+    ASSERT_EQ(gauge.data_points_size(), 2);
+    EXPECT_EQ(gauge.data_points(0).as_int(), 42);
+    EXPECT_EQ(GetAttributes(gauge.data_points(0))["label"], "first");
+    EXPECT_EQ(gauge.data_points(1).as_int(), 43);
+    EXPECT_EQ(GetAttributes(gauge.data_points(1))["label"], "second");
+
+    ASSERT_EQ(metrics["test.ratio"].gauge().data_points_size(), 1);
+    EXPECT_EQ(metrics["test.ratio"].gauge().data_points(0).as_double(), 0.5);
+
+    const auto& sum = metrics["test.requests"].sum();
+    EXPECT_TRUE(sum.is_monotonic());
+    EXPECT_EQ(sum.aggregation_temporality(), metrics_proto::AGGREGATION_TEMPORALITY_CUMULATIVE);
+    ASSERT_EQ(sum.data_points_size(), 1);
+    EXPECT_EQ(sum.data_points(0).as_int(), 7);
+    EXPECT_LE(sum.data_points(0).start_time_unix_nano(), sum.data_points(0).time_unix_nano());
+
+    const auto& timings = metrics["test.timings"].histogram();
+    EXPECT_EQ(timings.aggregation_temporality(), metrics_proto::AGGREGATION_TEMPORALITY_CUMULATIVE);
+    ASSERT_EQ(timings.data_points_size(), 1);
+    const auto& data_point = timings.data_points(0);
+    EXPECT_EQ(data_point.count(), std::uint64_t{4});
+    EXPECT_EQ(std::vector<double>(data_point.explicit_bounds().begin(), data_point.explicit_bounds().end()),
+              (std::vector<double>{10, 100}));
+    EXPECT_EQ(std::vector<std::uint64_t>(data_point.bucket_counts().begin(), data_point.bucket_counts().end()),
+              (std::vector<std::uint64_t>{1, 2, 1}));
+}
+
+USERVER_NAMESPACE_END
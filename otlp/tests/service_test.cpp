@@ -1,9 +1,13 @@
 #include <userver/utest/utest.hpp>
 
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 #include <otlp/logs/logger.hpp>
 #include <userver/engine/sleep.hpp>
+#include <userver/tracing/span_exporter.hpp>
+#include <userver/tracing/tags.hpp>
 
 #include <userver/ugrpc/tests/service_fixtures.hpp>
 #include <userver/utest/default_logger_fixture.hpp>
@@ -95,9 +99,13 @@ public:
             otlp::LoggerConfig{}
         );
         SetDefaultLogger(logger_);
+        tracing::SetSpanExporter(logger_);
     }
 
-    ~LogServiceTest() override { logger_->Stop(); }
+    ~LogServiceTest() override {
+        tracing::SetSpanExporter(nullptr);
+        logger_->Stop();
+    }
 
 private:
     std::shared_ptr<otlp::Logger> logger_;
@@ -151,4 +159,30 @@ UTEST_F(LogServiceTest, SmokeTrace) {
     EXPECT_LE(span.end_time_unix_nano(), timestamp2.count());
 }
 
+UTEST_F(LogServiceTest, TraceTags) {
+    {
+        tracing::Span span("span_with_tags");
+        span.AddTag("int_tag", 42);
+        span.AddNonInheritableTag("string_tag", "value");
+        span.AddNonInheritableTag(tracing::kErrorFlag, true);
+    }
+
+    while (GetService2().spans.size() < 1) {
+        engine::SleepFor(std::chrono::milliseconds(10));
+    }
+
+    const auto& span = GetService2().spans[0];
+    EXPECT_EQ(span.name(), "span_with_tags");
+    EXPECT_EQ(span.status().code(), ::opentelemetry::proto::trace::v1::Status::STATUS_CODE_ERROR);
+
+    std::unordered_map<std::string, ::opentelemetry::proto::common::v1::AnyValue> attributes;
+    for (const auto& attribute : span.attributes()) {
+        attributes.emplace(attribute.key(), attribute.value());
+    }
+    ASSERT_EQ(attributes.count("int_tag"), 1);
+    EXPECT_EQ(attributes["int_tag"].int_value(), 42);
+    ASSERT_EQ(attributes.count("string_tag"), 1);
+    EXPECT_EQ(attributes["string_tag"].string_value(), "value");
+}
+
 USERVER_NAMESPACE_END
@@ -0,0 +1,211 @@
+#pragma once
+
+/// @file userver/storages/postgres/copy.hpp
+/// @brief Streaming bulk data transfer with `COPY ... (FORMAT binary)`
+
+#include <limits>
+#include <memory>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <userver/storages/postgres/io/field_buffer.hpp>
+#include <userver/storages/postgres/io/row_types.hpp>
+#include <userver/storages/postgres/io/supported_types.hpp>
+#include <userver/storages/postgres/io/user_types.hpp>
+#include <userver/storages/postgres/options.hpp>
+#include <userver/storages/postgres/postgres_fwd.hpp>
+#include <userver/storages/postgres/query.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres {
+
+/// @brief Writes rows to a `COPY table [(columns)] FROM STDIN (FORMAT binary)`
+/// statement.
+///
+/// Rows are serialized with the same formatters as query parameters and are
+/// sent to the server in batches, so that memory consumption does not depend
+/// on the number of rows. The server applies the data only after Finish() is
+/// called; a writer destroyed without Finish() aborts the COPY and the
+/// statement fails.
+///
+/// The connection can not be used for other statements until the writer is
+/// finished or destroyed.
+///
+/// @code
+/// auto writer = trx.CopyFrom("COPY foo (id, name) FROM STDIN (FORMAT binary)");
+/// for (const auto& [id, name] : data) {
+///   writer.WriteRow(id, name);
+/// }
+/// writer.Finish();
+/// @endcode
+class CopyWriter {
+public:
+    CopyWriter(detail::Connection* conn, const Query& query, OptionalCommandControl cmd_ctl = {});
+
+    CopyWriter(CopyWriter&&) noexcept;
+    CopyWriter& operator=(CopyWriter&&) noexcept;
+
+    CopyWriter(const CopyWriter&) = delete;
+    CopyWriter& operator=(const CopyWriter&) = delete;
+
+    ~CopyWriter();
+
+    /// Write a row, one argument per column in the order of the column list
+    /// of the COPY statement
+    template <typename... Columns>
+    void WriteRow(const Columns&... columns);
+
+    /// Write a row from a row type (tuple, aggregate or a type with
+    /// Introspect method), one data member per column
+    template <typename T>
+    void WriteRow(const T& row, RowTag);
+
+    /// Write all the rows of a container of row types
+    template <typename Container>
+    void WriteRows(const Container& rows);
+
+    /// Send the rest of the data and complete the COPY statement.
+    /// @returns the number of rows written
+    std::size_t Finish();
+
+    std::size_t RowsWritten() const;
+
+private:
+    using BufferType = std::vector<char>;
+
+    const UserTypes& GetUserTypes() const;
+    BufferType& GetBuffer();
+    /// Accounts the row that was serialized to the buffer and sends the buffer
+    /// if it has grown large enough
+    void RowWritten();
+
+    template <typename Tuple, std::size_t... Indexes>
+    void WriteTuple(const Tuple& tuple, std::index_sequence<Indexes...>) {
+        WriteRow(std::get<Indexes>(tuple)...);
+    }
+
+    struct Impl;
+    std::unique_ptr<Impl> pimpl_;
+};
+
+/// @brief Reads rows of a `COPY {table | (query)} TO STDOUT (FORMAT binary)`
+/// statement.
+///
+/// Rows are received from the server one by one, without materializing the
+/// whole result set. There is no row description in binary COPY data, so the
+/// column types are deduced from the C++ types passed to ReadRow().
+///
+/// The connection can not be used for other statements until all the rows are
+/// read or the reader is destroyed. Destroying the reader earlier cancels the
+/// statement.
+///
+/// @code
+/// auto reader = trx.CopyTo("COPY foo (id, name) TO STDOUT (FORMAT binary)");
+/// int id{};
+/// std::string name;
+/// while (reader.ReadRow(id, name)) {
+///   Process(id, name);
+/// }
+/// @endcode
+class CopyReader {
+public:
+    CopyReader(detail::Connection* conn, const Query& query, OptionalCommandControl cmd_ctl = {});
+
+    CopyReader(CopyReader&&) noexcept;
+    CopyReader& operator=(CopyReader&&) noexcept;
+
+    CopyReader(const CopyReader&) = delete;
+    CopyReader& operator=(const CopyReader&) = delete;
+
+    ~CopyReader();
+
+    /// Read the next row into variables, one per column.
+    /// @returns false if there are no more rows
+    /// @throws InvalidTupleSizeRequested if the number of columns doesn't match
+    template <typename... Columns>
+    bool ReadRow(Columns&... columns);
+
+    /// Read the next row into a row type (tuple, aggregate or a type with
+    /// Introspect method).
+    /// @returns false if there are no more rows
+    template <typename T>
+    bool ReadRow(T& row, RowTag);
+
+    /// @returns true if all the rows were read
+    bool Done() const;
+
+    std::size_t RowsRead() const;
+
+private:
+    const io::TypeBufferCategory& GetTypeBufferCategories() const;
+    /// Positions the buffer at the first field of the next row.
+    /// @returns false if there are no more rows
+    bool NextRow(std::size_t field_count, io::FieldBuffer& row);
+
+    template <typename Tuple, std::size_t... Indexes>
+    bool ReadTuple(Tuple&& tuple, std::index_sequence<Indexes...>) {
+        return ReadRow(std::get<Indexes>(tuple)...);
+    }
+
+    struct Impl;
+    std::unique_ptr<Impl> pimpl_;
+};
+
+template <typename... Columns>
+void CopyWriter::WriteRow(const Columns&... columns) {
+    static_assert(sizeof...(Columns) > 0, "A row must contain at least one column");
+    static_assert(
+        sizeof...(Columns) <= static_cast<std::size_t>(std::numeric_limits<Smallint>::max()),
+        "Too many columns in a row"
+    );
+    const auto& types = GetUserTypes();
+    auto& buffer = GetBuffer();
+    const auto row_start = buffer.size();
+    try {
+        io::WriteBuffer(types, buffer, static_cast<Smallint>(sizeof...(Columns)));
+        (io::WriteRawBinary(types, buffer, columns), ...);
+    } catch (const std::exception&) {
+        // Do not leave a partially serialized row in the buffer
+        buffer.resize(row_start);
+        throw;
+    }
+    RowWritten();
+}
+
+template <typename T>
+void CopyWriter::WriteRow(const T& row, RowTag) {
+    io::traits::AssertIsValidRowType<T>();
+    using RowType = io::RowType<T>;
+    WriteTuple(RowType::GetTuple(row), typename RowType::IndexSequence{});
+}
+
+template <typename Container>
+void CopyWriter::WriteRows(const Container& rows) {
+    for (const auto& row : rows) {
+        WriteRow(row, kRowTag);
+    }
+}
+
+template <typename... Columns>
+bool CopyReader::ReadRow(Columns&... columns) {
+    static_assert(sizeof...(Columns) > 0, "A row must contain at least one column");
+    io::FieldBuffer row;
+    if (!NextRow(sizeof...(Columns), row)) return false;
+
+    const auto& categories = GetTypeBufferCategories();
+    (row.ReadRaw(columns, categories, io::traits::kTypeBufferCategory<Columns>), ...);
+    return true;
+}
+
+template <typename T>
+bool CopyReader::ReadRow(T& row, RowTag) {
+    io::traits::AssertIsValidRowType<T>();
+    using RowType = io::RowType<T>;
+    return ReadTuple(RowType::GetTuple(row), typename RowType::IndexSequence{});
+}
+
+}  // namespace storages::postgres
+
+USERVER_NAMESPACE_END
@@ -6,6 +6,7 @@
 #include <memory>
 #include <string>
 
+#include <userver/storages/postgres/copy.hpp>
 #include <userver/storages/postgres/detail/connection_ptr.hpp>
 #include <userver/storages/postgres/detail/query_parameters.hpp>
 #include <userver/storages/postgres/detail/time_types.hpp>
@@ -293,6 +294,28 @@ public:
     /// and per-statement command control.
     Portal MakePortal(OptionalCommandControl statement_cmd_ctl, const Query& query, const ParameterStore& store);
 
+    /// Start a `COPY ... FROM STDIN (FORMAT binary)` statement to load rows
+    /// into a table. The fastest way to insert a large number of rows.
+    /// The transaction can not be used until the writer is finished or
+    /// destroyed.
+    CopyWriter CopyFrom(const Query& query) { return CopyFrom(OptionalCommandControl{}, query); }
+
+    /// Start a `COPY ... FROM STDIN (FORMAT binary)` statement with
+    /// per-statement command control. The execute timeout applies to every
+    /// chunk of data sent to the server.
+    CopyWriter CopyFrom(OptionalCommandControl statement_cmd_ctl, const Query& query);
+
+    /// Start a `COPY ... TO STDOUT (FORMAT binary)` statement to stream rows of
+    /// a table or a query result without materializing them.
+    /// The transaction can not be used until all the rows are read or the
+    /// reader is destroyed.
+    CopyReader CopyTo(const Query& query) { return CopyTo(OptionalCommandControl{}, query); }
+
+    /// Start a `COPY ... TO STDOUT (FORMAT binary)` statement with
+    /// per-statement command control. The execute timeout applies to every
+    /// row received from the server.
+    CopyReader CopyTo(OptionalCommandControl statement_cmd_ctl, const Query& query);
+
     /// Set a connection parameter
     /// https://www.postgresql.org/docs/current/sql-set.html
     /// The parameter is set for this transaction only
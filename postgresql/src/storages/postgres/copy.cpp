@@ -0,0 +1,218 @@
+#include <userver/storages/postgres/copy.hpp>
+
+#include <cstring>
+#include <string_view>
+
+#include <storages/postgres/detail/connection.hpp>
+#include <userver/storages/postgres/exceptions.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres {
+
+namespace {
+
+// https://www.postgresql.org/docs/current/sql-copy.html#id-1.9.3.55.9.4
+constexpr std::string_view kBinaryCopySignature{"PGCOPY\n\377\r\n\0", 11};
+// Bit 16 of the header flags field
+constexpr Integer kBinaryCopyHasOids = 1 << 16;
+constexpr Smallint kBinaryCopyTrailer = -1;
+
+// Rows are accumulated up to this size before being sent to the server.
+// Larger chunks do not make COPY noticeably faster, but take more memory.
+constexpr std::size_t kCopyChunkSize = 64 * 1024;
+
+}  // namespace
+
+struct CopyWriter::Impl {
+    detail::Connection* conn{nullptr};
+    BufferType buffer;
+    std::size_t rows_written{0};
+    bool done{false};
+
+    Impl(detail::Connection* conn, const Query& query, OptionalCommandControl cmd_ctl) : conn{conn} {
+        UASSERT(conn);
+        if (!cmd_ctl) {
+            cmd_ctl = conn->GetQueryCmdCtl(query.GetName());
+        }
+        conn->CopyStart(query, detail::Connection::CopyDirection::kFromStdin, std::move(cmd_ctl));
+
+        buffer.reserve(kCopyChunkSize);
+        buffer.insert(buffer.end(), kBinaryCopySignature.begin(), kBinaryCopySignature.end());
+        const auto& types = conn->GetUserTypes();
+        io::WriteBuffer(types, buffer, Integer{0});  // flags
+        io::WriteBuffer(types, buffer, Integer{0});  // header extension length
+    }
+
+    ~Impl() {
+        if (!done) {
+            // The server discards all the data sent so far
+            conn->CopyCancel();
+        }
+    }
+
+    void Send() {
+        try {
+            conn->CopyPutData(std::string_view{buffer.data(), buffer.size()});
+        } catch (const std::exception&) {
+            // The connection has already left the COPY mode
+            done = true;
+            throw;
+        }
+        buffer.clear();
+    }
+
+    std::size_t Finish() {
+        if (done) {
+            throw LogicError{"COPY is already finished"};
+        }
+        io::WriteBuffer(conn->GetUserTypes(), buffer, kBinaryCopyTrailer);
+        Send();
+        done = true;
+        conn->CopyFinish();
+        return rows_written;
+    }
+};
+
+CopyWriter::CopyWriter(detail::Connection* conn, const Query& query, OptionalCommandControl cmd_ctl)
+    : pimpl_(std::make_unique<Impl>(conn, query, std::move(cmd_ctl))) {}
+
+CopyWriter::CopyWriter(CopyWriter&&) noexcept = default;
+CopyWriter& CopyWriter::operator=(CopyWriter&&) noexcept = default;
+CopyWriter::~CopyWriter() = default;
+
+std::size_t CopyWriter::Finish() { return pimpl_->Finish(); }
+
+std::size_t CopyWriter::RowsWritten() const { return pimpl_->rows_written; }
+
+const UserTypes& CopyWriter::GetUserTypes() const { return pimpl_->conn->GetUserTypes(); }
+
+CopyWriter::BufferType& CopyWriter::GetBuffer() {
+    if (pimpl_->done) {
+        throw LogicError{"Writing to a finished COPY"};
+    }
+    return pimpl_->buffer;
+}
+
+void CopyWriter::RowWritten() {
+    ++pimpl_->rows_written;
+    if (pimpl_->buffer.size() >= kCopyChunkSize) {
+        pimpl_->Send();
+    }
+}
+
+struct CopyReader::Impl {
+    detail::Connection* conn{nullptr};
+    std::string message;
+    std::size_t rows_read{0};
+    bool header_read{false};
+    bool done{false};
+
+    Impl(detail::Connection* conn, const Query& query, OptionalCommandControl cmd_ctl) : conn{conn} {
+        UASSERT(conn);
+        if (!cmd_ctl) {
+            cmd_ctl = conn->GetQueryCmdCtl(query.GetName());
+        }
+        conn->CopyStart(query, detail::Connection::CopyDirection::kToStdout, std::move(cmd_ctl));
+    }
+
+    ~Impl() {
+        if (!done) {
+            conn->CopyCancel();
+        }
+    }
+
+    bool GetData(std::string& data) {
+        try {
+            return conn->CopyGetData(data);
+        } catch (const std::exception&) {
+            // The connection has already left the COPY mode
+            done = true;
+            throw;
+        }
+    }
+
+    static void ReadHeader(io::FieldBuffer& buffer) {
+        if (buffer.length < kBinaryCopySignature.size() ||
+            std::memcmp(buffer.buffer, kBinaryCopySignature.data(), kBinaryCopySignature.size()) != 0) {
+            throw InvalidBinaryBuffer{"COPY data doesn't start with the binary format signature"};
+        }
+        buffer = buffer.GetSubBuffer(kBinaryCopySignature.size());
+
+        Integer flags{0};
+        buffer.Read(flags, io::BufferCategory::kPlainBuffer);
+        if (flags & kBinaryCopyHasOids) {
+            throw InvalidBinaryBuffer{"COPY data with OIDs is not supported"};
+        }
+        Integer extension_length{0};
+        buffer.Read(extension_length, io::BufferCategory::kPlainBuffer);
+        if (extension_length < 0) {
+            throw InvalidBinaryBuffer{"Negative COPY header extension length"};
+        }
+        buffer = buffer.GetSubBuffer(extension_length);
+    }
+
+    bool NextRow(std::size_t field_count, io::FieldBuffer& row) {
+        if (done) return false;
+
+        if (!GetData(message)) {
+            // The server always sends the trailer before ending the data, but
+            // there is nothing to read anyway
+            Finish();
+            return false;
+        }
+        io::FieldBuffer buffer{
+            false,
+            io::BufferCategory::kPlainBuffer,
+            message.size(),
+            reinterpret_cast<const std::uint8_t*>(message.data())};
+        if (!header_read) {
+            ReadHeader(buffer);
+            header_read = true;
+        }
+
+        Smallint row_field_count{0};
+        buffer.Read(row_field_count, io::BufferCategory::kPlainBuffer);
+        if (row_field_count == kBinaryCopyTrailer) {
+            // No data is expected after the trailer, just wait for the end
+            while (GetData(message)) {
+            }
+            Finish();
+            return false;
+        }
+        if (row_field_count < 0 || static_cast<std::size_t>(row_field_count) != field_count) {
+            throw InvalidTupleSizeRequested(row_field_count, field_count);
+        }
+
+        ++rows_read;
+        row = buffer;
+        return true;
+    }
+
+    void Finish() {
+        done = true;
+        conn->CopyFinish();
+    }
+};
+
+CopyReader::CopyReader(detail::Connection* conn, const Query& query, OptionalCommandControl cmd_ctl)
+    : pimpl_(std::make_unique<Impl>(conn, query, std::move(cmd_ctl))) {}
+
+CopyReader::CopyReader(CopyReader&&) noexcept = default;
+CopyReader& CopyReader::operator=(CopyReader&&) noexcept = default;
+CopyReader::~CopyReader() = default;
+
+bool CopyReader::Done() const { return pimpl_->done; }
+
+std::size_t CopyReader::RowsRead() const { return pimpl_->rows_read; }
+
+const io::TypeBufferCategory& CopyReader::GetTypeBufferCategories() const {
+    return pimpl_->conn->GetUserTypes().GetTypeBufferCategories();
+}
+
+bool CopyReader::NextRow(std::size_t field_count, io::FieldBuffer& row) { return pimpl_->NextRow(field_count, row); }
+
+}  // namespace storages::postgres
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,111 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+#include <storages/postgres/detail/connection.hpp>
+#include <userver/storages/postgres/copy.hpp>
+
+#include <storages/postgres/util_benchmark.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+namespace pg = storages::postgres;
+using namespace pg::bench;
+
+const pg::Query kCreateTable{"create temporary table if not exists copy_bench(id integer, name text)"};
+const pg::Query kTruncateTable{"truncate copy_bench"};
+
+std::vector<int> MakeIds(std::size_t size) {
+    std::vector<int> ids(size);
+    for (std::size_t i = 0; i < size; ++i) ids[i] = static_cast<int>(i);
+    return ids;
+}
+
+std::vector<std::string> MakeNames(std::size_t size) {
+    std::vector<std::string> names(size);
+    for (std::size_t i = 0; i < size; ++i) names[i] = "name " + std::to_string(i);
+    return names;
+}
+
+BENCHMARK_DEFINE_F(PgConnection, CopyFromStdin)(benchmark::State& state) {
+    RunStandalone(state, [this, &state] {
+        const auto ids = MakeIds(state.range(0));
+        const auto names = MakeNames(state.range(0));
+        GetConnection().Execute(kCreateTable);
+        for (auto _ : state) {
+            pg::CopyWriter writer{&GetConnection(), "copy copy_bench (id, name) from stdin (format binary)"};
+            for (std::size_t i = 0; i < ids.size(); ++i) {
+                writer.WriteRow(ids[i], names[i]);
+            }
+            writer.Finish();
+
+            state.PauseTiming();
+            GetConnection().Execute(kTruncateTable);
+            state.ResumeTiming();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    });
+}
+BENCHMARK_REGISTER_F(PgConnection, CopyFromStdin)->RangeMultiplier(10)->Range(100, 100'000);
+
+BENCHMARK_DEFINE_F(PgConnection, InsertUnnestArrays)(benchmark::State& state) {
+    RunStandalone(state, [this, &state] {
+        const auto ids = MakeIds(state.range(0));
+        const auto names = MakeNames(state.range(0));
+        GetConnection().Execute(kCreateTable);
+        for (auto _ : state) {
+            GetConnection().Execute(
+                "insert into copy_bench (id, name) select * from unnest($1::integer[], $2::text[])", ids, names
+            );
+
+            state.PauseTiming();
+            GetConnection().Execute(kTruncateTable);
+            state.ResumeTiming();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    });
+}
+BENCHMARK_REGISTER_F(PgConnection, InsertUnnestArrays)->RangeMultiplier(10)->Range(100, 100'000);
+
+BENCHMARK_DEFINE_F(PgConnection, CopyToStdout)(benchmark::State& state) {
+    RunStandalone(state, [this, &state] {
+        const pg::Query query{
+            "copy (select i, 'name ' || i from generate_series(1, " + std::to_string(state.range(0)) +
+            ") i) to stdout (format binary)"};
+        for (auto _ : state) {
+            pg::CopyReader reader{&GetConnection(), query};
+            int id{};
+            std::string name;
+            while (reader.ReadRow(id, name)) {
+                benchmark::DoNotOptimize(name);
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    });
+}
+BENCHMARK_REGISTER_F(PgConnection, CopyToStdout)->RangeMultiplier(10)->Range(100, 100'000);
+
+BENCHMARK_DEFINE_F(PgConnection, SelectResultSet)(benchmark::State& state) {
+    RunStandalone(state, [this, &state] {
+        const pg::Query query{
+            "select i, 'name ' || i from generate_series(1, " + std::to_string(state.range(0)) + ") i"};
+        for (auto _ : state) {
+            const auto res = GetConnection().Execute(query);
+            int id{};
+            std::string name;
+            for (const auto& row : res) {
+                row.To(id, name);
+                benchmark::DoNotOptimize(name);
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    });
+}
+BENCHMARK_REGISTER_F(PgConnection, SelectResultSet)->RangeMultiplier(10)->Range(100, 100'000);
+
+}  // namespace
+
+USERVER_NAMESPACE_END
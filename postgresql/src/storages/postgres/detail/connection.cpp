@@ -174,6 +174,18 @@ void Connection::ReloadUserTypes() { pimpl_->LoadUserTypes(); }
 
 const UserTypes& Connection::GetUserTypes() const { return pimpl_->GetUserTypes(); }
 
+void Connection::CopyStart(const Query& query, CopyDirection direction, OptionalCommandControl statement_cmd_ctl) {
+    pimpl_->CopyStart(query, direction, std::move(statement_cmd_ctl));
+}
+
+void Connection::CopyPutData(std::string_view data) { pimpl_->CopyPutData(data); }
+
+bool Connection::CopyGetData(std::string& data) { return pimpl_->CopyGetData(data); }
+
+ResultSet Connection::CopyFinish() { return pimpl_->CopyFinish(); }
+
+void Connection::CopyCancel() noexcept { pimpl_->CopyCancel(); }
+
 void Connection::Listen(std::string_view channel, OptionalCommandControl cmd_ctl) { pimpl_->Listen(channel, cmd_ctl); }
 
 void Connection::Unlisten(std::string_view channel, OptionalCommandControl cmd_ctl) {
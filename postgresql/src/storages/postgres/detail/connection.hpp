@@ -52,6 +52,12 @@ public:
                       //!< finished
     };
 
+    /// Direction of a COPY statement
+    enum class CopyDirection {
+        kFromStdin,  //!< COPY ... FROM STDIN, the client sends the data
+        kToStdout,   //!< COPY ... TO STDOUT, the server sends the data
+    };
+
     /// Strong typedef for IDs assigned to prepared statements
     using StatementId = USERVER_NAMESPACE::utils::StrongTypedef<struct StatementIdTag, std::size_t>;
 
@@ -281,6 +287,19 @@ public:
     void ReloadUserTypes();
     const UserTypes& GetUserTypes() const;
 
+    /// @brief Start a binary COPY statement, the connection stays in COPY mode
+    /// until CopyFinish or CopyCancel is called
+    void CopyStart(const Query& query, CopyDirection direction, OptionalCommandControl statement_cmd_ctl = {});
+    /// Send a chunk of COPY FROM STDIN data
+    void CopyPutData(std::string_view data);
+    /// Receive a row of COPY TO STDOUT data, returns false when there are no
+    /// more rows
+    bool CopyGetData(std::string& data);
+    /// Finish the COPY statement and return its result
+    ResultSet CopyFinish();
+    /// Abort the COPY statement if one is in progress, never throws
+    void CopyCancel() noexcept;
+
     void Listen(std::string_view channel, OptionalCommandControl);
     void Unlisten(std::string_view channel, OptionalCommandControl);
 
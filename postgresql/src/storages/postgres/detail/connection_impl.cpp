@@ -172,6 +172,7 @@ constexpr std::string_view kCommands[] = {
     "begin",
     "commit",
     "rollback",
+    "copy",
 };
 
 }  // namespace
@@ -512,6 +513,116 @@ ResultSet ConnectionImpl::PortalExecute(
     );
 }
 
+void ConnectionImpl::CopyStart(
+    const Query& query,
+    Connection::CopyDirection direction,
+    OptionalCommandControl statement_cmd_ctl
+) {
+    CheckBusy();
+    const auto network_timeout = ExecuteTimeout(statement_cmd_ctl);
+    const auto deadline = testsuite_pg_ctl_.MakeExecuteDeadline(network_timeout);
+    SetStatementTimeout(std::move(statement_cmd_ctl));
+    CheckDeadlineReached(deadline);
+
+    tracing::Span span{FindQueryShortInfo(scopes::kCopy, query.Statement())};
+    conn_wrapper_.FillSpanTags(span, {network_timeout, GetStatementTimeout()});
+    query.FillSpanTags(span);
+    if (testsuite::AreTestpointsAvailable() && query.GetName()) {
+        ReportStatement(query.GetName()->GetUnderlying());
+    }
+    auto scope = span.CreateScopeTime();
+
+    // COPY is not allowed in pipeline mode
+    const bool restore_pipeline_mode = IsPipelineActive();
+    if (restore_pipeline_mode) {
+        try {
+            if (conn_wrapper_.IsSyncingPipeline()) {
+                // Collect the results of the statements sent before, e.g. BEGIN
+                conn_wrapper_.WaitResult(deadline, scope, nullptr);
+            }
+            conn_wrapper_.ExitPipelineMode();
+        } catch (const std::exception&) {
+            span.AddTag(tracing::kErrorFlag, true);
+            throw;
+        }
+    }
+
+    ++stats_.execute_total;
+    copy_state_.emplace(CopyState{
+        direction, query.Statement(), network_timeout, SteadyClock::now(), std::move(span), restore_pipeline_mode});
+
+    try {
+        conn_wrapper_.SendQuery(query.Statement(), scope);
+        conn_wrapper_.WaitCopyStart(
+            deadline, scope, direction == Connection::CopyDirection::kFromStdin ? PGRES_COPY_IN : PGRES_COPY_OUT
+        );
+    } catch (const std::exception&) {
+        HandleCopyError(/*connection_left_in_copy_mode=*/false);
+        throw;
+    }
+}
+
+void ConnectionImpl::CopyPutData(std::string_view data) {
+    UASSERT(copy_state_ && copy_state_->direction == Connection::CopyDirection::kFromStdin);
+    const auto deadline = testsuite_pg_ctl_.MakeExecuteDeadline(copy_state_->network_timeout);
+    auto scope = copy_state_->span.CreateScopeTime();
+    try {
+        conn_wrapper_.PutCopyData(data, deadline, scope);
+    } catch (const std::exception&) {
+        HandleCopyError(/*connection_left_in_copy_mode=*/true);
+        throw;
+    }
+}
+
+bool ConnectionImpl::CopyGetData(std::string& data) {
+    UASSERT(copy_state_ && copy_state_->direction == Connection::CopyDirection::kToStdout);
+    const auto deadline = testsuite_pg_ctl_.MakeExecuteDeadline(copy_state_->network_timeout);
+    auto scope = copy_state_->span.CreateScopeTime();
+    try {
+        return conn_wrapper_.GetCopyData(data, deadline, scope);
+    } catch (const std::exception&) {
+        HandleCopyError(/*connection_left_in_copy_mode=*/true);
+        throw;
+    }
+}
+
+ResultSet ConnectionImpl::CopyFinish() {
+    UASSERT(copy_state_);
+    const auto deadline = testsuite_pg_ctl_.MakeExecuteDeadline(copy_state_->network_timeout);
+    auto scope = copy_state_->span.CreateScopeTime();
+    try {
+        if (copy_state_->direction == Connection::CopyDirection::kFromStdin) {
+            conn_wrapper_.PutCopyEnd(nullptr, deadline, scope);
+        }
+        auto res = conn_wrapper_.WaitResult(deadline, scope, nullptr);
+        EndCopy(/*success=*/true);
+        return res;
+    } catch (const std::exception&) {
+        HandleCopyError(/*connection_left_in_copy_mode=*/false);
+        throw;
+    }
+}
+
+void ConnectionImpl::CopyCancel() noexcept {
+    if (!copy_state_) return;
+
+    const auto deadline = testsuite_pg_ctl_.MakeExecuteDeadline(copy_state_->network_timeout);
+    auto scope = copy_state_->span.CreateScopeTime();
+    try {
+        if (copy_state_->direction == Connection::CopyDirection::kFromStdin) {
+            conn_wrapper_.AbortCopy(PGRES_COPY_IN, "COPY was cancelled by the client", deadline, scope);
+        } else {
+            // Stop the server from sending the rest of the data
+            Cancel();
+            conn_wrapper_.AbortCopy(PGRES_COPY_OUT, nullptr, deadline, scope);
+        }
+    } catch (const std::exception& e) {
+        LOG_LIMITED_WARNING() << "Failed to cancel COPY statement `" << copy_state_->statement << "`: " << e;
+        MarkAsBroken();
+    }
+    EndCopy(/*success=*/false);
+}
+
 void ConnectionImpl::Listen(std::string_view channel, OptionalCommandControl cmd_ctl) {
     ExecuteCommandNoPrepare(
         fmt::format(kStatementListen, conn_wrapper_.EscapeIdentifier(channel)),
@@ -1067,6 +1178,51 @@ ResultSet ConnectionImpl::WaitResult(
 
 void ConnectionImpl::Cancel() { conn_wrapper_.Cancel().Wait(); }
 
+void ConnectionImpl::EndCopy(bool success) {
+    UASSERT(copy_state_);
+    const auto now = SteadyClock::now();
+    if (!success) {
+        ++stats_.error_execute_total;
+        copy_state_->span.AddTag(tracing::kErrorFlag, true);
+    }
+    stats_.sum_query_duration += now - copy_state_->start_time;
+    stats_.last_execute_finish = now;
+
+    const bool restore_pipeline_mode = copy_state_->restore_pipeline_mode;
+    copy_state_.reset();
+
+    if (restore_pipeline_mode && !IsBroken()) {
+        try {
+            conn_wrapper_.EnterPipelineMode();
+        } catch (const std::exception&) {
+            MarkAsBroken();
+        }
+    }
+}
+
+void ConnectionImpl::HandleCopyError(bool connection_left_in_copy_mode) {
+    UASSERT(copy_state_);
+    try {
+        throw;
+    } catch (const ConnectionTimeoutError& e) {
+        ++stats_.execute_timeout;
+        LOG_LIMITED_WARNING() << "Statement `" << copy_state_->statement << "` network timeout error: " << e << ". "
+                              << "Network timeout was " << copy_state_->network_timeout.count() << "ms";
+    } catch (const QueryCancelled& e) {
+        ++stats_.execute_timeout;
+        LOG_LIMITED_WARNING() << "Statement `" << copy_state_->statement << "` was cancelled: " << e
+                              << ". Statement timeout was " << current_statement_timeout_.count() << "ms";
+    } catch (const std::exception&) {
+    }
+
+    if (connection_left_in_copy_mode) {
+        // There is no way to tell how much data was sent or received, the
+        // connection can not be reused
+        MarkAsBroken();
+    }
+    EndCopy(/*success=*/false);
+}
+
 void ConnectionImpl::ReportStatement(const std::string& name) {
     // Only report statement usage once.
     {
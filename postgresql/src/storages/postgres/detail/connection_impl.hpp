@@ -116,6 +116,12 @@ public:
         OptionalCommandControl statement_cmd_ctl
     );
 
+    void CopyStart(const Query& query, Connection::CopyDirection direction, OptionalCommandControl statement_cmd_ctl);
+    void CopyPutData(std::string_view data);
+    bool CopyGetData(std::string& data);
+    ResultSet CopyFinish();
+    void CopyCancel() noexcept;
+
     void Listen(std::string_view channel, OptionalCommandControl);
     void Unlisten(std::string_view channel, OptionalCommandControl);
     Notification WaitNotify(engine::Deadline deadline);
@@ -139,6 +145,15 @@ private:
 
     struct ResetTransactionCommandControl;
 
+    struct CopyState {
+        Connection::CopyDirection direction;
+        std::string statement;
+        TimeoutDuration network_timeout;
+        SteadyClock::time_point start_time;
+        tracing::Span span;
+        bool restore_pipeline_mode;
+    };
+
     void CheckBusy() const;
     void CheckDeadlineReached(const engine::Deadline& deadline);
     tracing::Span MakeQuerySpan(const Query& query, const CommandControl& cc) const;
@@ -200,6 +215,12 @@ private:
 
     void Cancel();
 
+    /// Accounts the COPY statement in stats and leaves the COPY state
+    void EndCopy(bool success);
+    /// Handles an exception thrown during a COPY, must be called from a catch
+    /// block
+    void HandleCopyError(bool connection_left_in_copy_mode);
+
     void ReportStatement(const std::string& name);
 
     bool IsOmitDescribeInExecuteEnabled() const;
@@ -220,6 +241,7 @@ private:
     testsuite::PostgresControl testsuite_pg_ctl_;
     OptionalCommandControl transaction_cmd_ctl_;
     TimeoutDuration current_statement_timeout_{};
+    std::optional<CopyState> copy_state_;
     const error_injection::Settings ei_settings_;
 
     std::unordered_set<std::string> statements_reported_;
@@ -542,6 +542,120 @@ ResultSet PGConnectionWrapper::WaitResult(Deadline deadline, tracing::ScopeTime&
     return MakeResult(std::move(handle));
 }
 
+void PGConnectionWrapper::WaitCopyStart(Deadline deadline, tracing::ScopeTime& scope, ExecStatusType expected_status) {
+    UASSERT(expected_status == PGRES_COPY_IN || expected_status == PGRES_COPY_OUT);
+    scope.Reset(scopes::kLibpqWaitResult);
+    Flush(deadline);
+
+    auto handle = MakeResultHandle(ReadResult(deadline, nullptr));
+    const auto status = handle ? PQresultStatus(handle.get()) : PGRES_EMPTY_QUERY;
+    switch (status) {
+        case PGRES_COPY_IN:
+        case PGRES_COPY_OUT:
+            if (status != expected_status) {
+                AbortCopy(status, "COPY direction mismatch", deadline, scope);
+                throw LogicError{
+                    expected_status == PGRES_COPY_IN ? "Statement is not a COPY FROM STDIN"
+                                                     : "Statement is not a COPY TO STDOUT"};
+            }
+            if (!PQbinaryTuples(handle.get())) {
+                AbortCopy(status, "COPY text format is not supported", deadline, scope);
+                throw LogicError{"Only COPY with (FORMAT binary) is supported"};
+            }
+            return;
+        case PGRES_COPY_BOTH:
+            PGCW_LOG_LIMITED_ERROR() << "PostgreSQL COPY BOTH mode is not supported";
+            CloseWithError(NotImplemented{"Copy both is not implemented"});
+        default:
+            break;
+    }
+
+    // Throws on errors
+    MakeResult(std::move(handle));
+    DiscardInput(deadline);
+    throw LogicError{"Statement is not a COPY command"};
+}
+
+void PGConnectionWrapper::PutCopyData(std::string_view data, Deadline deadline, tracing::ScopeTime& scope) {
+    scope.Reset(scopes::kLibpqPutCopyData);
+    while (true) {
+        const int put_res = PQputCopyData(conn_, data.data(), static_cast<int>(data.size()));
+        if (put_res > 0) break;
+        if (put_res < 0) {
+            HandleSocketPostClose();
+            throw CommandError(fmt::format("PQputCopyData execution error: {}", PQerrorMessage(conn_)));
+        }
+        // libpq output buffer is full, wait for the socket to accept the data
+        Flush(deadline);
+    }
+    // Sending the data right away makes the writer wait for the socket, which
+    // keeps the memory usage bounded for arbitrarily large COPY streams
+    Flush(deadline);
+    UpdateLastUse();
+}
+
+void PGConnectionWrapper::PutCopyEnd(const char* error_message, Deadline deadline, tracing::ScopeTime& scope) {
+    scope.Reset(scopes::kLibpqPutCopyEnd);
+    while (true) {
+        const int put_res = PQputCopyEnd(conn_, error_message);
+        if (put_res > 0) break;
+        if (put_res < 0) {
+            HandleSocketPostClose();
+            throw CommandError(fmt::format("PQputCopyEnd execution error: {}", PQerrorMessage(conn_)));
+        }
+        Flush(deadline);
+    }
+    Flush(deadline);
+    UpdateLastUse();
+}
+
+bool PGConnectionWrapper::GetCopyData(std::string& data, Deadline deadline, tracing::ScopeTime& scope) {
+    scope.Reset(scopes::kLibpqGetCopyData);
+    while (true) {
+        char* buffer = nullptr;
+        const int get_res = PQgetCopyData(conn_, &buffer, /*async=*/1);
+        if (get_res > 0) {
+            const std::unique_ptr<char, decltype(&PQfreemem)> buffer_guard{buffer, &PQfreemem};
+            data.assign(buffer, get_res);
+            return true;
+        }
+        if (get_res == -1) {
+            return false;
+        }
+        if (get_res < -1) {
+            HandleSocketPostClose();
+            throw CommandError(fmt::format("PQgetCopyData execution error: {}", PQerrorMessage(conn_)));
+        }
+
+        // A complete row is not available yet
+        if (!WaitSocketReadable(deadline)) {
+            if (engine::current_task::ShouldCancel()) {
+                throw ConnectionInterrupted("Task cancelled while receiving COPY data");
+            }
+            PGCW_LOG_LIMITED_WARNING() << "Timeout while receiving COPY data from PostgreSQL connection";
+            throw ConnectionTimeoutError("Timed out while receiving COPY data");
+        }
+        CheckError<CommandError>("PQconsumeInput", PQconsumeInput(conn_));
+        UpdateLastUse();
+    }
+}
+
+void PGConnectionWrapper::AbortCopy(
+    ExecStatusType status,
+    const char* reason,
+    Deadline deadline,
+    tracing::ScopeTime& scope
+) {
+    if (status == PGRES_COPY_IN) {
+        PutCopyEnd(reason, deadline, scope);
+    } else {
+        std::string discarded;
+        while (GetCopyData(discarded, deadline, scope)) {
+        }
+    }
+    DiscardInput(deadline);
+}
+
 Notification PGConnectionWrapper::WaitNotify(Deadline deadline) {
     auto notify = std::unique_ptr<PGnotify, decltype(&PQfreemem)>(PQnotifies(conn_), &PQfreemem);
     while (!notify) {
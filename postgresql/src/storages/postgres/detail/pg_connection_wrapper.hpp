@@ -109,6 +109,27 @@ public:
     /// @brief Wrapper for PQXSendPortalExecute
     void SendPortalExecute(const std::string& portal_name, std::uint32_t n_rows, tracing::ScopeTime&);
 
+    /// @brief Wait for the server to enter COPY mode after a COPY statement.
+    /// Throws if the statement failed, is not a COPY in the expected direction
+    /// or does not use the binary format. The connection leaves COPY mode in
+    /// the latter cases.
+    void WaitCopyStart(Deadline deadline, tracing::ScopeTime&, ExecStatusType expected_status);
+
+    /// @brief Wrapper for PQputCopyData, the data is flushed before returning
+    void PutCopyData(std::string_view data, Deadline deadline, tracing::ScopeTime&);
+
+    /// @brief Wrapper for PQputCopyEnd, a non-null error message aborts the COPY
+    void PutCopyEnd(const char* error_message, Deadline deadline, tracing::ScopeTime&);
+
+    /// @brief Wrapper for PQgetCopyData
+    /// Returns false after the last row was received, the result of the COPY
+    /// statement should be read with WaitResult after that.
+    bool GetCopyData(std::string& data, Deadline deadline, tracing::ScopeTime&);
+
+    /// @brief Leave COPY mode of the given status discarding all the data
+    /// and the result of the COPY statement
+    void AbortCopy(ExecStatusType status, const char* reason, Deadline deadline, tracing::ScopeTime&);
+
     /// @brief Wait for query result
     /// Will return result or throw an exception
     ResultSet WaitResult(Deadline deadline, tracing::ScopeTime&, const PGresult* description);
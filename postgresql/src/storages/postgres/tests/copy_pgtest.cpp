@@ -0,0 +1,172 @@
+#include <storages/postgres/tests/util_pgtest.hpp>
+
+#include <optional>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <storages/postgres/detail/connection.hpp>
+#include <userver/storages/postgres/copy.hpp>
+#include <userver/storages/postgres/exceptions.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace pg = storages::postgres;
+
+namespace {
+
+struct CopyRow {
+    int id{};
+    std::string name;
+    std::optional<double> value;
+};
+
+const pg::Query kCreateTable{
+    "create temporary table copy_test("
+    "id integer primary key, name text not null, value double precision)"};
+const pg::Query kCopyIn{"copy copy_test (id, name, value) from stdin (format binary)"};
+const pg::Query kCopyOut{"copy (select id, name, value from copy_test order by id) to stdout (format binary)"};
+
+}  // namespace
+
+UTEST_P(PostgreConnection, CopyRoundTrip) {
+    CheckConnection(GetConn());
+    GetConn()->Execute(kCreateTable);
+
+    constexpr int kRows = 10000;
+    {
+        pg::CopyWriter writer{GetConn().get(), kCopyIn};
+        for (int i = 0; i < kRows; ++i) {
+            writer.WriteRow(i, "row " + std::to_string(i), i % 3 ? std::optional<double>{i * 0.5} : std::nullopt);
+        }
+        EXPECT_EQ(kRows, writer.RowsWritten());
+        EXPECT_EQ(kRows, writer.Finish());
+    }
+    EXPECT_EQ(kRows, GetConn()->Execute("select count(*) from copy_test").AsSingleRow<pg::Bigint>());
+
+    pg::CopyReader reader{GetConn().get(), kCopyOut};
+    int id{};
+    std::string name;
+    std::optional<double> value;
+    int expected_id = 0;
+    while (reader.ReadRow(id, name, value)) {
+        EXPECT_EQ(expected_id, id);
+        EXPECT_EQ("row " + std::to_string(expected_id), name);
+        if (expected_id % 3) {
+            EXPECT_EQ(expected_id * 0.5, value);
+        } else {
+            EXPECT_FALSE(value);
+        }
+        ++expected_id;
+    }
+    EXPECT_EQ(kRows, expected_id);
+    EXPECT_TRUE(reader.Done());
+    EXPECT_EQ(kRows, reader.RowsRead());
+
+    // The connection is usable after the COPY
+    CheckConnection(GetConn());
+}
+
+UTEST_P(PostgreConnection, CopyRowTypes) {
+    CheckConnection(GetConn());
+    GetConn()->Execute(kCreateTable);
+
+    const std::vector<CopyRow> rows{{1, "one", 1.0}, {2, "two", std::nullopt}, {3, "three", 3.0}};
+    {
+        pg::CopyWriter writer{GetConn().get(), kCopyIn};
+        writer.WriteRows(rows);
+        writer.WriteRow(std::make_tuple(4, std::string{"four"}, std::optional<double>{4.0}), pg::kRowTag);
+        EXPECT_EQ(4, writer.Finish());
+    }
+
+    pg::CopyReader reader{GetConn().get(), kCopyOut};
+    std::vector<CopyRow> read_rows;
+    CopyRow row;
+    while (reader.ReadRow(row, pg::kRowTag)) {
+        read_rows.push_back(row);
+    }
+    ASSERT_EQ(4, read_rows.size());
+    for (std::size_t i = 0; i < rows.size(); ++i) {
+        EXPECT_EQ(rows[i].id, read_rows[i].id);
+        EXPECT_EQ(rows[i].name, read_rows[i].name);
+        EXPECT_EQ(rows[i].value, read_rows[i].value);
+    }
+    EXPECT_EQ("four", read_rows.back().name);
+}
+
+UTEST_P(PostgreConnection, CopyInTransaction) {
+    CheckConnection(GetConn());
+    GetConn()->Execute(kCreateTable);
+
+    UEXPECT_NO_THROW(GetConn()->Begin({}, pg::detail::SteadyClock::now()));
+    {
+        pg::CopyWriter writer{GetConn().get(), kCopyIn};
+        writer.WriteRow(1, std::string{"one"}, 1.0);
+        EXPECT_EQ(1, writer.Finish());
+    }
+    EXPECT_EQ(1, GetConn()->Execute("select count(*) from copy_test").AsSingleRow<pg::Bigint>());
+    UEXPECT_NO_THROW(GetConn()->Rollback());
+
+    EXPECT_EQ(0, GetConn()->Execute("select count(*) from copy_test").AsSingleRow<pg::Bigint>());
+}
+
+UTEST_P(PostgreConnection, CopyWriterAbandoned) {
+    CheckConnection(GetConn());
+    GetConn()->Execute(kCreateTable);
+
+    {
+        pg::CopyWriter writer{GetConn().get(), kCopyIn};
+        writer.WriteRow(1, std::string{"one"}, 1.0);
+        // Destroyed without Finish()
+    }
+    EXPECT_FALSE(GetConn()->IsBroken());
+    EXPECT_EQ(0, GetConn()->Execute("select count(*) from copy_test").AsSingleRow<pg::Bigint>());
+}
+
+UTEST_P(PostgreConnection, CopyReaderAbandoned) {
+    CheckConnection(GetConn());
+
+    {
+        pg::CopyReader reader{
+            GetConn().get(), "copy (select generate_series(1, 1000000)) to stdout (format binary)"};
+        int value{};
+        ASSERT_TRUE(reader.ReadRow(value));
+        EXPECT_EQ(1, value);
+        // Destroyed before all the rows are read
+    }
+    EXPECT_FALSE(GetConn()->IsBroken());
+    CheckConnection(GetConn());
+}
+
+UTEST_P(PostgreConnection, CopyErrors) {
+    CheckConnection(GetConn());
+    GetConn()->Execute(kCreateTable);
+
+    UEXPECT_THROW(pg::CopyReader(GetConn().get(), kCopyIn), pg::LogicError)
+        << "COPY FROM is not readable";
+    UEXPECT_THROW(pg::CopyWriter(GetConn().get(), kCopyOut), pg::LogicError)
+        << "COPY TO is not writable";
+    UEXPECT_THROW(pg::CopyReader(GetConn().get(), "copy copy_test to stdout"), pg::LogicError)
+        << "Only the binary format is supported";
+    UEXPECT_THROW(pg::CopyReader(GetConn().get(), "select 1"), pg::LogicError);
+    UEXPECT_THROW(pg::CopyWriter(GetConn().get(), "copy no_such_table from stdin (format binary)"), pg::Error);
+    CheckConnection(GetConn());
+
+    {
+        pg::CopyWriter writer{GetConn().get(), kCopyIn};
+        writer.WriteRow(1, std::string{"one"});
+        UEXPECT_THROW(writer.Finish(), pg::Error) << "Column count mismatch is detected by the server";
+    }
+    CheckConnection(GetConn());
+
+    GetConn()->Execute("insert into copy_test values (1, 'one', 1.0)");
+    {
+        pg::CopyReader reader{GetConn().get(), kCopyOut};
+        int id{};
+        std::string name;
+        UEXPECT_THROW(reader.ReadRow(id, name), pg::InvalidTupleSizeRequested);
+    }
+    CheckConnection(GetConn());
+}
+
+USERVER_NAMESPACE_END
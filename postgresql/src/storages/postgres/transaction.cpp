@@ -104,6 +104,28 @@ Portal Transaction::MakePortal(
     return Portal{conn_.get(), portal_name, query, params, std::move(statement_cmd_ctl)};
 }
 
+CopyWriter Transaction::CopyFrom(OptionalCommandControl statement_cmd_ctl, const Query& query) {
+    if (!conn_) {
+        LOG_LIMITED_ERROR() << "CopyFrom called after transaction finished" << logging::LogExtra::Stacktrace();
+        throw NotInTransaction("Transaction handle is not valid");
+    }
+    auto source = conn_.GetConfigSource();
+    if (source) CheckDeadlineIsExpired(source->GetSnapshot());
+
+    return CopyWriter{conn_.get(), query, std::move(statement_cmd_ctl)};
+}
+
+CopyReader Transaction::CopyTo(OptionalCommandControl statement_cmd_ctl, const Query& query) {
+    if (!conn_) {
+        LOG_LIMITED_ERROR() << "CopyTo called after transaction finished" << logging::LogExtra::Stacktrace();
+        throw NotInTransaction("Transaction handle is not valid");
+    }
+    auto source = conn_.GetConfigSource();
+    if (source) CheckDeadlineIsExpired(source->GetSnapshot());
+
+    return CopyReader{conn_.get(), query, std::move(statement_cmd_ctl)};
+}
+
 void Transaction::SetParameter(const std::string& param_name, const std::string& value) {
     if (!conn_) {
         LOG_LIMITED_ERROR() << "Set parameter called after transaction finished" << logging::LogExtra::Stacktrace();
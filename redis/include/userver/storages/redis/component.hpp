@@ -29,6 +29,7 @@ namespace storages {}
 /// Redis client
 namespace storages::redis {
 class Client;
+class ClientSideCache;
 class SubscribeClient;
 class SubscribeClientImpl;
 }  // namespace storages::redis
@@ -64,6 +65,11 @@ namespace components {
 /// groups.[].db | name to refer to the cluster in components::Redis::GetClient() | -
 /// groups.[].sharding_strategy | one of RedisCluster, KeyShardCrc32, KeyShardTaximeterCrc32 or KeyShardGpsStorageDriver | "KeyShardTaximeterCrc32"
 /// groups.[].allow_reads_from_master | allows read requests from master instance | false
+/// groups.[].client_side_cache.enabled | cache GET replies locally, invalidating them with `CLIENT TRACKING` (Redis 6.0+, not supported with RedisCluster) | false
+/// groups.[].client_side_cache.max_size | maximum number of cached keys | 100000
+/// groups.[].client_side_cache.ways | number of independently locked parts of the cache | 16
+/// groups.[].client_side_cache.ttl | entries older than that are never served, bounds staleness if an invalidation is lost | 10s
+/// groups.[].client_side_cache.prefixes | cache only the keys with one of the prefixes | all the keys
 /// subscribe_groups | array of redis clusters to work with in subscribe mode | -
 /// subscribe_groups.[].config_name | key name in secdist with options for this cluster | -
 /// subscribe_groups.[].db | name to refer to the cluster in components::Redis::GetSubscribeClient() | -
@@ -109,6 +115,21 @@ namespace components {
 /// }
 /// @endcode
 ///
+/// ## Client side caching
+///
+/// With `client_side_cache.enabled` the storages::redis::Client::Get() replies
+/// are kept in a local LRU cache. A dedicated subscriber connection to each
+/// shard enables `CLIENT TRACKING ... BCAST` and receives the invalidation
+/// messages for every modification of the cached keys, so hot keys are read
+/// from Redis only once per modification. Other commands are not cached.
+///
+/// Invalidations arrive asynchronously, so a reader may observe a value
+/// modified by another client a bit later than with a plain GET. Cache misses
+/// are always read from the master: a lagging replica could return a value
+/// that was already invalidated. The cache is flushed on every
+/// (re)subscription of the invalidation connection, as the invalidations sent
+/// while it was not subscribed are lost.
+///
 /// ## Cluster Redis setup
 ///
 /// Redis cluster is the new recommended way of setting up Redis servers
@@ -158,6 +179,7 @@ private:
     std::unordered_map<std::string, std::shared_ptr<redis::Sentinel>> sentinels_;
     std::unordered_map<std::string, std::shared_ptr<storages::redis::Client>> clients_;
     std::unordered_map<std::string, std::shared_ptr<storages::redis::SubscribeClientImpl>> subscribe_clients_;
+    std::unordered_map<std::string, std::shared_ptr<storages::redis::ClientSideCache>> client_side_caches_;
 
     dynamic_config::Source config_;
     concurrent::AsyncEventSubscriberScope config_subscription_;
@@ -2,6 +2,7 @@
 
 #include <userver/utils/assert.hpp>
 
+#include <storages/redis/client_side_cache.hpp>
 #include <storages/redis/impl/sentinel.hpp>
 
 #include "impl/command_control_impl.hpp"
@@ -35,13 +36,53 @@ void DoCheckShard(size_t shard, std::optional<size_t> force_shard_idx) {
         );
 }
 
+// Puts the reply to the client side cache once it is received
+class CachingGetRequestData final : public RequestDataBase<std::optional<std::string>> {
+public:
+    CachingGetRequestData(
+        USERVER_NAMESPACE::redis::Request&& request,
+        std::shared_ptr<ClientSideCache> cache,
+        std::string key,
+        ClientSideCache::Ticket ticket
+    )
+        : impl_(std::move(request)), cache_(std::move(cache)), key_(std::move(key)), ticket_(ticket) {}
+
+    ~CachingGetRequestData() override {
+        // Otherwise the key is never served from the cache until evicted
+        if (!is_fetch_finished_) cache_->CancelFetch(key_, ticket_);
+    }
+
+    void Wait() override { impl_.Wait(); }
+
+    std::optional<std::string> Get(const std::string& request_description) override {
+        auto value = impl_.Get(request_description);
+        cache_->FinishFetch(key_, ticket_, value);
+        is_fetch_finished_ = true;
+        return value;
+    }
+
+    ReplyPtr GetRaw() override { return impl_.GetRaw(); }
+
+    engine::impl::ContextAccessor* TryGetContextAccessor() noexcept override { return impl_.TryGetContextAccessor(); }
+
+private:
+    RequestDataImpl<std::optional<std::string>, std::optional<std::string>> impl_;
+    std::shared_ptr<ClientSideCache> cache_;
+    std::string key_;
+    ClientSideCache::Ticket ticket_;
+    bool is_fetch_finished_{false};
+};
+
 }  // namespace
 
 ClientImpl::ClientImpl(
     std::shared_ptr<USERVER_NAMESPACE::redis::Sentinel> sentinel,
-    std::optional<size_t> force_shard_idx
+    std::optional<size_t> force_shard_idx,
+    std::shared_ptr<ClientSideCache> client_side_cache
 )
-    : redis_client_(std::move(sentinel)), force_shard_idx_(force_shard_idx) {}
+    : redis_client_(std::move(sentinel)),
+      force_shard_idx_(force_shard_idx),
+      client_side_cache_(std::move(client_side_cache)) {}
 
 void ClientImpl::WaitConnectedOnce(USERVER_NAMESPACE::redis::RedisWaitConnected wait_connected) {
     redis_client_->WaitConnectedOnce(wait_connected);
@@ -57,7 +98,7 @@ const std::string& ClientImpl::GetAnyKeyForShard(size_t shard_idx) const {
 }
 
 std::shared_ptr<Client> ClientImpl::GetClientForShard(size_t shard_idx) {
-    return std::make_shared<ClientImpl>(redis_client_, shard_idx);
+    return std::make_shared<ClientImpl>(redis_client_, shard_idx, client_side_cache_);
 }
 
 std::optional<size_t> ClientImpl::GetForcedShardIdx() const { return force_shard_idx_; }
@@ -94,6 +135,7 @@ Request<ScanReplyTmpl<scan_tag>> ClientImpl::MakeScanRequestWithKey(
 
 RequestAppend ClientImpl::Append(std::string key, std::string value, const CommandControl& command_control) {
     auto shard = ShardByKey(key, command_control);
+    InvalidateCached(key);
     return CreateRequest<RequestAppend>(MakeRequest(
         CmdArgs{"append", std::move(key), std::move(value)}, shard, true, GetCommandControl(command_control)
     ));
@@ -106,6 +148,7 @@ RequestBitop ClientImpl::Bitop(
     const CommandControl& command_control
 ) {
     auto shard = ShardByKey(dest_key, command_control);
+    InvalidateCached(dest_key);
     const auto operation = ToString(op);
 
     return CreateRequest<RequestBitop>(MakeRequest(
@@ -124,6 +167,7 @@ RequestDbsize ClientImpl::Dbsize(size_t shard, const CommandControl& command_con
 
 RequestDecr ClientImpl::Decr(std::string key, const CommandControl& command_control) {
     auto shard = ShardByKey(key, command_control);
+    InvalidateCached(key);
     return CreateRequest<RequestDecr>(
         MakeRequest(CmdArgs{"decr", std::move(key)}, shard, true, GetCommandControl(command_control))
     );
@@ -131,6 +175,7 @@ RequestDecr ClientImpl::Decr(std::string key, const CommandControl& command_cont
 
 RequestDel ClientImpl::Del(std::string key, const CommandControl& command_control) {
     auto shard = ShardByKey(key, command_control);
+    InvalidateCached(key);
     return CreateRequest<RequestDel>(
         MakeRequest(CmdArgs{"del", std::move(key)}, shard, true, GetCommandControl(command_control))
     );
@@ -139,6 +184,7 @@ RequestDel ClientImpl::Del(std::string key, const CommandControl& command_contro
 RequestDel ClientImpl::Del(std::vector<std::string> keys, const CommandControl& command_control) {
     if (keys.empty()) return CreateDummyRequest<RequestDel>(std::make_shared<Reply>("del", 0));
     auto shard = ShardByKey(keys.at(0), command_control);
+    InvalidateCached(keys);
     return CreateRequest<RequestDel>(
         MakeRequest(CmdArgs{"del", std::move(keys)}, shard, true, GetCommandControl(command_control))
     );
@@ -146,6 +192,7 @@ RequestDel ClientImpl::Del(std::vector<std::string> keys, const CommandControl&
 
 RequestUnlink ClientImpl::Unlink(std::string key, const CommandControl& command_control) {
     auto shard = ShardByKey(key, command_control);
+    InvalidateCached(key);
     return CreateRequest<RequestUnlink>(
         MakeRequest(CmdArgs{"unlink", std::move(key)}, shard, true, GetCommandControl(command_control))
     );
@@ -154,6 +201,7 @@ RequestUnlink ClientImpl::Unlink(std::string key, const CommandControl& command_
 RequestUnlink ClientImpl::Unlink(std::vector<std::string> keys, const CommandControl& command_control) {
     if (keys.empty()) return CreateDummyRequest<RequestUnlink>(std::make_shared<Reply>("unlink", 0));
     auto shard = ShardByKey(keys.at(0), command_control);
+    InvalidateCached(keys);
     return CreateRequest<RequestUnlink>(
         MakeRequest(CmdArgs{"unlink", std::move(keys)}, shard, true, GetCommandControl(command_control))
     );
@@ -167,6 +215,7 @@ RequestEvalCommon ClientImpl::EvalCommon(
 ) {
     UASSERT(!keys.empty());
     auto shard = ShardByKey(keys.at(0), command_control);
+    InvalidateCached(keys);
     size_t keys_size = keys.size();
     return CreateRequest<RequestEvalCommon>(MakeRequest(
         CmdArgs{"eval", std::move(script), keys_size, std::move(keys), std::move(args)},
@@ -184,6 +233,7 @@ RequestEvalShaCommon ClientImpl::EvalShaCommon(
 ) {
     UASSERT(!keys.empty());
     auto shard = ShardByKey(keys.at(0), command_control);
+    InvalidateCached(keys);
     size_t keys_size = keys.size();
     return CreateRequest<RequestEvalShaCommon>(MakeRequest(
         CmdArgs{"evalsha", std::move(script_hash), keys_size, std::move(keys), std::move(args)},
@@ -216,6 +266,7 @@ RequestExists ClientImpl::Exists(std::vector<std::string> keys, const CommandCon
 
 RequestExpire ClientImpl::Expire(std::string key, std::chrono::seconds ttl, const CommandControl& command_control) {
     auto shard = ShardByKey(key, command_control);
+    InvalidateCached(key);
     return CreateRequest<RequestExpire>(
         MakeRequest(CmdArgs{"expire", std::move(key), ttl.count()}, shard, true, GetCommandControl(command_control))
     );
@@ -348,6 +399,21 @@ RequestGeosearch ClientImpl::Geosearch(
 
 RequestGet ClientImpl::Get(std::string key, const CommandControl& command_control) {
     auto shard = ShardByKey(key, command_control);
+    if (client_side_cache_ && client_side_cache_->IsCacheable(key)) {
+        if (auto cached = client_side_cache_->Get(key)) {
+            return CreateDummyRequest<RequestGet>(std::make_shared<Reply>(
+                "get",
+                *cached ? USERVER_NAMESPACE::redis::ReplyData(std::move(**cached))
+                        : USERVER_NAMESPACE::redis::ReplyData::CreateNil()
+            ));
+        }
+        const auto ticket = client_side_cache_->StartFetch(key);
+        // A lagging replica could return a value that is already invalidated
+        auto request = MakeRequest(CmdArgs{"get", key}, shard, /*master=*/true, GetCommandControl(command_control));
+        return RequestGet(
+            std::make_unique<CachingGetRequestData>(std::move(request), client_side_cache_, std::move(key), ticket)
+        );
+    }
     return CreateRequest<RequestGet>(
         MakeRequest(CmdArgs{"get", std::move(key)}, shard, false, GetCommandControl(command_control))
     );
@@ -355,6 +421,7 @@ RequestGet ClientImpl::Get(std::string key, const CommandControl& command_contro
 
 RequestGetset ClientImpl::Getset(std::string key, std::string value, const CommandControl& command_control) {
     auto shard = ShardByKey(key, command_control);
+    InvalidateCached(key);
     return CreateRequest<RequestGetset>(MakeRequest(
         CmdArgs{"getset", std::move(key), std::move(value)}, shard, true, GetCommandControl(command_control)
     ));
@@ -487,6 +554,7 @@ RequestHvals ClientImpl::Hvals(std::string key, const CommandControl& command_co
 
 RequestIncr ClientImpl::Incr(std::string key, const CommandControl& command_control) {
     auto shard = ShardByKey(key, command_control);
+    InvalidateCached(key);
     return CreateRequest<RequestIncr>(
         MakeRequest(CmdArgs{"incr", std::move(key)}, shard, true, GetCommandControl(command_control))
     );
@@ -590,6 +658,7 @@ ClientImpl::Mset(std::vector<std::pair<std::string, std::string>> key_values, co
             "mset", USERVER_NAMESPACE::redis::ReplyData::CreateStatus("OK")
         ));
     auto shard = ShardByKey(key_values.at(0).first, command_control);
+    for (const auto& key_value : key_values) InvalidateCached(key_value.first);
     return CreateRequest<RequestMset>(
         MakeRequest(CmdArgs{"mset", std::move(key_values)}, shard, true, GetCommandControl(command_control))
     );
@@ -611,6 +680,7 @@ RequestPersist ClientImpl::Persist(std::string key, const CommandControl& comman
 RequestPexpire
 ClientImpl::Pexpire(std::string key, std::chrono::milliseconds ttl, const CommandControl& command_control) {
     auto shard = ShardByKey(key, command_control);
+    InvalidateCached(key);
     return CreateRequest<RequestPexpire>(
         MakeRequest(CmdArgs{"pexpire", std::move(key), ttl.count()}, shard, true, GetCommandControl(command_control))
     );
@@ -659,6 +729,8 @@ RequestRename ClientImpl::Rename(std::string key, std::string new_key, const Com
         throw USERVER_NAMESPACE::redis::InvalidArgumentException(
             "shard of key != shard of new_key (" + std::to_string(shard) + " != " + std::to_string(new_shard) + ')'
         );
+    InvalidateCached(key);
+    InvalidateCached(new_key);
     return CreateRequest<RequestRename>(MakeRequest(
         CmdArgs{"rename", std::move(key), std::move(new_key)}, shard, true, GetCommandControl(command_control)
     ));
@@ -735,6 +807,7 @@ RequestScard ClientImpl::Scard(std::string key, const CommandControl& command_co
 
 RequestSet ClientImpl::Set(std::string key, std::string value, const CommandControl& command_control) {
     auto shard = ShardByKey(key, command_control);
+    InvalidateCached(key);
     return CreateRequest<RequestSet>(
         MakeRequest(CmdArgs{"set", std::move(key), std::move(value)}, shard, true, GetCommandControl(command_control))
     );
@@ -747,6 +820,7 @@ RequestSet ClientImpl::Set(
     const CommandControl& command_control
 ) {
     auto shard = ShardByKey(key, command_control);
+    InvalidateCached(key);
     return CreateRequest<RequestSet>(MakeRequest(
         CmdArgs{"set", std::move(key), std::move(value), "PX", ttl.count()},
         shard,
@@ -757,6 +831,7 @@ RequestSet ClientImpl::Set(
 
 RequestSetIfExist ClientImpl::SetIfExist(std::string key, std::string value, const CommandControl& command_control) {
     auto shard = ShardByKey(key, command_control);
+    InvalidateCached(key);
     return CreateRequest<RequestSetIfExist>(MakeRequest(
         CmdArgs{"set", std::move(key), std::move(value), "XX"}, shard, true, GetCommandControl(command_control)
     ));
@@ -769,6 +844,7 @@ RequestSetIfExist ClientImpl::SetIfExist(
     const CommandControl& command_control
 ) {
     auto shard = ShardByKey(key, command_control);
+    InvalidateCached(key);
     return CreateRequest<RequestSetIfExist>(MakeRequest(
         CmdArgs{"set", std::move(key), std::move(value), "PX", ttl.count(), "XX"},
         shard,
@@ -780,6 +856,7 @@ RequestSetIfExist ClientImpl::SetIfExist(
 RequestSetIfNotExist
 ClientImpl::SetIfNotExist(std::string key, std::string value, const CommandControl& command_control) {
     auto shard = ShardByKey(key, command_control);
+    InvalidateCached(key);
     return CreateRequest<RequestSetIfExist>(MakeRequest(
         CmdArgs{"set", std::move(key), std::move(value), "NX"}, shard, true, GetCommandControl(command_control)
     ));
@@ -792,6 +869,7 @@ RequestSetIfNotExist ClientImpl::SetIfNotExist(
     const CommandControl& command_control
 ) {
     auto shard = ShardByKey(key, command_control);
+    InvalidateCached(key);
     return CreateRequest<RequestSetIfExist>(MakeRequest(
         CmdArgs{"set", std::move(key), std::move(value), "PX", ttl.count(), "NX"},
         shard,
@@ -807,6 +885,7 @@ RequestSetex ClientImpl::Setex(
     const CommandControl& command_control
 ) {
     auto shard = ShardByKey(key, command_control);
+    InvalidateCached(key);
     return CreateRequest<RequestSetex>(MakeRequest(
         CmdArgs{"setex", std::move(key), seconds.count(), std::move(value)},
         shard,
@@ -1212,6 +1291,15 @@ void ClientImpl::CheckShard(size_t shard, const CommandControl& cc) const {
     DoCheckShard(shard, cc.force_shard_idx);
 }
 
+void ClientImpl::InvalidateCached(const std::string& key) {
+    if (client_side_cache_ && client_side_cache_->IsCacheable(key)) client_side_cache_->Invalidate(key);
+}
+
+void ClientImpl::InvalidateCached(const std::vector<std::string>& keys) {
+    if (!client_side_cache_) return;
+    for (const auto& key : keys) InvalidateCached(key);
+}
+
 template Request<ScanReplyTmpl<ScanTag::kSscan>> ClientImpl::MakeScanRequestWithKey(
     std::string key,
     size_t shard,
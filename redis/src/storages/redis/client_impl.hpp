@@ -23,6 +23,7 @@ class Sentinel;
 
 namespace storages::redis {
 
+class ClientSideCache;
 class TransactionImpl;
 
 // NOLINTNEXTLINE(fuchsia-multiple-inheritance)
@@ -30,7 +31,8 @@ class ClientImpl final : public Client, public std::enable_shared_from_this<Clie
 public:
     explicit ClientImpl(
         std::shared_ptr<USERVER_NAMESPACE::redis::Sentinel> sentinel,
-        std::optional<size_t> force_shard_idx = std::nullopt
+        std::optional<size_t> force_shard_idx = std::nullopt,
+        std::shared_ptr<ClientSideCache> client_side_cache = nullptr
     );
 
     void WaitConnectedOnce(USERVER_NAMESPACE::redis::RedisWaitConnected wait_connected) override;
@@ -468,9 +470,15 @@ private:
 
     void CheckShard(size_t shard, const CommandControl& cc) const;
 
+    // Must be called before sending a command that modifies or expires the keys,
+    // so that the command author never reads a value cached before it
+    void InvalidateCached(const std::string& key);
+    void InvalidateCached(const std::vector<std::string>& keys);
+
     std::shared_ptr<USERVER_NAMESPACE::redis::Sentinel> redis_client_;
     std::atomic<int> publish_shard_{0};
     const std::optional<size_t> force_shard_idx_;
+    const std::shared_ptr<ClientSideCache> client_side_cache_;
 };
 
 }  // namespace storages::redis
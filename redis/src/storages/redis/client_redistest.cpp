@@ -1,8 +1,13 @@
 #include <storages/redis/client_redistest.hpp>
 
+#include <chrono>
+
+#include <userver/engine/sleep.hpp>
 #include <userver/engine/task/cancel.hpp>
 #include <userver/engine/wait_any.hpp>
 
+#include <storages/redis/client_side_cache.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace {
@@ -861,4 +866,32 @@ UTEST_F(RedisClientTest, WaitAny) {
     EXPECT_EQ(finished, kReqCount);
 }
 
+UTEST_F(RedisClientTest, ClientSideCacheReadYourWrites) {
+    // No invalidation subscription: only the local invalidation keeps the reads fresh
+    auto cache = std::make_shared<storages::redis::ClientSideCache>(storages::redis::ClientSideCacheSettings{});
+    auto client = std::make_shared<storages::redis::ClientImpl>(GetSentinel(), std::nullopt, cache);
+
+    client->Set("key", "old", {}).Get();
+    EXPECT_EQ(client->Get("key", {}).Get(), "old");
+    EXPECT_EQ(client->Get("key", {}).Get(), "old");
+    EXPECT_EQ(cache->GetStatistics().hits.Load().value, 1);
+
+    client->Set("key", "new", {}).Get();
+    EXPECT_EQ(client->Get("key", {}).Get(), "new");
+
+    client->Incr("counter", {}).Get();
+    EXPECT_EQ(client->Get("counter", {}).Get(), "1");
+    client->Incr("counter", {}).Get();
+    EXPECT_EQ(client->Get("counter", {}).Get(), "2");
+
+    client->Del("key", {}).Get();
+    EXPECT_EQ(client->Get("key", {}).Get(), std::nullopt);
+
+    client->Set("key", "expiring", {}).Get();
+    EXPECT_EQ(client->Get("key", {}).Get(), "expiring");
+    client->Pexpire("key", std::chrono::milliseconds{1}, {}).Get();
+    engine::SleepFor(std::chrono::milliseconds{10});
+    EXPECT_EQ(client->Get("key", {}).Get(), std::nullopt);
+}
+
 USERVER_NAMESPACE_END
@@ -0,0 +1,143 @@
+#include <storages/redis/client_side_cache.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <mutex>
+#include <stdexcept>
+
+#include <userver/formats/parse/common_containers.hpp>
+#include <userver/storages/redis/subscribe_client.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/text_light.hpp>
+#include <userver/yaml_config/yaml_config.hpp>
+
+#include <storages/redis/impl/redis_creation_settings.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis {
+
+ClientSideCacheSettings Parse(const yaml_config::YamlConfig& value, formats::parse::To<ClientSideCacheSettings>) {
+    ClientSideCacheSettings settings;
+    settings.ways = value["ways"].As<std::size_t>(settings.ways);
+    settings.max_size = value["max_size"].As<std::size_t>(settings.max_size);
+    settings.ttl = value["ttl"].As<std::chrono::milliseconds>(settings.ttl);
+    settings.prefixes = value["prefixes"].As<std::vector<std::string>>(settings.prefixes);
+    return settings;
+}
+
+ClientSideCache::ClientSideCache(ClientSideCacheSettings settings) : settings_(std::move(settings)) {
+    if (settings_.ways == 0) throw std::logic_error("Client side cache ways must be positive");
+    const auto way_size = std::max<std::size_t>(1, (settings_.max_size + settings_.ways - 1) / settings_.ways);
+    ways_.reserve(settings_.ways);
+    for (std::size_t i = 0; i < settings_.ways; ++i) ways_.push_back(std::make_unique<Way>(way_size));
+}
+
+ClientSideCache::~ClientSideCache() { subscription_token_.reset(); }
+
+void ClientSideCache::ListenInvalidations(std::shared_ptr<SubscribeClient> subscribe_client) {
+    UASSERT(subscribe_client);
+    subscribe_client_ = std::move(subscribe_client);
+    subscription_token_.emplace(subscribe_client_->Subscribe(
+        std::string{USERVER_NAMESPACE::redis::kClientTrackingInvalidateChannel},
+        [this](const std::string&, const std::string& message) { OnInvalidation(message); }
+    ));
+}
+
+bool ClientSideCache::IsCacheable(const std::string& key) const {
+    if (settings_.prefixes.empty()) return true;
+    return std::any_of(settings_.prefixes.begin(), settings_.prefixes.end(), [&key](const std::string& prefix) {
+        return utils::text::StartsWith(key, prefix);
+    });
+}
+
+std::optional<std::optional<std::string>> ClientSideCache::Get(const std::string& key) {
+    auto& way = GetWay(key);
+    {
+        const std::lock_guard lock(way.mutex);
+        const auto* entry = way.entries.Get(key);
+        if (entry && !entry->pending && std::chrono::steady_clock::now() < entry->expires_at) {
+            ++statistics_.hits;
+            return entry->value;
+        }
+    }
+    ++statistics_.misses;
+    return std::nullopt;
+}
+
+ClientSideCache::Ticket ClientSideCache::StartFetch(const std::string& key) {
+    const auto ticket = next_ticket_.fetch_add(1, std::memory_order_relaxed);
+    auto& way = GetWay(key);
+    const std::lock_guard lock(way.mutex);
+    way.entries.Put(key, Entry{std::nullopt, {}, ticket, true});
+    return ticket;
+}
+
+void ClientSideCache::FinishFetch(const std::string& key, Ticket ticket, const std::optional<std::string>& value) {
+    auto& way = GetWay(key);
+    const std::lock_guard lock(way.mutex);
+    auto* entry = way.entries.Get(key);
+    // Invalidated or refetched by someone else since StartFetch()
+    if (!entry || !entry->pending || entry->ticket != ticket) return;
+
+    entry->value = value;
+    entry->expires_at = std::chrono::steady_clock::now() + settings_.ttl;
+    entry->pending = false;
+}
+
+void ClientSideCache::CancelFetch(const std::string& key, Ticket ticket) {
+    auto& way = GetWay(key);
+    const std::lock_guard lock(way.mutex);
+    const auto* entry = way.entries.Get(key);
+    if (entry && entry->pending && entry->ticket == ticket) way.entries.Erase(key);
+}
+
+void ClientSideCache::Invalidate(const std::string& key) {
+    auto& way = GetWay(key);
+    const std::lock_guard lock(way.mutex);
+    way.entries.Erase(key);
+}
+
+void ClientSideCache::OnInvalidation(std::string_view message) {
+    if (message == USERVER_NAMESPACE::redis::kClientTrackingInvalidateAll) {
+        InvalidateAll();
+        return;
+    }
+    if (message.empty() || message.front() != USERVER_NAMESPACE::redis::kClientTrackingKeyPrefix) {
+        UASSERT_MSG(false, "Unexpected client tracking message");
+        InvalidateAll();
+        return;
+    }
+
+    ++statistics_.invalidations;
+    const std::string key{message.substr(1)};
+    auto& way = GetWay(key);
+    const std::lock_guard lock(way.mutex);
+    way.entries.Erase(key);
+}
+
+void ClientSideCache::InvalidateAll() {
+    ++statistics_.flushes;
+    for (auto& way : ways_) {
+        const std::lock_guard lock(way->mutex);
+        way->entries.Clear();
+    }
+}
+
+USERVER_NAMESPACE::redis::ClientSideCacheStatistics ClientSideCache::GetStatistics() const {
+    auto result = statistics_;
+    result.size = 0;
+    for (const auto& way : ways_) {
+        const std::lock_guard lock(way->mutex);
+        result.size += way->entries.GetSize();
+    }
+    return result;
+}
+
+ClientSideCache::Way& ClientSideCache::GetWay(const std::string& key) {
+    return *ways_[std::hash<std::string>{}(key) % ways_.size()];
+}
+
+}  // namespace storages::redis
+
+USERVER_NAMESPACE_END
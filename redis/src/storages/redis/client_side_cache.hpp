@@ -0,0 +1,123 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <userver/cache/lru_map.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/formats/parse/to.hpp>
+#include <userver/storages/redis/subscription_token.hpp>
+#include <userver/yaml_config/fwd.hpp>
+
+#include <storages/redis/impl/redis_stats.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis {
+
+class SubscribeClient;
+
+struct ClientSideCacheSettings {
+    /// Number of independently locked parts of the cache
+    std::size_t ways{16};
+    /// Maximum number of cached keys, approximately
+    std::size_t max_size{100'000};
+    /// Entries older than that are never served. Bounds the staleness if an
+    /// invalidation message is lost, e.g. on a reconnect of the subscriber.
+    std::chrono::milliseconds ttl{std::chrono::seconds{10}};
+    /// Cache only the keys starting with one of the prefixes, all the keys if
+    /// empty. Passed to `CLIENT TRACKING ... BCAST PREFIX`.
+    std::vector<std::string> prefixes;
+};
+
+ClientSideCacheSettings Parse(const yaml_config::YamlConfig& value, formats::parse::To<ClientSideCacheSettings>);
+
+/// @brief Local cache of GET replies that is kept consistent by the
+/// invalidation messages of `CLIENT TRACKING ... BCAST`.
+///
+/// A read from Redis is performed between StartFetch() and FinishFetch(). The
+/// reply is cached only if the key was not invalidated in between, so a reply
+/// that raced with a concurrent modification is never stored. The reads are
+/// performed on the master: a replica could return a value that was already
+/// invalidated by the time StartFetch() is called.
+///
+/// The keys written or expired through the client are invalidated locally
+/// before the command is sent, so the writer reads its own writes without
+/// waiting for the invalidation message.
+class ClientSideCache final {
+public:
+    using Ticket = std::uint64_t;
+
+    explicit ClientSideCache(ClientSideCacheSettings settings);
+    ~ClientSideCache();
+
+    ClientSideCache(const ClientSideCache&) = delete;
+    ClientSideCache& operator=(const ClientSideCache&) = delete;
+
+    /// Subscribes to the invalidation messages of a subscribe client created
+    /// with client tracking enabled
+    void ListenInvalidations(std::shared_ptr<SubscribeClient> subscribe_client);
+
+    bool IsCacheable(const std::string& key) const;
+
+    /// @returns the cached reply to `GET key` (std::nullopt for a missing
+    /// key) or no value on cache miss
+    std::optional<std::optional<std::string>> Get(const std::string& key);
+
+    /// Marks the start of a read of the key from Redis
+    Ticket StartFetch(const std::string& key);
+
+    /// Caches the reply if the key was not invalidated after StartFetch()
+    void FinishFetch(const std::string& key, Ticket ticket, const std::optional<std::string>& value);
+
+    /// Drops the pending entry of a read that will never call FinishFetch()
+    void CancelFetch(const std::string& key, Ticket ticket);
+
+    /// Drops the key before a local modification is sent, so that neither the
+    /// cached value nor a concurrent fetch outlives the modification
+    void Invalidate(const std::string& key);
+
+    /// Handles a message of the invalidation channel, see
+    /// redis::kClientTrackingInvalidateAll and redis::kClientTrackingKeyPrefix
+    void OnInvalidation(std::string_view message);
+
+    void InvalidateAll();
+
+    USERVER_NAMESPACE::redis::ClientSideCacheStatistics GetStatistics() const;
+
+private:
+    struct Entry {
+        std::optional<std::string> value;
+        std::chrono::steady_clock::time_point expires_at;
+        Ticket ticket{0};
+        bool pending{false};
+    };
+
+    struct Way {
+        explicit Way(std::size_t size) : entries(size) {}
+
+        mutable engine::Mutex mutex;
+        cache::LruMap<std::string, Entry> entries;
+    };
+
+    Way& GetWay(const std::string& key);
+
+    const ClientSideCacheSettings settings_;
+    std::vector<std::unique_ptr<Way>> ways_;
+    std::atomic<Ticket> next_ticket_{1};
+    USERVER_NAMESPACE::redis::ClientSideCacheStatistics statistics_;
+
+    std::shared_ptr<SubscribeClient> subscribe_client_;
+    // Must be destroyed first, the subscription callback uses the cache
+    std::optional<SubscriptionToken> subscription_token_;
+};
+
+}  // namespace storages::redis
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,138 @@
+#include <storages/redis/client_side_cache.hpp>
+
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+storages::redis::ClientSideCacheSettings MakeSettings() {
+    storages::redis::ClientSideCacheSettings settings;
+    settings.ways = 2;
+    settings.max_size = 16;
+    settings.ttl = std::chrono::hours{1};
+    return settings;
+}
+
+}  // namespace
+
+UTEST(ClientSideCache, FetchAndHit) {
+    storages::redis::ClientSideCache cache{MakeSettings()};
+
+    EXPECT_FALSE(cache.Get("key"));
+    const auto ticket = cache.StartFetch("key");
+    EXPECT_FALSE(cache.Get("key"));
+    cache.FinishFetch("key", ticket, "value");
+
+    const auto cached = cache.Get("key");
+    ASSERT_TRUE(cached);
+    EXPECT_EQ(*cached, std::optional<std::string>{"value"});
+
+    cache.FinishFetch("missing", cache.StartFetch("missing"), std::nullopt);
+    const auto missing = cache.Get("missing");
+    ASSERT_TRUE(missing);
+    EXPECT_FALSE(*missing);
+
+    const auto stats = cache.GetStatistics();
+    EXPECT_EQ(stats.hits.Load().value, 2);
+    EXPECT_EQ(stats.misses.Load().value, 2);
+    EXPECT_EQ(stats.size, 2);
+}
+
+UTEST(ClientSideCache, InvalidationDuringFetch) {
+    storages::redis::ClientSideCache cache{MakeSettings()};
+
+    const auto ticket = cache.StartFetch("key");
+    cache.OnInvalidation("+key");
+    cache.FinishFetch("key", ticket, "stale");
+    EXPECT_FALSE(cache.Get("key"));
+
+    const auto first = cache.StartFetch("key");
+    const auto second = cache.StartFetch("key");
+    cache.FinishFetch("key", first, "stale");
+    EXPECT_FALSE(cache.Get("key"));
+    cache.FinishFetch("key", second, "fresh");
+    EXPECT_EQ(cache.Get("key"), std::optional<std::optional<std::string>>{"fresh"});
+}
+
+UTEST(ClientSideCache, LocalInvalidation) {
+    storages::redis::ClientSideCache cache{MakeSettings()};
+    cache.FinishFetch("key", cache.StartFetch("key"), "old");
+
+    cache.Invalidate("key");
+    EXPECT_FALSE(cache.Get("key"));
+
+    // A read that started before a local write must not cache its reply
+    const auto ticket = cache.StartFetch("key");
+    cache.Invalidate("key");
+    cache.FinishFetch("key", ticket, "old");
+    EXPECT_FALSE(cache.Get("key"));
+}
+
+UTEST(ClientSideCache, CancelFetch) {
+    storages::redis::ClientSideCache cache{MakeSettings()};
+
+    const auto abandoned = cache.StartFetch("key");
+    cache.CancelFetch("key", abandoned);
+    EXPECT_EQ(cache.GetStatistics().size, 0);
+
+    // Does not drop a newer fetch
+    const auto first = cache.StartFetch("key");
+    const auto second = cache.StartFetch("key");
+    cache.CancelFetch("key", first);
+    cache.FinishFetch("key", second, "value");
+    EXPECT_EQ(cache.Get("key"), std::optional<std::optional<std::string>>{"value"});
+}
+
+UTEST(ClientSideCache, Invalidation) {
+    storages::redis::ClientSideCache cache{MakeSettings()};
+    cache.FinishFetch("a", cache.StartFetch("a"), "1");
+    cache.FinishFetch("b", cache.StartFetch("b"), "2");
+
+    cache.OnInvalidation("+a");
+    EXPECT_FALSE(cache.Get("a"));
+    EXPECT_TRUE(cache.Get("b"));
+
+    // Sent on FLUSHALL and on every (re)subscription to the invalidations
+    cache.OnInvalidation("*");
+    EXPECT_FALSE(cache.Get("b"));
+
+    const auto stats = cache.GetStatistics();
+    EXPECT_EQ(stats.invalidations.Load().value, 1);
+    EXPECT_EQ(stats.flushes.Load().value, 1);
+    EXPECT_EQ(stats.size, 0);
+}
+
+UTEST(ClientSideCache, EmptyKeyInvalidation) {
+    storages::redis::ClientSideCache cache{MakeSettings()};
+    cache.FinishFetch("", cache.StartFetch(""), "empty");
+    cache.FinishFetch("a", cache.StartFetch("a"), "1");
+
+    // An empty key is not a flush of all the keys
+    cache.OnInvalidation("+");
+    EXPECT_FALSE(cache.Get(""));
+    EXPECT_TRUE(cache.Get("a"));
+    EXPECT_EQ(cache.GetStatistics().flushes.Load().value, 0);
+}
+
+UTEST(ClientSideCache, Ttl) {
+    auto settings = MakeSettings();
+    settings.ttl = std::chrono::milliseconds{0};
+    storages::redis::ClientSideCache cache{settings};
+
+    cache.FinishFetch("key", cache.StartFetch("key"), "value");
+    EXPECT_FALSE(cache.Get("key"));
+}
+
+TEST(ClientSideCache, Prefixes) {
+    auto settings = MakeSettings();
+    settings.prefixes = {"user:", "item:"};
+    const storages::redis::ClientSideCache cache{settings};
+
+    EXPECT_TRUE(cache.IsCacheable("user:1"));
+    EXPECT_TRUE(cache.IsCacheable("item:"));
+    EXPECT_FALSE(cache.IsCacheable("order:1"));
+    EXPECT_TRUE(storages::redis::ClientSideCache{MakeSettings()}.IsCacheable("order:1"));
+}
+
+USERVER_NAMESPACE_END
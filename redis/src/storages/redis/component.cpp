@@ -31,6 +31,7 @@
 #include <storages/redis/impl/subscribe_sentinel.hpp>
 
 #include "client_impl.hpp"
+#include "client_side_cache.hpp"
 #include "redis_secdist.hpp"
 #include "subscribe_client_impl.hpp"
 #include "userver/storages/redis/impl/base.hpp"
@@ -65,6 +66,7 @@ struct RedisGroup {
     std::string config_name;
     std::string sharding_strategy;
     bool allow_reads_from_master{false};
+    std::optional<storages::redis::ClientSideCacheSettings> client_side_cache;
 };
 
 RedisGroup Parse(const yaml_config::YamlConfig& value, formats::parse::To<RedisGroup>) {
@@ -73,6 +75,16 @@ RedisGroup Parse(const yaml_config::YamlConfig& value, formats::parse::To<RedisG
     config.config_name = value["config_name"].As<std::string>();
     config.sharding_strategy = value["sharding_strategy"].As<std::string>("");
     config.allow_reads_from_master = value["allow_reads_from_master"].As<bool>(false);
+    if (value["client_side_cache"]["enabled"].As<bool>(false)) {
+        if (USERVER_NAMESPACE::redis::IsClusterStrategy(config.sharding_strategy)) {
+            throw std::runtime_error(fmt::format(
+                "client_side_cache is not supported with the {} sharding_strategy (db={})",
+                config.sharding_strategy,
+                config.db
+            ));
+        }
+        config.client_side_cache = value["client_side_cache"].As<storages::redis::ClientSideCacheSettings>();
+    }
     return config;
 }
 
@@ -195,6 +207,7 @@ void Redis::Connect(
         std::make_shared<redis::ThreadPools>(redis_pools.sentinel_thread_pool_size, redis_pools.redis_thread_pool_size);
 
     const auto redis_groups = config["groups"].As<std::vector<RedisGroup>>();
+    std::vector<std::shared_ptr<storages::redis::SubscribeClientImpl>> tracking_clients;
     for (const RedisGroup& redis_group : redis_groups) {
         auto settings = GetSecdistSettings(secdist_component, redis_group);
 
@@ -213,7 +226,37 @@ void Redis::Connect(
         );
         if (sentinel) {
             sentinels_.emplace(redis_group.db, sentinel);
-            const auto& client = std::make_shared<storages::redis::ClientImpl>(sentinel);
+            std::shared_ptr<storages::redis::ClientSideCache> client_side_cache;
+            if (redis_group.client_side_cache) {
+                // Invalidations are received by dedicated subscriber connections,
+                // in RESP2 a connection with CLIENT TRACKING enabled for itself
+                // could not run the regular commands
+                redis::ClientTrackingSettings tracking_settings;
+                tracking_settings.prefixes = redis_group.client_side_cache->prefixes;
+                auto tracking_sentinel = redis::SubscribeSentinel::Create(
+                    thread_pools_,
+                    settings,
+                    redis_group.config_name,
+                    config_source,
+                    redis_group.db,
+                    /*is_cluster_mode=*/false,
+                    cc,
+                    testsuite_redis_control,
+                    tracking_settings
+                );
+                if (!tracking_sentinel) {
+                    throw std::runtime_error("Failed to create client side cache subscriber for " + redis_group.db);
+                }
+                auto tracking_client =
+                    std::make_shared<storages::redis::SubscribeClientImpl>(std::move(tracking_sentinel));
+                client_side_cache =
+                    std::make_shared<storages::redis::ClientSideCache>(*redis_group.client_side_cache);
+                client_side_cache->ListenInvalidations(tracking_client);
+                client_side_caches_.emplace(redis_group.db, client_side_cache);
+                tracking_clients.push_back(std::move(tracking_client));
+            }
+            const auto& client =
+                std::make_shared<storages::redis::ClientImpl>(sentinel, std::nullopt, std::move(client_side_cache));
             clients_.emplace(redis_group.db, client);
         } else {
             LOG_WARNING() << "skip redis client for " << redis_group.db;
@@ -259,6 +302,9 @@ void Redis::Connect(
     for (auto& subscribe_client_it : subscribe_clients_) {
         subscribe_client_it.second->WaitConnectedOnce(redis_wait_connected_subscribe);
     }
+    for (auto& tracking_client : tracking_clients) {
+        tracking_client->WaitConnectedOnce(redis_wait_connected_subscribe);
+    }
 }
 
 Redis::~Redis() {
@@ -272,6 +318,9 @@ void Redis::WriteStatistics(utils::statistics::Writer& writer) {
     for (const auto& [name, redis] : sentinels_) {
         writer.ValueWithLabels(redis->GetStatistics(*settings), {"redis_database", name});
     }
+    for (const auto& [name, cache] : client_side_caches_) {
+        writer["client_side_cache"].ValueWithLabels(cache->GetStatistics(), {"redis_database", name});
+    }
     auto threads_writer = writer["ev_threads"]["cpu_load_percent"];
     threads_writer.ValueWithLabels(*thread_pools_->GetRedisThreadPool(), {});
     threads_writer.ValueWithLabels(thread_pools_->GetSentinelThreadPool(), {});
@@ -363,6 +412,36 @@ properties:
                     type: boolean
                     description: allows read requests from master instance
                     defaultDescription: false
+                client_side_cache:
+                    type: object
+                    description: caching of GET replies invalidated with CLIENT TRACKING
+                    additionalProperties: false
+                    properties:
+                        enabled:
+                            type: boolean
+                            description: enables the cache, not supported with RedisCluster
+                            defaultDescription: false
+                        max_size:
+                            type: integer
+                            description: maximum number of cached keys
+                            defaultDescription: 100000
+                            minimum: 1
+                        ways:
+                            type: integer
+                            description: number of independently locked parts of the cache
+                            defaultDescription: 16
+                            minimum: 1
+                        ttl:
+                            type: string
+                            description: entries older than that are never served
+                            defaultDescription: 10s
+                        prefixes:
+                            type: array
+                            description: cache only the keys with one of the prefixes
+                            defaultDescription: all the keys
+                            items:
+                                type: string
+                                description: key prefix
     metrics_level:
         type: string
         description: set metrics detail level
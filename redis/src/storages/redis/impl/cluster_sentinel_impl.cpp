@@ -1027,6 +1027,12 @@ void ClusterSentinelImpl::SetRetryBudgetSettings(const utils::RetryBudgetSetting
     }
 }
 
+void ClusterSentinelImpl::SetClientTrackingSettings(const ClientTrackingSettings&) {
+    // Invalidations are sent by the node that owns the key, while a
+    // subscription is served by a single node of the cluster
+    throw std::runtime_error("Client tracking is not supported in cluster mode");
+}
+
 SentinelStatistics ClusterSentinelImpl::GetStatistics(const MetricsSettings& settings) const {
     if (!topology_holder_) {
         return {settings, {}};
@@ -65,6 +65,7 @@ public:
     void SetReplicationMonitoringSettings(const ReplicationMonitoringSettings& replication_monitoring_settings
     ) override;
     void SetRetryBudgetSettings(const utils::RetryBudgetSettings& settings) override;
+    void SetClientTrackingSettings(const ClientTrackingSettings& client_tracking_settings) override;
     PublishSettings GetPublishSettings() override;
 
     static size_t GetClusterSlotsCalledCounter();
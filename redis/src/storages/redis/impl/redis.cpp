@@ -222,6 +222,7 @@ private:
     void ProcessCommand(const CommandPtr& command);
 
     void Authenticate();
+    void EnableClientTracking();
     void SendReadOnly();
     void FreeCommands();
 
@@ -278,6 +279,7 @@ private:
     std::atomic_bool forbid_requests_to_syncing_replicas_ = false;
     const bool send_readonly_;
     const ConnectionSecurity connection_security_;
+    const std::shared_ptr<const ClientTrackingSettings> client_tracking_;
     std::chrono::milliseconds ping_interval_{2000};
     std::chrono::milliseconds ping_timeout_{4000};
     std::chrono::milliseconds info_replication_interval_{2000};
@@ -370,6 +372,7 @@ Redis::RedisImpl::RedisImpl(
       thread_pool_(thread_pool),
       send_readonly_(redis_settings.send_readonly),
       connection_security_(redis_settings.connection_security),
+      client_tracking_(redis_settings.client_tracking),
       server_id_(ServerId::Generate()),
       retry_budget_(utils::RetryBudgetSettings{100, 0.1, false}) {
     SetCommandsBufferingSettings(CommandsBufferingSettings{});
@@ -974,7 +977,7 @@ void Redis::RedisImpl::Authenticate() {
         if (send_readonly_)
             SendReadOnly();
         else
-            SetState(State::kConnected);
+            EnableClientTracking();
     } else {
         ProcessCommand(PrepareCommand(
             CmdArgs{"AUTH", password_.GetUnderlying()},
@@ -983,7 +986,7 @@ void Redis::RedisImpl::Authenticate() {
                     if (send_readonly_)
                         SendReadOnly();
                     else
-                        SetState(State::kConnected);
+                        EnableClientTracking();
                 } else {
                     if (*reply) {
                         if (reply->IsUnknownCommandError()) {
@@ -1013,7 +1016,7 @@ void Redis::RedisImpl::SendReadOnly() {
     LOG_DEBUG() << "Send READONLY command to slave " << GetServerId().GetDescription() << " in cluster mode";
     ProcessCommand(PrepareCommand(CmdArgs{"READONLY"}, [this](const CommandPtr&, ReplyPtr reply) {
         if (*reply && reply->data.IsStatus()) {
-            SetState(State::kConnected);
+            EnableClientTracking();
         } else {
             if (*reply) {
                 LOG_LIMITED_ERROR() << log_extra_ << "READONLY failed: response type=" << reply->data.GetTypeString()
@@ -1027,6 +1030,40 @@ void Redis::RedisImpl::SendReadOnly() {
     }));
 }
 
+void Redis::RedisImpl::EnableClientTracking() {
+    if (!client_tracking_) {
+        SetState(State::kConnected);
+        return;
+    }
+
+    // Invalidations are redirected to the connection itself: with RESP2 they
+    // are delivered only to a redirect target that is in the subscribed state.
+    ProcessCommand(PrepareCommand(CmdArgs{"CLIENT", "ID"}, [this](const CommandPtr&, ReplyPtr reply) {
+        if (!*reply || !reply->data.IsInt()) {
+            LOG_LIMITED_ERROR() << log_extra_ << "CLIENT ID failed: status=" << reply->status << " ("
+                                << reply->status_string << ") msg=" << reply->data.ToDebugString();
+            Disconnect();
+            return;
+        }
+
+        CmdArgs::CmdArgsArray args{"CLIENT", "TRACKING", "on", "REDIRECT", std::to_string(reply->data.GetInt()), "BCAST"};
+        for (const auto& prefix : client_tracking_->prefixes) {
+            args.emplace_back("PREFIX");
+            args.emplace_back(prefix);
+        }
+        ProcessCommand(PrepareCommand(CmdArgs{std::move(args)}, [this](const CommandPtr&, ReplyPtr reply) {
+            if (*reply && reply->data.IsStatus()) {
+                SetState(State::kConnected);
+                return;
+            }
+            LOG_LIMITED_ERROR() << log_extra_ << "CLIENT TRACKING failed (Redis 6.0+ is required): status="
+                                << reply->status << " (" << reply->status_string
+                                << ") msg=" << reply->data.ToDebugString();
+            Disconnect();
+        }));
+    }));
+}
+
 void Redis::RedisImpl::OnRedisReply(redisAsyncContext* c, void* r, void* privdata) noexcept {
     auto* impl = static_cast<Redis::RedisImpl*>(c->data);
     UASSERT(impl != nullptr);
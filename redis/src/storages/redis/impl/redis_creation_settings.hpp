@@ -1,6 +1,10 @@
 #pragma once
 
+#include <memory>
+#include <string>
+#include <string_view>
 #include <unordered_map>
+#include <vector>
 
 #include <userver/storages/redis/impl/base.hpp>
 
@@ -8,9 +12,29 @@ USERVER_NAMESPACE_BEGIN
 
 namespace redis {
 
+/// Settings of `CLIENT TRACKING ... BCAST` for subscriber connections. Such a
+/// connection redirects the invalidation messages to itself, so with RESP2
+/// they arrive as messages of the `__redis__:invalidate` channel.
+struct ClientTrackingSettings {
+    /// Track only the keys starting with one of the prefixes, all the keys if
+    /// empty
+    std::vector<std::string> prefixes;
+};
+
+inline constexpr std::string_view kClientTrackingInvalidateChannel = "__redis__:invalidate";
+
+/// Subscribers of kClientTrackingInvalidateChannel receive either a key
+/// prefixed with kClientTrackingKeyPrefix or kClientTrackingInvalidateAll, so
+/// that invalidation of all the keys is not confused with an empty key.
+/// kClientTrackingInvalidateAll is also sent on every (re)subscription, as the
+/// invalidations are lost while the connection is not subscribed.
+inline constexpr char kClientTrackingKeyPrefix = '+';
+inline constexpr std::string_view kClientTrackingInvalidateAll = "*";
+
 struct RedisCreationSettings {
     ConnectionSecurity connection_security = ConnectionSecurity::kNone;
     bool send_readonly{false};
+    std::shared_ptr<const ClientTrackingSettings> client_tracking{};
 };
 
 }  // namespace redis
@@ -294,6 +294,14 @@ void DumpMetric(utils::statistics::Writer& writer, const SentinelStatistics& sta
     }
 }
 
+void DumpMetric(utils::statistics::Writer& writer, const ClientSideCacheStatistics& stats) {
+    writer["hits"] = stats.hits.Load();
+    writer["misses"] = stats.misses.Load();
+    writer["invalidations"] = stats.invalidations.Load();
+    writer["flushes"] = stats.flushes.Load();
+    writer["size"] = stats.size;
+}
+
 }  // namespace redis
 
 USERVER_NAMESPACE_END
@@ -141,6 +141,18 @@ void DumpMetric(utils::statistics::Writer& writer, const ShardStatistics& stats)
 
 void DumpMetric(utils::statistics::Writer& writer, const SentinelStatistics& stats);
 
+struct ClientSideCacheStatistics {
+    utils::statistics::RateCounter hits;
+    utils::statistics::RateCounter misses;
+    /// Keys invalidated by the server
+    utils::statistics::RateCounter invalidations;
+    /// Whole cache invalidations, e.g. on FLUSHALL
+    utils::statistics::RateCounter flushes;
+    std::size_t size{0};
+};
+
+void DumpMetric(utils::statistics::Writer& writer, const ClientSideCacheStatistics& stats);
+
 }  // namespace redis
 
 USERVER_NAMESPACE_END
@@ -19,6 +19,7 @@
 #include <storages/redis/impl/cluster_sentinel_impl.hpp>
 #include <storages/redis/impl/command.hpp>
 #include <storages/redis/impl/redis.hpp>
+#include <storages/redis/impl/redis_creation_settings.hpp>
 #include <storages/redis/impl/sentinel_impl.hpp>
 #include <storages/redis/impl/subscribe_sentinel.hpp>
 
@@ -35,6 +36,24 @@ void ThrowIfCancelled() {
     }
 }
 
+void OnClientTrackingMessage(
+    const Sentinel::MessageCallback& message_callback,
+    ServerId server_id,
+    const std::string& channel,
+    const ReplyData& message
+) {
+    if (message.IsArray()) {
+        for (const auto& key : message.GetArray()) {
+            if (key.IsString()) message_callback(server_id, channel, kClientTrackingKeyPrefix + key.GetString());
+        }
+    } else if (message.IsString()) {
+        message_callback(server_id, channel, kClientTrackingKeyPrefix + message.GetString());
+    } else {
+        // Invalidation of all the keys, e.g. on FLUSHALL
+        message_callback(server_id, channel, std::string{kClientTrackingInvalidateAll});
+    }
+}
+
 void OnSubscribeImpl(
     std::string_view message_type,
     const Sentinel::MessageCallback& message_callback,
@@ -49,10 +68,18 @@ void OnSubscribeImpl(
     if (reply_array.size() != 3 || !reply_array[0].IsString()) return;
     if (!strcasecmp(reply_array[0].GetString().c_str(), subscribe_type.data())) {
         subscribe_callback(reply->server_id, reply_array[1].GetString(), reply_array[2].GetInt());
+        if (reply_array[1].GetString() == kClientTrackingInvalidateChannel) {
+            // The invalidations sent before the subscription are lost
+            message_callback(reply->server_id, reply_array[1].GetString(), std::string{kClientTrackingInvalidateAll});
+        }
     } else if (!strcasecmp(reply_array[0].GetString().c_str(), unsubscribe_type.data())) {
         unsubscribe_callback(reply->server_id, reply_array[1].GetString(), reply_array[2].GetInt());
     } else if (!strcasecmp(reply_array[0].GetString().c_str(), message_type.data())) {
-        message_callback(reply->server_id, reply_array[1].GetString(), reply_array[2].GetString());
+        if (reply_array[1].GetString() == kClientTrackingInvalidateChannel) {
+            OnClientTrackingMessage(message_callback, reply->server_id, reply_array[1].GetString(), reply_array[2]);
+        } else {
+            message_callback(reply->server_id, reply_array[1].GetString(), reply_array[2].GetString());
+        }
     }
 }
 
@@ -346,6 +373,10 @@ void Sentinel::SetRetryBudgetSettings(const utils::RetryBudgetSettings& settings
     impl_->SetRetryBudgetSettings(settings);
 }
 
+void Sentinel::SetClientTrackingSettings(const ClientTrackingSettings& settings) {
+    impl_->SetClientTrackingSettings(settings);
+}
+
 std::vector<Request>
 Sentinel::MakeRequests(CmdArgs&& args, bool master, const CommandControl& command_control, size_t replies_to_skip) {
     std::vector<Request> rslt;
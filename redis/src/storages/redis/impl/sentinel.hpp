@@ -19,6 +19,7 @@
 #include <userver/storages/redis/impl/types.hpp>
 #include <userver/storages/redis/impl/wait_connected_mode.hpp>
 
+#include <storages/redis/impl/redis_creation_settings.hpp>
 #include <storages/redis/impl/redis_stats.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -144,6 +145,9 @@ public:
     void SetCommandsBufferingSettings(CommandsBufferingSettings commands_buffering_settings);
     void SetReplicationMonitoringSettings(const ReplicationMonitoringSettings& replication_monitoring_settings);
     void SetRetryBudgetSettings(const utils::RetryBudgetSettings& settings);
+    /// Makes the connections created after the call enable `CLIENT TRACKING`,
+    /// should be called before Start()
+    void SetClientTrackingSettings(const ClientTrackingSettings& settings);
 
     // NOLINTNEXTLINE(misc-non-private-member-variables-in-classes)
     boost::signals2::signal<void(size_t shard)> signal_instances_changed;
@@ -530,6 +530,10 @@ void SentinelImpl::SetRetryBudgetSettings(const utils::RetryBudgetSettings& retr
     for (auto& shard : master_shards_) shard->SetRetryBudgetSettings(retry_budget_settings);
 }
 
+void SentinelImpl::SetClientTrackingSettings(const ClientTrackingSettings& client_tracking_settings) {
+    for (auto& shard : master_shards_) shard->SetClientTrackingSettings(client_tracking_settings);
+}
+
 PublishSettings SentinelImpl::GetPublishSettings() {
     /// Why do we always publish to master? We can actually publish to any host in
     /// shard to distribute load evenly
@@ -83,6 +83,7 @@ public:
     virtual void SetReplicationMonitoringSettings(const ReplicationMonitoringSettings& replication_monitoring_settings
     ) = 0;
     virtual void SetRetryBudgetSettings(const utils::RetryBudgetSettings& retry_budget_settings) = 0;
+    virtual void SetClientTrackingSettings(const ClientTrackingSettings& client_tracking_settings) = 0;
 
     virtual PublishSettings GetPublishSettings() = 0;
 };
@@ -137,6 +138,7 @@ public:
     void SetReplicationMonitoringSettings(const ReplicationMonitoringSettings& replication_monitoring_settings
     ) override;
     void SetRetryBudgetSettings(const utils::RetryBudgetSettings& retry_budget_settings) override;
+    void SetClientTrackingSettings(const ClientTrackingSettings& client_tracking_settings) override;
     PublishSettings GetPublishSettings() override;
 
 private:
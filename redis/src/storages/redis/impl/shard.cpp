@@ -263,7 +263,8 @@ bool Shard::ProcessCreation(const std::shared_ptr<engine::ev::ThreadPool>& redis
     // https://github.com/boostorg/signals2/issues/59
     // NOLINTNEXTLINE(clang-analyzer-cplusplus.NewDelete)
     for (const auto& id : need_to_create) {
-        const auto redis_settings = RedisCreationSettings{id.GetConnectionSecurity(), cluster_mode_ && id.IsReadOnly()};
+        const auto redis_settings = RedisCreationSettings{
+            id.GetConnectionSecurity(), cluster_mode_ && id.IsReadOnly(), client_tracking_settings_.Get()};
         ConnectionStatus entry{
             id,
             std::make_shared<Redis>(
@@ -408,6 +409,10 @@ void Shard::SetCommandsBufferingSettings(CommandsBufferingSettings commands_buff
     commands_buffering_settings_.Set(std::make_shared<CommandsBufferingSettings>(commands_buffering_settings));
 }
 
+void Shard::SetClientTrackingSettings(ClientTrackingSettings client_tracking_settings) {
+    client_tracking_settings_.Set(std::make_shared<ClientTrackingSettings>(std::move(client_tracking_settings)));
+}
+
 void Shard::SetReplicationMonitoringSettings(const ReplicationMonitoringSettings& replication_monitoring_settings) {
     std::shared_lock lock(mutex_);
 
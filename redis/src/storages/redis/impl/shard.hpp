@@ -98,6 +98,8 @@ public:
     void SetCommandsBufferingSettings(CommandsBufferingSettings commands_buffering_settings);
     void SetReplicationMonitoringSettings(const ReplicationMonitoringSettings& replication_monitoring_settings);
     void SetRetryBudgetSettings(const utils::RetryBudgetSettings& replication_monitoring_settings);
+    /// Applies to the connections created after the call
+    void SetClientTrackingSettings(ClientTrackingSettings client_tracking_settings);
 
 private:
     std::vector<unsigned char>
@@ -128,6 +130,7 @@ private:
 
     utils::SwappingSmart<CommandsBufferingSettings> commands_buffering_settings_;
     utils::SwappingSmart<utils::RetryBudgetSettings> retry_budget_settings_;
+    utils::SwappingSmart<ClientTrackingSettings> client_tracking_settings_;
 
     bool prev_connected_ = false;
     const bool cluster_mode_ = false;
@@ -104,7 +104,8 @@ std::shared_ptr<SubscribeSentinel> SubscribeSentinel::Create(
     const std::string& client_name,
     bool is_cluster_mode,
     const CommandControl& command_control,
-    const testsuite::RedisControl& testsuite_redis_control
+    const testsuite::RedisControl& testsuite_redis_control,
+    const std::optional<ClientTrackingSettings>& client_tracking
 ) {
     auto ready_callback = [](size_t shard, const std::string& shard_name, bool ready) {
         LOG_INFO() << "redis: ready_callback:"
@@ -122,7 +123,8 @@ std::shared_ptr<SubscribeSentinel> SubscribeSentinel::Create(
         std::move(ready_callback),
         is_cluster_mode,
         command_control,
-        testsuite_redis_control
+        testsuite_redis_control,
+        client_tracking
     );
 }
 
@@ -135,7 +137,8 @@ std::shared_ptr<SubscribeSentinel> SubscribeSentinel::Create(
     ReadyChangeCallback ready_callback,
     bool is_cluster_mode,
     const CommandControl& command_control,
-    const testsuite::RedisControl& testsuite_redis_control
+    const testsuite::RedisControl& testsuite_redis_control,
+    const std::optional<ClientTrackingSettings>& client_tracking
 ) {
     const auto& password = settings.password;
 
@@ -172,6 +175,7 @@ std::shared_ptr<SubscribeSentinel> SubscribeSentinel::Create(
         command_control,
         testsuite_redis_control
     );
+    if (client_tracking) subscribe_sentinel->SetClientTrackingSettings(*client_tracking);
     subscribe_sentinel->Start();
     return subscribe_sentinel;
 }
@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <vector>
 
 #include <userver/testsuite/testsuite_support.hpp>
@@ -40,7 +41,8 @@ public:
         const std::string& client_name,
         bool is_cluster_mode,
         const CommandControl& command_control,
-        const testsuite::RedisControl& testsuite_redis_control
+        const testsuite::RedisControl& testsuite_redis_control,
+        const std::optional<ClientTrackingSettings>& client_tracking = std::nullopt
     );
     static std::shared_ptr<SubscribeSentinel> Create(
         const std::shared_ptr<ThreadPools>& thread_pools,
@@ -51,7 +53,8 @@ public:
         ReadyChangeCallback ready_callback,
         bool is_cluster_mode,
         const CommandControl& command_control,
-        const testsuite::RedisControl& testsuite_redis_control
+        const testsuite::RedisControl& testsuite_redis_control,
+        const std::optional<ClientTrackingSettings>& client_tracking = std::nullopt
     );
 
     SubscriptionToken Subscribe(
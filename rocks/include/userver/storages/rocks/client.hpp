@@ -3,23 +3,46 @@
 /// @file userver/storages/rocks/client.hpp
 /// @brief @copybrief storages::rocks::Client
 
+#include <cstddef>
+#include <memory>
+#include <optional>
 #include <string>
 #include <string_view>
+#include <vector>
 
 #include <rocksdb/db.h>
 
 #include <userver/engine/task/task_processor_fwd.hpp>
+#include <userver/storages/rocks/client_fwd.hpp>
+#include <userver/storages/rocks/cursor.hpp>
+#include <userver/storages/rocks/settings.hpp>
+#include <userver/storages/rocks/snapshot.hpp>
+#include <userver/storages/rocks/write_batch.hpp>
+#include <userver/utils/statistics/fwd.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace storages::rocks {
 
+namespace impl {
+class Database;
+}  // namespace impl
+
 /**
  * @brief Client for working with RocksDB storage.
  *
  * This class provides an interface for interacting with the RocksDB database.
  * To use the class, you need to specify the database path when creating an
  * object.
+ *
+ * Every call executes on the blocking task processor. Prefer MultiGet(),
+ * Write() and cursors for bulk operations, each of them does a single
+ * task processor switch per call (per chunk for cursors) instead of one per
+ * key.
+ *
+ * A client works with a single column family, the default one for the
+ * clients created by constructors. Clients of the other column families of
+ * the same database are obtained via MakeColumnFamilyClient().
  */
 class Client final {
 public:
@@ -32,6 +55,27 @@ public:
      */
     Client(const std::string& db_path, engine::TaskProcessor& blocking_task_processor);
 
+    /**
+     * @brief Constructor of the Client class.
+     *
+     * @param db_path The path to the RocksDB database.
+     * @param settings Tuning of the database and its column families.
+     * @param blocking_task_processor - task processor to execute blocking FS
+     * operations
+     */
+    Client(const std::string& db_path, const Settings& settings, engine::TaskProcessor& blocking_task_processor);
+
+    ~Client();
+
+    /**
+     * @brief Returns a client of another column family of the same database.
+     *
+     * @param column_family The name of a column family from Settings or of an
+     * existing column family of the database.
+     * @throws Exception if there is no such column family.
+     */
+    ClientPtr MakeColumnFamilyClient(std::string_view column_family) const;
+
     /**
      * @brief Puts a record into the database.
      *
@@ -54,6 +98,51 @@ public:
      */
     void Delete(std::string_view key);
 
+    /**
+     * @brief Retrieves the values of several records at once.
+     *
+     * @param keys The keys of the records.
+     * @returns Values in the order of `keys`, std::nullopt for missing records.
+     */
+    std::vector<std::optional<std::string>> MultiGet(const std::vector<std::string_view>& keys);
+
+    /**
+     * @brief Atomically applies all the operations of the batch.
+     *
+     * @param batch The operations to apply.
+     */
+    void Write(WriteBatch&& batch);
+
+    /**
+     * @brief Returns a cursor over the records with keys starting with
+     * `prefix`, in the key order.
+     *
+     * @param prefix The prefix of the keys.
+     * @param chunk_size The max number of records returned by Cursor::NextChunk.
+     */
+    Cursor ScanPrefix(std::string_view prefix, std::size_t chunk_size = kDefaultChunkSize);
+
+    /**
+     * @brief Returns a cursor over the records with keys in `[begin, end)`,
+     * in the key order.
+     *
+     * @param begin The first key of the range.
+     * @param end The key after the range, std::nullopt for no upper bound.
+     * @param chunk_size The max number of records returned by Cursor::NextChunk.
+     */
+    Cursor ScanRange(
+        std::string_view begin,
+        std::optional<std::string_view> end,
+        std::size_t chunk_size = kDefaultChunkSize
+    );
+
+    /**
+     * @brief Creates a consistent read-only view of the database as of now.
+     *
+     * The snapshot must not outlive the client.
+     */
+    Snapshot MakeSnapshot();
+
     /**
      * Checks the status of an operation and handles any errors based on the given
      * method name.
@@ -63,10 +152,37 @@ public:
      */
     void CheckStatus(rocksdb::Status status, std::string_view method_name);
 
+    /// Writes RocksDB statistics of the whole database, not only of the
+    /// column family of the client.
+    friend void DumpMetric(utils::statistics::Writer& writer, const Client& client);
+
 private:
-    std::unique_ptr<rocksdb::DB> db_;
+    friend class Snapshot;
+
+    Client(
+        std::shared_ptr<impl::Database> database,
+        rocksdb::ColumnFamilyHandle* column_family,
+        engine::TaskProcessor& blocking_task_processor
+    );
+
+    std::string DoGet(std::string_view key, const rocksdb::Snapshot* snapshot);
+    std::vector<std::optional<std::string>>
+    DoMultiGet(const std::vector<std::string_view>& keys, const rocksdb::Snapshot* snapshot);
+    Cursor DoScanPrefix(std::string_view prefix, std::size_t chunk_size, const rocksdb::Snapshot* snapshot);
+    Cursor DoScanRange(
+        std::string_view begin,
+        std::optional<std::string_view> end,
+        std::size_t chunk_size,
+        const rocksdb::Snapshot* snapshot
+    );
+    void ReleaseSnapshot(const rocksdb::Snapshot* snapshot) noexcept;
+
+    std::shared_ptr<impl::Database> database_;
+    rocksdb::DB& db_;
+    rocksdb::ColumnFamilyHandle* column_family_;
     engine::TaskProcessor& blocking_task_processor_;
 };
+
 }  // namespace storages::rocks
 
 USERVER_NAMESPACE_END
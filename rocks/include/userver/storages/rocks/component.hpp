@@ -3,11 +3,14 @@
 /// @file userver/storages/rocks/component.hpp
 /// @brief @copybrief rocks::Rocks
 
+#include <string_view>
+
 #include <userver/components/component_base.hpp>
 #include <userver/components/component_config.hpp>
 #include <userver/components/component_context.hpp>
 #include <userver/engine/task/task_processor_fwd.hpp>
 #include <userver/storages/rocks/client_fwd.hpp>
+#include <userver/utils/statistics/entry.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -18,11 +21,29 @@ namespace storages::rocks {
 /// @ingroup userver_components
 ///
 /// @brief RocksDB client component.
+///
+/// Exports the properties of the column families to the metrics. With
+/// `statistics-enabled` also exports the RocksDB statistics of the database
+/// (block cache hits and misses, stall time, compaction bytes etc.) and the
+/// operation timings over the last `statistics-period`.
+///
 /// ## Static options:
 /// Name                               | Description                                      | Default value
 /// ---------------------------------- | ------------------------------------------------ | ---------------
 /// task-processor                     | name of the task processor to run the blocking file operations | -
 /// db-path                            | path to database file                            | -
+/// block-cache-size                   | size in bytes of the block cache shared by all the databases of the process, 0 for a separate default cache | 0
+/// statistics-enabled                 | collect RocksDB tickers and histograms for the metrics | false
+/// statistics-period                  | period of the operation timings in the metrics   | 10s
+/// max-background-jobs                | max number of concurrent background flushes and compactions | 2
+/// column-families                    | list of column families to open or create, see below | []
+/// column-families.[].name            | name of the column family, `default` to tune the default one | -
+/// column-families.[].write-buffer-size | size in bytes of a single memtable             | 64MiB
+/// column-families.[].max-write-buffer-number | max number of memtables                  | 2
+/// column-families.[].compaction-style | one of `level`, `universal`, `fifo`             | level
+/// column-families.[].bloom-filter-bits-per-key | bits per key of the bloom filter, 0 to disable | 0
+/// column-families.[].block-size      | size in bytes of an uncompressed data block      | 4KiB
+/// column-families.[].compression-per-level | list of `none`, `snappy`, `zlib`, `lz4`, `zstd` for each LSM level | RocksDB default
 
 // clang-format on
 
@@ -30,14 +51,19 @@ class Component : public components::ComponentBase {
 public:
     Component(const components::ComponentConfig&, const components::ComponentContext&);
 
-    ~Component() = default;
+    ~Component() override;
 
+    /// Returns the client of the default column family
     storages::rocks::ClientPtr MakeClient();
 
+    /// Returns the client of the column family
+    storages::rocks::ClientPtr MakeClient(std::string_view column_family);
+
     static yaml_config::Schema GetStaticConfigSchema();
 
 private:
     storages::rocks::ClientPtr client_ptr_;
+    utils::statistics::Entry statistics_holder_;
 };
 
 }  // namespace storages::rocks
@@ -0,0 +1,59 @@
+#pragma once
+
+/// @file userver/storages/rocks/cursor.hpp
+/// @brief @copybrief storages::rocks::Cursor
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::rocks {
+
+class Client;
+
+/// Default max number of records returned by Cursor::NextChunk
+inline constexpr std::size_t kDefaultChunkSize = 1000;
+
+/// @brief A record of the database
+struct KeyValue final {
+    std::string key;
+    std::string value;
+};
+
+/**
+ * @brief Reads a range of records in the key order, chunk by chunk.
+ *
+ * Each NextChunk() call does a single switch to the blocking task processor.
+ * The cursor sees the database as of the first NextChunk() call, or as of the
+ * snapshot it was created from. The cursor must not outlive the client or the
+ * snapshot it was created from.
+ */
+class Cursor final {
+public:
+    Cursor(Cursor&&) noexcept;
+    Cursor& operator=(Cursor&&) noexcept;
+    ~Cursor();
+
+    /// @returns The next records of the range, an empty vector if the range is
+    /// exhausted.
+    std::vector<KeyValue> NextChunk();
+
+    /// @returns `true` if all the records of the range were returned.
+    bool IsFinished() const noexcept;
+
+private:
+    friend class Client;
+
+    struct Impl;
+
+    explicit Cursor(std::unique_ptr<Impl>&& impl);
+
+    std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace storages::rocks
+
+USERVER_NAMESPACE_END
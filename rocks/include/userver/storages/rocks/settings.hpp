@@ -0,0 +1,97 @@
+#pragma once
+
+/// @file userver/storages/rocks/settings.hpp
+/// @brief @copybrief storages::rocks::Settings
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <userver/formats/parse/to.hpp>
+#include <userver/yaml_config/fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::rocks {
+
+/// Name of the column family that always exists in a database
+inline constexpr std::string_view kDefaultColumnFamily = "default";
+
+enum class CompactionStyle {
+    kLevel,
+    kUniversal,
+    kFifo,
+};
+
+enum class Compression {
+    kNone,
+    kSnappy,
+    kZlib,
+    kLz4,
+    kZstd,
+};
+
+/// @brief Tuning of a single column family
+struct ColumnFamilySettings final {
+    std::string name{kDefaultColumnFamily};
+
+    /// Size of a single memtable, larger values mean fewer flushes and less
+    /// write amplification at the cost of memory
+    std::size_t write_buffer_size{64 * 1024 * 1024};
+
+    /// Max number of memtables, including the ones being flushed
+    int max_write_buffer_number{2};
+
+    CompactionStyle compaction_style{CompactionStyle::kLevel};
+
+    /// Bits per key of the bloom filter, 0 disables the filter. 10 bits give
+    /// ~1% false positives and save most of the disk reads for missing keys.
+    double bloom_filter_bits_per_key{0};
+
+    /// Size of an uncompressed data block, the unit of reads and caching
+    std::size_t block_size{4 * 1024};
+
+    /// Compression of each LSM level, RocksDB default compression for all
+    /// levels if empty. Leaving the upper levels uncompressed saves CPU on the
+    /// hot data, while the bottom levels hold most of the data.
+    std::vector<Compression> compression_per_level;
+};
+
+/// @brief Tuning of a RocksDB database
+struct Settings final {
+    /// Capacity of the LRU block cache that is shared by all the databases of
+    /// the process that set it. The cache grows to the largest requested
+    /// capacity. 0 means a separate RocksDB default block cache per database.
+    std::size_t block_cache_size{0};
+
+    /// Collect RocksDB statistics (tickers and histograms) for the metrics.
+    /// Costs a few percent of CPU on hot paths, so it is off by default.
+    bool statistics_enabled{false};
+
+    /// Period of the operation timings in the metrics: the RocksDB histograms
+    /// are read and reset once per period
+    std::chrono::milliseconds statistics_period{std::chrono::seconds{10}};
+
+    /// Max number of concurrent background flushes and compactions
+    int max_background_jobs{2};
+
+    /// Column families to open or create. The default column family uses the
+    /// settings of the column family named "default" if it is in the list.
+    /// Existing column families of the database that are not in the list are
+    /// opened with the default settings.
+    std::vector<ColumnFamilySettings> column_families;
+};
+
+CompactionStyle Parse(const yaml_config::YamlConfig& value, formats::parse::To<CompactionStyle>);
+
+Compression Parse(const yaml_config::YamlConfig& value, formats::parse::To<Compression>);
+
+ColumnFamilySettings Parse(const yaml_config::YamlConfig& value, formats::parse::To<ColumnFamilySettings>);
+
+Settings Parse(const yaml_config::YamlConfig& value, formats::parse::To<Settings>);
+
+}  // namespace storages::rocks
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,64 @@
+#pragma once
+
+/// @file userver/storages/rocks/snapshot.hpp
+/// @brief @copybrief storages::rocks::Snapshot
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <userver/storages/rocks/cursor.hpp>
+
+namespace rocksdb {
+class Snapshot;
+}  // namespace rocksdb
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::rocks {
+
+class Client;
+
+/**
+ * @brief A consistent read-only view of the database, created by
+ * Client::MakeSnapshot().
+ *
+ * All the reads from a snapshot see the database as of the moment of the
+ * snapshot creation. The snapshot must not outlive the client.
+ */
+class Snapshot final {
+public:
+    Snapshot(Snapshot&&) noexcept;
+    Snapshot& operator=(Snapshot&&) noexcept;
+    ~Snapshot();
+
+    /// @copydoc Client::Get
+    std::string Get(std::string_view key);
+
+    /// @copydoc Client::MultiGet
+    std::vector<std::optional<std::string>> MultiGet(const std::vector<std::string_view>& keys);
+
+    /// @copydoc Client::ScanPrefix
+    Cursor ScanPrefix(std::string_view prefix, std::size_t chunk_size = kDefaultChunkSize);
+
+    /// @copydoc Client::ScanRange
+    Cursor ScanRange(
+        std::string_view begin,
+        std::optional<std::string_view> end,
+        std::size_t chunk_size = kDefaultChunkSize
+    );
+
+private:
+    friend class Client;
+
+    Snapshot(Client& client, const rocksdb::Snapshot* snapshot) noexcept;
+
+    Client* client_;
+    const rocksdb::Snapshot* snapshot_;
+};
+
+}  // namespace storages::rocks
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,67 @@
+#pragma once
+
+/// @file userver/storages/rocks/write_batch.hpp
+/// @brief @copybrief storages::rocks::WriteBatch
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::rocks {
+
+class Client;
+
+/**
+ * @brief A set of Put/Delete operations that Client::Write applies atomically.
+ *
+ * Keys and values are copied into the batch, so they do not have to outlive
+ * the call. The batch is not bound to a column family, the operations are
+ * applied to the column family of the client that writes the batch.
+ */
+class WriteBatch final {
+public:
+    WriteBatch();
+    ~WriteBatch();
+
+    WriteBatch(WriteBatch&&) noexcept;
+    WriteBatch& operator=(WriteBatch&&) noexcept;
+
+    /// @brief Adds a record to put into the database.
+    void Put(std::string_view key, std::string_view value);
+
+    /// @brief Adds a record to delete from the database by key.
+    void Delete(std::string_view key);
+
+    /// @brief Adds deletion of the records with keys in `[begin, end)`.
+    void DeleteRange(std::string_view begin, std::string_view end);
+
+    /// @returns The number of operations in the batch.
+    std::size_t GetSize() const { return operations_.size(); }
+
+    bool IsEmpty() const { return operations_.empty(); }
+
+private:
+    friend class Client;
+
+    enum class OperationType {
+        kPut,
+        kDelete,
+        kDeleteRange,
+    };
+
+    struct Operation final {
+        OperationType type;
+        std::string key;
+        // Value for kPut, end of the range for kDeleteRange
+        std::string value;
+    };
+
+    std::vector<Operation> operations_;
+};
+
+}  // namespace storages::rocks
+
+USERVER_NAMESPACE_END
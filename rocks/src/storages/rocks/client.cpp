@@ -4,56 +4,187 @@
 
 #include <userver/storages/rocks/exception.hpp>
 #include <userver/utils/async.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+#include <storages/rocks/cursor_impl.hpp>
+#include <storages/rocks/database.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace storages::rocks {
 
+namespace {
+
+// The smallest key that is greater than all the keys with the prefix,
+// std::nullopt if there is no such key (the prefix is all 0xff).
+std::optional<std::string> GetPrefixEnd(std::string_view prefix) {
+    std::string end{prefix};
+    while (!end.empty()) {
+        auto& last = reinterpret_cast<unsigned char&>(end.back());
+        if (last != 0xff) {
+            ++last;
+            return end;
+        }
+        end.pop_back();
+    }
+    return std::nullopt;
+}
+
+}  // namespace
+
 Client::Client(const std::string& db_path, engine::TaskProcessor& blocking_task_processor)
-    : blocking_task_processor_(blocking_task_processor) {
-    rocksdb::Options options;
-    options.create_if_missing = true;
+    : Client(db_path, Settings{}, blocking_task_processor) {}
+
+Client::Client(const std::string& db_path, const Settings& settings, engine::TaskProcessor& blocking_task_processor)
+    : Client(std::make_shared<impl::Database>(db_path, settings), nullptr, blocking_task_processor) {}
 
-    rocksdb::DB* db{};
-    rocksdb::Status status = rocksdb::DB::Open(options, db_path, &db);
-    db_.reset(db);
-    CheckStatus(status, "Create client");
+Client::Client(
+    std::shared_ptr<impl::Database> database,
+    rocksdb::ColumnFamilyHandle* column_family,
+    engine::TaskProcessor& blocking_task_processor
+)
+    : database_(std::move(database)),
+      db_(database_->Get()),
+      column_family_(column_family ? column_family : database_->GetDefaultColumnFamily()),
+      blocking_task_processor_(blocking_task_processor) {}
+
+Client::~Client() = default;
+
+ClientPtr Client::MakeColumnFamilyClient(std::string_view column_family) const {
+    auto* handle = database_->FindColumnFamily(column_family);
+    if (!handle) {
+        throw Exception(fmt::format("Column family '{}' is not opened", column_family));
+    }
+    return ClientPtr{new Client(database_, handle, blocking_task_processor_)};
 }
 
 void Client::Put(std::string_view key, std::string_view value) {
     engine::AsyncNoSpan(blocking_task_processor_, [this, key, value] {
-        rocksdb::Status status = db_->Put(rocksdb::WriteOptions(), key, value);
+        rocksdb::Status status = db_.Put(rocksdb::WriteOptions(), column_family_, key, value);
         CheckStatus(status, "Put");
     }).Get();
 }
 
-std::string Client::Get(std::string_view key) {
+std::string Client::Get(std::string_view key) { return DoGet(key, nullptr); }
+
+void Client::Delete(std::string_view key) {
     return engine::AsyncNoSpan(
                blocking_task_processor_,
                [this, key] {
+                   rocksdb::Status status = db_.Delete(rocksdb::WriteOptions(), column_family_, key);
+                   CheckStatus(status, "Delete");
+               }
+    ).Get();
+}
+
+std::vector<std::optional<std::string>> Client::MultiGet(const std::vector<std::string_view>& keys) {
+    return DoMultiGet(keys, nullptr);
+}
+
+void Client::Write(WriteBatch&& batch) {
+    if (batch.IsEmpty()) return;
+
+    engine::AsyncNoSpan(blocking_task_processor_, [this, &batch] {
+        rocksdb::WriteBatch rocks_batch;
+        for (const auto& operation : batch.operations_) {
+            switch (operation.type) {
+                case WriteBatch::OperationType::kPut:
+                    rocks_batch.Put(column_family_, operation.key, operation.value);
+                    break;
+                case WriteBatch::OperationType::kDelete:
+                    rocks_batch.Delete(column_family_, operation.key);
+                    break;
+                case WriteBatch::OperationType::kDeleteRange:
+                    rocks_batch.DeleteRange(column_family_, operation.key, operation.value);
+                    break;
+            }
+        }
+        rocksdb::Status status = db_.Write(rocksdb::WriteOptions(), &rocks_batch);
+        CheckStatus(status, "Write");
+    }).Get();
+}
+
+Cursor Client::ScanPrefix(std::string_view prefix, std::size_t chunk_size) {
+    return DoScanPrefix(prefix, chunk_size, nullptr);
+}
+
+Cursor Client::ScanRange(std::string_view begin, std::optional<std::string_view> end, std::size_t chunk_size) {
+    return DoScanRange(begin, end, chunk_size, nullptr);
+}
+
+Snapshot Client::MakeSnapshot() { return Snapshot{*this, db_.GetSnapshot()}; }
+
+void Client::CheckStatus(rocksdb::Status status, std::string_view method_name) {
+    if (!status.ok() && !status.IsNotFound()) {
+        throw USERVER_NAMESPACE::storages::rocks::RequestFailedException(method_name, status.ToString());
+    }
+}
+
+std::string Client::DoGet(std::string_view key, const rocksdb::Snapshot* snapshot) {
+    return engine::AsyncNoSpan(
+               blocking_task_processor_,
+               [this, key, snapshot] {
+                   rocksdb::ReadOptions options;
+                   options.snapshot = snapshot;
                    std::string res;
-                   rocksdb::Status status = db_->Get(rocksdb::ReadOptions(), key, &res);
+                   rocksdb::Status status = db_.Get(options, column_family_, key, &res);
                    CheckStatus(status, "Get");
                    return res;
                }
     ).Get();
 }
 
-void Client::Delete(std::string_view key) {
+std::vector<std::optional<std::string>>
+Client::DoMultiGet(const std::vector<std::string_view>& keys, const rocksdb::Snapshot* snapshot) {
+    if (keys.empty()) return {};
+
     return engine::AsyncNoSpan(
                blocking_task_processor_,
-               [this, key] {
-                   rocksdb::Status status = db_->Delete(rocksdb::WriteOptions(), key);
-                   CheckStatus(status, "Delete");
+               [this, &keys, snapshot] {
+                   rocksdb::ReadOptions options;
+                   options.snapshot = snapshot;
+                   const std::vector<rocksdb::Slice> slices(keys.begin(), keys.end());
+                   const std::vector<rocksdb::ColumnFamilyHandle*> column_families(keys.size(), column_family_);
+                   std::vector<std::string> values;
+                   const auto statuses = db_.MultiGet(options, column_families, slices, &values);
+
+                   std::vector<std::optional<std::string>> result(keys.size());
+                   for (std::size_t i = 0; i < keys.size(); ++i) {
+                       CheckStatus(statuses[i], "MultiGet");
+                       if (statuses[i].ok()) result[i] = std::move(values[i]);
+                   }
+                   return result;
                }
     ).Get();
 }
 
-void Client::CheckStatus(rocksdb::Status status, std::string_view method_name) {
-    if (!status.ok() && !status.IsNotFound()) {
-        throw USERVER_NAMESPACE::storages::rocks::RequestFailedException(method_name, status.ToString());
-    }
+Cursor Client::DoScanPrefix(std::string_view prefix, std::size_t chunk_size, const rocksdb::Snapshot* snapshot) {
+    const auto end = GetPrefixEnd(prefix);
+    return DoScanRange(prefix, end ? std::optional<std::string_view>{*end} : std::nullopt, chunk_size, snapshot);
+}
+
+Cursor Client::DoScanRange(
+    std::string_view begin,
+    std::optional<std::string_view> end,
+    std::size_t chunk_size,
+    const rocksdb::Snapshot* snapshot
+) {
+    if (chunk_size == 0) throw std::invalid_argument("Cursor chunk size must be positive");
+    return Cursor{std::make_unique<Cursor::Impl>(
+        db_,
+        column_family_,
+        blocking_task_processor_,
+        std::string{begin},
+        end ? std::optional<std::string>{*end} : std::nullopt,
+        chunk_size,
+        snapshot
+    )};
 }
+
+void Client::ReleaseSnapshot(const rocksdb::Snapshot* snapshot) noexcept { db_.ReleaseSnapshot(snapshot); }
+
+void DumpMetric(utils::statistics::Writer& writer, const Client& client) { writer = *client.database_; }
+
 }  // namespace storages::rocks
 
 USERVER_NAMESPACE_END
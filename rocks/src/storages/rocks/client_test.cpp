@@ -1,6 +1,15 @@
 #include <userver/storages/rocks/client.hpp>
+
+#include <chrono>
+#include <string>
+#include <string_view>
+
+#include <userver/engine/sleep.hpp>
+#include <userver/storages/rocks/exception.hpp>
 #include <userver/utest/utest.hpp>
 #include <userver/utils/async.hpp>
+#include <userver/utils/statistics/storage.hpp>
+#include <userver/utils/statistics/testing.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -24,6 +33,165 @@ UTEST(Rocks, CheckCRUD) {
     EXPECT_EQ("", res);
 }
 
+std::vector<storages::rocks::KeyValue> ReadAll(storages::rocks::Cursor&& cursor) {
+    std::vector<storages::rocks::KeyValue> result;
+    while (!cursor.IsFinished()) {
+        auto chunk = cursor.NextChunk();
+        EXPECT_LE(chunk.size(), 2);
+        for (auto& kv : chunk) result.push_back(std::move(kv));
+    }
+    EXPECT_TRUE(cursor.NextChunk().empty());
+    return result;
+}
+
+std::vector<std::string> Keys(const std::vector<storages::rocks::KeyValue>& records) {
+    std::vector<std::string> result;
+    for (const auto& kv : records) result.push_back(kv.key);
+    return result;
+}
+
+UTEST(Rocks, MultiGetAndWriteBatch) {
+    storages::rocks::Client client{"/tmp/rocksdb_batch_example", engine::current_task::GetTaskProcessor()};
+
+    storages::rocks::WriteBatch batch;
+    batch.Put("a", "1");
+    batch.Put("b", "2");
+    batch.Put("c", "3");
+    batch.Delete("c");
+    EXPECT_EQ(batch.GetSize(), 4);
+    client.Write(std::move(batch));
+
+    const auto values = client.MultiGet({"a", "b", "c"});
+    ASSERT_EQ(values.size(), 3);
+    EXPECT_EQ(values[0], std::optional<std::string>{"1"});
+    EXPECT_EQ(values[1], std::optional<std::string>{"2"});
+    EXPECT_EQ(values[2], std::nullopt);
+    EXPECT_TRUE(client.MultiGet({}).empty());
+
+    storages::rocks::WriteBatch cleanup;
+    cleanup.DeleteRange("a", "c");
+    client.Write(std::move(cleanup));
+    EXPECT_EQ(client.MultiGet({"a", "b"}), (std::vector<std::optional<std::string>>{std::nullopt, std::nullopt}));
+}
+
+UTEST(Rocks, Scan) {
+    storages::rocks::Client client{"/tmp/rocksdb_scan_example", engine::current_task::GetTaskProcessor()};
+
+    storages::rocks::WriteBatch batch;
+    for (const auto* key : {"user:1", "user:2", "user:3", "users", "item:1", "user\xff"}) batch.Put(key, key);
+    client.Write(std::move(batch));
+
+    EXPECT_EQ(
+        Keys(ReadAll(client.ScanPrefix("user:", 2))), (std::vector<std::string>{"user:1", "user:2", "user:3"})
+    );
+    EXPECT_EQ(Keys(ReadAll(client.ScanRange("user:2", "users", 2))), (std::vector<std::string>{"user:2", "user:3"}));
+    EXPECT_EQ(
+        Keys(ReadAll(client.ScanRange("users", std::nullopt, 2))), (std::vector<std::string>{"users", "user\xff"})
+    );
+    EXPECT_TRUE(ReadAll(client.ScanPrefix("order:", 2)).empty());
+}
+
+UTEST(Rocks, Snapshot) {
+    storages::rocks::Client client{"/tmp/rocksdb_snapshot_example", engine::current_task::GetTaskProcessor()};
+    client.Put("key", "old");
+
+    auto snapshot = client.MakeSnapshot();
+    client.Put("key", "new");
+    client.Put("key2", "new");
+
+    EXPECT_EQ(snapshot.Get("key"), "old");
+    EXPECT_EQ(snapshot.MultiGet({"key", "key2"}), (std::vector<std::optional<std::string>>{"old", std::nullopt}));
+    EXPECT_EQ(Keys(ReadAll(snapshot.ScanPrefix("key", 2))), (std::vector<std::string>{"key"}));
+    EXPECT_EQ(client.Get("key"), "new");
+
+    client.Delete("key");
+    client.Delete("key2");
+}
+
+UTEST(Rocks, ColumnFamilies) {
+    storages::rocks::Settings settings;
+    settings.block_cache_size = 8 * 1024 * 1024;
+    storages::rocks::ColumnFamilySettings users;
+    users.name = "users";
+    users.bloom_filter_bits_per_key = 10;
+    users.compression_per_level = {storages::rocks::Compression::kNone, storages::rocks::Compression::kLz4};
+    settings.column_families.push_back(users);
+
+    storages::rocks::Client client{
+        "/tmp/rocksdb_column_families_example", settings, engine::current_task::GetTaskProcessor()
+    };
+    const auto users_client = client.MakeColumnFamilyClient("users");
+    EXPECT_THROW(client.MakeColumnFamilyClient("orders"), storages::rocks::Exception);
+
+    client.Put("key", "default");
+    storages::rocks::WriteBatch batch;
+    batch.Put("key", "users");
+    users_client->Write(std::move(batch));
+
+    EXPECT_EQ(client.Get("key"), "default");
+    EXPECT_EQ(users_client->Get("key"), "users");
+    EXPECT_EQ(Keys(ReadAll(users_client->ScanPrefix("k", 2))), (std::vector<std::string>{"key"}));
+
+    client.Delete("key");
+    users_client->Delete("key");
+    EXPECT_EQ(users_client->Get("key"), "");
+}
+
+UTEST(Rocks, Statistics) {
+    storages::rocks::Settings settings;
+    settings.statistics_enabled = true;
+    settings.statistics_period = std::chrono::milliseconds{10};
+    storages::rocks::Client client{
+        "/tmp/rocksdb_statistics_example", settings, engine::current_task::GetTaskProcessor()
+    };
+    client.Put("key", "value");
+    client.Get("key");
+
+    utils::statistics::Storage storage;
+    const auto holder = storage.RegisterWriter("rocks", [&](utils::statistics::Writer& writer) { writer = client; });
+    const auto wait_for_timing = [&storage](std::string_view path, bool is_expected_zero) {
+        while (true) {
+            const utils::statistics::Snapshot snapshot{storage, "rocks"};
+            if ((snapshot.SingleMetric(std::string{path}).AsFloat() == 0) == is_expected_zero) return;
+            engine::SleepFor(std::chrono::milliseconds{1});
+        }
+    };
+
+    const utils::statistics::Snapshot snapshot{storage, "rocks"};
+    EXPECT_EQ(snapshot.SingleMetric("keys.written").AsRate(), 1);
+    EXPECT_EQ(snapshot.SingleMetric("keys.read").AsRate(), 1);
+    EXPECT_NO_THROW(snapshot.SingleMetric("column-family.keys", {{"rocks_column_family", "default"}}));
+
+    // Dumps have no side effects, tickers stay monotonic over the resets
+    const utils::statistics::Snapshot same_snapshot{storage, "rocks"};
+    EXPECT_EQ(same_snapshot.SingleMetric("keys.read").AsRate(), 1);
+
+    // Timings cover only the last period
+    wait_for_timing("timings-us.get.max", false);
+    wait_for_timing("timings-us.write.max", true);
+
+    client.Get("key");
+    const utils::statistics::Snapshot next_snapshot{storage, "rocks"};
+    EXPECT_EQ(next_snapshot.SingleMetric("keys.written").AsRate(), 1);
+    EXPECT_EQ(next_snapshot.SingleMetric("keys.read").AsRate(), 2);
+
+    client.Delete("key");
+}
+
+UTEST(Rocks, StatisticsDisabled) {
+    storages::rocks::Client client{"/tmp/rocksdb_statistics_example", engine::current_task::GetTaskProcessor()};
+    client.Put("key", "value");
+
+    utils::statistics::Storage storage;
+    const auto holder = storage.RegisterWriter("rocks", [&](utils::statistics::Writer& writer) { writer = client; });
+    const utils::statistics::Snapshot snapshot{storage, "rocks"};
+
+    EXPECT_THROW(snapshot.SingleMetric("keys.written"), utils::statistics::MetricQueryError);
+    EXPECT_NO_THROW(snapshot.SingleMetric("column-family.keys", {{"rocks_column_family", "default"}}));
+
+    client.Delete("key");
+}
+
 }  // namespace
 
 USERVER_NAMESPACE_END
@@ -2,7 +2,10 @@
 
 #include <memory>
 
+#include <userver/components/statistics_storage.hpp>
 #include <userver/storages/rocks/client.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/statistics/writer.hpp>
 #include <userver/yaml_config/merge_schemas.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -13,11 +16,28 @@ Component::Component(const components::ComponentConfig& config, const components
     : ComponentBase(config, context),
       client_ptr_(std::make_shared<storages::rocks::Client>(
           config["db-path"].As<std::string>(),
+          config.As<Settings>(),
           context.GetTaskProcessor(config["task-processor"].As<std::string>())
-      )) {}
+      )) {
+    auto& statistics_storage = context.FindComponent<components::StatisticsStorage>();
+    statistics_holder_ = statistics_storage.GetStorage().RegisterWriter(
+        "rocks",
+        [this](utils::statistics::Writer& writer) {
+            UASSERT(client_ptr_);
+            writer = *client_ptr_;
+        },
+        {{"rocks_database", config.Name()}}
+    );
+}
+
+Component::~Component() { statistics_holder_.Unregister(); }
 
 storages::rocks::ClientPtr Component::MakeClient() { return client_ptr_; }
 
+storages::rocks::ClientPtr Component::MakeClient(std::string_view column_family) {
+    return client_ptr_->MakeColumnFamilyClient(column_family);
+}
+
 yaml_config::Schema Component::GetStaticConfigSchema() {
     return yaml_config::MergeSchemas<ComponentBase>(R"(
 type: object
@@ -30,6 +50,79 @@ properties:
     db-path:
         type: string
         description: path to database file
+    block-cache-size:
+        type: integer
+        description: |
+            size in bytes of the block cache shared by all the databases of the
+            process, 0 for a separate default cache per database
+        defaultDescription: 0
+        minimum: 0
+    statistics-enabled:
+        type: boolean
+        description: collect RocksDB tickers and histograms for the metrics
+        defaultDescription: false
+    statistics-period:
+        type: string
+        description: period of the operation timings in the metrics
+        defaultDescription: 10s
+    max-background-jobs:
+        type: integer
+        description: max number of concurrent background flushes and compactions
+        defaultDescription: 2
+        minimum: 1
+    column-families:
+        type: array
+        description: column families to open or create
+        defaultDescription: '[]'
+        items:
+            type: object
+            description: column family settings
+            additionalProperties: false
+            properties:
+                name:
+                    type: string
+                    description: name of the column family, 'default' to tune the default one
+                write-buffer-size:
+                    type: integer
+                    description: size in bytes of a single memtable
+                    defaultDescription: 67108864
+                    minimum: 1
+                max-write-buffer-number:
+                    type: integer
+                    description: max number of memtables, including the ones being flushed
+                    defaultDescription: 2
+                    minimum: 1
+                compaction-style:
+                    type: string
+                    description: compaction style
+                    defaultDescription: level
+                    enum:
+                      - level
+                      - universal
+                      - fifo
+                bloom-filter-bits-per-key:
+                    type: number
+                    description: bits per key of the bloom filter, 0 to disable the filter
+                    defaultDescription: 0
+                    minimum: 0
+                block-size:
+                    type: integer
+                    description: size in bytes of an uncompressed data block
+                    defaultDescription: 4096
+                    minimum: 1
+                compression-per-level:
+                    type: array
+                    description: compression of each LSM level
+                    defaultDescription: RocksDB default compression for all the levels
+                    items:
+                        type: string
+                        description: compression algorithm
+                        enum:
+                          - none
+                          - snappy
+                          - zlib
+                          - lz4
+                          - zstd
 )");
 }
 }  // namespace storages::rocks
@@ -0,0 +1,77 @@
+#include <userver/storages/rocks/cursor.hpp>
+
+#include <userver/storages/rocks/exception.hpp>
+#include <userver/utils/async.hpp>
+
+#include <storages/rocks/cursor_impl.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::rocks {
+
+Cursor::Impl::Impl(
+    rocksdb::DB& db,
+    rocksdb::ColumnFamilyHandle* column_family,
+    engine::TaskProcessor& blocking_task_processor,
+    std::string begin,
+    std::optional<std::string> end,
+    std::size_t chunk_size,
+    const rocksdb::Snapshot* snapshot
+)
+    : db(db),
+      column_family(column_family),
+      blocking_task_processor(blocking_task_processor),
+      begin(std::move(begin)),
+      end(std::move(end)),
+      chunk_size(chunk_size) {
+    options.snapshot = snapshot;
+    if (this->end) {
+        end_slice = rocksdb::Slice{*this->end};
+        options.iterate_upper_bound = &end_slice;
+    }
+}
+
+Cursor::Cursor(std::unique_ptr<Impl>&& impl) : impl_(std::move(impl)) {}
+
+Cursor::Cursor(Cursor&&) noexcept = default;
+
+Cursor& Cursor::operator=(Cursor&&) noexcept = default;
+
+Cursor::~Cursor() = default;
+
+std::vector<KeyValue> Cursor::NextChunk() {
+    if (IsFinished()) return {};
+
+    return engine::AsyncNoSpan(
+               impl_->blocking_task_processor,
+               [&impl = *impl_] {
+                   if (!impl.iterator) {
+                       impl.iterator.reset(impl.db.NewIterator(impl.options, impl.column_family));
+                       impl.iterator->Seek(impl.begin);
+                   }
+
+                   auto& it = *impl.iterator;
+                   std::vector<KeyValue> chunk;
+                   chunk.reserve(impl.chunk_size);
+                   for (; it.Valid() && chunk.size() < impl.chunk_size; it.Next()) {
+                       chunk.push_back(KeyValue{it.key().ToString(), it.value().ToString()});
+                   }
+
+                   const auto status = it.status();
+                   if (!status.ok()) {
+                       throw RequestFailedException("Scan", status.ToString());
+                   }
+                   if (!it.Valid()) {
+                       impl.finished = true;
+                       impl.iterator.reset();
+                   }
+                   return chunk;
+               }
+    ).Get();
+}
+
+bool Cursor::IsFinished() const noexcept { return !impl_ || impl_->finished; }
+
+}  // namespace storages::rocks
+
+USERVER_NAMESPACE_END
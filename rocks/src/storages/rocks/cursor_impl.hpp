@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+
+#include <rocksdb/db.h>
+
+#include <userver/engine/task/task_processor_fwd.hpp>
+#include <userver/storages/rocks/cursor.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::rocks {
+
+struct Cursor::Impl final {
+    Impl(
+        rocksdb::DB& db,
+        rocksdb::ColumnFamilyHandle* column_family,
+        engine::TaskProcessor& blocking_task_processor,
+        std::string begin,
+        std::optional<std::string> end,
+        std::size_t chunk_size,
+        const rocksdb::Snapshot* snapshot
+    );
+
+    rocksdb::DB& db;
+    rocksdb::ColumnFamilyHandle* const column_family;
+    engine::TaskProcessor& blocking_task_processor;
+    const std::string begin;
+    const std::optional<std::string> end;
+    // Must outlive the iterator, as rocksdb::ReadOptions refers to it
+    rocksdb::Slice end_slice;
+    rocksdb::ReadOptions options;
+    const std::size_t chunk_size;
+
+    std::unique_ptr<rocksdb::Iterator> iterator;
+    bool finished{false};
+};
+
+}  // namespace storages::rocks
+
+USERVER_NAMESPACE_END
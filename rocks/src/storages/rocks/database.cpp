@@ -0,0 +1,263 @@
+#include <storages/rocks/database.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <mutex>
+#include <optional>
+
+#include <rocksdb/filter_policy.h>
+#include <rocksdb/table.h>
+
+#include <userver/storages/rocks/exception.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/statistics/rate.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::rocks::impl {
+
+namespace {
+
+// Databases of the process share a single block cache, so that the memory
+// limit is global and the hot blocks of a small database are not evicted by
+// the scans of a large one.
+std::shared_ptr<rocksdb::Cache> GetSharedBlockCache(std::size_t capacity) {
+    static std::mutex mutex;
+    static std::weak_ptr<rocksdb::Cache> shared_cache;
+
+    const std::lock_guard lock{mutex};
+    auto cache = shared_cache.lock();
+    if (!cache) {
+        cache = rocksdb::NewLRUCache(capacity);
+        shared_cache = cache;
+    } else if (cache->GetCapacity() < capacity) {
+        cache->SetCapacity(capacity);
+    }
+    return cache;
+}
+
+rocksdb::CompactionStyle ToRocks(CompactionStyle style) {
+    switch (style) {
+        case CompactionStyle::kLevel:
+            return rocksdb::kCompactionStyleLevel;
+        case CompactionStyle::kUniversal:
+            return rocksdb::kCompactionStyleUniversal;
+        case CompactionStyle::kFifo:
+            return rocksdb::kCompactionStyleFIFO;
+    }
+    UINVARIANT(false, "Unexpected compaction style");
+}
+
+rocksdb::CompressionType ToRocks(Compression compression) {
+    switch (compression) {
+        case Compression::kNone:
+            return rocksdb::kNoCompression;
+        case Compression::kSnappy:
+            return rocksdb::kSnappyCompression;
+        case Compression::kZlib:
+            return rocksdb::kZlibCompression;
+        case Compression::kLz4:
+            return rocksdb::kLZ4Compression;
+        case Compression::kZstd:
+            return rocksdb::kZSTD;
+    }
+    UINVARIANT(false, "Unexpected compression");
+}
+
+rocksdb::ColumnFamilyOptions
+MakeColumnFamilyOptions(const ColumnFamilySettings& settings, const std::shared_ptr<rocksdb::Cache>& block_cache) {
+    rocksdb::ColumnFamilyOptions options;
+    options.write_buffer_size = settings.write_buffer_size;
+    options.max_write_buffer_number = settings.max_write_buffer_number;
+    options.compaction_style = ToRocks(settings.compaction_style);
+    for (const auto compression : settings.compression_per_level) {
+        options.compression_per_level.push_back(ToRocks(compression));
+    }
+
+    rocksdb::BlockBasedTableOptions table_options;
+    table_options.block_size = settings.block_size;
+    if (block_cache) table_options.block_cache = block_cache;
+    if (settings.bloom_filter_bits_per_key > 0) {
+        table_options.filter_policy.reset(rocksdb::NewBloomFilterPolicy(settings.bloom_filter_bits_per_key));
+    }
+    options.table_factory.reset(rocksdb::NewBlockBasedTableFactory(table_options));
+    return options;
+}
+
+// Configured column families first, then the ones that exist in the database
+// but are not configured. The default column family is always there.
+std::vector<ColumnFamilySettings>
+GetColumnFamilies(const std::string& db_path, const rocksdb::DBOptions& db_options, const Settings& settings) {
+    std::vector<ColumnFamilySettings> result = settings.column_families;
+    const auto add_missing = [&result](const std::string& name) {
+        const auto it = std::find_if(result.begin(), result.end(), [&name](const auto& cf) { return cf.name == name; });
+        if (it == result.end()) {
+            ColumnFamilySettings cf;
+            cf.name = name;
+            result.push_back(std::move(cf));
+        }
+    };
+
+    add_missing(std::string{kDefaultColumnFamily});
+
+    std::vector<std::string> existing;
+    // Fails if the database does not exist yet, there is nothing to add then
+    if (rocksdb::DB::ListColumnFamilies(db_options, db_path, &existing).ok()) {
+        for (const auto& name : existing) add_missing(name);
+    }
+    return result;
+}
+
+struct TickerMetric final {
+    std::string_view path;
+    rocksdb::Tickers ticker;
+};
+
+constexpr TickerMetric kTickerMetrics[] = {
+    {"block-cache.hits", rocksdb::BLOCK_CACHE_HIT},
+    {"block-cache.misses", rocksdb::BLOCK_CACHE_MISS},
+    {"bloom-filter.useful", rocksdb::BLOOM_FILTER_USEFUL},
+    {"memtable.hits", rocksdb::MEMTABLE_HIT},
+    {"memtable.misses", rocksdb::MEMTABLE_MISS},
+    {"keys.read", rocksdb::NUMBER_KEYS_READ},
+    {"keys.written", rocksdb::NUMBER_KEYS_WRITTEN},
+    {"bytes.read", rocksdb::BYTES_READ},
+    {"bytes.written", rocksdb::BYTES_WRITTEN},
+    {"compaction.read-bytes", rocksdb::COMPACT_READ_BYTES},
+    {"compaction.write-bytes", rocksdb::COMPACT_WRITE_BYTES},
+    {"flush.write-bytes", rocksdb::FLUSH_WRITE_BYTES},
+    {"stall.time-us", rocksdb::STALL_MICROS},
+};
+
+struct HistogramMetric final {
+    std::string_view name;
+    rocksdb::Histograms histogram;
+};
+
+constexpr HistogramMetric kHistogramMetrics[] = {
+    {"get", rocksdb::DB_GET},
+    {"multiget", rocksdb::DB_MULTIGET},
+    {"write", rocksdb::DB_WRITE},
+    {"seek", rocksdb::DB_SEEK},
+    {"compaction", rocksdb::COMPACTION_TIME},
+};
+
+std::optional<std::uint64_t>
+GetIntProperty(rocksdb::DB& db, rocksdb::ColumnFamilyHandle* column_family, const std::string& property) {
+    std::uint64_t value = 0;
+    if (!db.GetIntProperty(column_family, property, &value)) return std::nullopt;
+    return value;
+}
+
+}  // namespace
+
+Database::Database(const std::string& db_path, const Settings& settings) {
+    if (settings.block_cache_size != 0) block_cache_ = GetSharedBlockCache(settings.block_cache_size);
+
+    rocksdb::DBOptions db_options;
+    db_options.create_if_missing = true;
+    db_options.create_missing_column_families = true;
+    db_options.max_background_jobs = settings.max_background_jobs;
+    if (settings.statistics_enabled) {
+        statistics_ = rocksdb::CreateDBStatistics();
+        db_options.statistics = statistics_;
+        ticker_totals_.resize(std::size(kTickerMetrics));
+        histograms_.resize(std::size(kHistogramMetrics));
+    }
+
+    std::vector<rocksdb::ColumnFamilyDescriptor> descriptors;
+    for (const auto& column_family : GetColumnFamilies(db_path, db_options, settings)) {
+        descriptors.emplace_back(column_family.name, MakeColumnFamilyOptions(column_family, block_cache_));
+    }
+
+    rocksdb::DB* db{};
+    const auto status = rocksdb::DB::Open(db_options, db_path, descriptors, &column_families_, &db);
+    db_.reset(db);
+    if (!status.ok()) throw RequestFailedException("Create client", status.ToString());
+
+    if (statistics_) {
+        statistics_task_.Start("rocks-statistics", settings.statistics_period, [this] { UpdateStatistics(); });
+    }
+}
+
+Database::~Database() {
+    statistics_task_.Stop();
+    if (!db_) return;
+    // Handles must be destroyed before the database is closed
+    for (auto* column_family : column_families_) db_->DestroyColumnFamilyHandle(column_family);
+}
+
+rocksdb::ColumnFamilyHandle* Database::FindColumnFamily(std::string_view name) const noexcept {
+    for (auto* column_family : column_families_) {
+        if (column_family->GetName() == name) return column_family;
+    }
+    return nullptr;
+}
+
+void Database::UpdateStatistics() {
+    std::vector<rocksdb::HistogramData> histograms(std::size(kHistogramMetrics));
+    for (std::size_t i = 0; i < std::size(kHistogramMetrics); ++i) {
+        statistics_->histogramData(kHistogramMetrics[i].histogram, &histograms[i]);
+    }
+
+    const std::lock_guard lock{statistics_mutex_};
+    for (std::size_t i = 0; i < std::size(kTickerMetrics); ++i) {
+        ticker_totals_[i] += statistics_->getAndResetTickerCount(kTickerMetrics[i].ticker);
+    }
+    // RocksDB histograms are cumulative and can only be reset together with
+    // the tickers, so only the ticks between the two resets are lost
+    statistics_->Reset();
+    histograms_ = std::move(histograms);
+}
+
+void DumpMetric(utils::statistics::Writer& writer, const Database& database) {
+    auto& db = *database.db_;
+
+    if (database.statistics_) {
+        const std::lock_guard lock{database.statistics_mutex_};
+
+        for (std::size_t i = 0; i < std::size(kTickerMetrics); ++i) {
+            const auto& metric = kTickerMetrics[i];
+            const auto total = database.ticker_totals_[i] + database.statistics_->getTickerCount(metric.ticker);
+            writer[metric.path] = utils::statistics::Rate{total};
+        }
+
+        auto timings = writer["timings-us"];
+        for (std::size_t i = 0; i < std::size(kHistogramMetrics); ++i) {
+            const auto& data = database.histograms_[i];
+            auto histogram = timings[kHistogramMetrics[i].name];
+            histogram["p50"] = data.median;
+            histogram["p95"] = data.percentile95;
+            histogram["p99"] = data.percentile99;
+            histogram["max"] = data.max;
+        }
+    }
+
+    const auto write_property = [&db](utils::statistics::Writer&& writer, const std::string& property) {
+        if (const auto value = GetIntProperty(db, db.DefaultColumnFamily(), property)) writer = *value;
+    };
+    write_property(writer["block-cache"]["usage"], rocksdb::DB::Properties::kBlockCacheUsage);
+    write_property(writer["block-cache"]["capacity"], rocksdb::DB::Properties::kBlockCacheCapacity);
+    write_property(writer["compaction"]["running"], rocksdb::DB::Properties::kNumRunningCompactions);
+    write_property(writer["flush"]["running"], rocksdb::DB::Properties::kNumRunningFlushes);
+
+    auto cf_writer = writer["column-family"];
+    for (auto* column_family : database.column_families_) {
+        const utils::statistics::LabelView label{"rocks_column_family", column_family->GetName()};
+        const auto write_cf_property = [&](std::string_view path, const std::string& property) {
+            if (const auto value = GetIntProperty(db, column_family, property)) {
+                cf_writer[path].ValueWithLabels(*value, label);
+            }
+        };
+        write_cf_property("keys", rocksdb::DB::Properties::kEstimateNumKeys);
+        write_cf_property("sst-files-size", rocksdb::DB::Properties::kTotalSstFilesSize);
+        write_cf_property("memtables-size", rocksdb::DB::Properties::kCurSizeAllMemTables);
+        write_cf_property("pending-compaction-bytes", rocksdb::DB::Properties::kEstimatePendingCompactionBytes);
+    }
+}
+
+}  // namespace storages::rocks::impl
+
+USERVER_NAMESPACE_END
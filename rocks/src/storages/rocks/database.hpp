@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <rocksdb/cache.h>
+#include <rocksdb/db.h>
+#include <rocksdb/statistics.h>
+
+#include <userver/storages/rocks/settings.hpp>
+#include <userver/utils/periodic_task.hpp>
+#include <userver/utils/statistics/fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::rocks::impl {
+
+/// RocksDB database with its column families, shared by the clients of all
+/// the column families.
+class Database final {
+public:
+    Database(const std::string& db_path, const Settings& settings);
+    ~Database();
+
+    Database(const Database&) = delete;
+    Database& operator=(const Database&) = delete;
+
+    rocksdb::DB& Get() const noexcept { return *db_; }
+
+    rocksdb::ColumnFamilyHandle* GetDefaultColumnFamily() const noexcept { return db_->DefaultColumnFamily(); }
+
+    /// @returns nullptr if there is no such column family
+    rocksdb::ColumnFamilyHandle* FindColumnFamily(std::string_view name) const noexcept;
+
+    friend void DumpMetric(utils::statistics::Writer& writer, const Database& database);
+
+private:
+    void UpdateStatistics();
+
+    std::shared_ptr<rocksdb::Cache> block_cache_;
+    std::shared_ptr<rocksdb::Statistics> statistics_;
+    // The statistics are reset each `statistics_period` for the histograms to
+    // cover a single period, the tickers are accumulated here to stay monotonic.
+    // Only the periodic task resets them, the metrics dumps just read.
+    mutable std::mutex statistics_mutex_;
+    std::vector<std::uint64_t> ticker_totals_;
+    std::vector<rocksdb::HistogramData> histograms_;
+    std::unique_ptr<rocksdb::DB> db_;
+    std::vector<rocksdb::ColumnFamilyHandle*> column_families_;
+    utils::PeriodicTask statistics_task_;
+};
+
+}  // namespace storages::rocks::impl
+
+USERVER_NAMESPACE_END
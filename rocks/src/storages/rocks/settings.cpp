@@ -0,0 +1,65 @@
+#include <userver/storages/rocks/settings.hpp>
+
+#include <userver/utils/trivial_map.hpp>
+#include <userver/yaml_config/yaml_config.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::rocks {
+
+namespace {
+
+constexpr utils::TrivialBiMap kCompactionStyleMap([](auto selector) {
+    return selector()
+        .Case(CompactionStyle::kLevel, "level")
+        .Case(CompactionStyle::kUniversal, "universal")
+        .Case(CompactionStyle::kFifo, "fifo");
+});
+
+constexpr utils::TrivialBiMap kCompressionMap([](auto selector) {
+    return selector()
+        .Case(Compression::kNone, "none")
+        .Case(Compression::kSnappy, "snappy")
+        .Case(Compression::kZlib, "zlib")
+        .Case(Compression::kLz4, "lz4")
+        .Case(Compression::kZstd, "zstd");
+});
+
+}  // namespace
+
+CompactionStyle Parse(const yaml_config::YamlConfig& value, formats::parse::To<CompactionStyle>) {
+    return utils::ParseFromValueString(value, kCompactionStyleMap);
+}
+
+Compression Parse(const yaml_config::YamlConfig& value, formats::parse::To<Compression>) {
+    return utils::ParseFromValueString(value, kCompressionMap);
+}
+
+ColumnFamilySettings Parse(const yaml_config::YamlConfig& value, formats::parse::To<ColumnFamilySettings>) {
+    ColumnFamilySettings settings;
+    settings.name = value["name"].As<std::string>();
+    settings.write_buffer_size = value["write-buffer-size"].As<std::size_t>(settings.write_buffer_size);
+    settings.max_write_buffer_number = value["max-write-buffer-number"].As<int>(settings.max_write_buffer_number);
+    settings.compaction_style = value["compaction-style"].As<CompactionStyle>(settings.compaction_style);
+    settings.bloom_filter_bits_per_key =
+        value["bloom-filter-bits-per-key"].As<double>(settings.bloom_filter_bits_per_key);
+    settings.block_size = value["block-size"].As<std::size_t>(settings.block_size);
+    settings.compression_per_level =
+        value["compression-per-level"].As<std::vector<Compression>>(settings.compression_per_level);
+    return settings;
+}
+
+Settings Parse(const yaml_config::YamlConfig& value, formats::parse::To<Settings>) {
+    Settings settings;
+    settings.block_cache_size = value["block-cache-size"].As<std::size_t>(settings.block_cache_size);
+    settings.statistics_enabled = value["statistics-enabled"].As<bool>(settings.statistics_enabled);
+    settings.statistics_period = value["statistics-period"].As<std::chrono::milliseconds>(settings.statistics_period);
+    settings.max_background_jobs = value["max-background-jobs"].As<int>(settings.max_background_jobs);
+    settings.column_families =
+        value["column-families"].As<std::vector<ColumnFamilySettings>>(settings.column_families);
+    return settings;
+}
+
+}  // namespace storages::rocks
+
+USERVER_NAMESPACE_END
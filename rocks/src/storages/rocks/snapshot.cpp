@@ -0,0 +1,46 @@
+#include <userver/storages/rocks/snapshot.hpp>
+
+#include <utility>
+
+#include <userver/storages/rocks/client.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::rocks {
+
+Snapshot::Snapshot(Client& client, const rocksdb::Snapshot* snapshot) noexcept
+    : client_(&client), snapshot_(snapshot) {}
+
+Snapshot::Snapshot(Snapshot&& other) noexcept
+    : client_(other.client_), snapshot_(std::exchange(other.snapshot_, nullptr)) {}
+
+Snapshot& Snapshot::operator=(Snapshot&& other) noexcept {
+    if (this != &other) {
+        if (snapshot_) client_->ReleaseSnapshot(snapshot_);
+        client_ = other.client_;
+        snapshot_ = std::exchange(other.snapshot_, nullptr);
+    }
+    return *this;
+}
+
+Snapshot::~Snapshot() {
+    if (snapshot_) client_->ReleaseSnapshot(snapshot_);
+}
+
+std::string Snapshot::Get(std::string_view key) { return client_->DoGet(key, snapshot_); }
+
+std::vector<std::optional<std::string>> Snapshot::MultiGet(const std::vector<std::string_view>& keys) {
+    return client_->DoMultiGet(keys, snapshot_);
+}
+
+Cursor Snapshot::ScanPrefix(std::string_view prefix, std::size_t chunk_size) {
+    return client_->DoScanPrefix(prefix, chunk_size, snapshot_);
+}
+
+Cursor Snapshot::ScanRange(std::string_view begin, std::optional<std::string_view> end, std::size_t chunk_size) {
+    return client_->DoScanRange(begin, end, chunk_size, snapshot_);
+}
+
+}  // namespace storages::rocks
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,29 @@
+#include <userver/storages/rocks/write_batch.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::rocks {
+
+WriteBatch::WriteBatch() = default;
+
+WriteBatch::~WriteBatch() = default;
+
+WriteBatch::WriteBatch(WriteBatch&&) noexcept = default;
+
+WriteBatch& WriteBatch::operator=(WriteBatch&&) noexcept = default;
+
+void WriteBatch::Put(std::string_view key, std::string_view value) {
+    operations_.push_back(Operation{OperationType::kPut, std::string{key}, std::string{value}});
+}
+
+void WriteBatch::Delete(std::string_view key) {
+    operations_.push_back(Operation{OperationType::kDelete, std::string{key}, {}});
+}
+
+void WriteBatch::DeleteRange(std::string_view begin, std::string_view end) {
+    operations_.push_back(Operation{OperationType::kDeleteRange, std::string{begin}, std::string{end}});
+}
+
+}  // namespace storages::rocks
+
+USERVER_NAMESPACE_END
@@ -27,3 +27,51 @@ async def test_hidden_file(service_client, service_source_dir):
     response = await service_client.get('/dir1/.hidden_file.txt')
     assert response.status == 404
     assert response.content.decode() == 'File not found'
+
+
+# index.html is larger than sendfile-min-size, so it is sent with sendfile(2)
+async def test_sendfile_range(service_client, service_source_dir):
+    file = service_source_dir.joinpath('public') / 'index.html'
+    content = file.read_bytes()
+
+    response = await service_client.get(
+        '/index.html', headers={'Range': 'bytes=1-80'},
+    )
+    assert response.status == 206
+    assert response.headers['Content-Range'] == f'bytes 1-80/{len(content)}'
+    assert response.content == content[1:81]
+
+    response = await service_client.get(
+        '/index.html', headers={'Range': f'bytes={len(content)}-'},
+    )
+    assert response.status == 416
+
+
+async def test_sendfile_etag(service_client, service_source_dir):
+    response = await service_client.get('/index.html')
+    assert response.status == 200
+    etag = response.headers['ETag']
+
+    response = await service_client.get(
+        '/index.html', headers={'If-None-Match': etag},
+    )
+    assert response.status == 304
+    assert response.content == b''
+
+    # A stale If-Range sends the whole file
+    response = await service_client.get(
+        '/index.html', headers={'Range': 'bytes=0-9', 'If-Range': '"stale"'},
+    )
+    assert response.status == 200
+    file = service_source_dir.joinpath('public') / 'index.html'
+    assert response.content == file.read_bytes()
+
+
+async def test_sendfile_head(service_client, service_source_dir):
+    response = await service_client.request('HEAD', '/index.html')
+    assert response.status == 200
+    file = service_source_dir.joinpath('public') / 'index.html'
+    assert response.headers['Content-Length'] == str(
+        len(file.read_bytes()),
+    )
+    assert response.content == b''
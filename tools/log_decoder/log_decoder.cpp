@@ -0,0 +1,117 @@
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+#include <boost/program_options.hpp>
+
+#include <logging/binary_record.hpp>
+#include <userver/logging/format.hpp>
+
+#include <userver/utest/using_namespace_userver.hpp>
+
+namespace {
+
+struct Config {
+    std::string input;
+    std::string format = "tskv";
+};
+
+Config ParseConfig(int argc, char** argv) {
+    namespace po = boost::program_options;
+
+    Config config;
+    po::options_description desc("Converts the logs written with 'format: binary' into text.\nAllowed options");
+    desc.add_options()("help,h", "produce help message")(
+        "format,f", po::value(&config.format)->default_value(config.format), "output format (tskv, ltsv, raw, json)"
+    )("input", po::value(&config.input), "binary log file, stdin if not set");
+
+    po::positional_options_description pos_desc;
+    pos_desc.add("input", 1);
+
+    po::variables_map vm;
+    try {
+        po::store(po::command_line_parser(argc, argv).options(desc).positional(pos_desc).run(), vm);
+        po::notify(vm);
+    } catch (const std::exception& ex) {
+        std::cerr << "Cannot parse command line: " << ex.what() << '\n';
+        exit(1);
+    }
+
+    if (vm.count("help")) {
+        std::cout << desc << '\n';
+        exit(0);
+    }
+
+    return config;
+}
+
+void FormatRecord(std::string_view record, const Config& config, std::string& out) {
+    if (config.format == "json") {
+        logging::impl::binary::FormatRecordAsJson(record, out);
+    } else {
+        logging::impl::binary::FormatRecord(record, logging::FormatFromString(config.format), out);
+    }
+}
+
+// Returns the number of the consumed bytes of `data`
+std::size_t DecodeRecords(std::string_view data, const Config& config, std::ostream& output) {
+    std::string out;
+    std::size_t consumed = 0;
+    while (true) {
+        const auto rest = data.substr(consumed);
+        const auto record_size = logging::impl::binary::GetRecordSize(rest);
+        if (record_size == 0 || record_size > rest.size()) break;
+
+        FormatRecord(rest.substr(0, record_size), config, out);
+        consumed += record_size;
+    }
+    output << out;
+    return consumed;
+}
+
+void Decode(std::istream& input, const Config& config) {
+    constexpr std::size_t kChunkSize = 1 << 16;
+
+    std::string data;
+    std::size_t offset = 0;
+    while (input) {
+        const auto old_size = data.size();
+        data.resize(old_size + kChunkSize);
+        input.read(data.data() + old_size, kChunkSize);
+        data.resize(old_size + input.gcount());
+
+        try {
+            const auto consumed = DecodeRecords(data, config, std::cout);
+            offset += consumed;
+            data.erase(0, consumed);
+        } catch (const std::exception& ex) {
+            std::cerr << "Failed to decode a record after offset " << offset << ": " << ex.what() << '\n';
+            exit(1);
+        }
+    }
+
+    if (!data.empty()) {
+        std::cerr << "Truncated record at offset " << offset << '\n';
+        exit(1);
+    }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const auto config = ParseConfig(argc, argv);
+
+    if (config.input.empty()) {
+        Decode(std::cin, config);
+    } else {
+        std::ifstream input{config.input, std::ios::binary};
+        if (!input) {
+            std::cerr << "Cannot open " << config.input << '\n';
+            return 1;
+        }
+        Decode(input, config);
+    }
+    return 0;
+}
@@ -24,6 +24,13 @@ public:
     explicit ErrWithCode(const char* errName) : DecompressionError(fmt::format("Decompression failed: {}", errName)) {}
 };
 
+/// Base class for compression errors
+class CompressionError : public std::runtime_error {
+public:
+    explicit CompressionError(const char* errName)
+        : std::runtime_error(fmt::format("Compression failed: {}", errName)) {}
+};
+
 }  // namespace compression
 
 USERVER_NAMESPACE_END
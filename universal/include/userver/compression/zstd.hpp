@@ -1,17 +1,61 @@
 #pragma once
 
+#include <memory>
+#include <string>
 #include <string_view>
 
 #include <userver/compression/error.hpp>
 
+struct ZSTD_CCtx_s;
+
 USERVER_NAMESPACE_BEGIN
 
 namespace compression::zstd {
 
+/// Default compression level, a good balance between speed and ratio
+inline constexpr int kDefaultLevel = 3;
+
 /// Decompresses the string.
 /// @throws DecompressionError
 std::string Decompress(std::string_view compressed, size_t max_size);
 
+/// Compresses the string into a single zstd frame.
+/// @throws CompressionError
+std::string Compress(std::string_view data, int level = kDefaultLevel);
+
+/// @brief Streaming compressor that produces a single zstd frame out of
+/// multiple chunks.
+///
+/// Output of each Flush() call may be decompressed on the receiving side
+/// without waiting for the following chunks.
+class Compressor final {
+public:
+    /// @throws CompressionError
+    explicit Compressor(int level = kDefaultLevel);
+
+    Compressor(Compressor&&) noexcept;
+    Compressor& operator=(Compressor&&) noexcept;
+    ~Compressor();
+
+    /// Compresses the chunk and flushes all the buffered data.
+    /// @throws CompressionError
+    std::string Flush(std::string_view chunk);
+
+    /// Compresses the last chunk and finishes the frame. The compressor must not
+    /// be used after that.
+    /// @throws CompressionError
+    std::string Finish(std::string_view chunk = {});
+
+private:
+    struct ContextDeleter {
+        void operator()(ZSTD_CCtx_s* context) const noexcept;
+    };
+
+    std::string Compress(std::string_view chunk, bool is_last);
+
+    std::unique_ptr<ZSTD_CCtx_s, ContextDeleter> context_;
+};
+
 }  // namespace compression::zstd
 
 USERVER_NAMESPACE_END
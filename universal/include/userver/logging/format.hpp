@@ -10,7 +10,10 @@ USERVER_NAMESPACE_BEGIN
 namespace logging {
 
 /// Log formats
-enum class Format { kTskv, kLtsv, kRaw };
+///
+/// Format::kBinary records keep the values unformatted and are converted to
+/// text by the logger consumer task or offline by the `log-decoder` tool.
+enum class Format { kTskv, kLtsv, kRaw, kBinary };
 
 /// Parse Format enum from string
 Format FormatFromString(std::string_view format_str);
@@ -5,6 +5,8 @@
 #include <zstd.h>
 #include <zstd_errors.h>
 
+#include <userver/utils/assert.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace compression::zstd {
@@ -80,5 +82,69 @@ std::string Decompress(std::string_view compressed, size_t max_size) {
     return decompressed;
 }
 
+std::string Compress(std::string_view data, int level) {
+    std::string compressed(ZSTD_compressBound(data.size()), '\0');
+    const auto compressed_size = ZSTD_compress(compressed.data(), compressed.size(), data.data(), data.size(), level);
+    if (ZSTD_isError(compressed_size)) {
+        throw CompressionError(ZSTD_getErrorName(compressed_size));
+    }
+
+    compressed.resize(compressed_size);
+    return compressed;
+}
+
+void Compressor::ContextDeleter::operator()(ZSTD_CCtx_s* context) const noexcept { ZSTD_freeCCtx(context); }
+
+Compressor::Compressor(int level) : context_(ZSTD_createCCtx()) {
+    if (!context_) {
+        throw std::runtime_error("Couldn't create ZSTD compression context");
+    }
+
+    if (const auto err_code = ZSTD_CCtx_setParameter(context_.get(), ZSTD_c_compressionLevel, level);
+        ZSTD_isError(err_code)) {
+        throw CompressionError(ZSTD_getErrorName(err_code));
+    }
+}
+
+Compressor::Compressor(Compressor&&) noexcept = default;
+
+Compressor& Compressor::operator=(Compressor&&) noexcept = default;
+
+Compressor::~Compressor() = default;
+
+std::string Compressor::Flush(std::string_view chunk) { return Compress(chunk, /*is_last=*/false); }
+
+std::string Compressor::Finish(std::string_view chunk) { return Compress(chunk, /*is_last=*/true); }
+
+std::string Compressor::Compress(std::string_view chunk, bool is_last) {
+    UASSERT(context_);
+    const auto directive = is_last ? ZSTD_e_end : ZSTD_e_flush;
+
+    std::string compressed;
+    // Usually enough to fit the whole output at once
+    compressed.resize(ZSTD_compressBound(chunk.size()));
+    std::size_t compressed_size = 0;
+
+    ZSTD_inBuffer input{chunk.data(), chunk.size(), 0};
+    while (true) {
+        if (compressed_size == compressed.size()) {
+            compressed.resize(compressed.size() + ZSTD_CStreamOutSize());
+        }
+
+        ZSTD_outBuffer output{compressed.data() + compressed_size, compressed.size() - compressed_size, 0};
+        const auto remaining = ZSTD_compressStream2(context_.get(), &output, &input, directive);
+        if (ZSTD_isError(remaining)) {
+            throw CompressionError(ZSTD_getErrorName(remaining));
+        }
+        compressed_size += output.pos;
+
+        // With ZSTD_e_flush and ZSTD_e_end zero means that the flush is complete
+        if (remaining == 0 && input.pos == input.size) break;
+    }
+
+    compressed.resize(compressed_size);
+    return compressed;
+}
+
 }  // namespace compression::zstd
 USERVER_NAMESPACE_END
@@ -60,4 +60,27 @@ TEST(Zstd, TestOverflow) {
     );
 }
 
+TEST(Zstd, CompressRoundTrip) {
+    const std::string str(16'000, 'a');
+
+    const auto compressed = compression::zstd::Compress(str);
+    EXPECT_LT(compressed.size(), str.size());
+    EXPECT_EQ(compression::zstd::Decompress(compressed, str.size()), str);
+}
+
+TEST(Zstd, CompressorChunks) {
+    const std::string chunk("This is a \"Very long\" msg!");
+
+    compression::zstd::Compressor compressor;
+    std::string compressed;
+    std::string expected;
+    for (int i = 0; i < 100; ++i) {
+        compressed += compressor.Flush(chunk);
+        expected += chunk;
+    }
+    compressed += compressor.Finish();
+
+    EXPECT_EQ(compression::zstd::Decompress(compressed, expected.size()), expected);
+}
+
 USERVER_NAMESPACE_END
@@ -1,5 +1,7 @@
 #include <http/header_map/danger.hpp>
 
+#include <http/header_map/known_headers.hpp>
+
 #include <userver/http/common_headers.hpp>
 
 #include <userver/utils/assert.hpp>
@@ -49,7 +51,7 @@ std::size_t Danger::SafeHash(std::string_view key) const noexcept {
 }
 
 std::size_t Danger::UnsafeHash(std::string_view key) noexcept {
-    return http::headers::impl::UnsafeConstexprHasher{}(key);
+    return UnsafeRuntimeHash(key);
 }
 
 }  // namespace http::headers::header_map
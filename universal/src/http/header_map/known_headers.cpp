@@ -0,0 +1,110 @@
+#include <http/header_map/known_headers.hpp>
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+
+#include <userver/http/predefined_header.hpp>
+
+#include <utils/impl/byte_utils.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace http::headers::header_map {
+
+namespace {
+
+constexpr std::uint64_t kMul = (0xc6a4a793UL << 32UL) + 0x5bd1e995UL;
+constexpr std::uint64_t kLowercaseMask = 0x2020202020202020UL;
+
+inline std::uint64_t ShiftMix(std::uint64_t v) noexcept { return v ^ (v >> 47); }
+
+inline std::uint64_t LoadWord(const char* data) noexcept {
+    std::uint64_t result{};
+    std::memcpy(&result, data, sizeof(result));
+    return result | kLowercaseMask;
+}
+
+// Loads the last 1..7 bytes of the key in the same way
+// impl::UnsafeConstexprHasher does.
+inline std::uint64_t LoadTail(std::string_view full, std::size_t tail_size) noexcept {
+    const auto shift = 8 * (8 - tail_size);
+    if (full.size() >= 8) {
+        // Overlapping load of the last 8 bytes, the bytes that were already
+        // hashed are shifted out.
+        return LoadWord(full.data() + full.size() - 8) >> shift;
+    }
+
+    std::uint64_t result{};
+    std::memcpy(&result, full.data() + full.size() - tail_size, tail_size);
+    return result | (kLowercaseMask >> shift);
+}
+
+struct KnownHeaderSlot final {
+    std::string_view name;
+    Traits::HeaderIndex header_index{impl::kNoHeaderIndexInsertion};
+};
+
+// Open addressing with linear probing over the compile-time hashes of the
+// known headers, replaces a linear chain of case-insensitive comparisons.
+constexpr std::size_t kKnownHeadersTableSize = 128;
+constexpr std::size_t kKnownHeadersTableMask = kKnownHeadersTableSize - 1;
+static_assert(impl::kKnownHeadersLowercaseMap.size() * 2 < kKnownHeadersTableSize);
+static_assert(kKnownHeadersTableSize <= Traits::kMaxSize, "HeaderMap masked hash must be usable for the lookup");
+
+constexpr auto kKnownHeadersTable = [] {
+    std::array<KnownHeaderSlot, kKnownHeadersTableSize> table{};
+    for (const auto& [name, header_index] : impl::kKnownHeadersLowercaseMap) {
+        auto pos = impl::UnsafeConstexprHasher{}(name) & kKnownHeadersTableMask;
+        while (table[pos].header_index != impl::kNoHeaderIndexInsertion) {
+            pos = (pos + 1) & kKnownHeadersTableMask;
+        }
+        table[pos] = KnownHeaderSlot{name, header_index};
+    }
+    return table;
+}();
+
+}  // namespace
+
+std::size_t UnsafeRuntimeHash(std::string_view key) noexcept {
+    // Keep in sync with impl::UnsafeConstexprHasher
+    constexpr std::uint64_t kSeed = 54999;
+
+    std::uint64_t hash = kSeed ^ (key.size() * kMul);
+    const char* data = key.data();
+    const char* const words_end = data + (key.size() & ~std::size_t{7});
+    for (; data != words_end; data += 8) {
+        hash ^= ShiftMix(LoadWord(data) * kMul) * kMul;
+        hash *= kMul;
+    }
+
+    const auto tail_size = key.size() & 7;
+    if (tail_size != 0) {
+        hash ^= LoadTail(key, tail_size);
+        hash *= kMul;
+    }
+
+    hash = ShiftMix(hash) * kMul;
+    hash = ShiftMix(hash);
+    return hash;
+}
+
+Traits::HeaderIndex GetKnownHeaderIndex(std::string_view key, std::size_t unsafe_hash) noexcept {
+    for (auto pos = unsafe_hash & kKnownHeadersTableMask;; pos = (pos + 1) & kKnownHeadersTableMask) {
+        const auto& slot = kKnownHeadersTable[pos];
+        if (slot.header_index == impl::kNoHeaderIndexInsertion) {
+            return impl::kNoHeaderIndexInsertion;
+        }
+        if (slot.name.size() == key.size() && utils::impl::CaseInsensitiveEqual{}(slot.name, key)) {
+            return slot.header_index;
+        }
+    }
+}
+
+Traits::HeaderIndex GetKnownHeaderIndex(std::string_view key) noexcept {
+    return GetKnownHeaderIndex(key, UnsafeRuntimeHash(key));
+}
+
+}  // namespace http::headers::header_map
+
+USERVER_NAMESPACE_END
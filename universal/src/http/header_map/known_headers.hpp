@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+
+#include <http/header_map/traits.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace http::headers::header_map {
+
+/// Runtime version of impl::UnsafeConstexprHasher: produces bit-identical
+/// results, but loads the data a machine word at a time.
+std::size_t UnsafeRuntimeHash(std::string_view key) noexcept;
+
+/// Returns the index of a known header (see impl::kKnownHeadersLowercaseMap)
+/// or impl::kNoHeaderIndexInsertion. `unsafe_hash` is the result of
+/// UnsafeRuntimeHash for the `key`, only its low bits are used, so a value
+/// masked by the HeaderMap is fine.
+Traits::HeaderIndex GetKnownHeaderIndex(std::string_view key, std::size_t unsafe_hash) noexcept;
+
+/// Same as above, but computes the hash itself.
+Traits::HeaderIndex GetKnownHeaderIndex(std::string_view key) noexcept;
+
+}  // namespace http::headers::header_map
+
+USERVER_NAMESPACE_END
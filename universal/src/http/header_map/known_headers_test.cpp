@@ -0,0 +1,54 @@
+#include <http/header_map/known_headers.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <userver/http/predefined_header.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace http::headers::header_map {
+
+namespace {
+
+std::string ToUpper(std::string_view str) {
+    std::string result{str};
+    std::transform(result.begin(), result.end(), result.begin(), [](unsigned char c) { return std::toupper(c); });
+    return result;
+}
+
+}  // namespace
+
+TEST(HeaderMapKnownHeaders, RuntimeHashMatchesConstexpr) {
+    std::string key;
+    for (std::size_t size = 0; size <= 40; ++size) {
+        EXPECT_EQ(UnsafeRuntimeHash(key), impl::UnsafeConstexprHasher{}(key)) << "size=" << size;
+        key.push_back(static_cast<char>('A' + size % 26));
+    }
+
+    for (const auto& [name, header_index] : impl::kKnownHeadersLowercaseMap) {
+        EXPECT_EQ(UnsafeRuntimeHash(name), impl::UnsafeConstexprHasher{}(name)) << name;
+        const auto upper = ToUpper(name);
+        EXPECT_EQ(UnsafeRuntimeHash(upper), UnsafeRuntimeHash(name)) << upper;
+    }
+}
+
+TEST(HeaderMapKnownHeaders, IndexMatchesTrivialMap) {
+    for (const auto& [name, header_index] : impl::kKnownHeadersLowercaseMap) {
+        EXPECT_EQ(GetKnownHeaderIndex(name), header_index) << name;
+        EXPECT_EQ(GetKnownHeaderIndex(ToUpper(name)), header_index) << name;
+        EXPECT_EQ(GetKnownHeaderIndex(name, impl::UnsafeConstexprHasher{}(name) & 0xff), header_index) << name;
+    }
+
+    for (const std::string_view unknown : {"", "x", "content-typ", "content-type2", "x-unknown-header", "[ost"}) {
+        EXPECT_EQ(GetKnownHeaderIndex(unknown), impl::kNoHeaderIndexInsertion) << unknown;
+        EXPECT_EQ(GetKnownHeaderIndex(unknown), impl::GetHeaderIndexForInsertion(unknown)) << unknown;
+    }
+}
+
+}  // namespace http::headers::header_map
+
+USERVER_NAMESPACE_END
@@ -1,4 +1,6 @@
 #include <http/header_map/map.hpp>
+
+#include <http/header_map/known_headers.hpp>
 #include <userver/utils/small_string.hpp>
 
 // Inspired by
@@ -328,14 +330,10 @@ Traits::HashValue Map::HashKey(const PredefinedHeader& header) const noexcept {
     return MaskHash(danger_.HashKey(header));
 }
 
-Traits::HeaderIndex Map::InsertEntry(std::string&& key, std::string&& value) {
-    // we could potentially restructure the code a bit, so instead of hashing
-    // and then at some point looking for index here,
-    // we look for index first, and if it's found - that means we already know the
-    // hash (the header name is known upfront, thus the hash is known as well).
-    // Clobbers interface/implementation a bit, and
-    // we're not sure if its worth it, since default hash is decently fast anyway.
-    const auto header_index = impl::GetHeaderIndexForInsertion(key);
+Traits::HeaderIndex Map::InsertEntry(std::string&& key, std::string&& value, Traits::HashValue hash) {
+    // While not in red state the hash is the unsafe one, and the known headers
+    // table is keyed by its low bits, so no rehashing is needed.
+    const auto header_index = danger_.IsRed() ? GetKnownHeaderIndex(key) : GetKnownHeaderIndex(key, hash);
 
     entries_.emplace_back(std::move(key), std::move(value));
 
@@ -454,7 +452,7 @@ Map::Iterator Map::DoInsertOrModify(
     const auto perform_robinhood =
         [this, hash](std::size_t dist, std::size_t positions_idx, std::string&& key, std::string&& value) {
             const auto entries_index = entries_.size();
-            const auto header_index = InsertEntry(std::move(key), std::move(value));
+            const auto header_index = InsertEntry(std::move(key), std::move(value), hash);
 
             const auto num_displaced = DoRobinhoodAtPosition(positions_idx, Pos{entries_index, hash, header_index});
 
@@ -466,7 +464,7 @@ Map::Iterator Map::DoInsertOrModify(
     const auto perform_vacant =
         [this, hash](std::size_t dist, std::size_t positions_idx, std::string&& key, std::string&& value) {
             const auto index = entries_.size();
-            const auto header_index = InsertEntry(std::move(key), std::move(value));
+            const auto header_index = InsertEntry(std::move(key), std::move(value), hash);
             positions_[positions_idx] = Pos{index, hash, header_index};
 
             if (dist >= kForwardShiftThreshold) {
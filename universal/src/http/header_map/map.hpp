@@ -113,7 +113,7 @@ private:
     Traits::HashValue HashKey(std::string_view key) const noexcept;
     Traits::HashValue HashKey(const PredefinedHeader& header) const noexcept;
 
-    Traits::HeaderIndex InsertEntry(std::string&& key, std::string&& value);
+    Traits::HeaderIndex InsertEntry(std::string&& key, std::string&& value, Traits::HashValue hash);
     std::size_t DoRobinhoodAtPosition(std::size_t idx, Pos old_pos);
 
     struct FindResult final {
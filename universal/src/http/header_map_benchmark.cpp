@@ -155,4 +155,34 @@ void HeaderMapEraseBenchmark(benchmark::State& state) {
 }
 BENCHMARK(HeaderMapEraseBenchmark);
 
+// Header names as they come from a typical request parser: runtime strings in
+// arbitrary case, most of them are known headers.
+void HeaderMapTypicalRequestInsertBenchmark(benchmark::State& state) {
+    const std::vector<std::string> headers{
+        "Host",
+        "User-Agent",
+        "Accept",
+        "Accept-Encoding",
+        "Accept-Language",
+        "Connection",
+        "Content-Type",
+        "Content-Length",
+        "Cookie",
+        "X-YaRequestId",
+        "X-YaTraceId",
+        "X-YaSpanId",
+        "X-Custom-Application-Header",
+        "X-Forwarded-For",
+    };
+
+    for ([[maybe_unused]] auto _ : state) {
+        http::headers::HeaderMap map{};
+        for (const auto& h : headers) {
+            map.emplace(h, "1");
+        }
+        benchmark::DoNotOptimize(map);
+    }
+}
+BENCHMARK(HeaderMapTypicalRequestInsertBenchmark);
+
 USERVER_NAMESPACE_END
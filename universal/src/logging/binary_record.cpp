@@ -0,0 +1,290 @@
+#include <logging/binary_record.hpp>
+
+#include <iterator>
+#include <stdexcept>
+
+#include <fmt/chrono.h>
+#include <fmt/compile.h>
+#include <fmt/format.h>
+
+#include <userver/formats/json/string_builder.hpp>
+#include <userver/utils/encoding/tskv.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace logging::impl::binary {
+
+namespace {
+
+using TimePoint = std::chrono::system_clock::time_point;
+
+class Reader final {
+public:
+    explicit Reader(std::string_view data) noexcept : data_(data) {}
+
+    bool IsEmpty() const noexcept { return data_.empty(); }
+
+    template <typename T>
+    T Read() {
+        static_assert(std::is_trivially_copyable_v<T>);
+        if (data_.size() < sizeof(T)) throw std::runtime_error("Truncated binary log record");
+        T value;
+        std::memcpy(&value, data_.data(), sizeof(T));
+        data_.remove_prefix(sizeof(T));
+        return value;
+    }
+
+    std::string_view ReadString() {
+        const auto size = Read<std::uint32_t>();
+        if (data_.size() < size) throw std::runtime_error("Truncated binary log record");
+        const auto result = data_.substr(0, size);
+        data_.remove_prefix(size);
+        return result;
+    }
+
+private:
+    std::string_view data_;
+};
+
+struct Header final {
+    RecordKind kind{};
+    Level level{};
+    TimePoint time{};
+};
+
+Header ReadHeader(Reader& reader) {
+    if (reader.Read<char>() != kRecordMagic) throw std::runtime_error("Not a binary log record");
+    reader.Read<std::uint32_t>();
+
+    Header header;
+    header.kind = static_cast<RecordKind>(reader.Read<std::uint8_t>());
+    const auto level = reader.Read<std::uint8_t>();
+    if (level > static_cast<std::uint8_t>(Level::kNone)) throw std::runtime_error("Invalid level of binary log record");
+    header.level = static_cast<Level>(level);
+    header.time = TimePoint{std::chrono::duration_cast<TimePoint::duration>(
+        std::chrono::microseconds{reader.Read<std::int64_t>()}
+    )};
+    return header;
+}
+
+// Calls the handler for each key and each part of the values:
+//   handler.Key(key, needs_escaping)
+//   handler.Text(value_part)    -- a part that is not escaped yet
+//   handler.RawText(value_part) -- a part that needs no escaping
+template <typename Handler>
+void VisitFields(Reader& reader, Handler& handler) {
+    fmt::memory_buffer buffer;
+    const auto format_raw = [&](auto&&... args) {
+        buffer.clear();
+        fmt::format_to(fmt::appender(buffer), std::forward<decltype(args)>(args)...);
+        handler.RawText(std::string_view{buffer.data(), buffer.size()});
+    };
+
+    while (!reader.IsEmpty()) {
+        switch (static_cast<FieldType>(reader.Read<std::uint8_t>())) {
+            case FieldType::kKey:
+                handler.Key(reader.ReadString(), true);
+                break;
+            case FieldType::kRawKey:
+                handler.Key(reader.ReadString(), false);
+                break;
+            case FieldType::kText:
+                handler.Text(reader.ReadString());
+                break;
+            case FieldType::kRawText:
+                handler.RawText(reader.ReadString());
+                break;
+            case FieldType::kSigned:
+                format_raw(FMT_COMPILE("{}"), reader.Read<std::int64_t>());
+                break;
+            case FieldType::kUnsigned:
+                format_raw(FMT_COMPILE("{}"), reader.Read<std::uint64_t>());
+                break;
+            case FieldType::kFloat:
+                format_raw(FMT_COMPILE("{}"), reader.Read<float>());
+                break;
+            case FieldType::kDouble:
+                format_raw(FMT_COMPILE("{}"), reader.Read<double>());
+                break;
+            case FieldType::kLongDouble:
+                format_raw(FMT_COMPILE("{}"), reader.Read<long double>());
+                break;
+            case FieldType::kBool:
+                format_raw(FMT_COMPILE("{}"), reader.Read<std::uint8_t>() != 0);
+                break;
+            case FieldType::kHex:
+                format_raw(FMT_COMPILE("0x{:016X}"), reader.Read<std::uint64_t>());
+                break;
+            case FieldType::kHexShort:
+                format_raw(FMT_COMPILE("{:X}"), reader.Read<std::uint64_t>());
+                break;
+            case FieldType::kLocation: {
+                const auto line = reader.Read<std::uint32_t>();
+                const auto function_name = reader.ReadString();
+                const auto file_name = reader.ReadString();
+                format_raw(FMT_COMPILE("{} ( {}:{} ) "), function_name, file_name, line);
+                break;
+            }
+            default:
+                throw std::runtime_error("Unknown field type in binary log record");
+        }
+    }
+}
+
+void AppendTime(std::string& out, TimePoint time) {
+    const auto seconds = std::chrono::time_point_cast<std::chrono::seconds>(time);
+    const auto microseconds = std::chrono::duration_cast<std::chrono::microseconds>(time - seconds).count();
+    fmt::format_to(
+        std::back_inserter(out),
+        FMT_COMPILE("{:%FT%T}.{:06}"),
+        fmt::localtime(std::chrono::system_clock::to_time_t(time)),
+        microseconds
+    );
+}
+
+class TextHandler final {
+public:
+    TextHandler(std::string& out, char key_value_separator) : out_(out), key_value_separator_(key_value_separator) {}
+
+    void Key(std::string_view key, bool may_need_escaping) {
+        out_.push_back(utils::encoding::kTskvPairsSeparator);
+        if (may_need_escaping && utils::encoding::ShouldKeyBeEscaped(key)) {
+            utils::encoding::EncodeTskv(out_, key, utils::encoding::EncodeTskvMode::kKeyReplacePeriod);
+        } else {
+            out_.append(key);
+        }
+        out_.push_back(key_value_separator_);
+    }
+
+    void Text(std::string_view value) {
+        utils::encoding::EncodeTskv(out_, value, utils::encoding::EncodeTskvMode::kValue);
+    }
+
+    void RawText(std::string_view value) { out_.append(value); }
+
+private:
+    std::string& out_;
+    const char key_value_separator_;
+};
+
+class JsonHandler final {
+public:
+    explicit JsonHandler(formats::json::StringBuilder& builder) : builder_(builder) {}
+
+    void Key(std::string_view key, bool /*may_need_escaping*/) {
+        Flush();
+        key_ = key;
+        has_key_ = true;
+    }
+
+    void Text(std::string_view value) { value_.append(value); }
+
+    void RawText(std::string_view value) { value_.append(value); }
+
+    void Flush() {
+        if (!has_key_) return;
+        builder_.Key(key_);
+        builder_.WriteString(value_);
+        value_.clear();
+        has_key_ = false;
+    }
+
+private:
+    formats::json::StringBuilder& builder_;
+    std::string key_;
+    std::string value_;
+    bool has_key_{false};
+};
+
+}  // namespace
+
+void AppendTextRecord(std::string& buffer, Level level, std::string_view text) {
+    const auto record_begin = buffer.size();
+    AppendHeader(buffer, RecordKind::kText, level, std::chrono::system_clock::now());
+    buffer.append(text);
+    FinishRecord(buffer, record_begin);
+}
+
+bool IsRecord(std::string_view data) noexcept { return data.size() >= kHeaderSize && data[0] == kRecordMagic; }
+
+std::size_t GetRecordSize(std::string_view data) {
+    if (data.size() < kSizeOffset + sizeof(std::uint32_t)) return 0;
+    if (data[0] != kRecordMagic) throw std::runtime_error("Not a binary log record");
+
+    std::uint32_t size{};
+    std::memcpy(&size, data.data() + kSizeOffset, sizeof(size));
+    if (size < kHeaderSize) throw std::runtime_error("Invalid size of binary log record");
+    return size;
+}
+
+void FormatRecord(std::string_view record, Format format, std::string& out) {
+    Reader reader{record};
+    const auto header = ReadHeader(reader);
+    if (header.kind == RecordKind::kText) {
+        out.append(record.substr(kHeaderSize));
+        return;
+    }
+    if (header.kind != RecordKind::kMessage) throw std::runtime_error("Unknown kind of binary log record");
+
+    const auto level_string = ToUpperCaseString(header.level);
+    char key_value_separator = '=';
+    switch (format) {
+        case Format::kTskv:
+            out.append("tskv\ttimestamp=");
+            AppendTime(out, header.time);
+            out.append("\tlevel=");
+            out.append(level_string);
+            break;
+        case Format::kLtsv:
+            key_value_separator = ':';
+            out.append("timestamp:");
+            AppendTime(out, header.time);
+            out.append("\tlevel:");
+            out.append(level_string);
+            break;
+        case Format::kRaw:
+            out.append("tskv");
+            break;
+        case Format::kBinary:
+            throw std::logic_error("Binary log records can only be formatted as text");
+    }
+
+    TextHandler handler{out, key_value_separator};
+    VisitFields(reader, handler);
+    out.push_back('\n');
+}
+
+void FormatRecordAsJson(std::string_view record, std::string& out) {
+    Reader reader{record};
+    const auto header = ReadHeader(reader);
+
+    formats::json::StringBuilder builder;
+    {
+        const formats::json::StringBuilder::ObjectGuard guard{builder};
+        if (header.kind == RecordKind::kText) {
+            auto text = record.substr(kHeaderSize);
+            if (!text.empty() && text.back() == '\n') text.remove_suffix(1);
+            builder.Key("raw");
+            builder.WriteString(text);
+        } else if (header.kind == RecordKind::kMessage) {
+            std::string timestamp;
+            AppendTime(timestamp, header.time);
+            builder.Key("timestamp");
+            builder.WriteString(timestamp);
+            builder.Key("level");
+            builder.WriteString(ToUpperCaseString(header.level));
+
+            JsonHandler handler{builder};
+            VisitFields(reader, handler);
+            handler.Flush();
+        } else {
+            throw std::runtime_error("Unknown kind of binary log record");
+        }
+    }
+    out.append(builder.GetStringView());
+    out.push_back('\n');
+}
+
+}  // namespace logging::impl::binary
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,118 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include <userver/logging/format.hpp>
+#include <userver/logging/level.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace logging::impl::binary {
+
+// Records of Format::kBinary keep the log values as they were passed to
+// LogHelper, so that the hot path does no formatting or escaping. The records
+// are converted to text by the logger consumer or offline, see
+// tools/log_decoder.
+//
+// All the integers are in the host byte order.
+//
+// record := header, body
+// header := u8 kRecordMagic, u32 record size, u8 RecordKind, u8 level,
+//           i64 microseconds since epoch
+// body of RecordKind::kMessage := field*
+// body of RecordKind::kText := a ready text record in any text format
+// field := u8 FieldType, field data
+
+inline constexpr char kRecordMagic = '\x1e';
+
+enum class RecordKind : std::uint8_t {
+    kMessage = 1,
+    kText = 2,
+};
+
+enum class FieldType : std::uint8_t {
+    kKey = 1,     // u32 size, key that is escaped on formatting if needed
+    kRawKey,      // u32 size, key that needs no escaping
+    kText,        // u32 size, value part that is escaped on formatting
+    kRawText,     // u32 size, value part that needs no escaping
+    kSigned,      // i64
+    kUnsigned,    // u64
+    kFloat,       // float
+    kDouble,      // double
+    kLongDouble,  // long double
+    kBool,        // u8
+    kHex,         // u64, formatted as 0x{:016X}
+    kHexShort,    // u64, formatted as {:X}
+    kLocation,    // u32 line, u32 size, function name, u32 size, file name
+};
+
+inline constexpr std::size_t kHeaderSize = 1 + sizeof(std::uint32_t) + 1 + 1 + sizeof(std::int64_t);
+inline constexpr std::size_t kSizeOffset = 1;
+
+template <typename Buffer, typename T>
+void Append(Buffer& buffer, const T& value) {
+    static_assert(std::is_trivially_copyable_v<T>);
+    const auto old_size = buffer.size();
+    buffer.resize(old_size + sizeof(T));
+    std::memcpy(buffer.data() + old_size, &value, sizeof(T));
+}
+
+template <typename Buffer>
+void AppendString(Buffer& buffer, std::string_view value) {
+    Append(buffer, static_cast<std::uint32_t>(value.size()));
+    buffer.append(value.data(), value.data() + value.size());
+}
+
+template <typename Buffer>
+void AppendHeader(Buffer& buffer, RecordKind kind, Level level, std::chrono::system_clock::time_point time) {
+    buffer.push_back(kRecordMagic);
+    Append(buffer, std::uint32_t{0});  // patched by FinishRecord
+    buffer.push_back(static_cast<char>(kind));
+    buffer.push_back(static_cast<char>(level));
+    Append(
+        buffer,
+        static_cast<std::int64_t>(
+            std::chrono::duration_cast<std::chrono::microseconds>(time.time_since_epoch()).count()
+        )
+    );
+}
+
+/// Patches the size of a record that starts at `record_begin` offset and ends
+/// at the end of the buffer.
+template <typename Buffer>
+void FinishRecord(Buffer& buffer, std::size_t record_begin) {
+    const auto size = static_cast<std::uint32_t>(buffer.size() - record_begin);
+    std::memcpy(buffer.data() + record_begin + kSizeOffset, &size, sizeof(size));
+}
+
+/// Wraps a text record into a binary one, so that it could be written to
+/// a binary log stream.
+void AppendTextRecord(std::string& buffer, Level level, std::string_view text);
+
+/// @returns true if the data starts with a binary record header.
+bool IsRecord(std::string_view data) noexcept;
+
+/// @returns the size of the record at the beginning of `data`, or 0 if the
+/// header is not complete yet.
+/// @throws std::runtime_error if the data does not start with a record.
+std::size_t GetRecordSize(std::string_view data);
+
+/// Appends a binary record, converted to a text record of the given format.
+/// Records of RecordKind::kText are appended as is.
+/// @throws std::runtime_error if the record is malformed.
+void FormatRecord(std::string_view record, Format format, std::string& out);
+
+/// Appends a binary record, converted to a single-line JSON object with
+/// "timestamp", "level" and the tag keys. Only the text parts of the values are
+/// unescaped, the parts that were put raw remain TSKV-escaped.
+/// @throws std::runtime_error if the record is malformed.
+void FormatRecordAsJson(std::string_view record, std::string& out);
+
+}  // namespace logging::impl::binary
+
+USERVER_NAMESPACE_END
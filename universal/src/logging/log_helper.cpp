@@ -116,6 +116,11 @@ struct LogHelper::Module final {
     const utils::impl::SourceLocation& location;
 
     void LogTo(LogHelper& lh) {
+        if (lh.pimpl_->IsBinary()) {
+            lh.pimpl_->PutLocation(location);
+            return;
+        }
+
         static constexpr std::string_view kDelimiter1 = " ( ";
         static constexpr std::string_view kDelimiter2 = ":";
         static constexpr std::string_view kDelimiter3 = " ) ";
@@ -322,27 +327,55 @@ LogHelper& LogHelper::operator<<(const LogExtra::Value& value) noexcept {
 }
 
 void LogHelper::PutFloatingPoint(float value) {
+    if (pimpl_->IsBinary()) {
+        pimpl_->PutBinaryValuePart(impl::binary::FieldType::kFloat, value);
+        return;
+    }
     fmt::format_to(fmt::appender(pimpl_->GetBufferForRawValuePart()), FMT_COMPILE("{}"), value);
 }
 void LogHelper::PutFloatingPoint(double value) {
+    if (pimpl_->IsBinary()) {
+        pimpl_->PutBinaryValuePart(impl::binary::FieldType::kDouble, value);
+        return;
+    }
     fmt::format_to(fmt::appender(pimpl_->GetBufferForRawValuePart()), FMT_COMPILE("{}"), value);
 }
 void LogHelper::PutFloatingPoint(long double value) {
+    if (pimpl_->IsBinary()) {
+        pimpl_->PutBinaryValuePart(impl::binary::FieldType::kLongDouble, value);
+        return;
+    }
     fmt::format_to(fmt::appender(pimpl_->GetBufferForRawValuePart()), FMT_COMPILE("{}"), value);
 }
 void LogHelper::PutUnsigned(unsigned long long value) {
+    if (pimpl_->IsBinary()) {
+        pimpl_->PutBinaryValuePart(impl::binary::FieldType::kUnsigned, static_cast<std::uint64_t>(value));
+        return;
+    }
     fmt::format_to(fmt::appender(pimpl_->GetBufferForRawValuePart()), FMT_COMPILE("{}"), value);
 }
 void LogHelper::PutSigned(long long value) {
+    if (pimpl_->IsBinary()) {
+        pimpl_->PutBinaryValuePart(impl::binary::FieldType::kSigned, static_cast<std::int64_t>(value));
+        return;
+    }
     fmt::format_to(fmt::appender(pimpl_->GetBufferForRawValuePart()), FMT_COMPILE("{}"), value);
 }
 void LogHelper::PutBoolean(bool value) {
+    if (pimpl_->IsBinary()) {
+        pimpl_->PutBinaryValuePart(impl::binary::FieldType::kBool, static_cast<std::uint8_t>(value));
+        return;
+    }
     fmt::format_to(fmt::appender(pimpl_->GetBufferForRawValuePart()), FMT_COMPILE("{}"), value);
 }
 
 LogHelper& LogHelper::operator<<(Hex hex) noexcept {
     try {
-        fmt::format_to(fmt::appender(pimpl_->GetBufferForRawValuePart()), FMT_COMPILE("0x{:016X}"), hex.value);
+        if (pimpl_->IsBinary()) {
+            pimpl_->PutBinaryValuePart(impl::binary::FieldType::kHex, static_cast<std::uint64_t>(hex.value));
+        } else {
+            fmt::format_to(fmt::appender(pimpl_->GetBufferForRawValuePart()), FMT_COMPILE("0x{:016X}"), hex.value);
+        }
     } catch (...) {
         InternalLoggingError("Failed to extend log Hex");
     }
@@ -351,7 +384,11 @@ LogHelper& LogHelper::operator<<(Hex hex) noexcept {
 
 LogHelper& LogHelper::operator<<(HexShort hex) noexcept {
     try {
-        fmt::format_to(fmt::appender(pimpl_->GetBufferForRawValuePart()), FMT_COMPILE("{:X}"), hex.value);
+        if (pimpl_->IsBinary()) {
+            pimpl_->PutBinaryValuePart(impl::binary::FieldType::kHexShort, static_cast<std::uint64_t>(hex.value));
+        } else {
+            fmt::format_to(fmt::appender(pimpl_->GetBufferForRawValuePart()), FMT_COMPILE("{:X}"), hex.value);
+        }
     } catch (...) {
         InternalLoggingError("Failed to extend log HexShort");
     }
@@ -1,6 +1,7 @@
 #include "log_helper_impl.hpp"
 
 #include <array>
+#include <cstring>
 
 #include <fmt/chrono.h>
 #include <fmt/compile.h>
@@ -22,6 +23,7 @@ char GetSeparatorFromLogger(LoggerRef logger) {
     switch (logger.GetFormat()) {
         case Format::kTskv:
         case Format::kRaw:
+        case Format::kBinary:
             return '=';
         case Format::kLtsv:
             return ':';
@@ -81,7 +83,8 @@ std::streamsize LogHelper::Impl::BufferStd::xsputn(const char_type* s, std::stre
 LogHelper::Impl::Impl(LoggerRef logger, Level level) noexcept
     : logger_(&logger),
       level_(std::max(level, logger_->GetLevel())),
-      key_value_separator_(GetSeparatorFromLogger(*logger_)) {
+      key_value_separator_(GetSeparatorFromLogger(*logger_)),
+      is_binary_(logger_->GetFormat() == Format::kBinary) {
     static_assert(
         sizeof(LogHelper::Impl) < 4096,
         "Structures with size more than 4096 would consume at least "
@@ -128,14 +131,31 @@ void LogHelper::Impl::PutMessageBegin() {
             msg_.append(std::string_view{"tskv"});
             return;
         }
+        case Format::kBinary: {
+            impl::binary::AppendHeader(msg_, impl::binary::RecordKind::kMessage, level_, TimePoint::clock::now());
+            return;
+        }
     }
     UASSERT_MSG(false, "Invalid value of Format enum");
 }
 
-void LogHelper::Impl::PutMessageEnd() { msg_.push_back('\n'); }
+void LogHelper::Impl::PutMessageEnd() {
+    if (is_binary_) {
+        CloseBinaryPart();
+        impl::binary::FinishRecord(msg_, 0);
+        return;
+    }
+    msg_.push_back('\n');
+}
 
 void LogHelper::Impl::PutKey(std::string_view key) {
-    if (!utils::encoding::ShouldKeyBeEscaped(key)) {
+    if (is_binary_) {
+        UASSERT(!std::exchange(is_within_value_, true));
+        CheckRepeatedKeys(key);
+        CloseBinaryPart();
+        msg_.push_back(static_cast<char>(impl::binary::FieldType::kKey));
+        impl::binary::AppendString(msg_, key);
+    } else if (!utils::encoding::ShouldKeyBeEscaped(key)) {
         PutRawKey(key);
     } else {
         UASSERT(!std::exchange(is_within_value_, true));
@@ -149,6 +169,13 @@ void LogHelper::Impl::PutKey(std::string_view key) {
 void LogHelper::Impl::PutRawKey(std::string_view key) {
     UASSERT(!std::exchange(is_within_value_, true));
     CheckRepeatedKeys(key);
+    if (is_binary_) {
+        CloseBinaryPart();
+        msg_.push_back(static_cast<char>(impl::binary::FieldType::kRawKey));
+        impl::binary::AppendString(msg_, key);
+        return;
+    }
+
     const auto old_size = msg_.size();
     msg_.resize(old_size + 1 + key.size() + 1);
 
@@ -161,20 +188,43 @@ void LogHelper::Impl::PutRawKey(std::string_view key) {
 
 void LogHelper::Impl::PutValuePart(std::string_view value) {
     UASSERT(is_within_value_);
+    if (is_binary_) {
+        OpenBinaryPart(impl::binary::FieldType::kText).append(value);
+        return;
+    }
     utils::encoding::EncodeTskv(msg_, value, utils::encoding::EncodeTskvMode::kValue);
 }
 
 void LogHelper::Impl::PutValuePart(char text_part) {
     UASSERT(is_within_value_);
+    if (is_binary_) {
+        OpenBinaryPart(impl::binary::FieldType::kText).push_back(text_part);
+        return;
+    }
     utils::encoding::EncodeTskv(fmt::appender(msg_), text_part, utils::encoding::EncodeTskvMode::kValue);
 }
 
-LogBuffer& LogHelper::Impl::GetBufferForRawValuePart() noexcept {
+LogBuffer& LogHelper::Impl::GetBufferForRawValuePart() {
     UASSERT(is_within_value_);
+    if (is_binary_) {
+        return OpenBinaryPart(impl::binary::FieldType::kRawText);
+    }
     return msg_;
 }
 
-void LogHelper::Impl::MarkValueEnd() noexcept { UASSERT(std::exchange(is_within_value_, false)); }
+void LogHelper::Impl::PutLocation(const utils::impl::SourceLocation& location) {
+    UASSERT(is_within_value_ && is_binary_);
+    CloseBinaryPart();
+    msg_.push_back(static_cast<char>(impl::binary::FieldType::kLocation));
+    impl::binary::Append(msg_, static_cast<std::uint32_t>(location.GetLine()));
+    impl::binary::AppendString(msg_, location.GetFunctionName());
+    impl::binary::AppendString(msg_, location.GetFileName());
+}
+
+void LogHelper::Impl::MarkValueEnd() noexcept {
+    UASSERT(std::exchange(is_within_value_, false));
+    CloseBinaryPart();
+}
 
 void LogHelper::Impl::MarkAsTrace() noexcept { is_trace_ = true; }
 
@@ -214,6 +264,24 @@ void LogHelper::Impl::CheckRepeatedKeys([[maybe_unused]] std::string_view raw_ke
     );
 }
 
+LogBuffer& LogHelper::Impl::OpenBinaryPart(impl::binary::FieldType type) {
+    if (open_part_size_offset_ == 0 || open_part_type_ != type) {
+        CloseBinaryPart();
+        msg_.push_back(static_cast<char>(type));
+        open_part_size_offset_ = msg_.size();
+        open_part_type_ = type;
+        impl::binary::Append(msg_, std::uint32_t{0});
+    }
+    return msg_;
+}
+
+void LogHelper::Impl::CloseBinaryPart() noexcept {
+    if (open_part_size_offset_ == 0) return;
+    const auto size = static_cast<std::uint32_t>(msg_.size() - open_part_size_offset_ - sizeof(std::uint32_t));
+    std::memcpy(msg_.data() + open_part_size_offset_, &size, sizeof(size));
+    open_part_size_offset_ = 0;
+}
+
 }  // namespace logging
 
 USERVER_NAMESPACE_END
@@ -9,6 +9,10 @@
 #include <userver/logging/level.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/logging/log_extra.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/impl/source_location.hpp>
+
+#include <logging/binary_record.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -35,7 +39,21 @@ public:
 
     void PutValuePart(std::string_view value);
     void PutValuePart(char text_part);
-    LogBuffer& GetBufferForRawValuePart() noexcept;
+    LogBuffer& GetBufferForRawValuePart();
+
+    bool IsBinary() const noexcept { return is_binary_; }
+
+    // Format::kBinary only: puts an unformatted value part
+    template <typename T>
+    void PutBinaryValuePart(impl::binary::FieldType type, T value) {
+        UASSERT(is_within_value_ && is_binary_);
+        CloseBinaryPart();
+        msg_.push_back(static_cast<char>(type));
+        impl::binary::Append(msg_, value);
+    }
+
+    // Format::kBinary only
+    void PutLocation(const utils::impl::SourceLocation& location);
 
     bool IsWithinValue() const noexcept { return is_within_value_; }
     void MarkValueEnd() noexcept;
@@ -80,13 +98,22 @@ private:
 
     void CheckRepeatedKeys(std::string_view raw_key);
 
+    // Consecutive text parts of the same type are merged into a single field,
+    // whose size is patched on closing.
+    LogBuffer& OpenBinaryPart(impl::binary::FieldType type);
+    void CloseBinaryPart() noexcept;
+
     impl::LoggerBase* logger_;
     const Level level_;
     const char key_value_separator_;
+    const bool is_binary_;
     LogBuffer msg_;
     std::optional<LazyInitedStream> lazy_stream_;
     LogExtra extra_;
     std::size_t initial_length_{0};
+    // Offset of the size of the open binary part, 0 if there is none
+    std::size_t open_part_size_offset_{0};
+    impl::binary::FieldType open_part_type_{};
     bool is_within_value_{false};
     bool is_trace_{false};
     std::optional<std::unordered_set<std::string>> debug_tag_keys_;